@@ -32,18 +32,22 @@
 
 /**
  * @file
- * @brief -- Interface to an AES-128 implementation.
+ * @brief -- Interface to an AES-128/192/256 implementation.
  *
- *  Overview:   AES-128 is a NIST approved block cipher specified in
+ *  Overview:   AES is a NIST approved block cipher specified in
  *              FIPS 197. Block ciphers are deterministic algorithms that
  *              perform a transformation specified by a symmetric key in fixed-
  *              length data sets, also called blocks.
  *
- *  Security:   AES-128 provides approximately 128 bits of security.
+ *  Security:   AES-128, AES-192 and AES-256 provide approximately 128, 192
+ *              and 256 bits of security.
  *
- *  Usage:      1) call tc_aes128_set_encrypt/decrypt_key to set the key.
+ *  Usage:      1) call tc_aes128/192/256_set_encrypt/decrypt_key to set the
+ *              key.
  *
- *              2) call tc_aes_encrypt/decrypt to process the data.
+ *              2) call tc_aes_encrypt/decrypt to process the data. The key
+ *              schedule carries its number of rounds, so the same calls
+ *              (and every mode built on them) serve all three key sizes.
  */
 
 #ifndef __TC_AES_H__
@@ -56,13 +60,44 @@ extern "C" {
 #endif
 
 #define Nb (4)  /* number of columns (32-bit words) comprising the state */
-#define Nk (4)  /* number of 32-bit words comprising the key */
-#define Nr (10) /* number of rounds */
+#define Nk (4)  /* number of 32-bit words comprising an AES-128 key */
+#define Nr (10) /* number of rounds of AES-128 */
 #define TC_AES_BLOCK_SIZE (Nb*Nk)
 #define TC_AES_KEY_SIZE (Nb*Nk)
+#define TC_AES192_KEY_SIZE (24)
+#define TC_AES256_KEY_SIZE (32)
+#define TC_AES_MAX_ROUNDS (14) /* number of rounds of AES-256 */
+
+/*
+ * On 64-bit targets encryption is bitsliced: four blocks are processed side
+ * by side in eight 64-bit words and the S-box is computed as a boolean
+ * circuit, so that no table is indexed by key or data. Define
+ * TC_AES_BITSLICED to 0 to build the byte-wise S-box table implementation,
+ * which is smaller and cheaper on 8-, 16- and 32-bit cores.
+ */
+#ifndef TC_AES_BITSLICED
+#if defined(UINTPTR_MAX) && (UINTPTR_MAX > 0xffffffffu)
+#define TC_AES_BITSLICED 1
+#else
+#define TC_AES_BITSLICED 0
+#endif
+#endif
+
+/* number of blocks tc_aes_encrypt_blocks encrypts at the cost of one: */
+#if TC_AES_BITSLICED
+#define TC_AES_PARALLEL_BLOCKS (4)
+#else
+#define TC_AES_PARALLEL_BLOCKS (1)
+#endif
 
 typedef struct tc_aes_key_sched_struct {
-	uint32_t words[Nb*(Nr+1)];
+	uint32_t words[Nb*(TC_AES_MAX_ROUNDS+1)];
+	uint32_t rounds; /* number of rounds: 10, 12 or 14 */
+	uint32_t decrypt; /* 1 if set by a tc_aes*_set_decrypt_key, 0 otherwise */
+#if TC_AES_BITSLICED
+	/* the round keys in bitsliced order, two 64-bit words per round key: */
+	uint64_t bitsliced[2*(TC_AES_MAX_ROUNDS+1)];
+#endif
 } *TCAesKeySched_t;
 
 /**
@@ -70,22 +105,32 @@ typedef struct tc_aes_key_sched_struct {
  *  Uses key k to initialize s
  *  @return  returns TC_CRYPTO_SUCCESS (1)
  *           returns TC_CRYPTO_FAIL (0) if: s == NULL or k == NULL
- *  @note       This implementation skips the additional steps required for keys
- *              larger than 128 bits, and must not be used for AES-192 or
- *              AES-256 key schedule -- see FIPS 197 for details
  *  @param      s IN/OUT -- initialized struct tc_aes_key_sched_struct
- *  @param      k IN -- points to the AES key
+ *  @param      k IN -- points to the 16-byte AES key
  */
 int tc_aes128_set_encrypt_key(TCAesKeySched_t s, const uint_least8_t *k);
 
 /**
- *  @brief AES-128 Encryption procedure
+ *  @brief Set AES-192 encryption key
+ *  Same as tc_aes128_set_encrypt_key, for a TC_AES192_KEY_SIZE-byte key
+ */
+int tc_aes192_set_encrypt_key(TCAesKeySched_t s, const uint_least8_t *k);
+
+/**
+ *  @brief Set AES-256 encryption key
+ *  Same as tc_aes128_set_encrypt_key, for a TC_AES256_KEY_SIZE-byte key
+ */
+int tc_aes256_set_encrypt_key(TCAesKeySched_t s, const uint_least8_t *k);
+
+/**
+ *  @brief AES Encryption procedure
  *  Encrypts contents of in buffer into out buffer under key;
  *              schedule s
- *  @note Assumes s was initialized by aes_set_encrypt_key;
+ *  @note Assumes s was initialized by a tc_aes*_set_encrypt_key;
  *              out and in point to 16 byte buffers
  *  @return  returns TC_CRYPTO_SUCCESS (1)
  *           returns TC_CRYPTO_FAIL (0) if: out == NULL or in == NULL or s == NULL
+ *                or s is a decryption schedule
  *  @param out IN/OUT -- buffer to receive ciphertext block
  *  @param in IN -- a plaintext block to encrypt
  *  @param s IN -- initialized AES key schedule
@@ -93,28 +138,61 @@ int tc_aes128_set_encrypt_key(TCAesKeySched_t s, const uint_least8_t *k);
 int tc_aes_encrypt(uint_least8_t *out, const uint_least8_t *in, 
 		   const TCAesKeySched_t s);
 
+/**
+ *  @brief AES Encryption of consecutive blocks
+ *  Encrypts the num_blocks blocks of in buffer into out buffer under key
+ *              schedule s, each block independently (ECB)
+ *  @note Assumes s was initialized by a tc_aes*_set_encrypt_key; out and in
+ *              point to buffers of num_blocks * TC_AES_BLOCK_SIZE bytes, and
+ *              may be the same buffer. Modes which can prepare several input
+ *              blocks ahead (CTR, CCM encryption) should pass
+ *              TC_AES_PARALLEL_BLOCKS or more at a time: the bitsliced
+ *              implementation encrypts that many for the cost of one
+ *  @return  returns TC_CRYPTO_SUCCESS (1)
+ *           returns TC_CRYPTO_FAIL (0) if: out == NULL or in == NULL or
+ *                s == NULL or num_blocks == 0 or s is a decryption schedule
+ *  @param out IN/OUT -- buffer to receive the ciphertext blocks
+ *  @param in IN -- the plaintext blocks to encrypt
+ *  @param num_blocks IN -- number of blocks
+ *  @param s IN -- initialized AES key schedule
+ */
+int tc_aes_encrypt_blocks(uint_least8_t *out, const uint_least8_t *in,
+			  uint32_t num_blocks, const TCAesKeySched_t s);
+
 /**
  *  @brief Set the AES-128 decryption key
  *  Uses key k to initialize s
  *  @return returns TC_CRYPTO_SUCCESS (1)
  *          returns TC_CRYPTO_FAIL (0) if: s == NULL or k == NULL
- *  @note       This is the implementation of the straightforward inverse cipher
- *              using the cipher documented in FIPS-197 figure 12, not the
- *              equivalent inverse cipher presented in Figure 15
- *  @warning    This routine skips the additional steps required for keys larger
- *              than 128, and must not be used for AES-192 or AES-256 key
- *              schedule -- see FIPS 197 for details
+ *  @note       This is the implementation of the equivalent inverse cipher
+ *              presented in FIPS-197 figure 15: InvMixColumns is applied to
+ *              the round keys here, so that decryption rounds have the same
+ *              structure as encryption rounds. The schedule is therefore
+ *              different from the one of tc_aes128_set_encrypt_key
  *  @param s  IN/OUT -- initialized struct tc_aes_key_sched_struct
- *  @param k  IN -- points to the AES key
+ *  @param k  IN -- points to the 16-byte AES key
  */
 int tc_aes128_set_decrypt_key(TCAesKeySched_t s, const uint_least8_t *k);
 
 /**
- *  @brief AES-128 Encryption procedure
+ *  @brief Set the AES-192 decryption key
+ *  Same as tc_aes128_set_decrypt_key, for a TC_AES192_KEY_SIZE-byte key
+ */
+int tc_aes192_set_decrypt_key(TCAesKeySched_t s, const uint_least8_t *k);
+
+/**
+ *  @brief Set the AES-256 decryption key
+ *  Same as tc_aes128_set_decrypt_key, for a TC_AES256_KEY_SIZE-byte key
+ */
+int tc_aes256_set_decrypt_key(TCAesKeySched_t s, const uint_least8_t *k);
+
+/**
+ *  @brief AES Decryption procedure
  *  Decrypts in buffer into out buffer under key schedule s
  *  @return returns TC_CRYPTO_SUCCESS (1)
  *          returns TC_CRYPTO_FAIL (0) if: out is NULL or in is NULL or s is NULL
- *  @note   Assumes s was initialized by aes_set_encrypt_key
+ *                or s was not initialized by a tc_aes*_set_decrypt_key
+ *  @note   Assumes s was initialized by a tc_aes*_set_decrypt_key
  *          out and in point to 16 byte buffers
  *  @param out IN/OUT -- buffer to receive ciphertext block
  *  @param in IN -- a plaintext block to encrypt
@@ -77,19 +77,124 @@
 extern "C" {
 #endif
 
-/* Word size (4 bytes considering 32-bits architectures) */
+/*
+ * Word size: 4 bytes (32-bit limbs) or 8 bytes (64-bit limbs). 64-bit limbs
+ * need a 128-bit integer type for double words, so they are selected by
+ * default only where the compiler provides one. Define uECC_WORD_SIZE to 4 or
+ * 8 at build time to override the default.
+ */
+#ifndef uECC_WORD_SIZE
+#if defined(__SIZEOF_INT128__)
+#define uECC_WORD_SIZE 8
+#else
 #define uECC_WORD_SIZE 4
+#endif
+#endif
+
+#if (uECC_WORD_SIZE != 4) && (uECC_WORD_SIZE != 8)
+#error "Unsupported value for uECC_WORD_SIZE"
+#endif
 
 /* setting max number of calls to prng: */
 #ifndef uECC_RNG_MAX_TRIES
 #define uECC_RNG_MAX_TRIES 64
 #endif
 
+/*
+ * Multiplications by the generator of p-256 use a precomputed table of 512
+ * points (32 KB of read-only data) instead of the Montgomery ladder. Define
+ * uECC_FIXED_BASE_TABLE to 0 to save the space on constrained targets.
+ */
+#ifndef uECC_FIXED_BASE_TABLE
+#define uECC_FIXED_BASE_TABLE 1
+#endif
+
+/*
+ * Modular inversion runs in constant time: Bernstein-Yang safegcd on signed
+ * 62-bit limbs where the compiler provides a 128-bit integer type, Fermat's
+ * little theorem with Montgomery multiplication otherwise. Define
+ * uECC_SAFEGCD to 0 to force the latter.
+ */
+#ifndef uECC_SAFEGCD
+#if defined(__SIZEOF_INT128__)
+#define uECC_SAFEGCD 1
+#else
+#define uECC_SAFEGCD 0
+#endif
+#endif
+
+/*
+ * On x86-64 with GCC or Clang, 4-word multiplications and squarings (the
+ * p-256 field arithmetic) use MULX/ADCX/ADOX kernels when the CPU supports
+ * BMI2 and ADX, and batch verification runs eight signatures at a time on
+ * AVX-512 IFMA when the CPU and the OS support it; both are checked at run
+ * time. Define uECC_ASM_X86_64 to 0 to build the portable code only.
+ */
+#ifndef uECC_ASM_X86_64
+#if (uECC_WORD_SIZE == 8) && defined(__x86_64__) && defined(__GNUC__)
+#define uECC_ASM_X86_64 1
+#else
+#define uECC_ASM_X86_64 0
+#endif
+#endif
+
+#if uECC_ASM_X86_64 && (uECC_WORD_SIZE != 8)
+#error "uECC_ASM_X86_64 requires uECC_WORD_SIZE 8"
+#endif
+
+/* CPU features the field arithmetic can use (see uECC_set_cpu_features): */
+#define uECC_CPU_BMI2_ADX 0x01
+#define uECC_CPU_AVX512_IFMA 0x02
+
+/* limits of the variable-time multi-scalar multiplication (wNAF): */
+#define uECC_WNAF_MAX_TERMS 4
+#define uECC_WNAF_MAX_WIDTH 6
+
+/*
+ * EccPoint_mult_multi: up to uECC_MSM_STRAUS_MAX points go through
+ * interleaved wNAF (Straus) with tables of width uECC_MSM_WIDTH, more through
+ * Pippenger's buckets with windows of at most uECC_MSM_MAX_WINDOW bits. The
+ * default is the measured crossover on p-256 (x86-64, 64-bit limbs, -Os):
+ * Straus is faster up to 160 points (57 us per point against 60 us), slower
+ * from 192 (58 us against 57 us). Straus keeps two arrays of
+ * 2 * uECC_MSM_STRAUS_MAX pointers on the stack (5 KB at the default), so
+ * lower it on targets with small stacks.
+ */
+#ifndef uECC_MSM_STRAUS_MAX
+#define uECC_MSM_STRAUS_MAX 160
+#endif
+#define uECC_MSM_WIDTH 5
+#ifndef uECC_MSM_MAX_WINDOW
+#define uECC_MSM_MAX_WINDOW 10
+#endif
+
+#if uECC_MSM_MAX_WINDOW < 2 || uECC_MSM_MAX_WINDOW > 14
+#error "Unsupported value for uECC_MSM_MAX_WINDOW"
+#endif
+
 /* defining data types to store word and bit counts: */
 typedef int_least8_t wordcount_t;
 typedef int16_t bitcount_t;
 /* defining data type for comparison result: */
 typedef int_least8_t cmpresult_t;
+#if (uECC_WORD_SIZE == 8)
+
+/* defining data type to store ECC coordinate/point in 64bits words: */
+typedef uint64_t uECC_word_t;
+/* defining data type to store the product of two 64bits words: */
+typedef unsigned __int128 uECC_dword_t;
+
+/* defining masks useful for ecc computations: */
+#define HIGH_BIT_SET 0x8000000000000000ull
+#define uECC_WORD_BITS 64
+#define uECC_WORD_BITS_SHIFT 6
+#define uECC_WORD_BITS_MASK 0x03F
+
+/* Number of words of 64 bits to represent an element of the the curve p-256: */
+#define NUM_ECC_WORDS 4
+
+#else
+
 /* defining data type to store ECC coordinate/point in 32bits words: */
 typedef uint32_t uECC_word_t;
 /* defining data type to store an ECC coordinate/point in 64bits words: */
@@ -103,9 +208,25 @@ typedef uint64_t uECC_dword_t;
 
 /* Number of words of 32 bits to represent an element of the the curve p-256: */
 #define NUM_ECC_WORDS 8
+
+#endif /* uECC_WORD_SIZE */
 /* Number of bytes to represent an element of the the curve p-256: */
 #define NUM_ECC_BYTES (uECC_WORD_SIZE*NUM_ECC_WORDS)
 
+/*
+ * Constants of an efficient endomorphism (x, y) -> (beta x, y) = lambda (x, y)
+ * (Gallant-Lambert-Vanstone), for curves that have one: a scalar k splits into
+ * k1 + k2 lambda with half-size k1 and k2 (see EccPoint_glv_split).
+ */
+struct uECC_GLV_t {
+  uECC_word_t beta[NUM_ECC_WORDS]; /* cube root of unity mod p */
+  uECC_word_t lambda[NUM_ECC_WORDS]; /* cube root of unity mod n */
+  uECC_word_t minus_b1[NUM_ECC_WORDS]; /* -b1 mod n, for the basis (a1, b1), */
+  uECC_word_t minus_b2[NUM_ECC_WORDS]; /* -b2 mod n, (a2, b2) of the lattice */
+  uECC_word_t g1[NUM_ECC_WORDS]; /* round(2^384 b2 / n) */
+  uECC_word_t g2[NUM_ECC_WORDS]; /* round(2^384 (-b1) / n) */
+};
+
 /* structure that represents an elliptic curve (e.g. p256):*/
 struct uECC_Curve_t;
 typedef const struct uECC_Curve_t * uECC_Curve;
@@ -120,7 +241,11 @@ struct uECC_Curve_t {
   void (*double_jacobian)(uECC_word_t * X1, uECC_word_t * Y1, uECC_word_t * Z1,
 	uECC_Curve curve);
   void (*x_side)(uECC_word_t *result, const uECC_word_t *x, uECC_Curve curve);
+  void (*mod_sqrt)(uECC_word_t *a, uECC_Curve curve);
   void (*mmod_fast)(uECC_word_t *result, uECC_word_t *product);
+  uECC_word_t (*mult_base)(uECC_word_t *result, const uECC_word_t *scalar,
+	uECC_Curve curve);
+  const struct uECC_GLV_t *glv;
 };
 
 /*
@@ -142,17 +267,76 @@ void double_jacobian_default(uECC_word_t * X1, uECC_word_t * Y1,
 void x_side_default(uECC_word_t *result, const uECC_word_t *x,
 		    uECC_Curve curve);
 
+/*
+ * @brief Computes a square root modulo p = 2^256 - 2^224 + 2^192 + 2^96 - 1,
+ * as a^((p + 1) / 4) (p = 3 mod 4) with a dedicated addition chain: 253
+ * squarings and 7 multiplications. If a is not a square, the result is not
+ * a square root of a, which the caller must check.
+ * @param a IN/OUT -- value, replaced by its square root
+ * @param curve IN -- elliptic curve (curve p-256)
+ */
+void mod_sqrt_secp256r1(uECC_word_t *a, uECC_Curve curve);
+
 /*
  * @brief Computes result = product % curve_p
  * from http://www.nsa.gov/ia/_files/nist-routines.pdf
  * @param result OUT -- product % curve_p
  * @param product IN -- value to be reduced mod curve_p
  */
-void vli_mmod_fast_secp256r1(uint32_t *result, uint32_t *product);
+void vli_mmod_fast_secp256r1(uECC_word_t *result, uECC_word_t *product);
+
+/*
+ * Fixed-point comb tables: row i holds the affine odd multiples
+ * (2j + 1) * 16^i * P, j < uECC_FIXED_ENTRIES, of a point P (32 KB for p-256).
+ */
+#define uECC_FIXED_ROWS 64
+#define uECC_FIXED_ENTRIES 8
+typedef uECC_word_t uECC_FixedTable[uECC_FIXED_ROWS][uECC_FIXED_ENTRIES][2 * NUM_ECC_WORDS];
+
+/*
+ * @brief Fills a fixed-point comb table for point.
+ * @param table OUT -- comb table of point
+ * @param point IN -- affine point, not the point at infinity
+ * @param curve IN -- elliptic curve (curve p-256)
+ */
+void EccPoint_fixed_table(uECC_FixedTable table, const uECC_word_t *point,
+			  uECC_Curve curve);
+
+/*
+ * @brief Computes result = scalar * P from the comb table of P, in constant
+ * time.
+ * @return 1 on success, 0 if an intermediate addition hit a doubling or the
+ * point at infinity, which cannot happen for scalars below n; the caller must
+ * then fall back to EccPoint_mult.
+ * @param result OUT -- scalar * P, in affine coordinates (0 for scalar 0)
+ * @param scalar IN -- scalar in the range [0, n-1]
+ * @param table IN -- comb table of P (see EccPoint_fixed_table)
+ * @param curve IN -- elliptic curve (curve p-256)
+ */
+uECC_word_t EccPoint_mult_fixed(uECC_word_t *result, const uECC_word_t *scalar,
+				const uECC_FixedTable table, uECC_Curve curve);
+
+/*
+ * @brief Computes result = scalar * G for curve p-256 using a precomputed
+ * table, in constant time.
+ * @return 1 on success, 0 if an intermediate addition hit a doubling or the
+ * point at infinity, which cannot happen for scalars below n; the caller must
+ * then fall back to EccPoint_mult.
+ * @param result OUT -- scalar * G, in affine coordinates (0 for scalar 0)
+ * @param scalar IN -- scalar in the range [0, n-1]
+ * @param curve IN -- elliptic curve (curve p-256)
+ */
+uECC_word_t mult_base_secp256r1(uECC_word_t *result, const uECC_word_t *scalar,
+				uECC_Curve curve);
 
 /* Bytes to words ordering: */
+#if (uECC_WORD_SIZE == 8)
+#define BYTES_TO_WORDS_8(a, b, c, d, e, f, g, h) 0x##h##g##f##e##d##c##b##a##ull
+#define BYTES_TO_WORDS_4(a, b, c, d) 0x##d##c##b##a
+#else
 #define BYTES_TO_WORDS_8(a, b, c, d, e, f, g, h) 0x##d##c##b##a, 0x##h##g##f##e
 #define BYTES_TO_WORDS_4(a, b, c, d) 0x##d##c##b##a
+#endif
 #define BITS_TO_WORDS(num_bits) \
 	((num_bits + ((uECC_WORD_SIZE * 8) - 1)) / (uECC_WORD_SIZE * 8))
 #define BITS_TO_BYTES(num_bits) ((num_bits + 7) / 8)
@@ -189,11 +373,130 @@ static const struct uECC_Curve_t curve_secp256r1 = {
 	},
         &double_jacobian_default,
         &x_side_default,
-        &vli_mmod_fast_secp256r1
+        &mod_sqrt_secp256r1,
+        &vli_mmod_fast_secp256r1,
+#if uECC_FIXED_BASE_TABLE
+        &mult_base_secp256r1,
+#else
+        0,
+#endif
+        0
 };
 
 uECC_Curve uECC_secp256r1(void);
 
+/*
+ * @brief Computes doubling of point (X1, Y1, Z1) on secp256k1 (a = 0).
+ * @param X1 IN/OUT -- x coordinate
+ * @param Y1 IN/OUT -- y coordinate
+ * @param Z1 IN/OUT -- z coordinate
+ * @param curve IN -- elliptic curve (curve secp256k1)
+ */
+void double_jacobian_secp256k1(uECC_word_t *X1, uECC_word_t *Y1,
+			       uECC_word_t *Z1, uECC_Curve curve);
+
+/*
+ * @brief Computes x^3 + 7. result must not overlap x.
+ * @param result OUT -- x^3 + 7
+ * @param x IN -- value of x
+ * @param curve IN -- elliptic curve (curve secp256k1)
+ */
+void x_side_secp256k1(uECC_word_t *result, const uECC_word_t *x,
+		      uECC_Curve curve);
+
+/*
+ * @brief Computes a square root modulo p = 2^256 - 2^32 - 977, as
+ * a^((p + 1) / 4) with an addition chain: 253 squarings and 13
+ * multiplications. If a is not a square, the result is not a square root of
+ * a, which the caller must check.
+ * @param a IN/OUT -- value, replaced by its square root
+ * @param curve IN -- elliptic curve (curve secp256k1)
+ */
+void mod_sqrt_secp256k1(uECC_word_t *a, uECC_Curve curve);
+
+/*
+ * @brief Computes result = product % p for p = 2^256 - 2^32 - 977, folding
+ * the upper half with 2^256 = 2^32 + 977 (mod p). Constant time.
+ * @param result OUT -- product % p
+ * @param product IN/OUT -- value to be reduced mod p (destroyed)
+ */
+void vli_mmod_fast_secp256k1(uECC_word_t *result, uECC_word_t *product);
+
+/* GLV endomorphism of secp256k1: */
+static const struct uECC_GLV_t glv_secp256k1 = {
+	{
+		BYTES_TO_WORDS_8(EE, 01, 95, 71, 28, 6C, 39, C1),
+		BYTES_TO_WORDS_8(95, 89, F5, 12, 75, 49, F0, 9C),
+		BYTES_TO_WORDS_8(E9, 34, 34, AC, 9E, 47, 64, 6E),
+		BYTES_TO_WORDS_8(10, 07, 7C, 65, 2B, 6A, E9, 7A)
+	}, {
+		BYTES_TO_WORDS_8(72, BD, 23, 1B, 7C, 96, 02, DF),
+		BYTES_TO_WORDS_8(78, 66, 81, 20, EA, 22, 2E, 12),
+		BYTES_TO_WORDS_8(5A, 64, 12, 88, 02, 1C, 26, A5),
+		BYTES_TO_WORDS_8(E0, 30, 5C, C0, 4C, AD, 63, 53)
+	}, {
+		BYTES_TO_WORDS_8(C3, E4, BF, 0A, A9, 7F, 54, 6F),
+		BYTES_TO_WORDS_8(28, 88, 0E, 01, D6, 7E, 43, E4),
+		BYTES_TO_WORDS_8(00, 00, 00, 00, 00, 00, 00, 00),
+		BYTES_TO_WORDS_8(00, 00, 00, 00, 00, 00, 00, 00)
+	}, {
+		BYTES_TO_WORDS_8(2C, 56, B1, 3D, A8, CD, 65, D7),
+		BYTES_TO_WORDS_8(6D, 34, 74, 07, C5, 0A, 28, 8A),
+		BYTES_TO_WORDS_8(FE, FF, FF, FF, FF, FF, FF, FF),
+		BYTES_TO_WORDS_8(FF, FF, FF, FF, FF, FF, FF, FF)
+	}, {
+		BYTES_TO_WORDS_8(31, B0, DB, 45, 9A, 20, 93, E8),
+		BYTES_TO_WORDS_8(7F, CA, E8, 71, 14, 8A, AA, 3D),
+		BYTES_TO_WORDS_8(15, EB, 84, 92, E4, 90, 6C, E8),
+		BYTES_TO_WORDS_8(CD, 6B, D4, A7, 21, D2, 86, 30)
+	}, {
+		BYTES_TO_WORDS_8(71, 7F, C4, 8A, AE, B4, 71, 15),
+		BYTES_TO_WORDS_8(C6, 06, F5, 9D, AC, 08, 12, 22),
+		BYTES_TO_WORDS_8(C4, E4, BF, 0A, A9, 7F, 54, 6F),
+		BYTES_TO_WORDS_8(28, 88, 0E, 01, D6, 7E, 43, E4)
+	}
+};
+
+/* definition of curve secp256k1 (SEC 2), without a fixed-base table: */
+static const struct uECC_Curve_t curve_secp256k1 = {
+	NUM_ECC_WORDS,
+	NUM_ECC_BYTES,
+	256, /* num_n_bits */ {
+		BYTES_TO_WORDS_8(2F, FC, FF, FF, FE, FF, FF, FF),
+		BYTES_TO_WORDS_8(FF, FF, FF, FF, FF, FF, FF, FF),
+		BYTES_TO_WORDS_8(FF, FF, FF, FF, FF, FF, FF, FF),
+		BYTES_TO_WORDS_8(FF, FF, FF, FF, FF, FF, FF, FF)
+	}, {
+		BYTES_TO_WORDS_8(41, 41, 36, D0, 8C, 5E, D2, BF),
+		BYTES_TO_WORDS_8(3B, A0, 48, AF, E6, DC, AE, BA),
+		BYTES_TO_WORDS_8(FE, FF, FF, FF, FF, FF, FF, FF),
+		BYTES_TO_WORDS_8(FF, FF, FF, FF, FF, FF, FF, FF)
+	}, {
+		BYTES_TO_WORDS_8(98, 17, F8, 16, 5B, 81, F2, 59),
+		BYTES_TO_WORDS_8(D9, 28, CE, 2D, DB, FC, 9B, 02),
+		BYTES_TO_WORDS_8(07, 0B, 87, CE, 95, 62, A0, 55),
+		BYTES_TO_WORDS_8(AC, BB, DC, F9, 7E, 66, BE, 79),
+
+		BYTES_TO_WORDS_8(B8, D4, 10, FB, 8F, D0, 47, 9C),
+		BYTES_TO_WORDS_8(19, 54, 85, A6, 48, B4, 17, FD),
+		BYTES_TO_WORDS_8(A8, 08, 11, 0E, FC, FB, A4, 5D),
+		BYTES_TO_WORDS_8(65, C4, A3, 26, 77, DA, 3A, 48)
+	}, {
+		BYTES_TO_WORDS_8(07, 00, 00, 00, 00, 00, 00, 00),
+		BYTES_TO_WORDS_8(00, 00, 00, 00, 00, 00, 00, 00),
+		BYTES_TO_WORDS_8(00, 00, 00, 00, 00, 00, 00, 00),
+		BYTES_TO_WORDS_8(00, 00, 00, 00, 00, 00, 00, 00)
+	},
+	&double_jacobian_secp256k1,
+	&x_side_secp256k1,
+	&mod_sqrt_secp256k1,
+	&vli_mmod_fast_secp256k1,
+	0,
+	&glv_secp256k1
+};
+
+uECC_Curve uECC_secp256k1(void);
+
 /*
  * @brief Generates a random integer in the range 0 < random < top.
  * Both random and top have num_words words.
@@ -242,6 +545,75 @@ void uECC_set_rng(uECC_RNG_Function rng_function);
  */
 uECC_RNG_Function uECC_get_rng(void);
 
+/* uECC_CtxRNG_Function type
+ * Same contract as uECC_RNG_Function, with the state registered in a
+ * uECC_Ctx passed as first argument (for instance a per-thread DRBG).
+ */
+typedef int(*uECC_CtxRNG_Function)(void *state, uint_least8_t *dest,
+				   uint32_t size);
+
+/*
+ * A per-caller source of randomness. The *_ctx functions only draw from
+ * their context, so threads with a context each never share an RNG; a NULL
+ * context selects the function set with uECC_set_rng().
+ */
+typedef struct uECC_Ctx {
+	uECC_CtxRNG_Function rng;
+	void *rng_state;
+} uECC_Ctx;
+
+/*
+ * @brief Sets up a context.
+ * @return Returns 1 on success, 0 if ctx is NULL.
+ * @param ctx OUT -- the context
+ * @param rng IN -- function that will be used to generate random bytes; NULL
+ * leaves the context without RNG (uECC_make_key_ctx and uECC_sign_ctx fail)
+ * @param rng_state IN -- first argument of every call to rng
+ */
+int uECC_ctx_init(uECC_Ctx *ctx, uECC_CtxRNG_Function rng, void *rng_state);
+
+/*
+ * @brief Tells whether random bytes are available.
+ * @return Returns 1 if the RNG of ctx (the global one if ctx is NULL) is set.
+ * @param ctx IN -- context or NULL
+ */
+int uECC_ctx_has_rng(const uECC_Ctx *ctx);
+
+/*
+ * @brief Fills dest with random bytes from the RNG of ctx (the global one if
+ * ctx is NULL).
+ * @return Returns 1 on success, 0 if there is no RNG or it failed.
+ * @param ctx IN -- context or NULL
+ * @param dest OUT -- random bytes
+ * @param size IN -- number of bytes
+ */
+int uECC_ctx_random(const uECC_Ctx *ctx, uint_least8_t *dest, uint32_t size);
+
+/*
+ * @brief uECC_generate_random_int with the RNG of ctx.
+ * @param ctx IN -- context or NULL
+ */
+int uECC_generate_random_int_ctx(const uECC_Ctx *ctx, uECC_word_t *random,
+				 const uECC_word_t *top, wordcount_t num_words);
+
+/*
+ * @brief Restricts the CPU features used by the field arithmetic. By default
+ * every supported feature the CPU reports is used; this is meant for testing
+ * and benchmarking the portable code on the same machine.
+ * @return Returns the features in use from now on: those requested that are
+ * both compiled in and reported by the CPU.
+ * @param features IN -- mask of uECC_CPU_* flags (~0U to use all of them)
+ * @note Must not race with ECC operations in other threads: call it before
+ * they start. Detection on first use is thread-safe.
+ */
+unsigned int uECC_set_cpu_features(unsigned int features);
+
+/*
+ * @brief provides the CPU features in use.
+ * @return Returns a mask of uECC_CPU_* flags.
+ */
+unsigned int uECC_get_cpu_features(void);
+
 /*
  * @brief computes the size of a private key for the curve in bytes.
  * @param curve IN -- elliptic curve
@@ -256,6 +628,35 @@ int uECC_curve_private_key_size(uECC_Curve curve);
  */
 int uECC_curve_public_key_size(uECC_Curve curve);
 
+/*
+ * @brief computes the size of a compressed public key for the curve in bytes.
+ * @param curve IN -- elliptic curve
+ * @return the size of a compressed public key for the curve in bytes.
+ */
+int uECC_curve_compressed_public_key_size(uECC_Curve curve);
+
+/*
+ * @brief Compresses a public key (SEC1 2.3.3): one byte 0x02 or 0x03 for the
+ * parity of y, followed by x.
+ * @param public_key IN -- The public key to compress
+ * @param compressed OUT -- Will be filled in with the compressed public key,
+ * uECC_curve_compressed_public_key_size() bytes
+ * @param curve IN -- elliptic curve
+ */
+void uECC_compress(const uint_least8_t *public_key, uint_least8_t *compressed,
+		   uECC_Curve curve);
+
+/*
+ * @brief Decompresses a public key (SEC1 2.3.4), recovering y as a square
+ * root of x^3 + ax + b.
+ * @param compressed IN -- The compressed public key
+ * @param public_key OUT -- Will be filled in with the public key
+ * @param curve IN -- elliptic curve
+ * @return Returns 1 if compressed encodes a point of the curve, 0 otherwise.
+ */
+int uECC_decompress(const uint_least8_t *compressed, uint_least8_t *public_key,
+		    uECC_Curve curve);
+
 /*
  * @brief Compute the corresponding public key for a private key.
  * @param private_key IN -- The private key to compute the public key for
@@ -276,6 +677,22 @@ int uECC_compute_public_key(const uint_least8_t *private_key,
 uECC_word_t EccPoint_compute_public_key(uECC_word_t *result,
 					uECC_word_t *private_key, uECC_Curve curve);
 
+/*
+ * @brief Computes count public keys at once: the multiplications by G stay in
+ * Jacobian coordinates and share a single modular inversion for the
+ * conversion to affine.
+ * @param results OUT -- count affine points, x followed by y for each
+ * @param private_keys IN -- count private keys in the range [1, n-1]
+ * @param count IN -- number of keys
+ * @param z IN/OUT -- scratch of count * num_words words
+ * @param scratch IN/OUT -- scratch of the same size as z
+ * @param curve IN -- elliptic curve
+ */
+void EccPoint_compute_public_keys(uECC_word_t *results,
+				  const uECC_word_t *private_keys,
+				  unsigned int count, uECC_word_t *z,
+				  uECC_word_t *scratch, uECC_Curve curve);
+
 /*
  * @brief Regularize the bitcount for the private key so that attackers cannot
  * use a side channel attack to learn the number of leading zeros.
@@ -303,6 +720,231 @@ void EccPoint_mult(uECC_word_t * result, const uECC_word_t * point,
 		   const uECC_word_t * scalar, const uECC_word_t * initial_Z,
 		   bitcount_t num_bits, uECC_Curve curve);
 
+/*
+ * @brief Multiplies the generator of the curve by a secret scalar, in
+ * constant time. Uses the curve's precomputed table when there is one and the
+ * Montgomery ladder otherwise.
+ * @param result OUT -- returns scalar*G
+ * @param scalar IN -- scalar
+ * @param curve IN -- elliptic curve
+ */
+void EccPoint_mult_base(uECC_word_t * result, const uECC_word_t * scalar,
+			uECC_Curve curve);
+
+/*
+ * @brief Inverts count values modulo mod at the cost of a single modular
+ * inversion (Montgomery's trick), in place.
+ * @note None of the values may be zero. Runs in variable time.
+ * @param values IN/OUT -- count integers of curve->num_words words each
+ * @param scratch IN/OUT -- buffer of the same size as values
+ * @param count IN -- number of values
+ * @param mod IN -- modulus (curve->p or curve->n)
+ * @param curve IN -- elliptic curve
+ */
+void uECC_vli_modInv_batch(uECC_word_t *values, uECC_word_t *scratch,
+			   unsigned int count, const uECC_word_t *mod,
+			   uECC_Curve curve);
+
+/*
+ * @brief Computes the affine odd multiples P, 3P, ..., (2^(width-1) - 1)P used
+ * as a wNAF table, with a single modular inversion.
+ * @param table OUT -- 2^(width-2) points, x followed by y for each
+ * @param point IN -- affine point P, not the point at infinity
+ * @param width IN -- window width, 2 < width <= uECC_WNAF_MAX_WIDTH
+ * @param curve IN -- elliptic curve
+ */
+void EccPoint_odd_multiples(uECC_word_t *table, const uECC_word_t *point,
+			    wordcount_t width, uECC_Curve curve);
+
+/*
+ * @brief Computes the tables of odd multiples of num_points points at once,
+ * sharing a single modular inversion between all of them.
+ * @param tables OUT -- num_points tables in the format of
+ * EccPoint_odd_multiples, one after the other
+ * @param points IN -- num_points affine points, none at infinity
+ * @param num_points IN -- number of points
+ * @param width IN -- window width, 2 < width <= uECC_WNAF_MAX_WIDTH
+ * @param z IN/OUT -- scratch of num_points * 2^(width-2) * num_words words
+ * @param scratch IN/OUT -- scratch of the same size as z
+ * @param curve IN -- elliptic curve
+ */
+void EccPoint_odd_multiples_batch(uECC_word_t *tables,
+				  const uECC_word_t *points,
+				  unsigned int num_points, wordcount_t width,
+				  uECC_word_t *z, uECC_word_t *scratch,
+				  uECC_Curve curve);
+
+/*
+ * @brief Returns a static table of odd multiples of the generator, if the
+ * curve has one.
+ * @return table in the format of EccPoint_odd_multiples, or 0
+ * @param curve IN -- elliptic curve
+ * @param width OUT -- window width of the table
+ */
+const uECC_word_t *EccPoint_odd_multiples_G(uECC_Curve curve,
+					    wordcount_t *width);
+
+/*
+ * @brief Computes the sum of scalars[i] * P_i with interleaved wNAF, where
+ * P_i is given by its table of odd multiples (see EccPoint_odd_multiples).
+ * All terms share the doublings. On curves with an endomorphism (curve->glv)
+ * and up to uECC_WNAF_MAX_TERMS / 2 terms, every scalar is split in two halves
+ * (see EccPoint_glv_split), which halves the number of doublings.
+ * @note Runs in variable time: use with public scalars only (e.g. signature
+ * verification).
+ * @param X OUT -- Jacobian x coordinate of the result
+ * @param Y OUT -- Jacobian y coordinate of the result
+ * @param Z OUT -- Jacobian z coordinate of the result (0 for infinity)
+ * @param scalars IN -- num_terms scalars of curve->num_words words
+ * @param tables IN -- num_terms tables of odd multiples
+ * @param widths IN -- window width of each table
+ * @param num_terms IN -- number of terms, at most uECC_WNAF_MAX_TERMS
+ * @param curve IN -- elliptic curve
+ */
+void EccPoint_mult_wnaf(uECC_word_t *X, uECC_word_t *Y, uECC_word_t *Z,
+			const uECC_word_t * const *scalars,
+			const uECC_word_t * const *tables,
+			const wordcount_t *widths, wordcount_t num_terms,
+			uECC_Curve curve);
+
+/* digits of a wNAF, and words taken by num_terms rows of them: */
+#define uECC_WNAF_DIGITS (NUM_ECC_WORDS * uECC_WORD_BITS + 1)
+#define uECC_WNAF_NAF_WORDS(num_terms) \
+	(((num_terms) * uECC_WNAF_DIGITS + uECC_WORD_SIZE - 1) / uECC_WORD_SIZE)
+
+/* scratch words of EccPoint_mult_wnaf_scratch in the worst case: */
+#define uECC_WNAF_SCRATCH_WORDS \
+	(uECC_WNAF_MAX_TERMS * \
+	 (NUM_ECC_WORDS + (1 << (uECC_WNAF_MAX_WIDTH - 2)) * 2 * NUM_ECC_WORDS) + \
+	 uECC_WNAF_NAF_WORDS(uECC_WNAF_MAX_TERMS))
+
+/*
+ * @brief Size of the scratch of EccPoint_mult_wnaf_scratch.
+ * @return number of words, at most uECC_WNAF_SCRATCH_WORDS
+ * @param widths IN -- window width of each table
+ * @param num_terms IN -- number of terms
+ * @param curve IN -- elliptic curve
+ */
+unsigned int EccPoint_mult_wnaf_scratch_words(const wordcount_t *widths,
+					      wordcount_t num_terms,
+					      uECC_Curve curve);
+
+/*
+ * @brief EccPoint_mult_wnaf with its temporaries (the halves of the scalars
+ * and tables on curves with an endomorphism, and the wNAF digits) in scratch
+ * instead of on the stack.
+ * @param scratch IN/OUT -- EccPoint_mult_wnaf_scratch_words() words
+ */
+void EccPoint_mult_wnaf_scratch(uECC_word_t *X, uECC_word_t *Y,
+				uECC_word_t *Z,
+				const uECC_word_t * const *scalars,
+				const uECC_word_t * const *tables,
+				const wordcount_t *widths, wordcount_t num_terms,
+				uECC_word_t *scratch, uECC_Curve curve);
+
+/*
+ * @brief Size of the scratch of EccPoint_mult_multi.
+ * @return number of words
+ * @param num_points IN -- number of points
+ * @param curve IN -- elliptic curve
+ */
+unsigned int EccPoint_mult_multi_scratch_words(unsigned int num_points,
+					       uECC_Curve curve);
+
+/*
+ * @brief Multi-scalar multiplication: computes the sum of scalars[i] * P_i
+ * for any number of affine points. Up to uECC_MSM_STRAUS_MAX points, all
+ * tables of odd multiples are built with one inversion and the terms share
+ * the doublings of an interleaved wNAF (halved with the endomorphism on
+ * curves that have one). Beyond that, Pippenger's bucket method adds every
+ * point once per window to the bucket of its signed digit, and sums the
+ * buckets by running sums; the window width grows with num_points.
+ * @note Runs in variable time: use with public scalars only (e.g. batch
+ * verification).
+ * @param X OUT -- Jacobian x coordinate of the result
+ * @param Y OUT -- Jacobian y coordinate of the result
+ * @param Z OUT -- Jacobian z coordinate of the result (0 for infinity)
+ * @param scalars IN -- num_points scalars of curve->num_words words, each
+ * below curve->n
+ * @param points IN -- num_points affine points, each x then y, none at
+ * infinity
+ * @param num_points IN -- number of points
+ * @param scratch IN/OUT -- EccPoint_mult_multi_scratch_words() words
+ * @param curve IN -- elliptic curve
+ */
+void EccPoint_mult_multi(uECC_word_t *X, uECC_word_t *Y, uECC_word_t *Z,
+			 const uECC_word_t *scalars, const uECC_word_t *points,
+			 unsigned int num_points, uECC_word_t *scratch,
+			 uECC_Curve curve);
+
+/*
+ * @brief Splits k into k1 + k2 lambda (mod n) with the endomorphism of the
+ * curve, where k1 and k2 are below 2^128 in absolute value. Runs in variable
+ * time.
+ * @return the signs: bit 0 set if k1 is negative, bit 1 if k2 is
+ * @param k1 OUT -- |k1|
+ * @param k2 OUT -- |k2|
+ * @param k IN -- scalar in the range [0, n-1]
+ * @param curve IN -- elliptic curve with an endomorphism (curve->glv)
+ */
+unsigned int EccPoint_glv_split(uECC_word_t *k1, uECC_word_t *k2,
+				const uECC_word_t *k, uECC_Curve curve);
+
+/*
+ * @brief Width-w non-adjacent form of scalar: every non-zero digit is odd and
+ * lies in (-2^(w-1), 2^(w-1)), and any w consecutive digits hold at most one
+ * non-zero digit. Runs in variable time.
+ * @return Returns the number of digits.
+ * @param naf OUT -- digits, least significant first (num_words * uECC_WORD_BITS
+ * + 1 at most)
+ * @param scalar IN -- scalar to recode
+ * @param width IN -- window width w, 2 < w <= uECC_WNAF_MAX_WIDTH
+ * @param num_words IN -- number of words in scalar
+ */
+bitcount_t wnaf_recode(int_least8_t *naf, const uECC_word_t *scalar,
+		       wordcount_t width, wordcount_t num_words);
+
+/* lanes of EccPoint_mult_wnaf_x8, and its limit on terms per lane: */
+#define uECC_LANES 8
+#define uECC_LANES_MAX_TERMS 2
+
+/*
+ * @brief Computes EccPoint_mult_wnaf for uECC_LANES independent sums at once,
+ * with one lane per 64-bit element of AVX-512 registers (p-256 only).
+ * @return Returns the mask of the lanes computed (bit l for lane l). Lanes
+ * whose additions meet equal or opposite points are left out, and so are all
+ * lanes if the CPU lacks AVX-512 IFMA or the curve is not p-256: the caller
+ * computes those with EccPoint_mult_wnaf.
+ * @note Runs in variable time: use with public scalars only.
+ * @param X OUT -- uECC_LANES Jacobian x coordinates, one after the other
+ * @param Y OUT -- uECC_LANES Jacobian y coordinates
+ * @param Z OUT -- uECC_LANES Jacobian z coordinates (0 for infinity)
+ * @param scalars IN -- num_terms scalars per lane; term t of lane l is
+ * scalars[l * num_terms + t]
+ * @param tables IN -- the matching tables of odd multiples
+ * @param widths IN -- window width of each term, the same for all lanes
+ * @param num_terms IN -- number of terms, at most uECC_LANES_MAX_TERMS
+ * @param curve IN -- elliptic curve
+ */
+unsigned int EccPoint_mult_wnaf_x8(uECC_word_t *X, uECC_word_t *Y,
+				   uECC_word_t *Z,
+				   const uECC_word_t * const *scalars,
+				   const uECC_word_t * const *tables,
+				   const wordcount_t *widths,
+				   wordcount_t num_terms, uECC_Curve curve);
+
+/*
+ * @brief Checks y^2 = x^3 + ax + b for uECC_LANES affine points at once, with
+ * the lanes of EccPoint_mult_wnaf_x8 (p-256 only).
+ * @return Returns 1 if the check was done, 0 if the CPU lacks AVX-512 IFMA or
+ * the curve is not p-256.
+ * @param on_curve OUT -- mask of the lanes whose point is on the curve
+ * @param points IN -- uECC_LANES points, each x then y, with x, y < p
+ * @param curve IN -- elliptic curve
+ */
+int EccPoint_on_curve_x8(unsigned int *on_curve, const uECC_word_t *points,
+			 uECC_Curve curve);
+
 /*
  * @brief Constant-time comparison to zero - secure way to compare long integers
  * @param vli IN -- very long integer
@@ -443,9 +1085,35 @@ void uECC_vli_modMult(uECC_word_t *result, const uECC_word_t *left,
 	              wordcount_t num_words);
 
 /*
- * @brief Computes (1 / input) % mod
+ * @brief Prepares Montgomery multiplication modulo mod.
+ * @return -1 / mod modulo 2^uECC_WORD_BITS, for uECC_vli_montMult
+ * @param r2 OUT -- R^2 % mod, with R = 2^(num_words * uECC_WORD_BITS)
+ * @param mod IN -- odd modulus (curve_p or curve_n)
+ * @param num_words IN -- number of words
+ */
+uECC_word_t uECC_vli_montInit(uECC_word_t *r2, const uECC_word_t *mod,
+			      wordcount_t num_words);
+
+/*
+ * @brief Computes the Montgomery product (left * right / R) % mod.
+ * @note Multiplying by r2 (see uECC_vli_montInit) moves a value into the
+ * Montgomery domain, multiplying by 1 moves it out. Runs in constant time.
+ * @param result OUT -- (left * right / R) % mod
+ * @param left IN -- left term in product, < mod
+ * @param right IN -- right term in product, < mod
+ * @param mod IN -- odd modulus
+ * @param mod_inv IN -- value returned by uECC_vli_montInit for mod
+ * @param num_words IN -- number of words
+ */
+void uECC_vli_montMult(uECC_word_t *result, const uECC_word_t *left,
+		       const uECC_word_t *right, const uECC_word_t *mod,
+		       uECC_word_t mod_inv, wordcount_t num_words);
+
+/*
+ * @brief Computes (1 / input) % mod, in constant time (see uECC_SAFEGCD).
  * @note All VLIs are the same size.
- * @note See "Euclid's GCD to Montgomery Multiplication to the Great Divide"
+ * @note mod must be an odd prime of 256 bits at most (curve_p or curve_n),
+ * and input < mod. The inverse of 0 is 0.
  * @param result OUT -- (1 / input) % mod
  * @param input IN -- value to be modular inverted
  * @param mod IN -- mod
@@ -520,18 +1188,55 @@ int uECC_valid_point(const uECC_word_t *point, uECC_Curve curve);
  */
 int uECC_valid_public_key(const uint_least8_t *public_key, uECC_Curve curve);
 
+/*
+ * @brief Checks many public keys, as uECC_valid_public_key would.
+ * @param public_keys IN -- count public keys, one after the other
+ * @param count IN -- number of keys
+ * @param valid OUT -- bitmap of (count + 7) / 8 bytes: bit i % 8 of byte
+ * i / 8 is set iff key i is valid
+ * @param curve IN -- elliptic curve
+ * @return returns the number of valid keys
+ *
+ * @note Keys are checked uECC_LANES at a time on CPUs with AVX-512 IFMA. To
+ * spread a job over threads, give each thread a range starting at a multiple
+ * of 8 keys, so that no two threads write the same byte of the bitmap.
+ */
+unsigned int uECC_valid_public_keys(const uint_least8_t *public_keys,
+				    unsigned int count, uint_least8_t *valid,
+				    uECC_Curve curve);
+
+/*
+ * @brief Converts an integer of uECC_word_t words to big-endian bytes.
+ * @param bytes OUT -- bytes representation
+ * @param num_bytes IN -- number of bytes
+ * @param native IN -- words, least significant first
+ */
+void uECC_vli_wordsToBytes(uint_least8_t *bytes, int num_bytes,
+			   const uECC_word_t *native);
+
+/*
+ * @brief Converts big-endian bytes to an integer of uECC_word_t words.
+ * @param native OUT -- words, least significant first
+ * @param bytes IN -- bytes representation
+ * @param num_bytes IN -- number of bytes
+ */
+void uECC_vli_bytesToWords(uECC_word_t *native, const uint_least8_t *bytes,
+			   int num_bytes);
+
  /*
   * @brief Converts an integer in uECC native format to big-endian bytes.
   * @param bytes OUT -- bytes representation
   * @param num_bytes IN -- number of bytes
-  * @param native IN -- uECC native representation
+  * @param native IN -- uECC native representation: 32-bit words, least
+  *        significant first, whatever uECC_WORD_SIZE is
   */
 void uECC_vli_nativeToBytes(uint_least8_t *bytes, int num_bytes,
     			    const uint32_t *native);
 
 /*
  * @brief Converts big-endian bytes to an integer in uECC native format.
- * @param native OUT -- uECC native representation
+ * @param native OUT -- uECC native representation: 32-bit words, least
+ *        significant first, whatever uECC_WORD_SIZE is
  * @param bytes IN -- bytes representation
  * @param num_bytes IN -- number of bytes
  */
@@ -75,6 +75,22 @@
 extern "C" {
 #endif
 
+/* number of keys uECC_make_key_batch converts with one modular inversion: */
+#ifndef uECC_KEYGEN_BATCH_SIZE
+#define uECC_KEYGEN_BATCH_SIZE 32
+#endif
+
+/*
+ * A peer public key prepared for repeated key agreements: validated once,
+ * with the fixed-point comb table of the key (see EccPoint_fixed_table).
+ */
+typedef struct uECC_PeerKeyCtx {
+	/* curve of the key, 0 if the context holds no valid key */
+	uECC_Curve curve;
+	/* multiples of the key */
+	uECC_FixedTable table;
+} uECC_PeerKeyCtx;
+
 /**
  * @brief Create a public/private key pair.
  * @return returns TC_CRYPTO_SUCCESS (1) if the key pair was generated successfully
@@ -93,6 +109,42 @@ extern "C" {
  */
 int uECC_make_key(uint_least8_t *p_public_key, uint_least8_t *p_private_key, uECC_Curve curve);
 
+/**
+ * @brief uECC_make_key drawing its randomness from the RNG of a context.
+ * @param ctx IN -- context (NULL: the uECC_set_rng() function)
+ */
+int uECC_make_key_ctx(const uECC_Ctx *ctx, uint_least8_t *p_public_key,
+		      uint_least8_t *p_private_key, uECC_Curve curve);
+
+/**
+ * @brief Create count public/private key pairs.
+ * @return returns TC_CRYPTO_SUCCESS (1) if all key pairs were generated
+ *         successfully
+ *         returns TC_CRYPTO_FAIL (0) if the RNG failed; the contents of the
+ *         output buffers are then unspecified
+ *
+ * @param p_public_keys OUT -- count public keys in the format of
+ * uECC_make_key, one after the other (64 bytes each for secp256r1).
+ * @param p_private_keys OUT -- count private keys, one after the other
+ * (32 bytes each for secp256r1).
+ * @param count IN -- number of key pairs
+ *
+ * @note Same keys as count calls to uECC_make_key, at a lower cost per key:
+ * the keys of each group of uECC_KEYGEN_BATCH_SIZE share a single modular
+ * inversion.
+ */
+int uECC_make_key_batch(uint_least8_t *p_public_keys,
+			uint_least8_t *p_private_keys, unsigned int count,
+			uECC_Curve curve);
+
+/**
+ * @brief uECC_make_key_batch drawing its randomness from the RNG of a context.
+ * @param ctx IN -- context (NULL: the uECC_set_rng() function)
+ */
+int uECC_make_key_batch_ctx(const uECC_Ctx *ctx, uint_least8_t *p_public_keys,
+			    uint_least8_t *p_private_keys, unsigned int count,
+			    uECC_Curve curve);
+
 #ifdef ENABLE_TESTS
 
 /**
@@ -124,6 +176,52 @@ int uECC_make_key_with_d(uint_least8_t *p_public_key, uint_least8_t *p_private_k
 int uECC_shared_secret(const uint_least8_t *p_public_key, const uint_least8_t *p_private_key,
 		       uint_least8_t *p_secret, uECC_Curve curve);
 
+/**
+ * @brief uECC_shared_secret drawing its randomization of Z from the RNG of a
+ * context.
+ * @param ctx IN -- context (NULL: the uECC_set_rng() function)
+ */
+int uECC_shared_secret_ctx(const uECC_Ctx *ctx,
+			   const uint_least8_t *p_public_key,
+			   const uint_least8_t *p_private_key,
+			   uint_least8_t *p_secret, uECC_Curve curve);
+
+/**
+ * @brief Prepare a peer public key for repeated key agreements.
+ * @return returns TC_CRYPTO_SUCCESS (1) if the key is valid
+ *         returns TC_CRYPTO_FAIL (0) if the key is not a point of the curve or
+ *         an argument is NULL.
+ *
+ * @param p_ctx OUT -- The prepared key (about 32 KB for secp256r1).
+ * @param p_public_key IN -- The public key of the remote party.
+ * @param curve IN -- elliptic curve
+ *
+ * @note Costs about as much as two or three calls to uECC_shared_secret;
+ * pays off from the third agreement with the same key.
+ */
+int uECC_prepare_peer_key(uECC_PeerKeyCtx *p_ctx,
+			  const uint_least8_t *p_public_key, uECC_Curve curve);
+
+/**
+ * @brief Compute a shared secret with a prepared peer public key.
+ * @return returns TC_CRYPTO_SUCCESS (1) if the shared secret was computed successfully
+ *         returns TC_CRYPTO_FAIL (0) if p_ctx holds no valid key or the private
+ *         key is not in the range [1, n-1]
+ *
+ * @param p_ctx IN -- The public key of the remote party, from
+ * uECC_prepare_peer_key.
+ * @param p_private_key IN -- Your private key.
+ * @param p_secret OUT -- Will be filled in with the shared secret value.
+ *
+ * @note Same secret as uECC_shared_secret. The comb table is scanned in full
+ * for every window, so the run time and memory accesses do not depend on the
+ * private key; unlike uECC_shared_secret, Z is not randomized and no RNG is
+ * needed.
+ */
+int uECC_shared_secret_prepared(const uECC_PeerKeyCtx *p_ctx,
+				const uint_least8_t *p_private_key,
+				uint_least8_t *p_secret);
+
 #ifdef __cplusplus
 }
 #endif
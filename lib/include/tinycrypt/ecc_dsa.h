@@ -79,11 +79,132 @@
 #define __TC_ECC_DSA_H__
 
 #include <tinycrypt/ecc.h>
+#include <tinycrypt/hmac.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/*
+ * Number of signatures uECC_verify_batch processes together. Larger chunks
+ * amortize the shared inversions further but take more stack (640 bytes per
+ * signature).
+ */
+#ifndef uECC_VERIFY_BATCH_SIZE
+#define uECC_VERIFY_BATCH_SIZE 16
+#endif
+
+/*
+ * wNAF window width of the table of multiples kept by a prepared public key.
+ * Each step of the width doubles the size of the table (64 bytes per point
+ * with 64-bit words) and removes a few point additions from every
+ * verification.
+ */
+#ifndef uECC_PREPARED_WIDTH
+#define uECC_PREPARED_WIDTH 6
+#endif
+
+#if (uECC_PREPARED_WIDTH < 3) || (uECC_PREPARED_WIDTH > uECC_WNAF_MAX_WIDTH)
+#error "Unsupported value for uECC_PREPARED_WIDTH"
+#endif
+
+/* wNAF window width for the public key during verification: */
+#define uECC_VERIFY_WIDTH 4
+
+/*
+ * Size in bytes of a scratch arena large enough for uECC_sign_scratch and
+ * uECC_verify_scratch on every curve: the maximum of uECC_scratch_size(),
+ * for arenas sized at compile time.
+ */
+#define uECC_SCRATCH_SIZE \
+	((8 * NUM_ECC_WORDS + \
+	  2 * (1 << (uECC_VERIFY_WIDTH - 2)) * 2 * NUM_ECC_WORDS + \
+	  uECC_WNAF_SCRATCH_WORDS) * uECC_WORD_SIZE)
+
+/* number of prepared public keys held by a uECC_PublicKeyCache: */
+#ifndef uECC_KEY_CACHE_SIZE
+#define uECC_KEY_CACHE_SIZE 64
+#endif
+
+/*
+ * A public key prepared for repeated verification: validated once, with the
+ * odd multiples Q, 3Q, ..., (2^(uECC_PREPARED_WIDTH-1) - 1)Q kept in native
+ * affine coordinates (the first entry is Q itself).
+ */
+typedef struct uECC_PublicKeyCtx {
+	/* curve of the key, 0 if the context holds no valid key */
+	uECC_Curve curve;
+	/* the key in the format accepted by uECC_verify */
+	uint_least8_t key[2 * NUM_ECC_BYTES];
+	/* odd multiples of the key */
+	uECC_word_t table[(1 << (uECC_PREPARED_WIDTH - 2)) * 2 * NUM_ECC_WORDS];
+} uECC_PublicKeyCtx;
+
+/* A bounded cache of prepared public keys with least-recently-used eviction. */
+typedef struct uECC_PublicKeyCache {
+	uECC_PublicKeyCtx entries[uECC_KEY_CACHE_SIZE];
+	/* value of clock at the last use of each entry, 0 for free entries */
+	uint32_t last_used[uECC_KEY_CACHE_SIZE];
+	uint32_t clock;
+} uECC_PublicKeyCache;
+
+/* number of precomputed signing nonces held by a uECC_NoncePool: */
+#ifndef uECC_NONCE_POOL_SIZE
+#define uECC_NONCE_POOL_SIZE 16
+#endif
+
+#if (uECC_NONCE_POOL_SIZE & (uECC_NONCE_POOL_SIZE - 1)) != 0
+#error "uECC_NONCE_POOL_SIZE must be a power of two"
+#endif
+
+/*
+ * A precomputed signing nonce: what a signature needs from a random k, with
+ * k itself already discarded. Values are modulo curve_n, the last two in its
+ * Montgomery domain (R = 2^(uECC_WORD_BITS * words of curve_n)).
+ */
+typedef struct uECC_Nonce {
+	/* r = x(kG) mod n */
+	uECC_word_t r[NUM_ECC_WORDS];
+	/* r R mod n */
+	uECC_word_t r_mont[NUM_ECC_WORDS];
+	/* (1 / k) R mod n */
+	uECC_word_t k_inv_mont[NUM_ECC_WORDS];
+} uECC_Nonce;
+
+/*
+ * A single-producer, single-consumer ring of precomputed signing nonces, each
+ * used at most once. The indices run freely and are taken modulo
+ * uECC_NONCE_POOL_SIZE: the unused nonces are those from head to tail - 1.
+ * Only the producer (uECC_nonce_pool_put, uECC_nonce_pool_refill) writes tail
+ * and only the consumer (uECC_sign_pooled) writes head.
+ *
+ * TinyCrypt creates no threads and allocates no memory, so both are left to
+ * the caller: refill the pool from a thread or idle task of its own, off the
+ * signing path, and place the structure in protected memory (locked and
+ * excluded from core dumps, e.g. mlock and MADV_DONTDUMP, or secure RAM).
+ */
+typedef struct uECC_NoncePool {
+	uECC_Curve curve;
+	uECC_Nonce nonces[uECC_NONCE_POOL_SIZE];
+	unsigned int head;
+	unsigned int tail;
+	/* -1 / n mod 2^uECC_WORD_BITS, for Montgomery products */
+	uECC_word_t n_inv;
+} uECC_NoncePool;
+
+/*
+ * A private key prepared for deterministic signing (RFC 6979 with
+ * HMAC-SHA-256). The first HMAC of the nonce derivation only depends on the
+ * key, so its keyed context is computed once and copied for each signature.
+ */
+typedef struct uECC_DeterministicKey {
+	uECC_Curve curve;
+	/* int2octets(x) */
+	uint_least8_t private_key[NUM_ECC_BYTES];
+	/* HMAC with K = 0x00...00 over V = 0x01...01 || 0x00 || int2octets(x) */
+	struct tc_hmac_state_struct prefix;
+} uECC_DeterministicKey;
+
 /**
  * @brief Generate an ECDSA signature for a given hash value.
  * @return returns TC_CRYPTO_SUCCESS (1) if the signature generated successfully
@@ -105,6 +226,14 @@ extern "C" {
 int uECC_sign(const uint_least8_t *p_private_key, const uint_least8_t *p_message_hash,
 	      uint32_t p_hash_size, uint_least8_t *p_signature, uECC_Curve curve);
 
+/**
+ * @brief uECC_sign drawing its randomness from the RNG of a context.
+ * @param ctx IN -- context (NULL: the uECC_set_rng() function)
+ */
+int uECC_sign_ctx(const uECC_Ctx *ctx, const uint_least8_t *p_private_key,
+		  const uint_least8_t *p_message_hash, uint32_t p_hash_size,
+		  uint_least8_t *p_signature, uECC_Curve curve);
+
 #ifdef ENABLE_TESTS
 /*
  * THIS FUNCTION SHOULD BE CALLED FOR TEST PURPOSES ONLY.
@@ -132,6 +261,292 @@ int uECC_sign_with_k(const uint_least8_t *private_key, const uint_least8_t *mess
 int uECC_verify(const uint_least8_t *p_public_key, const uint_least8_t *p_message_hash,
 		uint32_t p_hash_size, const uint_least8_t *p_signature, uECC_Curve curve);
 
+/**
+ * @brief Size of the scratch arena of uECC_sign_scratch and
+ * uECC_verify_scratch.
+ * @return size in bytes, at most uECC_SCRATCH_SIZE
+ * @param curve IN -- elliptic curve
+ */
+unsigned int uECC_scratch_size(uECC_Curve curve);
+
+/**
+ * @brief uECC_sign_ctx with its buffers in a caller-supplied arena.
+ * @return returns TC_CRYPTO_SUCCESS (1) if the signature generated
+ *         successfully
+ *         returns TC_CRYPTO_FAIL (0) if an error occurred or the arena is
+ *         smaller than uECC_scratch_size(curve)
+ *
+ * @param ctx IN -- context (NULL: the uECC_set_rng() function)
+ * @param p_scratch IN/OUT -- arena, wiped before returning
+ * @param p_scratch_size IN -- size of p_scratch in bytes
+ *
+ * @note Together with uECC_verify_scratch, this keeps the nonce, the scalars,
+ * the tables of multiples and the wNAF digits off the stack, so that many
+ * small stacks (e.g. coroutines) can share a few arenas or keep them in
+ * cache. The point and field arithmetic underneath still uses a bounded
+ * amount of stack: about 1.5 KB with 64-bit words, against 7 KB for
+ * uECC_verify.
+ */
+int uECC_sign_scratch(const uECC_Ctx *ctx, const uint_least8_t *p_private_key,
+		      const uint_least8_t *p_message_hash, uint32_t p_hash_size,
+		      uint_least8_t *p_signature, uECC_Curve curve,
+		      uECC_word_t *p_scratch, unsigned int p_scratch_size);
+
+/**
+ * @brief uECC_verify with its buffers in a caller-supplied arena.
+ * @return returns TC_SUCCESS (1) if the signature is valid
+ *         returns TC_FAIL (0) if the signature is invalid or the arena is
+ *         smaller than uECC_scratch_size(curve)
+ *
+ * @param p_scratch IN/OUT -- arena
+ * @param p_scratch_size IN -- size of p_scratch in bytes
+ */
+int uECC_verify_scratch(const uint_least8_t *p_public_key,
+			const uint_least8_t *p_message_hash,
+			uint32_t p_hash_size, const uint_least8_t *p_signature,
+			uECC_Curve curve, uECC_word_t *p_scratch,
+			unsigned int p_scratch_size);
+
+/**
+ * @brief Verify a batch of ECDSA signatures.
+ * @return returns TC_SUCCESS (1) if every signature is valid
+ *         returns TC_FAIL (0) if any signature is invalid or an argument is
+ *         NULL.
+ *
+ * @param p_public_keys IN -- The signers' public keys, one per signature.
+ * @param p_message_hashes IN -- The hashes of the signed data.
+ * @param p_hash_size IN -- The size of each message hash in bytes.
+ * @param p_signatures IN -- The signature values.
+ * @param p_count IN -- The number of signatures.
+ * @param p_results OUT -- p_results[i] is set to 1 if signature i is valid
+ * and to 0 otherwise.
+ * @param curve IN -- elliptic curve
+ *
+ * @note Gives the same verdicts as calling uECC_verify for each signature, at
+ * a lower cost per signature: the 1/s values and the affine tables of the
+ * public keys of up to uECC_VERIFY_BATCH_SIZE signatures are computed with a
+ * single modular inversion each. Public keys are checked with
+ * uECC_valid_point; signatures under an invalid key are rejected.
+ */
+int uECC_verify_batch(const uint_least8_t * const *p_public_keys,
+		      const uint_least8_t * const *p_message_hashes,
+		      uint32_t p_hash_size,
+		      const uint_least8_t * const *p_signatures,
+		      unsigned int p_count, int *p_results, uECC_Curve curve);
+
+/**
+ * @brief Prepare a public key for repeated verifications.
+ * @return returns TC_SUCCESS (1) if the key is valid
+ *         returns TC_FAIL (0) if uECC_valid_public_key rejects the key or an
+ *         argument is NULL.
+ *
+ * @param p_ctx OUT -- The prepared key.
+ * @param p_public_key IN -- The signer's public key.
+ * @param curve IN -- elliptic curve
+ */
+int uECC_prepare_public_key(uECC_PublicKeyCtx *p_ctx,
+			    const uint_least8_t *p_public_key, uECC_Curve curve);
+
+/**
+ * @brief Verify an ECDSA signature against a prepared public key.
+ * @return returns TC_SUCCESS (1) if the signature is valid
+ *         returns TC_FAIL (0) if the signature is invalid or p_ctx holds no
+ *         valid key.
+ *
+ * @param p_ctx IN -- The signer's public key, from uECC_prepare_public_key.
+ * @param p_message_hash IN -- The hash of the signed data.
+ * @param p_hash_size IN -- The size of p_message_hash in bytes.
+ * @param p_signature IN -- The signature values.
+ *
+ * @note Same verdict as uECC_verify, without parsing the key and computing
+ * its multiples again.
+ */
+int uECC_verify_prepared(const uECC_PublicKeyCtx *p_ctx,
+			 const uint_least8_t *p_message_hash,
+			 uint32_t p_hash_size, const uint_least8_t *p_signature);
+
+/**
+ * @brief Empty a cache of prepared public keys.
+ * @param p_cache OUT -- The cache.
+ */
+void uECC_key_cache_init(uECC_PublicKeyCache *p_cache);
+
+/**
+ * @brief Look up a public key in a cache, preparing it on a miss.
+ * @return returns the prepared key, or 0 if the key is invalid or an argument
+ *         is NULL. The returned context stays valid until the entry is
+ *         evicted by a later lookup.
+ *
+ * @param p_cache IN/OUT -- The cache, initialized with uECC_key_cache_init.
+ * @param p_public_key IN -- The signer's public key.
+ * @param curve IN -- elliptic curve
+ *
+ * @note On a miss, the key is checked by uECC_prepare_public_key and, if
+ * valid, replaces the least recently used entry. Invalid keys evict nothing. The cache is not thread-safe: calls for the same cache must
+ * be serialized by the caller.
+ */
+const uECC_PublicKeyCtx *uECC_key_cache_get(uECC_PublicKeyCache *p_cache,
+					    const uint_least8_t *p_public_key,
+					    uECC_Curve curve);
+
+/**
+ * @brief Verify an ECDSA signature, going through a cache of prepared keys.
+ * @return returns TC_SUCCESS (1) if the signature is valid
+ *         returns TC_FAIL (0) if the signature or the key is invalid.
+ *
+ * @param p_cache IN/OUT -- The cache, initialized with uECC_key_cache_init.
+ * @param p_public_key IN -- The signer's public key.
+ * @param p_message_hash IN -- The hash of the signed data.
+ * @param p_hash_size IN -- The size of p_message_hash in bytes.
+ * @param p_signature IN -- The signature values.
+ * @param curve IN -- elliptic curve
+ */
+int uECC_verify_cached(uECC_PublicKeyCache *p_cache,
+		       const uint_least8_t *p_public_key,
+		       const uint_least8_t *p_message_hash, uint32_t p_hash_size,
+		       const uint_least8_t *p_signature, uECC_Curve curve);
+
+/**
+ * @brief Empty a nonce pool and bind it to a curve.
+ * @return returns TC_CRYPTO_SUCCESS (1)
+ *         returns TC_CRYPTO_FAIL (0) if an argument is NULL.
+ *
+ * @param p_pool OUT -- The pool.
+ * @param curve IN -- elliptic curve
+ */
+int uECC_nonce_pool_init(uECC_NoncePool *p_pool, uECC_Curve curve);
+
+/**
+ * @brief Compute a signing nonce: draws a random k and performs the
+ * multiplication k*G and the inversion of k that signing would otherwise do.
+ * @return returns TC_CRYPTO_SUCCESS (1) if the nonce was computed
+ *         returns TC_CRYPTO_FAIL (0) if the RNG failed.
+ *
+ * @param p_nonce OUT -- The nonce, to be handed to uECC_nonce_pool_put.
+ * @param curve IN -- elliptic curve
+ *
+ * @note This is the expensive step. It does not touch any pool, so it can run
+ * in any thread.
+ */
+int uECC_nonce_make(uECC_Nonce *p_nonce, uECC_Curve curve);
+
+/**
+ * @brief uECC_nonce_make drawing k from the RNG of a context.
+ * @param ctx IN -- context (NULL: the uECC_set_rng() function)
+ */
+int uECC_nonce_make_ctx(const uECC_Ctx *ctx, uECC_Nonce *p_nonce,
+			uECC_Curve curve);
+
+/**
+ * @brief Move a nonce into a pool.
+ * @return returns TC_CRYPTO_SUCCESS (1) if the nonce was added
+ *         returns TC_CRYPTO_FAIL (0) if the pool is full or an argument is
+ *         NULL.
+ *
+ * @param p_pool IN/OUT -- The pool.
+ * @param p_nonce IN/OUT -- A nonce from uECC_nonce_make for the pool's curve;
+ * erased in any case, so that it cannot be used twice.
+ *
+ * @note Producer side of the pool: may run concurrently with
+ * uECC_sign_pooled, but not with another producer call for the same pool.
+ */
+int uECC_nonce_pool_put(uECC_NoncePool *p_pool, uECC_Nonce *p_nonce);
+
+/**
+ * @brief Fill a nonce pool (uECC_nonce_make and uECC_nonce_pool_put until
+ * the pool is full).
+ * @return returns TC_CRYPTO_SUCCESS (1) if the pool is full
+ *         returns TC_CRYPTO_FAIL (0) if the RNG failed or p_pool is NULL.
+ *
+ * @param p_pool IN/OUT -- The pool.
+ *
+ * @note Producer side of the pool, like uECC_nonce_pool_put.
+ */
+int uECC_nonce_pool_refill(uECC_NoncePool *p_pool);
+
+/**
+ * @brief uECC_nonce_pool_refill drawing each k from the RNG of a context.
+ * @param ctx IN -- context (NULL: the uECC_set_rng() function)
+ */
+int uECC_nonce_pool_refill_ctx(const uECC_Ctx *ctx, uECC_NoncePool *p_pool);
+
+/**
+ * @brief Erase every nonce left in a pool.
+ * @param p_pool IN/OUT -- The pool.
+ *
+ * @note Must not run concurrently with any other call for the same pool.
+ */
+void uECC_nonce_pool_clear(uECC_NoncePool *p_pool);
+
+/**
+ * @brief Generate an ECDSA signature with a precomputed nonce.
+ * @return returns TC_CRYPTO_SUCCESS (1) if the signature generated successfully
+ *         returns TC_CRYPTO_FAIL (0) if an error occurred.
+ *
+ * @param p_pool IN/OUT -- The pool, initialized with uECC_nonce_pool_init.
+ * @param p_private_key IN -- Your private key.
+ * @param p_message_hash IN -- The hash of the message to sign.
+ * @param p_hash_size IN -- The size of p_message_hash in bytes.
+ * @param p_signature OUT -- Will be filled in with the signature value (2 *
+ * curve size bytes).
+ *
+ * @note The nonce is removed from the pool and erased before it is used. With
+ * an empty pool, a nonce is computed on the spot (at the cost of uECC_sign).
+ * @note The pool holds secrets: keep it in memory that is neither swapped nor
+ * dumped, and call uECC_nonce_pool_clear before releasing it.
+ * @note Consumer side of the pool: one thread may sign while another refills
+ * it, without a lock (the indices are accessed with acquire/release
+ * semantics where the compiler provides __atomic builtins; elsewhere calls
+ * must be serialized). Two threads signing with the same pool must be
+ * serialized by the caller.
+ */
+int uECC_sign_pooled(uECC_NoncePool *p_pool, const uint_least8_t *p_private_key,
+		     const uint_least8_t *p_message_hash, uint32_t p_hash_size,
+		     uint_least8_t *p_signature);
+
+/**
+ * @brief Prepare a private key for uECC_sign_deterministic.
+ * @return returns TC_CRYPTO_SUCCESS (1) if the key was prepared
+ *         returns TC_CRYPTO_FAIL (0) if the private key is not in [1, n - 1]
+ *         or an argument is NULL.
+ *
+ * @param p_key OUT -- The prepared key.
+ * @param p_private_key IN -- Your private key.
+ * @param curve IN -- elliptic curve
+ *
+ * @note p_key holds the private key: erase it with
+ * uECC_deterministic_key_clear when done.
+ */
+int uECC_deterministic_key_init(uECC_DeterministicKey *p_key,
+				const uint_least8_t *p_private_key,
+				uECC_Curve curve);
+
+/**
+ * @brief Erase a prepared deterministic signing key.
+ * @param p_key IN/OUT -- The prepared key.
+ */
+void uECC_deterministic_key_clear(uECC_DeterministicKey *p_key);
+
+/**
+ * @brief Generate a deterministic ECDSA signature (RFC 6979).
+ * @return returns TC_CRYPTO_SUCCESS (1) if the signature generated successfully
+ *         returns TC_CRYPTO_FAIL (0) if an error occurred.
+ *
+ * @param p_key IN -- A key prepared with uECC_deterministic_key_init.
+ * @param p_message_hash IN -- The hash of the message to sign.
+ * @param p_hash_size IN -- The size of p_message_hash in bytes.
+ * @param p_signature OUT -- Will be filled in with the signature value (2 *
+ * curve size bytes).
+ *
+ * @note The nonce is derived from the private key and the hash with
+ * HMAC-DRBG, so the same key and hash always give the same signature, and no
+ * RNG is called (the RNG set with uECC_set_rng is not used).
+ * @note p_key is only read, so threads can share it.
+ */
+int uECC_sign_deterministic(const uECC_DeterministicKey *p_key,
+			    const uint_least8_t *p_message_hash,
+			    uint32_t p_hash_size, uint_least8_t *p_signature);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,192 @@
+/* ecc_ed25519.h - TinyCrypt interface to Ed25519 signatures */
+
+/*
+ *  Copyright (C) 2017 by Intel Corporation, All Rights Reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *    - Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *    - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ *    - Neither the name of Intel Corporation nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief Interface to Ed25519 signatures (RFC 8032).
+ *
+ *  Overview: Ed25519 is EdDSA on the twisted Edwards form of Curve25519 with
+ *            SHA-512. Private keys are 32-byte seeds, public keys are
+ *            32-byte encoded points and signatures are 64 bytes (R || S).
+ *            Messages are hashed by the scheme itself, they are passed whole.
+ *
+ *  Security: Ed25519 provides approximately 128 bits of security. Signing
+ *            is deterministic and runs in constant time; verification only
+ *            handles public data and runs in variable time.
+ *
+ *  Verification checks the cofactored equation [8][S]B = [8]R + [8][k]A, as
+ *  allowed by RFC 8032, section 5.1.7. It rejects S >= L and non-canonical
+ *  point encodings. uECC_ed25519_verify and uECC_ed25519_verify_batch use
+ *  the same equation, so they agree on every signature.
+ */
+
+#ifndef __TC_ECC_ED25519_H__
+#define __TC_ECC_ED25519_H__
+
+#include <tinycrypt/ecc.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define uECC_ED25519_KEY_SIZE 32
+#define uECC_ED25519_SIGNATURE_SIZE 64
+/* secret scalar, nonce prefix and public key (uECC_ed25519_expand_key): */
+#define uECC_ED25519_EXPANDED_KEY_SIZE 96
+
+/*
+ * Number of signatures uECC_ed25519_verify_batch checks with one
+ * multi-scalar multiplication. Each one costs about 450 bytes of stack, on
+ * top of about 5 KB for the buckets of the multiplication.
+ */
+#ifndef uECC_ED25519_BATCH_SIZE
+#define uECC_ED25519_BATCH_SIZE 64
+#endif
+
+/**
+ * @brief Compute the public key of an Ed25519 private key.
+ * @return returns TC_CRYPTO_SUCCESS (1) if the key was computed
+ *         returns TC_CRYPTO_FAIL (0) if an argument is NULL
+ *
+ * @param public_key OUT -- 32-byte public key
+ * @param private_key IN -- 32-byte private key (seed)
+ */
+int uECC_ed25519_public_key(uint_least8_t *public_key,
+			    const uint_least8_t *private_key);
+
+/**
+ * @brief Create an Ed25519 public/private key pair.
+ * @return returns TC_CRYPTO_SUCCESS (1) if the key pair was generated successfully
+ *         returns TC_CRYPTO_FAIL (0) if error while generating key pair
+ *
+ * @param public_key OUT -- 32-byte public key
+ * @param private_key OUT -- 32-byte private key
+ *
+ * @warning A cryptographically-secure PRNG function must be set (using
+ * uECC_set_rng()) before calling uECC_ed25519_make_key().
+ */
+int uECC_ed25519_make_key(uint_least8_t *public_key,
+			  uint_least8_t *private_key);
+
+/**
+ * @brief Same as uECC_ed25519_make_key(), drawing the private key from the
+ * generator of ctx (the global one if ctx is 0).
+ */
+int uECC_ed25519_make_key_ctx(const uECC_Ctx *ctx, uint_least8_t *public_key,
+			      uint_least8_t *private_key);
+
+/**
+ * @brief Generate an Ed25519 signature.
+ * @return returns TC_CRYPTO_SUCCESS (1) if the signature was generated
+ *         returns TC_CRYPTO_FAIL (0) if an argument is NULL
+ *
+ * @param private_key IN -- 32-byte private key of the signer
+ * @param message IN -- message to sign
+ * @param message_size IN -- size of message in bytes
+ * @param signature OUT -- 64-byte signature
+ *
+ * @note The public key is derived from private_key, never taken from the
+ * caller: signing with a mismatched public key would reveal the private key.
+ */
+int uECC_ed25519_sign(const uint_least8_t *private_key,
+		      const uint_least8_t *message, size_t message_size,
+		      uint_least8_t *signature);
+
+/**
+ * @brief Expand an Ed25519 private key for repeated signing.
+ * uECC_ed25519_sign() derives the secret scalar, the nonce prefix and the
+ * public key from the private key for every signature, which costs a second
+ * base point multiplication; the expanded key holds all three.
+ * @return returns TC_CRYPTO_SUCCESS (1) if the key was expanded
+ *         returns TC_CRYPTO_FAIL (0) if an argument is NULL
+ *
+ * @param expanded OUT -- uECC_ED25519_EXPANDED_KEY_SIZE bytes, as secret as
+ *        the private key
+ * @param private_key IN -- 32-byte private key of the signer
+ */
+int uECC_ed25519_expand_key(uint_least8_t *expanded,
+			    const uint_least8_t *private_key);
+
+/**
+ * @brief Same as uECC_ed25519_sign(), with a key expanded by
+ * uECC_ed25519_expand_key(): one base point multiplication per signature.
+ */
+int uECC_ed25519_sign_expanded(const uint_least8_t *expanded,
+			       const uint_least8_t *message,
+			       size_t message_size, uint_least8_t *signature);
+
+/**
+ * @brief Verify an Ed25519 signature.
+ * @return returns TC_CRYPTO_SUCCESS (1) if the signature is valid
+ *         returns TC_CRYPTO_FAIL (0) if the signature or the public key is
+ *         invalid, or an argument is NULL
+ *
+ * @param public_key IN -- 32-byte public key of the signer
+ * @param message IN -- signed message
+ * @param message_size IN -- size of message in bytes
+ * @param signature IN -- 64-byte signature
+ */
+int uECC_ed25519_verify(const uint_least8_t *public_key,
+			const uint_least8_t *message, size_t message_size,
+			const uint_least8_t *signature);
+
+/**
+ * @brief Verify a batch of Ed25519 signatures.
+ * @return returns TC_CRYPTO_SUCCESS (1) if every signature is valid
+ *         returns TC_CRYPTO_FAIL (0) if any signature is invalid or an
+ *         argument is NULL
+ *
+ * @param public_keys IN -- The signers' public keys, one per signature.
+ * @param messages IN -- The signed messages.
+ * @param message_sizes IN -- The size of each message in bytes.
+ * @param signatures IN -- The signatures.
+ * @param count IN -- The number of signatures.
+ * @param results OUT -- results[i] is set to 1 if signature i is valid and
+ * to 0 otherwise.
+ *
+ * @note Up to uECC_ED25519_BATCH_SIZE signatures are combined with 128-bit
+ * coefficients into one multi-scalar multiplication (Pippenger's bucket
+ * method). The coefficients are derived by hashing the whole batch. When a
+ * batch fails, its signatures are checked one by one to fill results.
+ */
+int uECC_ed25519_verify_batch(const uint_least8_t * const *public_keys,
+			      const uint_least8_t * const *messages,
+			      const size_t *message_sizes,
+			      const uint_least8_t * const *signatures,
+			      unsigned int count, int *results);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TC_ECC_ED25519_H__ */
@@ -0,0 +1,125 @@
+/* ecc_x25519.h - TinyCrypt interface to X25519 key agreement */
+
+/*
+ *  Copyright (C) 2017 by Intel Corporation, All Rights Reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *    - Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *    - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ *    - Neither the name of Intel Corporation nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief Interface to X25519 key agreement (RFC 7748).
+ *
+ *  Overview: X25519 is the Diffie-Hellman function on the Montgomery form of
+ *            Curve25519. Keys are 32-byte strings and only u-coordinates are
+ *            exchanged, so X25519 does not fit the Weierstrass uECC_Curve
+ *            interface: it has its own entry points, sharing the random
+ *            number generators of ecc.h.
+ *
+ *  Security: Curve25519 provides approximately 128 bits of security. The
+ *            Montgomery ladder runs in constant time; private keys are
+ *            clamped as required by RFC 7748.
+ */
+
+#ifndef __TC_ECC_X25519_H__
+#define __TC_ECC_X25519_H__
+
+#include <tinycrypt/ecc.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define uECC_X25519_KEY_SIZE 32
+
+/*
+ * Field elements use five 51-bit limbs and 64x64->128-bit products where the
+ * compiler provides a 128-bit integer type, the generic vli layer of ecc.c
+ * otherwise. Define uECC_X25519_RADIX51 to 0 to force the latter.
+ */
+#ifndef uECC_X25519_RADIX51
+#if defined(__SIZEOF_INT128__)
+#define uECC_X25519_RADIX51 1
+#else
+#define uECC_X25519_RADIX51 0
+#endif
+#endif
+
+/**
+ * @brief Computes the X25519 function.
+ * @return returns TC_CRYPTO_SUCCESS (1) if the result was computed
+ *         returns TC_CRYPTO_FAIL (0) if the result is all zero (u is a point
+ *         of small order)
+ *
+ * @param out OUT -- 32-byte u-coordinate of scalar * u
+ * @param scalar IN -- 32-byte scalar, clamped before use
+ * @param u IN -- 32-byte u-coordinate, most significant bit ignored
+ */
+int uECC_x25519(uint_least8_t *out, const uint_least8_t *scalar,
+		const uint_least8_t *u);
+
+/**
+ * @brief Create an X25519 public/private key pair.
+ * @return returns TC_CRYPTO_SUCCESS (1) if the key pair was generated successfully
+ *         returns TC_CRYPTO_FAIL (0) if error while generating key pair
+ *
+ * @param public_key OUT -- 32-byte public key
+ * @param private_key OUT -- 32-byte private key
+ *
+ * @warning A cryptographically-secure PRNG function must be set (using
+ * uECC_set_rng()) before calling uECC_x25519_make_key().
+ */
+int uECC_x25519_make_key(uint_least8_t *public_key, uint_least8_t *private_key);
+
+/**
+ * @brief Same as uECC_x25519_make_key(), drawing the private key from the
+ * generator of ctx (the global one if ctx is 0).
+ */
+int uECC_x25519_make_key_ctx(const uECC_Ctx *ctx, uint_least8_t *public_key,
+			     uint_least8_t *private_key);
+
+/**
+ * @brief Compute an X25519 shared secret.
+ * @return returns TC_CRYPTO_SUCCESS (1) if the shared secret was computed
+ *         returns TC_CRYPTO_FAIL (0) otherwise
+ *
+ * @param public_key IN -- 32-byte public key of the remote party
+ * @param private_key IN -- 32-byte private key
+ * @param secret OUT -- 32-byte shared secret
+ *
+ * @warning The secret must be passed through a key derivation function
+ * before use.
+ */
+int uECC_x25519_shared_secret(const uint_least8_t *public_key,
+			      const uint_least8_t *private_key,
+			      uint_least8_t *secret);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TC_ECC_X25519_H__ */
@@ -140,6 +140,59 @@ int tc_hmac_prng_reseed(TCHmacPrng_t prng, const uint_least8_t *seed,
 			uint32_t seedlen, const uint_least8_t *additional_input,
 			uint32_t additionallen);
 
+/**
+ *  @brief HMAC-PRNG instantiate procedure
+ *  Instantiates prng directly from raw seed material, as RFC 6979 section
+ *  3.2 steps b. to g. do: K = 0x00...00, V = 0x01...01, then the update
+ *  function with seed || additional_input. Enables tc_hmac_prng_generate
+ *  @return returns  TC_CRYPTO_SUCCESS (1)
+ *          returns TC_CRYPTO_FAIL (0) if:
+ *          prng == NULL,
+ *          seed == NULL,
+ *          seedlen < MIN_SLEN,
+ *          seendlen > MAX_SLEN,
+ *          additional_input != (const uint_least8_t *) 0 && additionallen == 0,
+ *          additional_input != (const uint_least8_t *) 0 && additionallen > MAX_ALEN
+ *  @note Unlike tc_hmac_prng_init and tc_hmac_prng_reseed, this takes no
+ *        personalization; the seed must be the secret. tc_hmac_prng_init
+ *        need not be called.
+ *
+ *  @param prng OUT -- the PRNG state
+ *  @param prefix IN -- the state tc_hmac_prng_instantiate_prefix computed
+ *         for the same seed, or NULL to compute it here
+ *  @param seed IN -- seed material
+ *  @param seedlen IN -- length of seed in bytes
+ *  @param additional_input IN -- additional input to the prng
+ *  @param additionallen IN -- additional input length in bytes
+ */
+int tc_hmac_prng_instantiate(TCHmacPrng_t prng,
+			     const struct tc_hmac_state_struct *prefix,
+			     const uint_least8_t *seed,
+			     uint32_t seedlen,
+			     const uint_least8_t *additional_input,
+			     uint32_t additionallen);
+
+/**
+ *  @brief Precomputes the part of tc_hmac_prng_instantiate that only
+ *  depends on the seed, so that instantiating many times with the same
+ *  seed and different additional input (one per message, for RFC 6979)
+ *  costs two fewer SHA-256 blocks
+ *  @return returns  TC_CRYPTO_SUCCESS (1)
+ *          returns TC_CRYPTO_FAIL (0) if:
+ *          prefix == NULL,
+ *          seed == NULL,
+ *          seedlen < MIN_SLEN,
+ *          seendlen > MAX_SLEN
+ *  @note prefix holds keyed state derived from seed: wipe it with the seed
+ *
+ *  @param prefix OUT -- the precomputed state
+ *  @param seed IN -- seed material
+ *  @param seedlen IN -- length of seed in bytes
+ */
+int tc_hmac_prng_instantiate_prefix(struct tc_hmac_state_struct *prefix,
+				    const uint_least8_t *seed,
+				    uint32_t seedlen);
+
 /**
  *  @brief HMAC-PRNG generate procedure
  *  Generates outlen pseudo-random bytes into out buffer, updates prng
@@ -0,0 +1,202 @@
+/* prng_guard.h - TinyCrypt interface to a fork-safe PRNG wrapper */
+
+/*
+ *  Copyright (C) 2017 by Intel Corporation, All Rights Reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *    - Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *    - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ *    - Neither the name of Intel Corporation nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief Interface to a fork-safe PRNG wrapper.
+ *
+ *  Overview:   Neither CTR-PRNG nor HMAC-PRNG can tell that the process
+ *              holding them has been duplicated by fork(): parent and child
+ *              would otherwise produce the very same output stream. The PRNG
+ *              guard wraps an already seeded generator, remembers the process
+ *              that owns its state and reseeds it from an entropy source on
+ *              the first request made in a different process.
+ *
+ *              The guard also counts generate requests, so that reseeding can
+ *              be scheduled off the request path: tc_prng_guard_maintain
+ *              reseeds once the configured interval has elapsed, and as soon
+ *              as fewer than an interval's worth of requests remain before
+ *              the wrapped generator's own hard limit.
+ *
+ *  Security:   The guard only decides *when* to reseed; the output quality is
+ *              that of the wrapped generator and of the entropy source.
+ *              On POSIX-like systems a pthread_atfork handler bumps a fork
+ *              generation counter in every child, so the request path only
+ *              compares two words. A process id check alone would miss a
+ *              grandchild that reuses the pid of its dead grandparent after a
+ *              double fork; it is only the fallback if the handler cannot be
+ *              registered. Children created without fork() (raw clone() or
+ *              a vfork() that does not exec) are not detected. Elsewhere fork
+ *              detection is disabled and only the reseed schedule applies.
+ *
+ *  Requires:   - CTR-PRNG and/or HMAC-PRNG
+ *              - pthread_atfork and pthread_once on POSIX-like systems (link
+ *                with -pthread)
+ *
+ *  Usage:      1) initialize and seed a CTR-PRNG or HMAC-PRNG context
+ *
+ *              2) call tc_prng_guard_init_ctr or tc_prng_guard_init_hmac to
+ *              wrap it
+ *
+ *              3) call tc_prng_guard_generate instead of the generator's own
+ *              generate procedure
+ *
+ *              4) call tc_prng_guard_maintain periodically from an idle or
+ *              housekeeping context (and right after fork, if desired)
+ */
+
+#ifndef __TC_PRNG_GUARD_H__
+#define __TC_PRNG_GUARD_H__
+
+#include <tinycrypt/ctr_prng.h>
+#include <tinycrypt/hmac_prng.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TC_PRNG_GUARD_CTR 1
+#define TC_PRNG_GUARD_HMAC 2
+
+/* number of generate requests between scheduled reseeds, unless overridden: */
+#define TC_PRNG_GUARD_DEFAULT_INTERVAL ((uint64_t)1 << 20)
+
+/* bytes of entropy drawn on each reseed: */
+#define TC_PRNG_GUARD_SEED_SIZE (TC_AES_KEY_SIZE + TC_AES_BLOCK_SIZE)
+
+/*
+ * Entropy source used to reseed the wrapped generator. It has the same shape
+ * as uECC_RNG_Function, so default_CSPRNG can be used directly. It must return
+ * 1 if 'dest' was filled with 'size' bytes of entropy, 0 otherwise.
+ */
+typedef int (*TCEntropyFunction_t)(uint_least8_t *dest, uint32_t size);
+
+struct tc_prng_guard_struct {
+	/* which generator is wrapped: TC_PRNG_GUARD_CTR or TC_PRNG_GUARD_HMAC */
+	int type;
+	/* the wrapped generator (only the one matching type is set) */
+	TCCtrPrng_t *ctr;
+	TCHmacPrng_t hmac;
+	/* entropy source for every reseed */
+	TCEntropyFunction_t entropy;
+	/* process that owns the current generator state */
+	long pid;
+	/* fork generation of that process (see tc_prng_guard_generate) */
+	unsigned long generation;
+	/* generate requests served since the last reseed */
+	uint64_t requests;
+	/* requests after which tc_prng_guard_maintain reseeds */
+	uint64_t reseed_interval;
+};
+
+typedef struct tc_prng_guard_struct *TCPrngGuard_t;
+
+/**
+ *  @brief Wraps an initialized CTR-PRNG
+ *  @return returns TC_CRYPTO_SUCCESS (1)
+ *          returns TC_CRYPTO_FAIL (0) if:
+ *                guard == NULL,
+ *                prng == NULL,
+ *                entropy == NULL
+ *  @note Assumes tc_ctr_prng_init has been called for prng. The guard keeps a
+ *        pointer to prng, which must outlive it.
+ *  @param guard IN/OUT -- the guard to initialize
+ *  @param prng IN -- the seeded CTR-PRNG context
+ *  @param entropy IN -- entropy source used for reseeding
+ *  @param reseed_interval IN -- requests between scheduled reseeds (0 selects
+ *  TC_PRNG_GUARD_DEFAULT_INTERVAL; capped at half the generator's limit)
+ */
+int tc_prng_guard_init_ctr(TCPrngGuard_t guard, TCCtrPrng_t *prng,
+			   TCEntropyFunction_t entropy,
+			   uint64_t reseed_interval);
+
+/**
+ *  @brief Wraps an initialized HMAC-PRNG
+ *  @return returns TC_CRYPTO_SUCCESS (1)
+ *          returns TC_CRYPTO_FAIL (0) if:
+ *                guard == NULL,
+ *                prng == NULL,
+ *                entropy == NULL
+ *  @note Assumes tc_hmac_prng_init has been called for prng. The guard keeps a
+ *        pointer to prng, which must outlive it. A generator that has not been
+ *        reseeded yet is seeded on its first request.
+ *  @param guard IN/OUT -- the guard to initialize
+ *  @param prng IN -- the HMAC-PRNG state
+ *  @param entropy IN -- entropy source used for reseeding
+ *  @param reseed_interval IN -- requests between scheduled reseeds (0 selects
+ *  TC_PRNG_GUARD_DEFAULT_INTERVAL; capped at half the generator's limit)
+ */
+int tc_prng_guard_init_hmac(TCPrngGuard_t guard, TCHmacPrng_t prng,
+			    TCEntropyFunction_t entropy,
+			    uint64_t reseed_interval);
+
+/**
+ *  @brief Fork-safe generate procedure
+ *  Generates outlen pseudo-random bytes into out. If the calling process is
+ *  not the one that last seeded the generator, the generator is reseeded
+ *  first. If the wrapped generator demands a reseed because maintenance never
+ *  ran, it is reseeded synchronously.
+ *  @return returns TC_CRYPTO_SUCCESS (1)
+ *          returns TC_CRYPTO_FAIL (0) if:
+ *                guard == NULL,
+ *                out == NULL,
+ *                a required reseed failed,
+ *                the wrapped generator rejected the request
+ *  @param guard IN/OUT -- the PRNG guard
+ *  @param out IN/OUT -- buffer to receive output
+ *  @param outlen IN -- size of out buffer in bytes
+ */
+int tc_prng_guard_generate(TCPrngGuard_t guard, uint_least8_t *out,
+			   uint32_t outlen);
+
+/**
+ *  @brief Scheduled reseed procedure
+ *  Reseeds the wrapped generator if the reseed interval has elapsed, if fewer
+ *  than reseed_interval requests remain before the generator's own limit or
+ *  if the calling process does not own the generator state. Does nothing
+ *  otherwise, so it is cheap to call from an idle loop or a timer.
+ *  @return returns TC_CRYPTO_SUCCESS (1) if no reseed was due or the reseed
+ *          succeeded
+ *          returns TC_CRYPTO_FAIL (0) if:
+ *                guard == NULL,
+ *                the reseed failed
+ *  @note The guard is not thread-safe: calls for the same guard must be
+ *        serialized by the caller.
+ *  @param guard IN/OUT -- the PRNG guard
+ */
+int tc_prng_guard_maintain(TCPrngGuard_t guard);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __TC_PRNG_GUARD_H__ */
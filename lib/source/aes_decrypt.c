@@ -59,10 +59,56 @@ static const uint_least8_t inv_sbox[256] = {
 	0x55, 0x21, 0x0c, 0x7d
 };
 
-int tc_aes128_set_decrypt_key(TCAesKeySched_t s, const uint_least8_t *k)
-{
-	return tc_aes128_set_encrypt_key(s, k);
-}
+/*
+ * Inverse T-table: Td[x] is the column InvMixColumns makes of InvSubBytes(x)
+ * in row 0, that is (0e, 09, 0d, 0b) * inv_sbox[x]. Rows 1 to 3 use the same
+ * entry rotated right by 8, 16 and 24 bits.
+ */
+static const uint32_t Td[256] = {
+	0x51f4a750, 0x7e416553, 0x1a17a4c3, 0x3a275e96, 0x3bab6bcb, 0x1f9d45f1,
+	0xacfa58ab, 0x4be30393, 0x2030fa55, 0xad766df6, 0x88cc7691, 0xf5024c25,
+	0x4fe5d7fc, 0xc52acbd7, 0x26354480, 0xb562a38f, 0xdeb15a49, 0x25ba1b67,
+	0x45ea0e98, 0x5dfec0e1, 0xc32f7502, 0x814cf012, 0x8d4697a3, 0x6bd3f9c6,
+	0x038f5fe7, 0x15929c95, 0xbf6d7aeb, 0x955259da, 0xd4be832d, 0x587421d3,
+	0x49e06929, 0x8ec9c844, 0x75c2896a, 0xf48e7978, 0x99583e6b, 0x27b971dd,
+	0xbee14fb6, 0xf088ad17, 0xc920ac66, 0x7dce3ab4, 0x63df4a18, 0xe51a3182,
+	0x97513360, 0x62537f45, 0xb16477e0, 0xbb6bae84, 0xfe81a01c, 0xf9082b94,
+	0x70486858, 0x8f45fd19, 0x94de6c87, 0x527bf8b7, 0xab73d323, 0x724b02e2,
+	0xe31f8f57, 0x6655ab2a, 0xb2eb2807, 0x2fb5c203, 0x86c57b9a, 0xd33708a5,
+	0x302887f2, 0x23bfa5b2, 0x02036aba, 0xed16825c, 0x8acf1c2b, 0xa779b492,
+	0xf307f2f0, 0x4e69e2a1, 0x65daf4cd, 0x0605bed5, 0xd134621f, 0xc4a6fe8a,
+	0x342e539d, 0xa2f355a0, 0x058ae132, 0xa4f6eb75, 0x0b83ec39, 0x4060efaa,
+	0x5e719f06, 0xbd6e1051, 0x3e218af9, 0x96dd063d, 0xdd3e05ae, 0x4de6bd46,
+	0x91548db5, 0x71c45d05, 0x0406d46f, 0x605015ff, 0x1998fb24, 0xd6bde997,
+	0x894043cc, 0x67d99e77, 0xb0e842bd, 0x07898b88, 0xe7195b38, 0x79c8eedb,
+	0xa17c0a47, 0x7c420fe9, 0xf8841ec9, 0x00000000, 0x09808683, 0x322bed48,
+	0x1e1170ac, 0x6c5a724e, 0xfd0efffb, 0x0f853856, 0x3daed51e, 0x362d3927,
+	0x0a0fd964, 0x685ca621, 0x9b5b54d1, 0x24362e3a, 0x0c0a67b1, 0x9357e70f,
+	0xb4ee96d2, 0x1b9b919e, 0x80c0c54f, 0x61dc20a2, 0x5a774b69, 0x1c121a16,
+	0xe293ba0a, 0xc0a02ae5, 0x3c22e043, 0x121b171d, 0x0e090d0b, 0xf28bc7ad,
+	0x2db6a8b9, 0x141ea9c8, 0x57f11985, 0xaf75074c, 0xee99ddbb, 0xa37f60fd,
+	0xf701269f, 0x5c72f5bc, 0x44663bc5, 0x5bfb7e34, 0x8b432976, 0xcb23c6dc,
+	0xb6edfc68, 0xb8e4f163, 0xd731dcca, 0x42638510, 0x13972240, 0x84c61120,
+	0x854a247d, 0xd2bb3df8, 0xaef93211, 0xc729a16d, 0x1d9e2f4b, 0xdcb230f3,
+	0x0d8652ec, 0x77c1e3d0, 0x2bb3166c, 0xa970b999, 0x119448fa, 0x47e96422,
+	0xa8fc8cc4, 0xa0f03f1a, 0x567d2cd8, 0x223390ef, 0x87494ec7, 0xd938d1c1,
+	0x8ccaa2fe, 0x98d40b36, 0xa6f581cf, 0xa57ade28, 0xdab78e26, 0x3fadbfa4,
+	0x2c3a9de4, 0x5078920d, 0x6a5fcc9b, 0x547e4662, 0xf68d13c2, 0x90d8b8e8,
+	0x2e39f75e, 0x82c3aff5, 0x9f5d80be, 0x69d0937c, 0x6fd52da9, 0xcf2512b3,
+	0xc8ac993b, 0x10187da7, 0xe89c636e, 0xdb3bbb7b, 0xcd267809, 0x6e5918f4,
+	0xec9ab701, 0x834f9aa8, 0xe6956e65, 0xaaffe67e, 0x21bccf08, 0xef15e8e6,
+	0xbae79bd9, 0x4a6f36ce, 0xea9f09d4, 0x29b07cd6, 0x31a4b2af, 0x2a3f2331,
+	0xc6a59430, 0x35a266c0, 0x744ebc37, 0xfc82caa6, 0xe090d0b0, 0x33a7d815,
+	0xf104984a, 0x41ecdaf7, 0x7fcd500e, 0x1791f62f, 0x764dd68d, 0x43efb04d,
+	0xccaa4d54, 0xe49604df, 0x9ed1b5e3, 0x4c6a881b, 0xc12c1fb8, 0x4665517f,
+	0x9d5eea04, 0x018c355d, 0xfa877473, 0xfb0b412e, 0xb3671d5a, 0x92dbd252,
+	0xe9105633, 0x6dd64713, 0x9ad7618c, 0x37a10c7a, 0x59f8148e, 0xeb133c89,
+	0xcea927ee, 0xb761c935, 0xe11ce5ed, 0x7a47b13c, 0x9cd2df59, 0x55f2733f,
+	0x1814ce79, 0x73c737bf, 0x53f7cdea, 0x5ffdaa5b, 0xdf3d6f14, 0x7844db86,
+	0xcaaff381, 0xb968c43e, 0x3824342c, 0xc2a3405f, 0x161dc372, 0xbce2250c,
+	0x283c498b, 0xff0d9541, 0x39a80171, 0x080cb3de, 0xd8b4e49c, 0x6456c190,
+	0x7bcb8461, 0xd532b670, 0x486c5c74, 0xd0b85742
+};
 
 #define mult8(a)(_double_byte(_double_byte(_double_byte(a))))
 #define mult9(a)(mult8(a)^(a))
@@ -78,57 +124,85 @@ static inline void mult_row_column(uint_least8_t *out, const uint_least8_t *in)
 	out[3] = multb(in[0]) ^ multd(in[1]) ^ mult9(in[2]) ^ multe(in[3]);
 }
 
-static inline void inv_mix_columns(uint_least8_t *s)
+/* InvMixColumns of a single column, held as a key schedule word. */
+static inline uint32_t inv_mix_column(uint32_t w)
+{
+	uint_least8_t in[Nb];
+	uint_least8_t out[Nb];
+
+	in[0] = (uint_least8_t)(w >> 24); in[1] = (uint_least8_t)(w >> 16);
+	in[2] = (uint_least8_t)(w >> 8); in[3] = (uint_least8_t)(w);
+	mult_row_column(out, in);
+	return ((uint32_t)out[0] << 24) | ((uint32_t)out[1] << 16) |
+	       ((uint32_t)out[2] << 8) | ((uint32_t)out[3]);
+}
+
+/*
+ * Turns an encryption schedule into one for the equivalent inverse cipher
+ * (FIPS-197 figure 15): InvMixColumns is linear, so it moves from the state
+ * into the round keys of rounds 1 to Nr - 1.
+ */
+static void inv_mix_round_keys(TCAesKeySched_t s)
 {
-	uint_least8_t t[Nb*Nk];
+	uint32_t i;
 
-	mult_row_column(t, s);
-	mult_row_column(&t[Nb], s+Nb);
-	mult_row_column(&t[2*Nb], s+(2*Nb));
-	mult_row_column(&t[3*Nb], s+(3*Nb));
-	(void)_copy(s, sizeof(t), t, sizeof(t));
+	for (i = Nb; i < Nb*s->rounds; ++i) {
+		s->words[i] = inv_mix_column(s->words[i]);
+	}
+	s->decrypt = 1;
 }
 
-static inline void add_round_key(uint_least8_t *s, const uint32_t *k)
+int tc_aes128_set_decrypt_key(TCAesKeySched_t s, const uint_least8_t *k)
 {
-	s[0] ^= (uint_least8_t)(k[0] >> 24); s[1] ^= (uint_least8_t)(k[0] >> 16);
-	s[2] ^= (uint_least8_t)(k[0] >> 8); s[3] ^= (uint_least8_t)(k[0]);
-	s[4] ^= (uint_least8_t)(k[1] >> 24); s[5] ^= (uint_least8_t)(k[1] >> 16);
-	s[6] ^= (uint_least8_t)(k[1] >> 8); s[7] ^= (uint_least8_t)(k[1]);
-	s[8] ^= (uint_least8_t)(k[2] >> 24); s[9] ^= (uint_least8_t)(k[2] >> 16);
-	s[10] ^= (uint_least8_t)(k[2] >> 8); s[11] ^= (uint_least8_t)(k[2]);
-	s[12] ^= (uint_least8_t)(k[3] >> 24); s[13] ^= (uint_least8_t)(k[3] >> 16);
-	s[14] ^= (uint_least8_t)(k[3] >> 8); s[15] ^= (uint_least8_t)(k[3]);
+	if (tc_aes128_set_encrypt_key(s, k) == TC_CRYPTO_FAIL) {
+		return TC_CRYPTO_FAIL;
+	}
+	inv_mix_round_keys(s);
+	return TC_CRYPTO_SUCCESS;
 }
 
-static inline void inv_sub_bytes(uint_least8_t *s)
+int tc_aes192_set_decrypt_key(TCAesKeySched_t s, const uint_least8_t *k)
 {
-	uint32_t i;
+	if (tc_aes192_set_encrypt_key(s, k) == TC_CRYPTO_FAIL) {
+		return TC_CRYPTO_FAIL;
+	}
+	inv_mix_round_keys(s);
+	return TC_CRYPTO_SUCCESS;
+}
 
-	for (i = 0; i < (Nb*Nk); ++i) {
-		s[i] = inv_sbox[s[i]];
+int tc_aes256_set_decrypt_key(TCAesKeySched_t s, const uint_least8_t *k)
+{
+	if (tc_aes256_set_encrypt_key(s, k) == TC_CRYPTO_FAIL) {
+		return TC_CRYPTO_FAIL;
 	}
+	inv_mix_round_keys(s);
+	return TC_CRYPTO_SUCCESS;
 }
 
+#define rotr(a, n)(((a) >> (n))|((a) << (32 - (n))))
+#define byte(a, o)(((a) >> (o))&0xff)
+
 /*
- * This inv_shift_rows also implements the matrix flip required for
- * inv_mix_columns, but performs it here to reduce the number of memory
- * operations.
+ * Column c of InvMixColumns(InvSubBytes(InvShiftRows(state))): InvShiftRows
+ * takes row r of the column from column c - r of the state.
  */
-static inline void inv_shift_rows(uint_least8_t *s)
-{
-	uint_least8_t t[Nb*Nk];
-
-	t[0]  = s[0]; t[1] = s[13]; t[2] = s[10]; t[3] = s[7];
-	t[4]  = s[4]; t[5] = s[1]; t[6] = s[14]; t[7] = s[11];
-	t[8]  = s[8]; t[9] = s[5]; t[10] = s[2]; t[11] = s[15];
-	t[12] = s[12]; t[13] = s[9]; t[14] = s[6]; t[15] = s[3];
-	(void)_copy(s, sizeof(t), t, sizeof(t));
-}
+#define inv_round_column(t, c) \
+	(Td[byte(t[(c)], 24)] ^ rotr(Td[byte(t[((c)+3)%Nb], 16)], 8) ^ \
+	 rotr(Td[byte(t[((c)+2)%Nb], 8)], 16) ^ \
+	 rotr(Td[byte(t[((c)+1)%Nb], 0)], 24))
+
+/* Column c of InvSubBytes(InvShiftRows(state)), for the last round. */
+#define inv_last_column(t, c) \
+	(((uint32_t)inv_sbox[byte(t[(c)], 24)] << 24) | \
+	 ((uint32_t)inv_sbox[byte(t[((c)+3)%Nb], 16)] << 16) | \
+	 ((uint32_t)inv_sbox[byte(t[((c)+2)%Nb], 8)] << 8) | \
+	 ((uint32_t)inv_sbox[byte(t[((c)+1)%Nb], 0)]))
 
 int tc_aes_decrypt(uint_least8_t *out, const uint_least8_t *in, const TCAesKeySched_t s)
 {
-	uint_least8_t state[Nk*Nb];
+	uint32_t state[Nb];
+	uint32_t t[Nb];
+	const uint32_t *k;
 	uint32_t i;
 
 	if (out == (uint_least8_t *) 0) {
@@ -137,28 +211,44 @@ int tc_aes_decrypt(uint_least8_t *out, const uint_least8_t *in, const TCAesKeySc
 		return TC_CRYPTO_FAIL;
 	} else if (s == (TCAesKeySched_t) 0) {
 		return TC_CRYPTO_FAIL;
+	} else if (s->rounds < Nr || s->rounds > TC_AES_MAX_ROUNDS) {
+		/* not set by a tc_aes*_set_*_key */
+		return TC_CRYPTO_FAIL;
+	} else if (!s->decrypt) {
+		/* an encryption schedule would give the wrong plaintext */
+		return TC_CRYPTO_FAIL;
 	}
 
-	(void)_copy(state, sizeof(state), in, sizeof(state));
-
-	add_round_key(state, s->words + Nb*Nr);
-
-	for (i = Nr - 1; i > 0; --i) {
-		inv_shift_rows(state);
-		inv_sub_bytes(state);
-		add_round_key(state, s->words + Nb*i);
-		inv_mix_columns(state);
+	k = s->words + Nb*s->rounds;
+	for (i = 0; i < Nb; ++i) {
+		state[i] = (((uint32_t)in[Nb*i]<<24) | ((uint32_t)in[Nb*i+1]<<16) |
+			    ((uint32_t)in[Nb*i+2]<<8) | ((uint32_t)in[Nb*i+3])) ^ k[i];
 	}
 
-	inv_shift_rows(state);
-	inv_sub_bytes(state);
-	add_round_key(state, s->words);
+	for (i = s->rounds - 1; i > 0; --i) {
+		k = s->words + Nb*i;
+		t[0] = state[0]; t[1] = state[1];
+		t[2] = state[2]; t[3] = state[3];
+		state[0] = inv_round_column(t, 0) ^ k[0];
+		state[1] = inv_round_column(t, 1) ^ k[1];
+		state[2] = inv_round_column(t, 2) ^ k[2];
+		state[3] = inv_round_column(t, 3) ^ k[3];
+	}
 
-	(void)_copy(out, sizeof(state), state, sizeof(state));
+	k = s->words;
+	t[0] = state[0]; t[1] = state[1];
+	t[2] = state[2]; t[3] = state[3];
+	for (i = 0; i < Nb; ++i) {
+		state[i] = inv_last_column(t, i) ^ k[i];
+		out[Nb*i] = (uint_least8_t)(state[i] >> 24);
+		out[Nb*i+1] = (uint_least8_t)(state[i] >> 16);
+		out[Nb*i+2] = (uint_least8_t)(state[i] >> 8);
+		out[Nb*i+3] = (uint_least8_t)(state[i]);
+	}
 
-	/*zeroing out the state buffer */
+	/*zeroing out the state buffers */
 	_set(state, TC_ZERO_BYTE, sizeof(state));
-
+	_set(t, TC_ZERO_BYTE, sizeof(t));
 
 	return TC_CRYPTO_SUCCESS;
 }
@@ -34,6 +34,419 @@
 #include <tinycrypt/utils.h>
 #include <tinycrypt/constants.h>
 
+#if TC_AES_BITSLICED
+
+/*
+ * Bitsliced AES (Kasper and Schwabe; here in the 64-bit layout of four blocks
+ * per eight words). Bit i of every state byte of the four blocks lives in
+ * q[i]: the 16-bit group k of q[i] holds row k of the states, four bits per
+ * column, one bit per block. SubBytes then becomes the S-box circuit below
+ * evaluated on all 128 bytes at once, ShiftRows a permutation of bits within
+ * each word and MixColumns rotations and XORs of whole words. Nothing is
+ * indexed by key or data, and every block costs the same time.
+ */
+
+#define SWAPN(cl, ch, s, x, y) do { \
+		uint64_t a_ = (x), b_ = (y); \
+		(x) = (a_ & (uint64_t)(cl)) | ((b_ & (uint64_t)(cl)) << (s)); \
+		(y) = ((a_ & (uint64_t)(ch)) >> (s)) | (b_ & (uint64_t)(ch)); \
+	} while (0)
+
+#define SWAP2(x, y) SWAPN(0x5555555555555555, 0xAAAAAAAAAAAAAAAA, 1, x, y)
+#define SWAP4(x, y) SWAPN(0x3333333333333333, 0xCCCCCCCCCCCCCCCC, 2, x, y)
+#define SWAP8(x, y) SWAPN(0x0F0F0F0F0F0F0F0F, 0xF0F0F0F0F0F0F0F0, 4, x, y)
+
+/*
+ * Transposes the 8x8 bit matrices formed by the same byte of the eight words:
+ * bit i of byte b of q[j] is exchanged with bit j of byte b of q[i]. The
+ * transposition is its own inverse.
+ */
+static void ortho(uint64_t *q)
+{
+	SWAP2(q[0], q[1]); SWAP2(q[2], q[3]); SWAP2(q[4], q[5]); SWAP2(q[6], q[7]);
+	SWAP4(q[0], q[2]); SWAP4(q[1], q[3]); SWAP4(q[4], q[6]); SWAP4(q[5], q[7]);
+	SWAP8(q[0], q[4]); SWAP8(q[1], q[5]); SWAP8(q[2], q[6]); SWAP8(q[3], q[7]);
+}
+
+/*
+ * Spreads the four little-endian column words of a block over two words, so
+ * that ortho then leaves each byte of the state in its row group.
+ */
+static void interleave_in(uint64_t *q0, uint64_t *q1, const uint32_t *w)
+{
+	uint64_t x0 = w[0], x1 = w[1], x2 = w[2], x3 = w[3];
+
+	x0 |= (x0 << 16); x1 |= (x1 << 16); x2 |= (x2 << 16); x3 |= (x3 << 16);
+	x0 &= 0x0000FFFF0000FFFF; x1 &= 0x0000FFFF0000FFFF;
+	x2 &= 0x0000FFFF0000FFFF; x3 &= 0x0000FFFF0000FFFF;
+	x0 |= (x0 << 8); x1 |= (x1 << 8); x2 |= (x2 << 8); x3 |= (x3 << 8);
+	x0 &= 0x00FF00FF00FF00FF; x1 &= 0x00FF00FF00FF00FF;
+	x2 &= 0x00FF00FF00FF00FF; x3 &= 0x00FF00FF00FF00FF;
+	*q0 = x0 | (x2 << 8);
+	*q1 = x1 | (x3 << 8);
+}
+
+/* The inverse of interleave_in. */
+static void interleave_out(uint32_t *w, uint64_t q0, uint64_t q1)
+{
+	uint64_t x0, x1, x2, x3;
+
+	x0 = q0 & 0x00FF00FF00FF00FF;
+	x1 = q1 & 0x00FF00FF00FF00FF;
+	x2 = (q0 >> 8) & 0x00FF00FF00FF00FF;
+	x3 = (q1 >> 8) & 0x00FF00FF00FF00FF;
+	x0 |= (x0 >> 8); x1 |= (x1 >> 8); x2 |= (x2 >> 8); x3 |= (x3 >> 8);
+	x0 &= 0x0000FFFF0000FFFF; x1 &= 0x0000FFFF0000FFFF;
+	x2 &= 0x0000FFFF0000FFFF; x3 &= 0x0000FFFF0000FFFF;
+	w[0] = (uint32_t)x0 | (uint32_t)(x0 >> 16);
+	w[1] = (uint32_t)x1 | (uint32_t)(x1 >> 16);
+	w[2] = (uint32_t)x2 | (uint32_t)(x2 >> 16);
+	w[3] = (uint32_t)x3 | (uint32_t)(x3 >> 16);
+}
+
+/*
+ * The AES S-box as the 113-gate circuit of Boyar and Peralta ("A depth-16
+ * circuit for the AES S-box"), applied to every bit position of q at once;
+ * q[7] holds the most significant bits.
+ */
+static void sub_bytes(uint64_t *q)
+{
+	uint64_t x0, x1, x2, x3, x4, x5, x6, x7;
+	uint64_t y1, y2, y3, y4, y5, y6, y7, y8, y9;
+	uint64_t y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+	uint64_t y20, y21;
+	uint64_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+	uint64_t z10, z11, z12, z13, z14, z15, z16, z17;
+	uint64_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+	uint64_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+	uint64_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+	uint64_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+	uint64_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+	uint64_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+	uint64_t t60, t61, t62, t63, t64, t65, t66, t67;
+	uint64_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+	x0 = q[7]; x1 = q[6]; x2 = q[5]; x3 = q[4];
+	x4 = q[3]; x5 = q[2]; x6 = q[1]; x7 = q[0];
+
+	/* top linear transformation: */
+	y14 = x3 ^ x5;
+	y13 = x0 ^ x6;
+	y9 = x0 ^ x3;
+	y8 = x0 ^ x5;
+	t0 = x1 ^ x2;
+	y1 = t0 ^ x7;
+	y4 = y1 ^ x3;
+	y12 = y13 ^ y14;
+	y2 = y1 ^ x0;
+	y5 = y1 ^ x6;
+	y3 = y5 ^ y8;
+	t1 = x4 ^ y12;
+	y15 = t1 ^ x5;
+	y20 = t1 ^ x1;
+	y6 = y15 ^ x7;
+	y10 = y15 ^ t0;
+	y11 = y20 ^ y9;
+	y7 = x7 ^ y11;
+	y17 = y10 ^ y11;
+	y19 = y10 ^ y8;
+	y16 = t0 ^ y11;
+	y21 = y13 ^ y16;
+	y18 = x0 ^ y16;
+
+	/* non-linear section (inversion in GF(2^8) through GF(2^4)): */
+	t2 = y12 & y15;
+	t3 = y3 & y6;
+	t4 = t3 ^ t2;
+	t5 = y4 & x7;
+	t6 = t5 ^ t2;
+	t7 = y13 & y16;
+	t8 = y5 & y1;
+	t9 = t8 ^ t7;
+	t10 = y2 & y7;
+	t11 = t10 ^ t7;
+	t12 = y9 & y11;
+	t13 = y14 & y17;
+	t14 = t13 ^ t12;
+	t15 = y8 & y10;
+	t16 = t15 ^ t12;
+	t17 = t4 ^ t14;
+	t18 = t6 ^ t16;
+	t19 = t9 ^ t14;
+	t20 = t11 ^ t16;
+	t21 = t17 ^ y20;
+	t22 = t18 ^ y19;
+	t23 = t19 ^ y21;
+	t24 = t20 ^ y18;
+
+	t25 = t21 ^ t22;
+	t26 = t21 & t23;
+	t27 = t24 ^ t26;
+	t28 = t25 & t27;
+	t29 = t28 ^ t22;
+	t30 = t23 ^ t24;
+	t31 = t22 ^ t26;
+	t32 = t31 & t30;
+	t33 = t32 ^ t24;
+	t34 = t23 ^ t33;
+	t35 = t27 ^ t33;
+	t36 = t24 & t35;
+	t37 = t36 ^ t34;
+	t38 = t27 ^ t36;
+	t39 = t29 & t38;
+	t40 = t25 ^ t39;
+
+	t41 = t40 ^ t37;
+	t42 = t29 ^ t33;
+	t43 = t29 ^ t40;
+	t44 = t33 ^ t37;
+	t45 = t42 ^ t41;
+	z0 = t44 & y15;
+	z1 = t37 & y6;
+	z2 = t33 & x7;
+	z3 = t43 & y16;
+	z4 = t40 & y1;
+	z5 = t29 & y7;
+	z6 = t42 & y11;
+	z7 = t45 & y17;
+	z8 = t41 & y10;
+	z9 = t44 & y12;
+	z10 = t37 & y3;
+	z11 = t33 & y4;
+	z12 = t43 & y13;
+	z13 = t40 & y5;
+	z14 = t29 & y2;
+	z15 = t42 & y9;
+	z16 = t45 & y14;
+	z17 = t41 & y8;
+
+	/* bottom linear transformation (with the affine constant 0x63): */
+	t46 = z15 ^ z16;
+	t47 = z10 ^ z11;
+	t48 = z5 ^ z13;
+	t49 = z9 ^ z10;
+	t50 = z2 ^ z12;
+	t51 = z2 ^ z5;
+	t52 = z7 ^ z8;
+	t53 = z0 ^ z3;
+	t54 = z6 ^ z7;
+	t55 = z16 ^ z17;
+	t56 = z12 ^ t48;
+	t57 = t50 ^ t53;
+	t58 = z4 ^ t46;
+	t59 = z3 ^ t54;
+	t60 = t46 ^ t57;
+	t61 = z14 ^ t57;
+	t62 = t52 ^ t58;
+	t63 = t49 ^ t58;
+	t64 = z4 ^ t59;
+	t65 = t61 ^ t62;
+	t66 = z1 ^ t63;
+	s0 = t59 ^ t63;
+	s6 = t56 ^ ~t62;
+	s7 = t48 ^ ~t60;
+	t67 = t64 ^ t65;
+	s3 = t53 ^ t66;
+	s4 = t51 ^ t66;
+	s5 = t47 ^ t65;
+	s1 = t64 ^ ~s3;
+	s2 = t55 ^ ~t67;
+
+	q[7] = s0; q[6] = s1; q[5] = s2; q[4] = s3;
+	q[3] = s4; q[2] = s5; q[1] = s6; q[0] = s7;
+}
+
+/* SubWord of the key expansion, through the same circuit: */
+static uint32_t sub_word(uint32_t a)
+{
+	uint64_t q[8];
+
+	_set(q, 0, sizeof(q));
+	q[0] = a;
+	ortho(q);
+	sub_bytes(q);
+	ortho(q);
+	return (uint32_t)q[0];
+}
+
+#define subword(a) sub_word(a)
+
+static inline uint32_t swap_bytes(uint32_t a)
+{
+	return (a >> 24) | ((a >> 8) & 0x0000ff00) | ((a << 8) & 0x00ff0000) |
+	       (a << 24);
+}
+
+/*
+ * Stores the round keys of s in bitsliced order. A round key is the same for
+ * the four blocks, so each of its bits fills four bit positions of a word:
+ * only one of them needs to be kept, and q[0..3] (q[4..7]) are compressed
+ * into a single word by taking bit j of every nibble from q[j] (q[4+j]).
+ */
+static void bitslice_round_keys(TCAesKeySched_t s)
+{
+	uint64_t q[8];
+	uint32_t w[Nb];
+	uint32_t i;
+	uint32_t j;
+
+	for (i = 0; i <= s->rounds; ++i) {
+		for (j = 0; j < Nb; ++j) {
+			w[j] = swap_bytes(s->words[Nb*i+j]);
+		}
+		interleave_in(&q[0], &q[4], w);
+		q[1] = q[2] = q[3] = q[0];
+		q[5] = q[6] = q[7] = q[4];
+		ortho(q);
+		s->bitsliced[2*i] =
+			(q[0] & 0x1111111111111111) | (q[1] & 0x2222222222222222) |
+			(q[2] & 0x4444444444444444) | (q[3] & 0x8888888888888888);
+		s->bitsliced[2*i+1] =
+			(q[4] & 0x1111111111111111) | (q[5] & 0x2222222222222222) |
+			(q[6] & 0x4444444444444444) | (q[7] & 0x8888888888888888);
+	}
+
+	_set(q, 0, sizeof(q));
+	_set(w, 0, sizeof(w));
+}
+
+/* Undoes the compression of bitslice_round_keys: k receives 8 words a round. */
+static void expand_round_keys(uint64_t *k, const TCAesKeySched_t s)
+{
+	uint64_t x0, x1, x2, x3;
+	uint32_t i;
+
+	for (i = 0; i < 2*(s->rounds+1); ++i, k += 4) {
+		x0 = s->bitsliced[i] & 0x1111111111111111;
+		x1 = (s->bitsliced[i] & 0x2222222222222222) >> 1;
+		x2 = (s->bitsliced[i] & 0x4444444444444444) >> 2;
+		x3 = (s->bitsliced[i] & 0x8888888888888888) >> 3;
+		k[0] = (x0 << 4) - x0;
+		k[1] = (x1 << 4) - x1;
+		k[2] = (x2 << 4) - x2;
+		k[3] = (x3 << 4) - x3;
+	}
+}
+
+static inline void add_round_key(uint64_t *q, const uint64_t *k)
+{
+	q[0] ^= k[0]; q[1] ^= k[1]; q[2] ^= k[2]; q[3] ^= k[3];
+	q[4] ^= k[4]; q[5] ^= k[5]; q[6] ^= k[6]; q[7] ^= k[7];
+}
+
+static inline void shift_rows(uint64_t *q)
+{
+	uint64_t x;
+	uint32_t i;
+
+	for (i = 0; i < 8; ++i) {
+		x = q[i];
+		q[i] = (x & 0x000000000000FFFF) |
+		       ((x & 0x00000000FFF00000) >> 4) |
+		       ((x & 0x00000000000F0000) << 12) |
+		       ((x & 0x0000FF0000000000) >> 8) |
+		       ((x & 0x000000FF00000000) << 8) |
+		       ((x & 0xF000000000000000) >> 12) |
+		       ((x & 0x0FFF000000000000) << 4);
+	}
+}
+
+static inline uint64_t rotr32(uint64_t x)
+{
+	return (x << 32) | (x >> 32);
+}
+
+/*
+ * With r = the state rotated by one row, column by column
+ * MixColumns(s) = 2(s + r) + r + rotr32(s + r): doubling moves each bit plane
+ * up by one and folds q[7] into the planes of 0x1b.
+ */
+static inline void mix_columns(uint64_t *q)
+{
+	uint64_t q0, q1, q2, q3, q4, q5, q6, q7;
+	uint64_t r0, r1, r2, r3, r4, r5, r6, r7;
+
+	q0 = q[0]; q1 = q[1]; q2 = q[2]; q3 = q[3];
+	q4 = q[4]; q5 = q[5]; q6 = q[6]; q7 = q[7];
+	r0 = (q0 >> 16) | (q0 << 48);
+	r1 = (q1 >> 16) | (q1 << 48);
+	r2 = (q2 >> 16) | (q2 << 48);
+	r3 = (q3 >> 16) | (q3 << 48);
+	r4 = (q4 >> 16) | (q4 << 48);
+	r5 = (q5 >> 16) | (q5 << 48);
+	r6 = (q6 >> 16) | (q6 << 48);
+	r7 = (q7 >> 16) | (q7 << 48);
+
+	q[0] = q7 ^ r7 ^ r0 ^ rotr32(q0 ^ r0);
+	q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ rotr32(q1 ^ r1);
+	q[2] = q1 ^ r1 ^ r2 ^ rotr32(q2 ^ r2);
+	q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ rotr32(q3 ^ r3);
+	q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ rotr32(q4 ^ r4);
+	q[5] = q4 ^ r4 ^ r5 ^ rotr32(q5 ^ r5);
+	q[6] = q5 ^ r5 ^ r6 ^ rotr32(q6 ^ r6);
+	q[7] = q6 ^ r6 ^ r7 ^ rotr32(q7 ^ r7);
+}
+
+/*
+ * Encrypts num_blocks blocks, TC_AES_PARALLEL_BLOCKS at a time; a last,
+ * partial group is padded with zero blocks whose output is dropped.
+ */
+static void encrypt_blocks(uint_least8_t *out, const uint_least8_t *in,
+			   uint32_t num_blocks, const TCAesKeySched_t s)
+{
+	uint64_t k[8*(TC_AES_MAX_ROUNDS+1)];
+	uint64_t q[8];
+	uint32_t w[Nb*TC_AES_PARALLEL_BLOCKS];
+	uint32_t n;
+	uint32_t i;
+
+	expand_round_keys(k, s);
+
+	for (; num_blocks > 0; num_blocks -= n) {
+		n = (num_blocks < TC_AES_PARALLEL_BLOCKS) ?
+			num_blocks : TC_AES_PARALLEL_BLOCKS;
+
+		_set(w, 0, sizeof(w));
+		for (i = 0; i < Nb*n; ++i, in += 4) {
+			w[i] = (uint32_t)in[0] | ((uint32_t)in[1] << 8) |
+			       ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+		}
+		for (i = 0; i < TC_AES_PARALLEL_BLOCKS; ++i) {
+			interleave_in(&q[i], &q[i+4], &w[Nb*i]);
+		}
+		ortho(q);
+
+		add_round_key(q, k);
+		for (i = 1; i < s->rounds; ++i) {
+			sub_bytes(q);
+			shift_rows(q);
+			mix_columns(q);
+			add_round_key(q, k + 8*i);
+		}
+		sub_bytes(q);
+		shift_rows(q);
+		add_round_key(q, k + 8*i);
+
+		ortho(q);
+		for (i = 0; i < TC_AES_PARALLEL_BLOCKS; ++i) {
+			interleave_out(&w[Nb*i], q[i], q[i+4]);
+		}
+		for (i = 0; i < Nb*n; ++i, out += 4) {
+			out[0] = (uint_least8_t)(w[i]);
+			out[1] = (uint_least8_t)(w[i] >> 8);
+			out[2] = (uint_least8_t)(w[i] >> 16);
+			out[3] = (uint_least8_t)(w[i] >> 24);
+		}
+	}
+
+	/* zeroing out the state and the expanded round keys */
+	_set(w, 0, sizeof(w));
+	_set(q, 0, sizeof(q));
+	_set(k, 0, sizeof(k));
+}
+
+#else
+
 static const uint_least8_t sbox[256] = {
 	0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b,
 	0xfe, 0xd7, 0xab, 0x76, 0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0,
@@ -59,45 +472,9 @@ static const uint_least8_t sbox[256] = {
 	0xb0, 0x54, 0xbb, 0x16
 };
 
-static inline uint32_t rotword(uint32_t a)
-{
-	return (((a) >> 24)|((a) << 8));
-}
-
 #define subbyte(a, o)(sbox[((a) >> (o))&0xff] << (o))
 #define subword(a)(subbyte(a, 24)|subbyte(a, 16)|subbyte(a, 8)|subbyte(a, 0))
 
-int tc_aes128_set_encrypt_key(TCAesKeySched_t s, const uint_least8_t *k)
-{
-	const uint32_t rconst[11] = {
-		0x00000000, 0x01000000, 0x02000000, 0x04000000, 0x08000000, 0x10000000,
-		0x20000000, 0x40000000, 0x80000000, 0x1b000000, 0x36000000
-	};
-	uint32_t i;
-	uint32_t t;
-
-	if (s == (TCAesKeySched_t) 0) {
-		return TC_CRYPTO_FAIL;
-	} else if (k == (const uint_least8_t *) 0) {
-		return TC_CRYPTO_FAIL;
-	}
-
-	for (i = 0; i < Nk; ++i) {
-		s->words[i] = ((uint32_t)k[Nb*i]<<24) | ((uint32_t)k[Nb*i+1]<<16) |
-			      ((uint32_t)k[Nb*i+2]<<8) | ((uint32_t)k[Nb*i+3]);
-	}
-
-	for (; i < (Nb * (Nr + 1)); ++i) {
-		t = s->words[i-1];
-		if ((i % Nk) == 0) {
-			t = subword(rotword(t)) ^ rconst[i/Nk];
-		}
-		s->words[i] = s->words[i-Nk] ^ t;
-	}
-
-	return TC_CRYPTO_SUCCESS;
-}
-
 static inline void add_round_key(uint_least8_t *s, const uint32_t *k)
 {
 	s[0] ^= (uint_least8_t)(k[0] >> 24); s[1] ^= (uint_least8_t)(k[0] >> 16);
@@ -155,37 +532,143 @@ static inline void shift_rows(uint_least8_t *s)
 	(void) _copy(s, sizeof(t), t, sizeof(t));
 }
 
-int tc_aes_encrypt(uint_least8_t *out, const uint_least8_t *in, const TCAesKeySched_t s)
+static void encrypt_blocks(uint_least8_t *out, const uint_least8_t *in,
+			   uint32_t num_blocks, const TCAesKeySched_t s)
 {
 	uint_least8_t state[Nk*Nb];
 	uint32_t i;
 
+	for (; num_blocks > 0; --num_blocks) {
+		(void)_copy(state, sizeof(state), in, sizeof(state));
+		add_round_key(state, s->words);
+
+		for (i = 0; i < (s->rounds - 1); ++i) {
+			sub_bytes(state);
+			shift_rows(state);
+			mix_columns(state);
+			add_round_key(state, s->words + Nb*(i+1));
+		}
+
+		sub_bytes(state);
+		shift_rows(state);
+		add_round_key(state, s->words + Nb*(i+1));
+
+		(void)_copy(out, sizeof(state), state, sizeof(state));
+		in += sizeof(state);
+		out += sizeof(state);
+	}
+
+	/* zeroing out the state buffer */
+	_set(state, TC_ZERO_BYTE, sizeof(state));
+}
+
+#endif /* TC_AES_BITSLICED */
+
+static inline uint32_t rotword(uint32_t a)
+{
+	return (((a) >> 24)|((a) << 8));
+}
+
+/*
+ * Key expansion (FIPS 197 section 5.2) of a key of nk 32-bit words into the
+ * round keys of nk + 6 rounds.
+ */
+static int set_encrypt_key(TCAesKeySched_t s, const uint_least8_t *k,
+			   uint32_t nk)
+{
+	const uint32_t rconst[11] = {
+		0x00000000, 0x01000000, 0x02000000, 0x04000000, 0x08000000, 0x10000000,
+		0x20000000, 0x40000000, 0x80000000, 0x1b000000, 0x36000000
+	};
+	uint32_t i;
+	uint32_t t;
+
+	if (s == (TCAesKeySched_t) 0) {
+		return TC_CRYPTO_FAIL;
+	} else if (k == (const uint_least8_t *) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	s->rounds = nk + 6;
+	s->decrypt = 0;
+
+	for (i = 0; i < nk; ++i) {
+		s->words[i] = ((uint32_t)k[Nb*i]<<24) | ((uint32_t)k[Nb*i+1]<<16) |
+			      ((uint32_t)k[Nb*i+2]<<8) | ((uint32_t)k[Nb*i+3]);
+	}
+
+	for (; i < (Nb * (s->rounds + 1)); ++i) {
+		t = s->words[i-1];
+		if ((i % nk) == 0) {
+			t = subword(rotword(t)) ^ rconst[i/nk];
+		} else if (nk > 6 && (i % nk) == 4) {
+			/* AES-256 only */
+			t = subword(t);
+		}
+		s->words[i] = s->words[i-nk] ^ t;
+	}
+
+#if TC_AES_BITSLICED
+	bitslice_round_keys(s);
+#endif
+
+	return TC_CRYPTO_SUCCESS;
+}
+
+int tc_aes128_set_encrypt_key(TCAesKeySched_t s, const uint_least8_t *k)
+{
+	return set_encrypt_key(s, k, TC_AES_KEY_SIZE / Nb);
+}
+
+int tc_aes192_set_encrypt_key(TCAesKeySched_t s, const uint_least8_t *k)
+{
+	return set_encrypt_key(s, k, TC_AES192_KEY_SIZE / Nb);
+}
+
+int tc_aes256_set_encrypt_key(TCAesKeySched_t s, const uint_least8_t *k)
+{
+	return set_encrypt_key(s, k, TC_AES256_KEY_SIZE / Nb);
+}
+
+int tc_aes_encrypt(uint_least8_t *out, const uint_least8_t *in, const TCAesKeySched_t s)
+{
 	if (out == (uint_least8_t *) 0) {
 		return TC_CRYPTO_FAIL;
 	} else if (in == (const uint_least8_t *) 0) {
 		return TC_CRYPTO_FAIL;
 	} else if (s == (TCAesKeySched_t) 0) {
 		return TC_CRYPTO_FAIL;
+	} else if (s->rounds < Nr || s->rounds > TC_AES_MAX_ROUNDS) {
+		/* not set by a tc_aes*_set_*_key */
+		return TC_CRYPTO_FAIL;
+	} else if (s->decrypt) {
+		/* the middle round keys went through InvMixColumns */
+		return TC_CRYPTO_FAIL;
 	}
 
-	(void)_copy(state, sizeof(state), in, sizeof(state));
-	add_round_key(state, s->words);
+	encrypt_blocks(out, in, 1, s);
 
-	for (i = 0; i < (Nr - 1); ++i) {
-		sub_bytes(state);
-		shift_rows(state);
-		mix_columns(state);
-		add_round_key(state, s->words + Nb*(i+1));
-	}
-
-	sub_bytes(state);
-	shift_rows(state);
-	add_round_key(state, s->words + Nb*(i+1));
+	return TC_CRYPTO_SUCCESS;
+}
 
-	(void)_copy(out, sizeof(state), state, sizeof(state));
+int tc_aes_encrypt_blocks(uint_least8_t *out, const uint_least8_t *in,
+			  uint32_t num_blocks, const TCAesKeySched_t s)
+{
+	if (out == (uint_least8_t *) 0) {
+		return TC_CRYPTO_FAIL;
+	} else if (in == (const uint_least8_t *) 0) {
+		return TC_CRYPTO_FAIL;
+	} else if (s == (TCAesKeySched_t) 0) {
+		return TC_CRYPTO_FAIL;
+	} else if (s->rounds < Nr || s->rounds > TC_AES_MAX_ROUNDS) {
+		return TC_CRYPTO_FAIL;
+	} else if (s->decrypt) {
+		return TC_CRYPTO_FAIL;
+	} else if (num_blocks == 0) {
+		return TC_CRYPTO_FAIL;
+	}
 
-	/* zeroing out the state buffer */
-	_set(state, TC_ZERO_BYTE, sizeof(state));
+	encrypt_blocks(out, in, num_blocks, s);
 
 	return TC_CRYPTO_SUCCESS;
 }
@@ -94,10 +94,13 @@ static int ccm_ctr_mode(uint_least8_t *out, uint32_t outlen, const uint_least8_t
 			uint32_t inlen, uint_least8_t *ctr, const TCAesKeySched_t sched)
 {
 
-	uint_least8_t buffer[TC_AES_BLOCK_SIZE];
-	uint_least8_t nonce[TC_AES_BLOCK_SIZE];
+	uint_least8_t buffer[TC_AES_BLOCK_SIZE*TC_AES_PARALLEL_BLOCKS];
+	uint_least8_t nonce[TC_AES_BLOCK_SIZE*TC_AES_PARALLEL_BLOCKS];
+	uint_least8_t *n;
 	uint16_t block_num;
+	uint32_t blocks;
 	uint32_t i;
+	uint32_t j;
 
 	/* input sanity check: */
 	if (out == (uint_least8_t *) 0 ||
@@ -110,26 +113,33 @@ static int ccm_ctr_mode(uint_least8_t *out, uint32_t outlen, const uint_least8_t
 		return TC_CRYPTO_FAIL;
 	}
 
-	/* copy the counter to the nonce */
-	(void) _copy(nonce, sizeof(nonce), ctr, sizeof(nonce));
-
-	/* select the last 2 bytes of the nonce to be incremented */
-	block_num = (uint16_t) ((nonce[14] << 8)|(nonce[15]));
+	/* select the last 2 bytes of the counter to be incremented */
+	block_num = (uint16_t) ((ctr[14] << 8)|(ctr[15]));
 	for (i = 0; i < inlen; ++i) {
-		if ((i % (TC_AES_BLOCK_SIZE)) == 0) {
-			block_num++;
-			nonce[14] = (uint_least8_t)(block_num >> 8);
-			nonce[15] = (uint_least8_t)(block_num);
-			if (!tc_aes_encrypt(buffer, nonce, sched)) {
+		if ((i % sizeof(buffer)) == 0) {
+			/* lay out the nonces of up to TC_AES_PARALLEL_BLOCKS blocks */
+			blocks = (inlen - i - 1) / TC_AES_BLOCK_SIZE + 1;
+			if (blocks > TC_AES_PARALLEL_BLOCKS) {
+				blocks = TC_AES_PARALLEL_BLOCKS;
+			}
+			for (j = 0, n = nonce; j < blocks; ++j, n += TC_AES_BLOCK_SIZE) {
+				block_num++;
+				(void) _copy(n, TC_AES_BLOCK_SIZE - 2, ctr,
+					     TC_AES_BLOCK_SIZE - 2);
+				n[14] = (uint_least8_t)(block_num >> 8);
+				n[15] = (uint_least8_t)(block_num);
+			}
+			if (!tc_aes_encrypt_blocks(buffer, nonce, blocks, sched)) {
 				return TC_CRYPTO_FAIL;
 			}
 		}
 		/* update the output */
-		*out++ = buffer[i % (TC_AES_BLOCK_SIZE)] ^ *in++;
+		*out++ = buffer[i % sizeof(buffer)] ^ *in++;
 	}
 
 	/* update the counter */
-	ctr[14] = nonce[14]; ctr[15] = nonce[15];
+	ctr[14] = (uint_least8_t)(block_num >> 8);
+	ctr[15] = (uint_least8_t)(block_num);
 
 	return TC_CRYPTO_SUCCESS;
 }
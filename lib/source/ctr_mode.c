@@ -38,10 +38,13 @@ int tc_ctr_mode(uint_least8_t *out, uint32_t outlen, const uint_least8_t *in,
 		uint32_t inlen, uint_least8_t *ctr, const TCAesKeySched_t sched)
 {
 
-	uint_least8_t buffer[TC_AES_BLOCK_SIZE];
-	uint_least8_t nonce[TC_AES_BLOCK_SIZE];
+	uint_least8_t buffer[TC_AES_BLOCK_SIZE*TC_AES_PARALLEL_BLOCKS];
+	uint_least8_t nonce[TC_AES_BLOCK_SIZE*TC_AES_PARALLEL_BLOCKS];
+	uint_least8_t *n;
 	uint32_t block_num;
+	uint32_t blocks;
 	uint32_t i;
+	uint32_t j;
 
 	/* input sanity check: */
 	if (out == (uint_least8_t *) 0 ||
@@ -54,32 +57,39 @@ int tc_ctr_mode(uint_least8_t *out, uint32_t outlen, const uint_least8_t *in,
 		return TC_CRYPTO_FAIL;
 	}
 
-	/* copy the ctr to the nonce */
-	(void)_copy(nonce, sizeof(nonce), ctr, sizeof(nonce));
-
-	/* select the last 4 bytes of the nonce to be incremented */
-	block_num = ((uint32_t)nonce[12] << 24) | ((uint32_t)nonce[13] << 16) |
-		    ((uint32_t)nonce[14] << 8) | ((uint32_t)nonce[15]);
+	/* select the last 4 bytes of the ctr to be incremented */
+	block_num = ((uint32_t)ctr[12] << 24) | ((uint32_t)ctr[13] << 16) |
+		    ((uint32_t)ctr[14] << 8) | ((uint32_t)ctr[15]);
 	for (i = 0; i < inlen; ++i) {
-		if ((i % (TC_AES_BLOCK_SIZE)) == 0) {
-			/* encrypt data using the current nonce */
-			if (tc_aes_encrypt(buffer, nonce, sched)) {
+		if ((i % sizeof(buffer)) == 0) {
+			/* lay out the nonces of up to TC_AES_PARALLEL_BLOCKS blocks */
+			blocks = (inlen - i - 1) / TC_AES_BLOCK_SIZE + 1;
+			if (blocks > TC_AES_PARALLEL_BLOCKS) {
+				blocks = TC_AES_PARALLEL_BLOCKS;
+			}
+			for (j = 0, n = nonce; j < blocks; ++j, n += TC_AES_BLOCK_SIZE) {
+				(void)_copy(n, TC_AES_BLOCK_SIZE - 4, ctr,
+					    TC_AES_BLOCK_SIZE - 4);
+				n[12] = (uint_least8_t)(block_num >> 24);
+				n[13] = (uint_least8_t)(block_num >> 16);
+				n[14] = (uint_least8_t)(block_num >> 8);
+				n[15] = (uint_least8_t)(block_num);
 				block_num++;
-				nonce[12] = (uint_least8_t)(block_num >> 24);
-				nonce[13] = (uint_least8_t)(block_num >> 16);
-				nonce[14] = (uint_least8_t)(block_num >> 8);
-				nonce[15] = (uint_least8_t)(block_num);
-			} else {
+			}
+			/* encrypt data using the current nonces */
+			if (!tc_aes_encrypt_blocks(buffer, nonce, blocks, sched)) {
 				return TC_CRYPTO_FAIL;
 			}
 		}
 		/* update the output */
-		*out++ = buffer[i%(TC_AES_BLOCK_SIZE)] ^ *in++;
+		*out++ = buffer[i%sizeof(buffer)] ^ *in++;
 	}
 
 	/* update the counter */
-	ctr[12] = nonce[12]; ctr[13] = nonce[13];
-	ctr[14] = nonce[14]; ctr[15] = nonce[15];
+	ctr[12] = (uint_least8_t)(block_num >> 24);
+	ctr[13] = (uint_least8_t)(block_num >> 16);
+	ctr[14] = (uint_least8_t)(block_num >> 8);
+	ctr[15] = (uint_least8_t)(block_num);
 
 	return TC_CRYPTO_SUCCESS;
 }
@@ -272,7 +272,7 @@ int tc_ctr_prng_generate(TCCtrPrng_t * const ctx,
 void tc_ctr_prng_uninstantiate(TCCtrPrng_t * const ctx)
 {
 	if (0 != ctx) {
-		memset(ctx->key.words, 0x00, sizeof ctx->key.words);
+		memset(&ctx->key,      0x00, sizeof ctx->key);
 		memset(ctx->V,         0x00, sizeof ctx->V);
 		ctx->reseedCount = 0U;
 	}
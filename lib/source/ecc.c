@@ -56,6 +56,10 @@
 #include <tinycrypt/ecc_platform_specific.h>
 #include <string.h>
 
+#if uECC_FIXED_BASE_TABLE
+#include "ecc_secp256r1_table.h"
+#endif
+
 /* IMPORTANT: Make sure a cryptographically-secure PRNG is set and the platform
  * has access to enough entropy in order to feed the PRNG regularly. */
 #if default_RNG_defined
@@ -74,6 +78,29 @@ uECC_RNG_Function uECC_get_rng(void)
 	return g_rng_function;
 }
 
+int uECC_ctx_init(uECC_Ctx *ctx, uECC_CtxRNG_Function rng, void *rng_state)
+{
+	if (!ctx) {
+		return 0;
+	}
+	ctx->rng = rng;
+	ctx->rng_state = rng_state;
+	return 1;
+}
+
+int uECC_ctx_has_rng(const uECC_Ctx *ctx)
+{
+	return ctx ? ctx->rng != 0 : g_rng_function != 0;
+}
+
+int uECC_ctx_random(const uECC_Ctx *ctx, uint_least8_t *dest, uint32_t size)
+{
+	if (ctx) {
+		return ctx->rng && ctx->rng(ctx->rng_state, dest, size);
+	}
+	return g_rng_function && g_rng_function(dest, size);
+}
+
 int uECC_curve_private_key_size(uECC_Curve curve)
 {
 	return BITS_TO_BYTES(curve->num_n_bits);
@@ -84,6 +111,11 @@ int uECC_curve_public_key_size(uECC_Curve curve)
 	return 2 * curve->num_bytes;
 }
 
+int uECC_curve_compressed_public_key_size(uECC_Curve curve)
+{
+	return curve->num_bytes + 1;
+}
+
 void uECC_vli_clear(uECC_word_t *vli, wordcount_t num_words)
 {
 	wordcount_t i;
@@ -242,19 +274,331 @@ static void uECC_vli_rshift1(uECC_word_t *vli, wordcount_t num_words)
 	}
 }
 
-static void muladd(uECC_word_t a, uECC_word_t b, uECC_word_t *r0,
-		   uECC_word_t *r1, uECC_word_t *r2)
+/*
+ * Product scanning (Comba): the columns of a product are accumulated in the
+ * three words r0, r1, r2, and each finished column is stored while the
+ * accumulator shifts down by a word. Written as macros so that the unrolled
+ * 64-bit routines below compile to straight carry chains (mul/adc, or
+ * mulx/adcx/adox where the compiler may use them).
+ */
+#define COMBA_MULADD(a, b) do { \
+	uECC_dword_t p_ = (uECC_dword_t)(a) * (b); \
+	uECC_dword_t r01_ = ((uECC_dword_t)r1 << uECC_WORD_BITS) | r0; \
+	r01_ += p_; \
+	r2 += (r01_ < p_); \
+	r1 = (uECC_word_t)(r01_ >> uECC_WORD_BITS); \
+	r0 = (uECC_word_t)r01_; \
+} while (0)
+
+/* r2:r1:r0 += 2 * a * b */
+#define COMBA_MUL2ADD(a, b) do { \
+	uECC_dword_t p_ = (uECC_dword_t)(a) * (b); \
+	uECC_dword_t r01_ = ((uECC_dword_t)r1 << uECC_WORD_BITS) | r0; \
+	r2 += (uECC_word_t)(p_ >> (uECC_WORD_BITS * 2 - 1)); \
+	p_ *= 2; \
+	r01_ += p_; \
+	r2 += (r01_ < p_); \
+	r1 = (uECC_word_t)(r01_ >> uECC_WORD_BITS); \
+	r0 = (uECC_word_t)r01_; \
+} while (0)
+
+#define COMBA_STORE(k) do { \
+	result[k] = r0; \
+	r0 = r1; \
+	r1 = r2; \
+	r2 = 0; \
+} while (0)
+
+#if (uECC_WORD_SIZE == 8)
+
+/* 4 x 4 word product, unrolled. */
+static void vli_mult_4(uECC_word_t *result, const uECC_word_t *left,
+		       const uECC_word_t *right)
+{
+	uECC_word_t r0 = 0, r1 = 0, r2 = 0;
+
+	COMBA_MULADD(left[0], right[0]);
+	COMBA_STORE(0);
+	COMBA_MULADD(left[0], right[1]);
+	COMBA_MULADD(left[1], right[0]);
+	COMBA_STORE(1);
+	COMBA_MULADD(left[0], right[2]);
+	COMBA_MULADD(left[1], right[1]);
+	COMBA_MULADD(left[2], right[0]);
+	COMBA_STORE(2);
+	COMBA_MULADD(left[0], right[3]);
+	COMBA_MULADD(left[1], right[2]);
+	COMBA_MULADD(left[2], right[1]);
+	COMBA_MULADD(left[3], right[0]);
+	COMBA_STORE(3);
+	COMBA_MULADD(left[1], right[3]);
+	COMBA_MULADD(left[2], right[2]);
+	COMBA_MULADD(left[3], right[1]);
+	COMBA_STORE(4);
+	COMBA_MULADD(left[2], right[3]);
+	COMBA_MULADD(left[3], right[2]);
+	COMBA_STORE(5);
+	COMBA_MULADD(left[3], right[3]);
+	COMBA_STORE(6);
+	result[7] = r0;
+}
+
+/* 4 word square, unrolled: 10 word products instead of 16. */
+static void vli_square_4(uECC_word_t *result, const uECC_word_t *left)
+{
+	uECC_word_t r0 = 0, r1 = 0, r2 = 0;
+
+	COMBA_MULADD(left[0], left[0]);
+	COMBA_STORE(0);
+	COMBA_MUL2ADD(left[0], left[1]);
+	COMBA_STORE(1);
+	COMBA_MUL2ADD(left[0], left[2]);
+	COMBA_MULADD(left[1], left[1]);
+	COMBA_STORE(2);
+	COMBA_MUL2ADD(left[0], left[3]);
+	COMBA_MUL2ADD(left[1], left[2]);
+	COMBA_STORE(3);
+	COMBA_MUL2ADD(left[1], left[3]);
+	COMBA_MULADD(left[2], left[2]);
+	COMBA_STORE(4);
+	COMBA_MUL2ADD(left[2], left[3]);
+	COMBA_STORE(5);
+	COMBA_MULADD(left[3], left[3]);
+	COMBA_STORE(6);
+	result[7] = r0;
+}
+
+#endif /* uECC_WORD_SIZE == 8 */
+
+#if uECC_ASM_X86_64
+
+#include <cpuid.h>
+
+/*
+ * 4 x 4 word product with BMI2 and ADX: one row per word of left, each row
+ * adding its low halves through the carry flag (ADCX) and its high halves
+ * through the overflow flag (ADOX), so the two carry chains run in parallel.
+ */
+static void vli_mult_4_adx(uECC_word_t *result, const uECC_word_t *left,
+			   const uECC_word_t *right)
+{
+	uECC_word_t t0, t1, t2, t3, t4, lo, hi;
+
+	__asm__ volatile (
+		"movq 0(%[a]), %%rdx\n\t"
+		"mulxq 0(%[b]), %[t0], %[t1]\n\t"
+		"mulxq 8(%[b]), %[lo], %[t2]\n\t"
+		"addq %[lo], %[t1]\n\t"
+		"mulxq 16(%[b]), %[lo], %[t3]\n\t"
+		"adcq %[lo], %[t2]\n\t"
+		"mulxq 24(%[b]), %[lo], %[t4]\n\t"
+		"adcq %[lo], %[t3]\n\t"
+		"adcq $0, %[t4]\n\t"
+		"movq %[t0], 0(%[r])\n\t"
+		"xorq %[t0], %[t0]\n\t"
+		"movq 8(%[a]), %%rdx\n\t"
+		"mulxq 0(%[b]), %[lo], %[hi]\n\t"
+		"adcxq %[lo], %[t1]\n\t"
+		"adoxq %[hi], %[t2]\n\t"
+		"mulxq 8(%[b]), %[lo], %[hi]\n\t"
+		"adcxq %[lo], %[t2]\n\t"
+		"adoxq %[hi], %[t3]\n\t"
+		"mulxq 16(%[b]), %[lo], %[hi]\n\t"
+		"adcxq %[lo], %[t3]\n\t"
+		"adoxq %[hi], %[t4]\n\t"
+		"mulxq 24(%[b]), %[lo], %[hi]\n\t"
+		"adcxq %[lo], %[t4]\n\t"
+		"adoxq %[hi], %[t0]\n\t"
+		"movq $0, %[hi]\n\t"
+		"adcxq %[hi], %[t0]\n\t"
+		"movq %[t1], 8(%[r])\n\t"
+		"xorq %[t1], %[t1]\n\t"
+		"movq 16(%[a]), %%rdx\n\t"
+		"mulxq 0(%[b]), %[lo], %[hi]\n\t"
+		"adcxq %[lo], %[t2]\n\t"
+		"adoxq %[hi], %[t3]\n\t"
+		"mulxq 8(%[b]), %[lo], %[hi]\n\t"
+		"adcxq %[lo], %[t3]\n\t"
+		"adoxq %[hi], %[t4]\n\t"
+		"mulxq 16(%[b]), %[lo], %[hi]\n\t"
+		"adcxq %[lo], %[t4]\n\t"
+		"adoxq %[hi], %[t0]\n\t"
+		"mulxq 24(%[b]), %[lo], %[hi]\n\t"
+		"adcxq %[lo], %[t0]\n\t"
+		"adoxq %[hi], %[t1]\n\t"
+		"movq $0, %[hi]\n\t"
+		"adcxq %[hi], %[t1]\n\t"
+		"movq %[t2], 16(%[r])\n\t"
+		"xorq %[t2], %[t2]\n\t"
+		"movq 24(%[a]), %%rdx\n\t"
+		"mulxq 0(%[b]), %[lo], %[hi]\n\t"
+		"adcxq %[lo], %[t3]\n\t"
+		"adoxq %[hi], %[t4]\n\t"
+		"mulxq 8(%[b]), %[lo], %[hi]\n\t"
+		"adcxq %[lo], %[t4]\n\t"
+		"adoxq %[hi], %[t0]\n\t"
+		"mulxq 16(%[b]), %[lo], %[hi]\n\t"
+		"adcxq %[lo], %[t0]\n\t"
+		"adoxq %[hi], %[t1]\n\t"
+		"mulxq 24(%[b]), %[lo], %[hi]\n\t"
+		"adcxq %[lo], %[t1]\n\t"
+		"adoxq %[hi], %[t2]\n\t"
+		"movq $0, %[hi]\n\t"
+		"adcxq %[hi], %[t2]\n\t"
+		"movq %[t3], 24(%[r])\n\t"
+		"movq %[t4], 32(%[r])\n\t"
+		"movq %[t0], 40(%[r])\n\t"
+		"movq %[t1], 48(%[r])\n\t"
+		"movq %[t2], 56(%[r])"
+		: [t0] "=&r" (t0), [t1] "=&r" (t1), [t2] "=&r" (t2),
+		  [t3] "=&r" (t3), [t4] "=&r" (t4), [lo] "=&r" (lo),
+		  [hi] "=&r" (hi)
+		: [r] "r" (result), [a] "r" (left), [b] "r" (right)
+		: "rdx", "cc", "memory");
+}
+
+/*
+ * 4 word square with BMI2 and ADX: the six cross products are accumulated
+ * once, doubled, and the four squares added on top.
+ */
+static void vli_square_4_adx(uECC_word_t *result, const uECC_word_t *left)
+{
+	uECC_word_t w1, w2, w3, w4, w5, w6, w7, lo, hi;
+
+	__asm__ volatile (
+		"movq 0(%[a]), %%rdx\n\t"
+		"mulxq 8(%[a]), %[w1], %[w2]\n\t"
+		"mulxq 16(%[a]), %[lo], %[w3]\n\t"
+		"addq %[lo], %[w2]\n\t"
+		"mulxq 24(%[a]), %[lo], %[w4]\n\t"
+		"adcq %[lo], %[w3]\n\t"
+		"adcq $0, %[w4]\n\t"
+		"movq 8(%[a]), %%rdx\n\t"
+		"xorq %[w5], %[w5]\n\t"
+		"mulxq 16(%[a]), %[lo], %[hi]\n\t"
+		"adcxq %[lo], %[w3]\n\t"
+		"adoxq %[hi], %[w4]\n\t"
+		"mulxq 24(%[a]), %[lo], %[hi]\n\t"
+		"adcxq %[lo], %[w4]\n\t"
+		"adoxq %[hi], %[w5]\n\t"
+		"movq $0, %[hi]\n\t"
+		"adcxq %[hi], %[w5]\n\t"
+		"movq 16(%[a]), %%rdx\n\t"
+		"mulxq 24(%[a]), %[lo], %[w6]\n\t"
+		"addq %[lo], %[w5]\n\t"
+		"adcq $0, %[w6]\n\t"
+		"xorq %[w7], %[w7]\n\t"
+		"addq %[w1], %[w1]\n\t"
+		"adcq %[w2], %[w2]\n\t"
+		"adcq %[w3], %[w3]\n\t"
+		"adcq %[w4], %[w4]\n\t"
+		"adcq %[w5], %[w5]\n\t"
+		"adcq %[w6], %[w6]\n\t"
+		"adcq $0, %[w7]\n\t"
+		"movq 0(%[a]), %%rdx\n\t"
+		"mulxq %%rdx, %[lo], %[hi]\n\t"
+		"movq %[lo], 0(%[r])\n\t"
+		"addq %[hi], %[w1]\n\t"
+		"movq 8(%[a]), %%rdx\n\t"
+		"mulxq %%rdx, %[lo], %[hi]\n\t"
+		"adcq %[lo], %[w2]\n\t"
+		"adcq %[hi], %[w3]\n\t"
+		"movq 16(%[a]), %%rdx\n\t"
+		"mulxq %%rdx, %[lo], %[hi]\n\t"
+		"adcq %[lo], %[w4]\n\t"
+		"adcq %[hi], %[w5]\n\t"
+		"movq 24(%[a]), %%rdx\n\t"
+		"mulxq %%rdx, %[lo], %[hi]\n\t"
+		"adcq %[lo], %[w6]\n\t"
+		"adcq %[hi], %[w7]\n\t"
+		"movq %[w1], 8(%[r])\n\t"
+		"movq %[w2], 16(%[r])\n\t"
+		"movq %[w3], 24(%[r])\n\t"
+		"movq %[w4], 32(%[r])\n\t"
+		"movq %[w5], 40(%[r])\n\t"
+		"movq %[w6], 48(%[r])\n\t"
+		"movq %[w7], 56(%[r])"
+		: [w1] "=&r" (w1), [w2] "=&r" (w2), [w3] "=&r" (w3),
+		  [w4] "=&r" (w4), [w5] "=&r" (w5), [w6] "=&r" (w6),
+		  [w7] "=&r" (w7), [lo] "=&r" (lo), [hi] "=&r" (hi)
+		: [r] "r" (result), [a] "r" (left)
+		: "rdx", "cc", "memory");
+}
+
+static unsigned int detect_cpu_features(void)
+{
+	unsigned int eax, ebx, ecx, edx;
+	unsigned int xcr0, xcr0_high;
+	unsigned int features = 0;
+
+	if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+		return 0;
+	}
+
+	/* leaf 7: BMI2 is EBX bit 8, ADX is EBX bit 19 */
+	if ((ebx & (1U << 8)) && (ebx & (1U << 19))) {
+		features |= uECC_CPU_BMI2_ADX;
+	}
+
+	/* AVX512F is EBX bit 16, AVX512IFMA is EBX bit 21; the OS must also
+	 * save the AVX-512 state (OSXSAVE, leaf 1 ECX bit 27, then XCR0 bits 1,
+	 * 2 and 5 to 7): */
+	if ((ebx & (1U << 16)) && (ebx & (1U << 21)) &&
+	    __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & (1U << 27))) {
+		__asm__ ("xgetbv" : "=a" (xcr0), "=d" (xcr0_high) : "c" (0));
+		if ((xcr0 & 0xe6) == 0xe6) {
+			features |= uECC_CPU_AVX512_IFMA;
+		}
+	}
+	return features;
+}
+
+/*
+ * Features used by the field arithmetic, or ~0U until detected. A single
+ * word, so that a reader never sees a mask without the fact that it is valid;
+ * a concurrent first use only repeats the detection and stores the same value.
+ */
+static unsigned int g_cpu_features = ~0U;
+
+static unsigned int cpu_features(void)
+{
+	unsigned int features = __atomic_load_n(&g_cpu_features,
+						__ATOMIC_RELAXED);
+
+	if (features == ~0U) {
+		features = detect_cpu_features();
+		__atomic_store_n(&g_cpu_features, features, __ATOMIC_RELAXED);
+	}
+	return features;
+}
+
+unsigned int uECC_set_cpu_features(unsigned int features)
+{
+	features &= detect_cpu_features();
+	__atomic_store_n(&g_cpu_features, features, __ATOMIC_RELAXED);
+	return features;
+}
+
+unsigned int uECC_get_cpu_features(void)
 {
+	return cpu_features();
+}
+
+#else
 
-	uECC_dword_t p = (uECC_dword_t)a * b;
-	uECC_dword_t r01 = ((uECC_dword_t)(*r1) << uECC_WORD_BITS) | *r0;
-	r01 += p;
-	*r2 += (r01 < p);
-	*r1 = r01 >> uECC_WORD_BITS;
-	*r0 = (uECC_word_t)r01;
+unsigned int uECC_set_cpu_features(unsigned int features)
+{
+	(void)features;
+	return 0;
+}
 
+unsigned int uECC_get_cpu_features(void)
+{
+	return 0;
 }
 
+#endif /* uECC_ASM_X86_64 */
+
 /* Computes result = left * right. Result must be 2 * num_words long. */
 static void uECC_vli_mult(uECC_word_t *result, const uECC_word_t *left,
 			  const uECC_word_t *right, wordcount_t num_words)
@@ -265,28 +609,66 @@ static void uECC_vli_mult(uECC_word_t *result, const uECC_word_t *left,
 	uECC_word_t r2 = 0;
 	wordcount_t i, k;
 
+#if (uECC_WORD_SIZE == 8)
+	if (num_words == 4) {
+#if uECC_ASM_X86_64
+		if (cpu_features() & uECC_CPU_BMI2_ADX) {
+			vli_mult_4_adx(result, left, right);
+			return;
+		}
+#endif
+		vli_mult_4(result, left, right);
+		return;
+	}
+#endif
+
 	/* Compute each digit of result in sequence, maintaining the carries. */
-	for (k = 0; k < num_words; ++k) {
+	for (k = 0; k < num_words * 2 - 1; ++k) {
+		wordcount_t min = (k < num_words ? 0 : (k + 1) - num_words);
 
-		for (i = 0; i <= k; ++i) {
-			muladd(left[i], right[k - i], &r0, &r1, &r2);
+		for (i = min; i <= k && i < num_words; ++i) {
+			COMBA_MULADD(left[i], right[k - i]);
 		}
+		COMBA_STORE(k);
+	}
+	result[num_words * 2 - 1] = r0;
+}
+
+/*
+ * Computes result = left^2. Result must be 2 * num_words long. Each cross
+ * product left[i] * left[j] (i != j) is computed once and counted twice.
+ */
+static void uECC_vli_square(uECC_word_t *result, const uECC_word_t *left,
+			    wordcount_t num_words)
+{
+	uECC_word_t r0 = 0;
+	uECC_word_t r1 = 0;
+	uECC_word_t r2 = 0;
+	wordcount_t i, k;
 
-		result[k] = r0;
-		r0 = r1;
-		r1 = r2;
-		r2 = 0;
+#if (uECC_WORD_SIZE == 8)
+	if (num_words == 4) {
+#if uECC_ASM_X86_64
+		if (cpu_features() & uECC_CPU_BMI2_ADX) {
+			vli_square_4_adx(result, left);
+			return;
+		}
+#endif
+		vli_square_4(result, left);
+		return;
 	}
+#endif
 
-	for (k = num_words; k < num_words * 2 - 1; ++k) {
+	for (k = 0; k < num_words * 2 - 1; ++k) {
+		wordcount_t min = (k < num_words ? 0 : (k + 1) - num_words);
 
-		for (i = (k + 1) - num_words; i < num_words; ++i) {
-			muladd(left[i], right[k - i], &r0, &r1, &r2);
+		for (i = min; i < k - i; ++i) {
+			COMBA_MUL2ADD(left[i], left[k - i]);
+		}
+		if (i == k - i) {
+			COMBA_MULADD(left[i], left[i]);
 		}
-		result[k] = r0;
-		r0 = r1;
-		r1 = r2;
-		r2 = 0;
+		COMBA_STORE(k);
 	}
 	result[num_words * 2 - 1] = r0;
 }
@@ -370,86 +752,410 @@ void uECC_vli_modMult(uECC_word_t *result, const uECC_word_t *left,
 	uECC_vli_mmod(result, product, mod, num_words);
 }
 
+/*
+ * Reduces a product modulo curve_p. The P-256 reduction is called directly,
+ * so that it can be inlined into the field operations; other curves go
+ * through their mmod_fast hook.
+ */
+static void vli_mmod_fast(uECC_word_t *result, uECC_word_t *product,
+			  uECC_Curve curve)
+{
+	if (curve->mmod_fast == &vli_mmod_fast_secp256r1) {
+		vli_mmod_fast_secp256r1(result, product);
+	} else {
+		curve->mmod_fast(result, product);
+	}
+}
+
 void uECC_vli_modMult_fast(uECC_word_t *result, const uECC_word_t *left,
 			   const uECC_word_t *right, uECC_Curve curve)
 {
 	uECC_word_t product[2 * NUM_ECC_WORDS];
 	uECC_vli_mult(product, left, right, curve->num_words);
 
-	curve->mmod_fast(result, product);
+	vli_mmod_fast(result, product, curve);
+}
+
+uECC_word_t uECC_vli_montInit(uECC_word_t *r2, const uECC_word_t *mod,
+			      wordcount_t num_words)
+{
+	uECC_word_t product[2 * NUM_ECC_WORDS];
+	uECC_word_t inv = 1;
+	wordcount_t i;
+
+	/* Newton iteration: each step doubles the number of correct low bits
+	 * of 1 / m[0] (m[0] * 1 == 1 mod 2 to start with). */
+	for (i = 0; i < 6; ++i) {
+		inv *= 2 - mod[0] * inv;
+	}
+	inv = (uECC_word_t)0 - inv;
+
+	/* R mod m, with R = 2^(num_words * uECC_WORD_BITS): R - m when the top
+	 * bit of m is set. */
+	uECC_vli_clear(product, 2 * num_words);
+	if (mod[num_words - 1] & HIGH_BIT_SET) {
+		uECC_vli_sub(r2, product, mod, num_words);
+	} else {
+		product[num_words] = 1;
+		uECC_vli_mmod(r2, product, mod, num_words);
+	}
+
+	/* 2^(num_words * uECC_WORD_BITS / 32) R by doubling, then five
+	 * Montgomery squarings turn 2^k R into 2^(32k) R = R^2: */
+	for (i = 0; i < num_words * uECC_WORD_BITS / 32; ++i) {
+		uECC_vli_modAdd(r2, r2, r2, mod, num_words);
+	}
+	for (i = 0; i < 5; ++i) {
+		uECC_vli_montMult(r2, r2, r2, mod, inv, num_words);
+	}
+	return inv;
+}
+
+void uECC_vli_montMult(uECC_word_t *result, const uECC_word_t *left,
+		       const uECC_word_t *right, const uECC_word_t *mod,
+		       uECC_word_t mod_inv, wordcount_t num_words)
+{
+	uECC_word_t t[NUM_ECC_WORDS + 2];
+	uECC_word_t borrow, mask;
+	wordcount_t i, j;
+
+	uECC_vli_clear(t, num_words + 2);
+	for (i = 0; i < num_words; ++i) {
+		uECC_dword_t acc = 0;
+		uECC_word_t m;
+
+		/* t += left * right[i] */
+		for (j = 0; j < num_words; ++j) {
+			acc = (uECC_dword_t)left[j] * right[i] + t[j] +
+			      (acc >> uECC_WORD_BITS);
+			t[j] = (uECC_word_t)acc;
+		}
+		acc = (uECC_dword_t)t[num_words] + (acc >> uECC_WORD_BITS);
+		t[num_words] = (uECC_word_t)acc;
+		t[num_words + 1] = (uECC_word_t)(acc >> uECC_WORD_BITS);
+
+		/* t = (t + m * mod) / 2^uECC_WORD_BITS, with m chosen so that the
+		 * division is exact: */
+		m = t[0] * mod_inv;
+		acc = (uECC_dword_t)m * mod[0] + t[0];
+		for (j = 1; j < num_words; ++j) {
+			acc = (uECC_dword_t)m * mod[j] + t[j] +
+			      (acc >> uECC_WORD_BITS);
+			t[j - 1] = (uECC_word_t)acc;
+		}
+		acc = (uECC_dword_t)t[num_words] + (acc >> uECC_WORD_BITS);
+		t[num_words - 1] = (uECC_word_t)acc;
+		t[num_words] = t[num_words + 1] + (uECC_word_t)(acc >> uECC_WORD_BITS);
+	}
+
+	/* t < 2 * mod: keep t - mod unless the subtraction borrows from a zero
+	 * top word. */
+	borrow = uECC_vli_sub(result, t, mod, num_words);
+	mask = (uECC_word_t)0 - (uECC_word_t)((t[num_words] == 0) & borrow);
+	for (i = 0; i < num_words; ++i) {
+		result[i] = (result[i] & ~mask) | (t[i] & mask);
+	}
 }
 
 static void uECC_vli_modSquare_fast(uECC_word_t *result,
 				    const uECC_word_t *left,
 				    uECC_Curve curve)
 {
-	uECC_vli_modMult_fast(result, left, left, curve);
+	uECC_word_t product[2 * NUM_ECC_WORDS];
+	uECC_vli_square(product, left, curve->num_words);
+
+	vli_mmod_fast(result, product, curve);
 }
 
 
-#define EVEN(vli) (!(vli[0] & 1))
+#if uECC_SAFEGCD
 
-static void vli_modInv_update(uECC_word_t *uv,
-			      const uECC_word_t *mod,
-			      wordcount_t num_words)
+/*
+ * Bernstein-Yang safegcd ("Fast constant-time gcd computation and modular
+ * inversion", 2019), in the formulation of libsecp256k1: integers are held as
+ * five signed 62-bit limbs, and divsteps are applied 59 at a time through a
+ * 2x2 transition matrix. 10 * 59 divsteps are enough for any 256-bit input.
+ * Signed right shifts are assumed to be arithmetic, as they are with every
+ * compiler that provides __int128.
+ */
+
+typedef __int128 safegcd_dword_t;
+
+#define SAFEGCD_LIMBS 5
+#define SAFEGCD_M62 ((uint64_t)-1 >> 2)
+
+typedef struct {
+	int64_t u, v, q, r;
+} safegcd_matrix_t;
+
+/* 256-bit vli to signed 62-bit limbs. */
+static void safegcd_from_vli(int64_t *out, const uECC_word_t *vli)
 {
+	uint64_t a[4];
+	int i;
 
-	uECC_word_t carry = 0;
+	for (i = 0; i < 4; ++i) {
+#if (uECC_WORD_SIZE == 8)
+		a[i] = vli[i];
+#else
+		a[i] = vli[2 * i] | ((uint64_t)vli[2 * i + 1] << 32);
+#endif
+	}
+	out[0] = (int64_t)(a[0] & SAFEGCD_M62);
+	out[1] = (int64_t)(((a[0] >> 62) | (a[1] << 2)) & SAFEGCD_M62);
+	out[2] = (int64_t)(((a[1] >> 60) | (a[2] << 4)) & SAFEGCD_M62);
+	out[3] = (int64_t)(((a[2] >> 58) | (a[3] << 6)) & SAFEGCD_M62);
+	out[4] = (int64_t)(a[3] >> 56);
+}
+
+/* Normalized signed 62-bit limbs (all in [0, 2^62)) to a 256-bit vli. */
+static void safegcd_to_vli(uECC_word_t *vli, const int64_t *in)
+{
+	uint64_t a[4];
+	int i;
+
+	a[0] = (uint64_t)in[0] | ((uint64_t)in[1] << 62);
+	a[1] = ((uint64_t)in[1] >> 2) | ((uint64_t)in[2] << 60);
+	a[2] = ((uint64_t)in[2] >> 4) | ((uint64_t)in[3] << 58);
+	a[3] = ((uint64_t)in[3] >> 6) | ((uint64_t)in[4] << 56);
+	for (i = 0; i < 4; ++i) {
+#if (uECC_WORD_SIZE == 8)
+		vli[i] = a[i];
+#else
+		vli[2 * i] = (uECC_word_t)a[i];
+		vli[2 * i + 1] = (uECC_word_t)(a[i] >> 32);
+#endif
+	}
+}
+
+/*
+ * Runs 59 divsteps on the low bits f0, g0 of f and g, starting from
+ * zeta = -(delta + 1/2). Returns the new zeta; t receives the transition
+ * matrix, scaled by 2^62. Branch-free.
+ */
+static int64_t safegcd_divsteps_59(int64_t zeta, uint64_t f0, uint64_t g0,
+				   safegcd_matrix_t *t)
+{
+	uint64_t u = 8, v = 0, q = 0, r = 8;
+	uint64_t f = f0, g = g0;
+	uint64_t mask1, mask2, x, y, z;
+	int i;
+
+	for (i = 3; i < 62; ++i) {
+		/* masks for (zeta < 0) and for (g odd): */
+		mask1 = (uint64_t)(zeta >> 63);
+		mask2 = (uint64_t)0 - (g & 1);
+		/* x, y, z = f, u, v, negated if zeta < 0: */
+		x = (f ^ mask1) - mask1;
+		y = (u ^ mask1) - mask1;
+		z = (v ^ mask1) - mask1;
+		/* if g is odd, add them to g, q, r: */
+		g += x & mask2;
+		q += y & mask2;
+		r += z & mask2;
+		/* if zeta < 0 and g was odd, swap: zeta = -zeta - 2 and f, u, v
+		 * take the old g, q, r; otherwise zeta = zeta - 1: */
+		mask1 &= mask2;
+		zeta = (zeta ^ (int64_t)mask1) - 1;
+		f += g & mask1;
+		u += q & mask1;
+		v += r & mask1;
+		g >>= 1;
+		u <<= 1;
+		v <<= 1;
+	}
+	t->u = (int64_t)u;
+	t->v = (int64_t)v;
+	t->q = (int64_t)q;
+	t->r = (int64_t)r;
+	return zeta;
+}
+
+/*
+ * [d, e] = t * [d, e] / 2^62 mod m, where d and e are in (-2m, m) on input
+ * and output. Multiples of m are added so that the division is exact.
+ */
+static void safegcd_update_de(int64_t *d, int64_t *e, const safegcd_matrix_t *t,
+			      const int64_t *m, uint64_t m_inv62)
+{
+	const int64_t u = t->u, v = t->v, q = t->q, r = t->r;
+	int64_t sd = d[SAFEGCD_LIMBS - 1] >> 63;
+	int64_t se = e[SAFEGCD_LIMBS - 1] >> 63;
+	int64_t md = (u & sd) + (v & se);
+	int64_t me = (q & sd) + (r & se);
+	safegcd_dword_t cd, ce;
+	int i;
+
+	cd = (safegcd_dword_t)u * d[0] + (safegcd_dword_t)v * e[0];
+	ce = (safegcd_dword_t)q * d[0] + (safegcd_dword_t)r * e[0];
+	/* choose md, me so that the low 62 bits of the sum vanish: */
+	md -= (int64_t)((m_inv62 * (uint64_t)cd + (uint64_t)md) & SAFEGCD_M62);
+	me -= (int64_t)((m_inv62 * (uint64_t)ce + (uint64_t)me) & SAFEGCD_M62);
+	cd += (safegcd_dword_t)m[0] * md;
+	ce += (safegcd_dword_t)m[0] * me;
+	cd >>= 62;
+	ce >>= 62;
+
+	for (i = 1; i < SAFEGCD_LIMBS; ++i) {
+		cd += (safegcd_dword_t)u * d[i] + (safegcd_dword_t)v * e[i] +
+		      (safegcd_dword_t)m[i] * md;
+		ce += (safegcd_dword_t)q * d[i] + (safegcd_dword_t)r * e[i] +
+		      (safegcd_dword_t)m[i] * me;
+		d[i - 1] = (int64_t)((uint64_t)cd & SAFEGCD_M62);
+		e[i - 1] = (int64_t)((uint64_t)ce & SAFEGCD_M62);
+		cd >>= 62;
+		ce >>= 62;
+	}
+	d[SAFEGCD_LIMBS - 1] = (int64_t)cd;
+	e[SAFEGCD_LIMBS - 1] = (int64_t)ce;
+}
+
+/* [f, g] = t * [f, g] / 2^62 (the division is exact). */
+static void safegcd_update_fg(int64_t *f, int64_t *g, const safegcd_matrix_t *t)
+{
+	const int64_t u = t->u, v = t->v, q = t->q, r = t->r;
+	safegcd_dword_t cf, cg;
+	int i;
+
+	cf = (safegcd_dword_t)u * f[0] + (safegcd_dword_t)v * g[0];
+	cg = (safegcd_dword_t)q * f[0] + (safegcd_dword_t)r * g[0];
+	cf >>= 62;
+	cg >>= 62;
+
+	for (i = 1; i < SAFEGCD_LIMBS; ++i) {
+		cf += (safegcd_dword_t)u * f[i] + (safegcd_dword_t)v * g[i];
+		cg += (safegcd_dword_t)q * f[i] + (safegcd_dword_t)r * g[i];
+		f[i - 1] = (int64_t)((uint64_t)cf & SAFEGCD_M62);
+		g[i - 1] = (int64_t)((uint64_t)cg & SAFEGCD_M62);
+		cf >>= 62;
+		cg >>= 62;
+	}
+	f[SAFEGCD_LIMBS - 1] = (int64_t)cf;
+	g[SAFEGCD_LIMBS - 1] = (int64_t)cg;
+}
 
-	if (!EVEN(uv)) {
-		carry = uECC_vli_add(uv, uv, mod, num_words);
+/* Carries every limb but the top one back into [0, 2^62). */
+static void safegcd_carry(int64_t *x)
+{
+	int i;
+
+	for (i = 0; i < SAFEGCD_LIMBS - 1; ++i) {
+		x[i + 1] += x[i] >> 62;
+		x[i] &= (int64_t)SAFEGCD_M62;
+	}
+}
+
+/*
+ * Brings x from (-2m, m) to [0, m), negating it on the way if sign < 0.
+ * Branch-free.
+ */
+static void safegcd_normalize(int64_t *x, int64_t sign, const int64_t *m)
+{
+	int64_t cond_add = x[SAFEGCD_LIMBS - 1] >> 63;
+	int64_t cond_negate = sign >> 63;
+	int i;
+
+	for (i = 0; i < SAFEGCD_LIMBS; ++i) {
+		x[i] += m[i] & cond_add;
+		x[i] = (x[i] ^ cond_negate) - cond_negate;
 	}
-	uECC_vli_rshift1(uv, num_words);
-	if (carry) {
-		uv[num_words - 1] |= HIGH_BIT_SET;
+	safegcd_carry(x);
+
+	cond_add = x[SAFEGCD_LIMBS - 1] >> 63;
+	for (i = 0; i < SAFEGCD_LIMBS; ++i) {
+		x[i] += m[i] & cond_add;
 	}
+	safegcd_carry(x);
 }
 
 void uECC_vli_modInv(uECC_word_t *result, const uECC_word_t *input,
 		     const uECC_word_t *mod, wordcount_t num_words)
 {
-	uECC_word_t a[NUM_ECC_WORDS], b[NUM_ECC_WORDS];
-	uECC_word_t u[NUM_ECC_WORDS], v[NUM_ECC_WORDS];
-	cmpresult_t cmpResult;
+	int64_t d[SAFEGCD_LIMBS] = {0, 0, 0, 0, 0};
+	int64_t e[SAFEGCD_LIMBS] = {1, 0, 0, 0, 0};
+	int64_t f[SAFEGCD_LIMBS];
+	int64_t g[SAFEGCD_LIMBS];
+	int64_t m[SAFEGCD_LIMBS];
+	int64_t zeta = -1; /* delta = 1/2 */
+	uint64_t m_inv62 = 1;
+	int i;
+
+	(void)num_words;
+	safegcd_from_vli(m, mod);
+	safegcd_from_vli(f, mod);
+	safegcd_from_vli(g, input);
+
+	/* 1 / m mod 2^62, by Newton iteration: */
+	for (i = 0; i < 6; ++i) {
+		m_inv62 *= 2 - (uint64_t)m[0] * m_inv62;
+	}
+	m_inv62 &= SAFEGCD_M62;
 
-	if (uECC_vli_isZero(input, num_words)) {
-		uECC_vli_clear(result, num_words);
-		return;
+	for (i = 0; i < 10; ++i) {
+		safegcd_matrix_t t;
+		zeta = safegcd_divsteps_59(zeta, (uint64_t)f[0], (uint64_t)g[0], &t);
+		safegcd_update_de(d, e, &t, m, m_inv62);
+		safegcd_update_fg(f, g, &t);
 	}
 
-	uECC_vli_set(a, input, num_words);
-	uECC_vli_set(b, mod, num_words);
-	uECC_vli_clear(u, num_words);
-	u[0] = 1;
-	uECC_vli_clear(v, num_words);
-	while ((cmpResult = uECC_vli_cmp_unsafe(a, b, num_words)) != 0) {
-		if (EVEN(a)) {
-			uECC_vli_rshift1(a, num_words);
-      			vli_modInv_update(u, mod, num_words);
-    		} else if (EVEN(b)) {
-			uECC_vli_rshift1(b, num_words);
-			vli_modInv_update(v, mod, num_words);
-		} else if (cmpResult > 0) {
-			uECC_vli_sub(a, a, b, num_words);
-			uECC_vli_rshift1(a, num_words);
-			if (uECC_vli_cmp_unsafe(u, v, num_words) < 0) {
-        			uECC_vli_add(u, u, mod, num_words);
-      			}
-      			uECC_vli_sub(u, u, v, num_words);
-      			vli_modInv_update(u, mod, num_words);
-    		} else {
-      			uECC_vli_sub(b, b, a, num_words);
-      			uECC_vli_rshift1(b, num_words);
-      			if (uECC_vli_cmp_unsafe(v, u, num_words) < 0) {
-        			uECC_vli_add(v, v, mod, num_words);
-      			}
-      			uECC_vli_sub(v, v, u, num_words);
-      			vli_modInv_update(v, mod, num_words);
-    		}
-  	}
-  	uECC_vli_set(result, u, num_words);
+	/* g is now 0 and f is +/-1 (for input != 0): d is +/- the inverse. */
+	safegcd_normalize(d, f[SAFEGCD_LIMBS - 1], m);
+	safegcd_to_vli(result, d);
+}
+
+#else /* !uECC_SAFEGCD */
+
+/*
+ * Fermat's little theorem: 1 / input = input^(mod - 2) for a prime modulus.
+ * Fixed 4-bit window exponentiation in the Montgomery domain. The exponent is
+ * public, so only the base needs to be handled in constant time.
+ */
+void uECC_vli_modInv(uECC_word_t *result, const uECC_word_t *input,
+		     const uECC_word_t *mod, wordcount_t num_words)
+{
+	uECC_word_t table[16][NUM_ECC_WORDS];
+	uECC_word_t exponent[NUM_ECC_WORDS];
+	uECC_word_t two[NUM_ECC_WORDS];
+	uECC_word_t r2[NUM_ECC_WORDS];
+	uECC_word_t mod_inv;
+	bitcount_t i;
+	int j;
+
+	mod_inv = uECC_vli_montInit(r2, mod, num_words);
+
+	/* table[j] = input^j, in the Montgomery domain: */
+	uECC_vli_clear(two, num_words);
+	two[0] = 1;
+	uECC_vli_montMult(table[0], two, r2, mod, mod_inv, num_words);
+	uECC_vli_montMult(table[1], input, r2, mod, mod_inv, num_words);
+	for (j = 2; j < 16; ++j) {
+		uECC_vli_montMult(table[j], table[j - 1], table[1], mod, mod_inv,
+				  num_words);
+	}
+
+	two[0] = 2;
+	uECC_vli_sub(exponent, mod, two, num_words);
+
+	uECC_vli_set(result, table[0], num_words);
+	for (i = num_words * uECC_WORD_BITS - 4; i >= 0; i -= 4) {
+		uECC_word_t digit = (exponent[i / uECC_WORD_BITS] >>
+				     (i % uECC_WORD_BITS)) & 0xF;
+		for (j = 0; j < 4; ++j) {
+			uECC_vli_montMult(result, result, result, mod, mod_inv,
+					  num_words);
+		}
+		uECC_vli_montMult(result, result, table[digit], mod, mod_inv,
+				  num_words);
+	}
+
+	/* out of the Montgomery domain: */
+	uECC_vli_clear(two, num_words);
+	two[0] = 1;
+	uECC_vli_montMult(result, result, two, mod, mod_inv, num_words);
 }
 
+#endif /* uECC_SAFEGCD */
+
 /* ------ Point operations ------ */
 
 void double_jacobian_default(uECC_word_t * X1, uECC_word_t * Y1,
@@ -513,109 +1219,268 @@ void x_side_default(uECC_word_t *result,
 	uECC_vli_modAdd(result, result, curve->b, curve->p, num_words);
 }
 
+/* result = a^(2^n), n > 0 */
+static void mod_square_n(uECC_word_t *result, const uECC_word_t *a,
+			 unsigned int n, uECC_Curve curve)
+{
+	uECC_vli_modSquare_fast(result, a, curve);
+	while (--n) {
+		uECC_vli_modSquare_fast(result, result, curve);
+	}
+}
+
+void mod_sqrt_secp256r1(uECC_word_t *a, uECC_Curve curve)
+{
+	uECC_word_t t[NUM_ECC_WORDS];
+	uECC_word_t u[NUM_ECC_WORDS];
+
+	/* (p + 1) / 4 = (2^32 - 1) 2^222 + 2^190 + 2^94; u = a^(2^32 - 1): */
+	mod_square_n(t, a, 1, curve);
+	uECC_vli_modMult_fast(u, t, a, curve);	/* a^(2^2 - 1) */
+	mod_square_n(t, u, 2, curve);
+	uECC_vli_modMult_fast(u, t, u, curve);	/* a^(2^4 - 1) */
+	mod_square_n(t, u, 4, curve);
+	uECC_vli_modMult_fast(u, t, u, curve);	/* a^(2^8 - 1) */
+	mod_square_n(t, u, 8, curve);
+	uECC_vli_modMult_fast(u, t, u, curve);	/* a^(2^16 - 1) */
+	mod_square_n(t, u, 16, curve);
+	uECC_vli_modMult_fast(u, t, u, curve);	/* a^(2^32 - 1) */
+
+	mod_square_n(t, u, 32, curve);
+	uECC_vli_modMult_fast(t, t, a, curve);	/* a^((2^32 - 1) 2^32 + 1) */
+	mod_square_n(t, t, 96, curve);
+	uECC_vli_modMult_fast(t, t, a, curve);
+	mod_square_n(a, t, 94, curve);
+}
+
 uECC_Curve uECC_secp256r1(void)
 {
 	return &curve_secp256r1;
 }
 
-void vli_mmod_fast_secp256r1(uint32_t *result, uint32_t*product)
-{
-	uint32_t tmp[NUM_ECC_WORDS];
-	int carry;
-
-	/* t */
-	uECC_vli_set(result, product, NUM_ECC_WORDS);
-
-	/* s1 */
-	tmp[0] = tmp[1] = tmp[2] = 0;
-	tmp[3] = product[11];
-	tmp[4] = product[12];
-	tmp[5] = product[13];
-	tmp[6] = product[14];
-	tmp[7] = product[15];
-	carry = uECC_vli_add(tmp, tmp, tmp, NUM_ECC_WORDS);
-	carry += uECC_vli_add(result, result, tmp, NUM_ECC_WORDS);
-
-	/* s2 */
-	tmp[3] = product[12];
-	tmp[4] = product[13];
-	tmp[5] = product[14];
-	tmp[6] = product[15];
-	tmp[7] = 0;
-	carry += uECC_vli_add(tmp, tmp, tmp, NUM_ECC_WORDS);
-	carry += uECC_vli_add(result, result, tmp, NUM_ECC_WORDS);
-
-	/* s3 */
-	tmp[0] = product[8];
-	tmp[1] = product[9];
-	tmp[2] = product[10];
-	tmp[3] = tmp[4] = tmp[5] = 0;
-	tmp[6] = product[14];
-	tmp[7] = product[15];
-  	carry += uECC_vli_add(result, result, tmp, NUM_ECC_WORDS);
-
-	/* s4 */
-	tmp[0] = product[9];
-	tmp[1] = product[10];
-	tmp[2] = product[11];
-	tmp[3] = product[13];
-	tmp[4] = product[14];
-	tmp[5] = product[15];
-	tmp[6] = product[13];
-	tmp[7] = product[8];
-	carry += uECC_vli_add(result, result, tmp, NUM_ECC_WORDS);
-
-	/* d1 */
-	tmp[0] = product[11];
-	tmp[1] = product[12];
-	tmp[2] = product[13];
-	tmp[3] = tmp[4] = tmp[5] = 0;
-	tmp[6] = product[8];
-	tmp[7] = product[10];
-	carry -= uECC_vli_sub(result, result, tmp, NUM_ECC_WORDS);
-
-	/* d2 */
-	tmp[0] = product[12];
-	tmp[1] = product[13];
-	tmp[2] = product[14];
-	tmp[3] = product[15];
-	tmp[4] = tmp[5] = 0;
-	tmp[6] = product[9];
-	tmp[7] = product[11];
-	carry -= uECC_vli_sub(result, result, tmp, NUM_ECC_WORDS);
-
-	/* d3 */
-	tmp[0] = product[13];
-	tmp[1] = product[14];
-	tmp[2] = product[15];
-	tmp[3] = product[8];
-	tmp[4] = product[9];
-	tmp[5] = product[10];
-	tmp[6] = 0;
-	tmp[7] = product[12];
-	carry -= uECC_vli_sub(result, result, tmp, NUM_ECC_WORDS);
-
-	/* d4 */
-	tmp[0] = product[14];
-	tmp[1] = product[15];
-	tmp[2] = 0;
-	tmp[3] = product[9];
-	tmp[4] = product[10];
-	tmp[5] = product[11];
-	tmp[6] = 0;
-	tmp[7] = product[13];
-	carry -= uECC_vli_sub(result, result, tmp, NUM_ECC_WORDS);
-
-	if (carry < 0) {
-		do {
-			carry += uECC_vli_add(result, result, curve_secp256r1.p, NUM_ECC_WORDS);
-		}
-		while (carry < 0);
-	} else  {
-		while (carry || 
-		       uECC_vli_cmp_unsafe(curve_secp256r1.p, result, NUM_ECC_WORDS) != 1) {
-			carry -= uECC_vli_sub(result, result, curve_secp256r1.p, NUM_ECC_WORDS);
+/* 32-bit limb i of a product, whatever the word size: */
+#if (uECC_WORD_SIZE == 8)
+#define PRODUCT_LIMB32(product, i) \
+	((int64_t)(uint32_t)((product)[(i) >> 1] >> (((i) & 1) * 32)))
+#else
+#define PRODUCT_LIMB32(product, i) ((int64_t)(product)[i])
+#endif
+
+/*
+ * Solinas reduction: with A0..A15 the 32-bit limbs of the product,
+ * result = T + 2 S1 + 2 S2 + S3 + S4 - D1 - D2 - D3 - D4 (mod p), as in
+ * "Mathematical routines for the NIST prime elliptic curves". The eight
+ * 32-bit columns of that sum are accumulated in signed 64-bit integers and
+ * carried at once; the carry out of the top column is folded back with
+ * 2^256 == 2^224 - 2^192 - 2^96 + 1 (mod p). Three passes always bring the
+ * carry to 0, and a final masked subtraction brings the result below p, so
+ * the reduction has no data-dependent branches.
+ */
+void vli_mmod_fast_secp256r1(uECC_word_t *result, uECC_word_t *product)
+{
+	int64_t a[16];
+	int64_t c[8];
+	uECC_word_t tmp[NUM_ECC_WORDS];
+	uECC_word_t mask;
+	int i, pass;
+
+	for (i = 0; i < 16; ++i) {
+		a[i] = PRODUCT_LIMB32(product, i);
+	}
+
+	c[0] = a[0] + a[8] + a[9] - a[11] - a[12] - a[13] - a[14];
+	c[1] = a[1] + a[9] + a[10] - a[12] - a[13] - a[14] - a[15];
+	c[2] = a[2] + a[10] + a[11] - a[13] - a[14] - a[15];
+	c[3] = a[3] + 2 * (a[11] + a[12]) + a[13] - a[15] - a[8] - a[9];
+	c[4] = a[4] + 2 * (a[12] + a[13]) + a[14] - a[9] - a[10];
+	c[5] = a[5] + 2 * (a[13] + a[14]) + a[15] - a[10] - a[11];
+	c[6] = a[6] + 3 * a[14] + 2 * a[15] + a[13] - a[8] - a[9];
+	c[7] = a[7] + 3 * a[15] + a[8] - a[10] - a[11] - a[12] - a[13];
+
+	for (pass = 0; pass < 3; ++pass) {
+		int64_t carry = 0;
+		for (i = 0; i < 8; ++i) {
+			uint64_t high;
+			c[i] += carry;
+			/* carry = c[i] >> 32, sign-extended without relying on
+			 * the implementation-defined shift of negative values */
+			high = (uint64_t)c[i] >> 32;
+			carry = (int64_t)(high ^ 0x80000000) - 0x80000000;
+			c[i] &= 0xffffffff;
 		}
+		c[0] += carry;
+		c[3] -= carry;
+		c[6] -= carry;
+		c[7] += carry;
+	}
+
+#if (uECC_WORD_SIZE == 8)
+	for (i = 0; i < 4; ++i) {
+		result[i] = (uECC_word_t)c[2 * i] |
+			    ((uECC_word_t)c[2 * i + 1] << 32);
+	}
+#else
+	for (i = 0; i < 8; ++i) {
+		result[i] = (uECC_word_t)c[i];
+	}
+#endif
+
+	/* result < 2^256 < 2p: subtract p unless that borrows */
+	mask = (uECC_word_t)0 -
+	       uECC_vli_sub(tmp, result, curve_secp256r1.p, NUM_ECC_WORDS);
+	for (i = 0; i < NUM_ECC_WORDS; ++i) {
+		result[i] = (result[i] & mask) | (tmp[i] & ~mask);
+	}
+}
+
+uECC_Curve uECC_secp256k1(void)
+{
+	return &curve_secp256k1;
+}
+
+void double_jacobian_secp256k1(uECC_word_t *X1, uECC_word_t *Y1,
+			       uECC_word_t *Z1, uECC_Curve curve)
+{
+	/* t1 = X, t2 = Y, t3 = Z */
+	uECC_word_t t4[NUM_ECC_WORDS];
+	uECC_word_t t5[NUM_ECC_WORDS];
+	wordcount_t num_words = curve->num_words;
+
+	if (uECC_vli_isZero(Z1, num_words)) {
+		return;
+	}
+
+	uECC_vli_modSquare_fast(t5, Y1, curve);   /* t5 = y1^2 */
+	uECC_vli_modMult_fast(t4, X1, t5, curve); /* t4 = x1*y1^2 = A */
+	uECC_vli_modSquare_fast(X1, X1, curve);   /* t1 = x1^2 */
+	uECC_vli_modSquare_fast(t5, t5, curve);   /* t5 = y1^4 */
+	uECC_vli_modMult_fast(Z1, Y1, Z1, curve); /* t3 = y1*z1 = z3 */
+
+	uECC_vli_modAdd(Y1, X1, X1, curve->p, num_words); /* t2 = 2*x1^2 */
+	uECC_vli_modAdd(Y1, Y1, X1, curve->p, num_words); /* t2 = 3*x1^2 */
+	if (uECC_vli_testBit(Y1, 0)) {
+		uECC_word_t l_carry = uECC_vli_add(Y1, Y1, curve->p, num_words);
+		uECC_vli_rshift1(Y1, num_words);
+		Y1[num_words - 1] |= l_carry << (uECC_WORD_BITS - 1);
+	} else {
+		uECC_vli_rshift1(Y1, num_words);
+	}
+	/* t2 = 3/2*(x1^2) = B */
+
+	uECC_vli_modSquare_fast(X1, Y1, curve); /* t1 = B^2 */
+	uECC_vli_modSub(X1, X1, t4, curve->p, num_words); /* t1 = B^2 - A */
+	uECC_vli_modSub(X1, X1, t4, curve->p, num_words); /* t1 = B^2 - 2A = x3 */
+
+	uECC_vli_modSub(t4, t4, X1, curve->p, num_words); /* t4 = A - x3 */
+	uECC_vli_modMult_fast(Y1, Y1, t4, curve); /* t2 = B * (A - x3) */
+	/* t2 = B * (A - x3) - y1^4 = y3: */
+	uECC_vli_modSub(Y1, Y1, t5, curve->p, num_words);
+}
+
+void x_side_secp256k1(uECC_word_t *result, const uECC_word_t *x,
+		      uECC_Curve curve)
+{
+	uECC_vli_modSquare_fast(result, x, curve); /* r = x^2 */
+	uECC_vli_modMult_fast(result, result, x, curve); /* r = x^3 */
+	/* r = x^3 + b: */
+	uECC_vli_modAdd(result, result, curve->b, curve->p, curve->num_words);
+}
+
+void mod_sqrt_secp256k1(uECC_word_t *a, uECC_Curve curve)
+{
+	uECC_word_t x2[NUM_ECC_WORDS];
+	uECC_word_t x3[NUM_ECC_WORDS];
+	uECC_word_t x22[NUM_ECC_WORDS];
+	uECC_word_t x44[NUM_ECC_WORDS];
+	uECC_word_t t[NUM_ECC_WORDS];
+
+	/* (p + 1) / 4 has blocks of 223, 22 and 2 ones; xN = a^(2^N - 1): */
+	mod_square_n(x2, a, 1, curve);
+	uECC_vli_modMult_fast(x2, x2, a, curve);
+	mod_square_n(x3, x2, 1, curve);
+	uECC_vli_modMult_fast(x3, x3, a, curve);
+	mod_square_n(t, x3, 3, curve);
+	uECC_vli_modMult_fast(t, t, x3, curve);		/* x6 */
+	mod_square_n(t, t, 3, curve);
+	uECC_vli_modMult_fast(t, t, x3, curve);		/* x9 */
+	mod_square_n(t, t, 2, curve);
+	uECC_vli_modMult_fast(t, t, x2, curve);		/* x11 */
+	mod_square_n(x22, t, 11, curve);
+	uECC_vli_modMult_fast(x22, x22, t, curve);
+	mod_square_n(x44, x22, 22, curve);
+	uECC_vli_modMult_fast(x44, x44, x22, curve);
+	mod_square_n(t, x44, 44, curve);
+	uECC_vli_modMult_fast(t, t, x44, curve);	/* x88 */
+	mod_square_n(a, t, 88, curve);
+	uECC_vli_modMult_fast(t, a, t, curve);		/* x176 */
+	mod_square_n(t, t, 44, curve);
+	uECC_vli_modMult_fast(t, t, x44, curve);	/* x220 */
+	mod_square_n(t, t, 3, curve);
+	uECC_vli_modMult_fast(t, t, x3, curve);		/* x223 */
+
+	mod_square_n(t, t, 23, curve);
+	uECC_vli_modMult_fast(t, t, x22, curve);
+	mod_square_n(t, t, 6, curve);
+	uECC_vli_modMult_fast(t, t, x2, curve);
+	mod_square_n(a, t, 2, curve);
+}
+
+/* result (NUM_ECC_WORDS + 2 words) = right * (2^32 + 977) */
+static void omega_mult_secp256k1(uECC_word_t *result, const uECC_word_t *right)
+{
+	uECC_dword_t acc = 0;
+	wordcount_t i;
+
+#if (uECC_WORD_SIZE == 8)
+	for (i = 0; i < NUM_ECC_WORDS; ++i) {
+		acc = (uECC_dword_t)0x1000003D1ull * right[i] +
+		      (acc >> uECC_WORD_BITS);
+		result[i] = (uECC_word_t)acc;
+	}
+	result[NUM_ECC_WORDS] = (uECC_word_t)(acc >> uECC_WORD_BITS);
+	result[NUM_ECC_WORDS + 1] = 0;
+#else
+	for (i = 0; i < NUM_ECC_WORDS; ++i) {
+		acc = (uECC_dword_t)0x3D1 * right[i] + (acc >> uECC_WORD_BITS);
+		result[i] = (uECC_word_t)acc;
+	}
+	result[NUM_ECC_WORDS] = (uECC_word_t)(acc >> uECC_WORD_BITS);
+	/* plus the 2^32 multiple, one word up: */
+	result[NUM_ECC_WORDS + 1] = uECC_vli_add(result + 1, result + 1, right,
+						 NUM_ECC_WORDS);
+#endif
+}
+
+void vli_mmod_fast_secp256k1(uECC_word_t *result, uECC_word_t *product)
+{
+	uECC_word_t tmp[NUM_ECC_WORDS + 2];
+	uECC_word_t high[NUM_ECC_WORDS];
+	uECC_word_t mask, carry;
+	wordcount_t i;
+
+	/* product = H 2^256 + L = L + H (2^32 + 977) (mod p): */
+	omega_mult_secp256k1(tmp, product + NUM_ECC_WORDS);
+	carry = uECC_vli_add(result, product, tmp, NUM_ECC_WORDS);
+
+	/* the overflow, below 2^34, once more: its product is below 2^67 */
+	uECC_vli_clear(high, NUM_ECC_WORDS);
+	high[0] = tmp[NUM_ECC_WORDS] + carry;
+	high[1] = tmp[NUM_ECC_WORDS + 1] + (high[0] < carry);
+	omega_mult_secp256k1(tmp, high);
+	carry = uECC_vli_add(result, result, tmp, NUM_ECC_WORDS);
+
+	/* a carry leaves result below 2^67, where adding 2^32 + 977 cannot
+	 * carry again: */
+	uECC_vli_clear(high, NUM_ECC_WORDS);
+	high[0] = carry;
+	omega_mult_secp256k1(tmp, high);
+	uECC_vli_add(result, result, tmp, NUM_ECC_WORDS);
+
+	/* result < 2^256 < 2p: subtract p unless that borrows */
+	mask = (uECC_word_t)0 -
+	       uECC_vli_sub(tmp, result, curve_secp256k1.p, NUM_ECC_WORDS);
+	for (i = 0; i < NUM_ECC_WORDS; ++i) {
+		result[i] = (result[i] & mask) | (tmp[i] & ~mask);
 	}
 }
 
@@ -788,21 +1653,249 @@ uECC_word_t regularize_k(const uECC_word_t * const k, uECC_word_t *k0,
 	return carry;
 }
 
-uECC_word_t EccPoint_compute_public_key(uECC_word_t *result,
-					uECC_word_t *private_key,
-					uECC_Curve curve)
+/*
+ * Mixed addition (X1, Y1, Z1) = (X1, Y1, Z1) + (x2, y2), with the second point
+ * in affine coordinates. Returns 1 if both points share the same x coordinate
+ * (doubling or point at infinity), in which case the result is not valid.
+ */
+static uECC_word_t add_mixed(uECC_word_t *X1, uECC_word_t *Y1, uECC_word_t *Z1,
+			     const uECC_word_t *x2, const uECC_word_t *y2,
+			     uECC_Curve curve)
+{
+	uECC_word_t t1[NUM_ECC_WORDS];
+	uECC_word_t t2[NUM_ECC_WORDS];
+	uECC_word_t t3[NUM_ECC_WORDS];
+	uECC_word_t t4[NUM_ECC_WORDS];
+	wordcount_t num_words = curve->num_words;
+
+	uECC_vli_modSquare_fast(t1, Z1, curve); /* t1 = z1^2 */
+	uECC_vli_modMult_fast(t2, t1, Z1, curve); /* t2 = z1^3 */
+	uECC_vli_modMult_fast(t1, t1, x2, curve); /* t1 = x2*z1^2 = U2 */
+	uECC_vli_modMult_fast(t2, t2, y2, curve); /* t2 = y2*z1^3 = S2 */
+	uECC_vli_modSub(t1, t1, X1, curve->p, num_words); /* t1 = U2 - x1 = H */
+	uECC_vli_modSub(t2, t2, Y1, curve->p, num_words); /* t2 = S2 - y1 = R */
+
+	uECC_vli_modMult_fast(Z1, Z1, t1, curve); /* z3 = z1*H */
+	uECC_vli_modSquare_fast(t3, t1, curve); /* t3 = H^2 */
+	uECC_vli_modMult_fast(t4, t3, t1, curve); /* t4 = H^3 */
+	uECC_vli_modMult_fast(t3, t3, X1, curve); /* t3 = x1*H^2 = V */
+
+	uECC_vli_modSquare_fast(X1, t2, curve); /* x3 = R^2 */
+	uECC_vli_modSub(X1, X1, t4, curve->p, num_words); /* x3 = R^2 - H^3 */
+	uECC_vli_modSub(X1, X1, t3, curve->p, num_words); /* x3 = R^2 - H^3 - V */
+	uECC_vli_modSub(X1, X1, t3, curve->p, num_words); /* x3 = R^2 - H^3 - 2V */
+
+	uECC_vli_modSub(t3, t3, X1, curve->p, num_words); /* t3 = V - x3 */
+	uECC_vli_modMult_fast(t3, t3, t2, curve); /* t3 = R*(V - x3) */
+	uECC_vli_modMult_fast(t4, t4, Y1, curve); /* t4 = y1*H^3 */
+	uECC_vli_modSub(Y1, t3, t4, curve->p, num_words); /* y3 = R*(V - x3) - y1*H^3 */
+
+	return uECC_vli_isZero(t1, num_words);
+}
+
+/* Returns all ones if a == b and 0 otherwise, without branching. */
+static uECC_word_t vli_eq_mask(uECC_word_t a, uECC_word_t b)
+{
+	uECC_word_t diff = a ^ b;
+	/* the top bit of (diff | -diff) is set iff diff != 0: */
+	return ((diff | (0 - diff)) >> (uECC_WORD_BITS - 1)) - 1;
+}
+
+/* Sets dest = src where mask is all ones, leaves dest alone where it is 0. */
+static void vli_cmov(uECC_word_t *dest, const uECC_word_t *src,
+		     uECC_word_t mask, wordcount_t num_words)
+{
+	wordcount_t i;
+	for (i = 0; i < num_words; ++i) {
+		dest[i] ^= mask & (dest[i] ^ src[i]);
+	}
+}
+
+/*
+ * Loads the table entry for window 'row' of the odd scalar k into (x, y).
+ * Windows are recoded to odd digits in [-15, 15]: digit i is
+ * (bits 4i..4i+4 of k) + 1 - bit 4i - 16, and the top digit keeps no sign.
+ * Every entry of the row is read, so the access pattern does not depend on k.
+ */
+static void table_select(uECC_word_t *x, uECC_word_t *y,
+			 const uECC_word_t *k, const uECC_FixedTable table,
+			 wordcount_t row, uECC_Curve curve)
+{
+	uECC_word_t tmp[NUM_ECC_WORDS];
+	bitcount_t bit = (bitcount_t)row * 4;
+	uECC_word_t w = (k[bit >> uECC_WORD_BITS_SHIFT] >>
+			 (bit & uECC_WORD_BITS_MASK)) & 0xF;
+	uECC_word_t d = w + 1 - (w & 1);
+	uECC_word_t neg = 0;
+	uECC_word_t mask;
+	uECC_word_t j;
+	wordcount_t num_words = curve->num_words;
+
+	if (row < uECC_FIXED_ROWS - 1) {
+		d += (uECC_word_t)(!!uECC_vli_testBit(k, bit + 4)) << 4;
+		neg = (d >> 4) ^ 1;
+		d -= 16;
+	}
+	mask = 0 - neg;
+	d = (d ^ mask) - mask; /* |digit| */
+
+	uECC_vli_clear(x, num_words);
+	uECC_vli_clear(y, num_words);
+	for (j = 0; j < uECC_FIXED_ENTRIES; ++j) {
+		uECC_word_t hit = vli_eq_mask(j, (d - 1) >> 1);
+		vli_cmov(x, table[row][j], hit, num_words);
+		vli_cmov(y, table[row][j] + num_words, hit, num_words);
+	}
+
+	/* y = -y for negative digits: */
+	uECC_vli_sub(tmp, curve->p, y, num_words);
+	vli_cmov(y, tmp, mask, num_words);
+}
+
+/*
+ * (X, Y, Z) = scalar * P in Jacobian coordinates, from the comb table of P.
+ * Returns 0 in the exceptional cases described for EccPoint_mult_fixed.
+ */
+static uECC_word_t mult_fixed_jacobian(uECC_word_t *X, uECC_word_t *Y,
+				       uECC_word_t *Z,
+				       const uECC_word_t *scalar,
+				       const uECC_FixedTable table,
+				       uECC_Curve curve)
+{
+	uECC_word_t k[NUM_ECC_WORDS];
+	uECC_word_t x[NUM_ECC_WORDS];
+	uECC_word_t y[NUM_ECC_WORDS];
+	uECC_word_t T[3][NUM_ECC_WORDS];
+	uECC_word_t odd = scalar[0] & 1;
+	uECC_word_t exceptional = 0;
+	uECC_word_t hit;
+	wordcount_t num_words = curve->num_words;
+	wordcount_t i;
+
+	/* The recoding needs an odd scalar: use k = n - scalar for an even scalar
+	 * and negate the result at the end. */
+	uECC_vli_sub(k, curve->n, scalar, num_words);
+	vli_cmov(k, scalar, 0 - odd, num_words);
+
+	table_select(X, Y, k, table, uECC_FIXED_ROWS - 1, curve);
+	uECC_vli_clear(Z, num_words);
+	Z[0] = 1;
+
+	for (i = uECC_FIXED_ROWS - 2; i > 0; --i) {
+		table_select(x, y, k, table, i, curve);
+		exceptional |= add_mixed(X, Y, Z, x, y, curve);
+	}
+
+	/* Only the last addition can meet its own operand, for k = n - 2, n - 6,
+	 * ..., n - 30: compute the doubling as well and keep it in that case. */
+	table_select(x, y, k, table, 0, curve);
+	uECC_vli_set(T[0], x, num_words);
+	uECC_vli_set(T[1], y, num_words);
+	uECC_vli_clear(T[2], num_words);
+	T[2][0] = 1;
+	curve->double_jacobian(T[0], T[1], T[2], curve);
+	hit = 0 - add_mixed(X, Y, Z, x, y, curve);
+	vli_cmov(X, T[0], hit, num_words);
+	vli_cmov(Y, T[1], hit, num_words);
+	vli_cmov(Z, T[2], hit, num_words);
+
+	/* y = -y for an even scalar: */
+	uECC_vli_sub(y, curve->p, Y, num_words);
+	vli_cmov(Y, y, odd - 1, num_words);
+
+	return !exceptional;
+}
+
+uECC_word_t EccPoint_mult_fixed(uECC_word_t *result, const uECC_word_t *scalar,
+				const uECC_FixedTable table, uECC_Curve curve)
+{
+	uECC_word_t Z[NUM_ECC_WORDS];
+	wordcount_t num_words = curve->num_words;
+	uECC_word_t r;
+
+	r = mult_fixed_jacobian(result, result + num_words, Z, scalar, table,
+				curve);
+	uECC_vli_modInv(Z, Z, curve->p, num_words);
+	apply_z(result, result + num_words, Z, curve);
+	return r;
+}
+
+void EccPoint_fixed_table(uECC_FixedTable table, const uECC_word_t *point,
+			  uECC_Curve curve)
 {
+	uECC_word_t z[uECC_FIXED_ROWS * NUM_ECC_WORDS];
+	uECC_word_t scratch[uECC_FIXED_ROWS * NUM_ECC_WORDS];
+	uECC_word_t bases[uECC_FIXED_ENTRIES][2 * NUM_ECC_WORDS];
+	uECC_word_t *X;
+	uECC_word_t *Y;
+	wordcount_t num_words = curve->num_words;
+	wordcount_t i, j;
+
+	/* 16^i P for every row, in Jacobian coordinates: */
+	uECC_vli_set(table[0][0], point, 2 * num_words);
+	uECC_vli_clear(z, num_words);
+	z[0] = 1;
+	for (i = 1; i < uECC_FIXED_ROWS; ++i) {
+		X = table[i][0];
+		Y = table[i][0] + num_words;
+		uECC_vli_set(X, table[i - 1][0], 2 * num_words);
+		uECC_vli_set(z + i * num_words, z + (i - 1) * num_words, num_words);
+		for (j = 0; j < 4; ++j) {
+			curve->double_jacobian(X, Y, z + i * num_words, curve);
+		}
+	}
+	uECC_vli_modInv_batch(z, scratch, uECC_FIXED_ROWS, curve->p, curve);
+	for (i = 0; i < uECC_FIXED_ROWS; ++i) {
+		apply_z(table[i][0], table[i][0] + num_words, z + i * num_words,
+			curve);
+	}
+
+	/* and their odd multiples, uECC_FIXED_ENTRIES rows per inversion: */
+	for (i = 0; i < uECC_FIXED_ROWS; i += uECC_FIXED_ENTRIES) {
+		for (j = 0; j < uECC_FIXED_ENTRIES; ++j) {
+			uECC_vli_set(bases[j], table[i + j][0], 2 * num_words);
+		}
+		EccPoint_odd_multiples_batch(table[i][0], bases[0],
+					     uECC_FIXED_ENTRIES, 5, z, scratch,
+					     curve);
+	}
+}
+
+#if uECC_FIXED_BASE_TABLE
 
+uECC_word_t mult_base_secp256r1(uECC_word_t *result, const uECC_word_t *scalar,
+				uECC_Curve curve)
+{
+	return EccPoint_mult_fixed(result, scalar, secp256r1_G_table, curve);
+}
+
+#endif /* uECC_FIXED_BASE_TABLE */
+
+void EccPoint_mult_base(uECC_word_t * result, const uECC_word_t * scalar,
+			uECC_Curve curve)
+{
 	uECC_word_t tmp1[NUM_ECC_WORDS];
  	uECC_word_t tmp2[NUM_ECC_WORDS];
 	uECC_word_t *p2[2] = {tmp1, tmp2};
 	uECC_word_t carry;
 
+	if (curve->mult_base && curve->mult_base(result, scalar, curve)) {
+		return;
+	}
+
 	/* Regularize the bitcount for the private key so that attackers cannot
 	 * use a side channel attack to learn the number of leading zeros. */
-	carry = regularize_k(private_key, tmp1, tmp2, curve);
+	carry = regularize_k(scalar, tmp1, tmp2, curve);
 
 	EccPoint_mult(result, curve->G, p2[!carry], 0, curve->num_n_bits + 1, curve);
+}
+
+uECC_word_t EccPoint_compute_public_key(uECC_word_t *result,
+					uECC_word_t *private_key,
+					uECC_Curve curve)
+{
+
+	EccPoint_mult_base(result, private_key, curve);
 
 	if (EccPoint_isZero(result, curve)) {
 		return 0;
@@ -810,9 +1903,788 @@ uECC_word_t EccPoint_compute_public_key(uECC_word_t *result,
 	return 1;
 }
 
+void EccPoint_compute_public_keys(uECC_word_t *results,
+				  const uECC_word_t *private_keys,
+				  unsigned int count, uECC_word_t *z,
+				  uECC_word_t *scratch, uECC_Curve curve)
+{
+	wordcount_t num_words = curve->num_words;
+	unsigned int i;
+
+	for (i = 0; i < count; ++i) {
+		uECC_word_t *X = results + i * 2 * num_words;
+		const uECC_word_t *k = private_keys + i * num_words;
+		uECC_word_t *Z = z + i * num_words;
+
+#if uECC_FIXED_BASE_TABLE
+		if (curve->mult_base == &mult_base_secp256r1 &&
+		    mult_fixed_jacobian(X, X + num_words, Z, k,
+					secp256r1_G_table, curve)) {
+			continue;
+		}
+#endif
+		/* no table, or an exceptional case of the comb: */
+		EccPoint_mult_base(X, k, curve);
+		uECC_vli_clear(Z, num_words);
+		Z[0] = 1;
+	}
+
+	/* modulo p, the products and the inversion all run in constant time: */
+	uECC_vli_modInv_batch(z, scratch, count, curve->p, curve);
+	for (i = 0; i < count; ++i) {
+		uECC_word_t *X = results + i * 2 * num_words;
+		apply_z(X, X + num_words, z + i * num_words, curve);
+	}
+}
+
+/*
+ * result = left * right % mod: the fast reduction when mod is p, and a
+ * Montgomery product (both factors in the Montgomery domain) otherwise.
+ */
+static void batch_mult(uECC_word_t *result, const uECC_word_t *left,
+		       const uECC_word_t *right, const uECC_word_t *mod,
+		       uECC_word_t mod_inv, uECC_Curve curve)
+{
+	if (mod == curve->p) {
+		uECC_vli_modMult_fast(result, left, right, curve);
+	} else {
+		uECC_vli_montMult(result, left, right, mod, mod_inv,
+				  curve->num_words);
+	}
+}
+
+void uECC_vli_modInv_batch(uECC_word_t *values, uECC_word_t *scratch,
+			   unsigned int count, const uECC_word_t *mod,
+			   uECC_Curve curve)
+{
+	uECC_word_t inv[NUM_ECC_WORDS];
+	uECC_word_t tmp[NUM_ECC_WORDS];
+	uECC_word_t r2[NUM_ECC_WORDS];
+	uECC_word_t one[NUM_ECC_WORDS];
+	uECC_word_t mod_inv = 0;
+	wordcount_t num_words = curve->num_words;
+	unsigned int i;
+
+	if (count == 0) {
+		return;
+	}
+
+	/* Moduli without a fast reduction (curve_n) go through the Montgomery
+	 * domain, where a product costs a fraction of uECC_vli_modMult: */
+	if (mod != curve->p) {
+		mod_inv = uECC_vli_montInit(r2, mod, num_words);
+		for (i = 0; i < count; ++i) {
+			uECC_vli_montMult(values + i * num_words,
+					  values + i * num_words, r2, mod,
+					  mod_inv, num_words);
+		}
+	}
+
+	/* scratch[i] = values[0] * ... * values[i]: */
+	uECC_vli_set(scratch, values, num_words);
+	for (i = 1; i < count; ++i) {
+		batch_mult(scratch + i * num_words, scratch + (i - 1) * num_words,
+			   values + i * num_words, mod, mod_inv, curve);
+	}
+
+	uECC_vli_modInv(inv, scratch + (count - 1) * num_words, mod, num_words);
+	if (mod != curve->p) {
+		/* (aR)^-1 = a^-1 R^-1 -> a^-1 R: */
+		uECC_vli_montMult(inv, inv, r2, mod, mod_inv, num_words);
+		uECC_vli_montMult(inv, inv, r2, mod, mod_inv, num_words);
+	}
+
+	/* walk back, peeling one value off the running inverse at a time: */
+	for (i = count - 1; i > 0; --i) {
+		batch_mult(tmp, inv, scratch + (i - 1) * num_words, mod, mod_inv,
+			   curve);
+		batch_mult(inv, inv, values + i * num_words, mod, mod_inv, curve);
+		uECC_vli_set(values + i * num_words, tmp, num_words);
+	}
+	uECC_vli_set(values, inv, num_words);
+
+	if (mod != curve->p) {
+		uECC_vli_clear(one, num_words);
+		one[0] = 1;
+		for (i = 0; i < count; ++i) {
+			uECC_vli_montMult(values + i * num_words,
+					  values + i * num_words, one, mod,
+					  mod_inv, num_words);
+		}
+	}
+}
+
+void EccPoint_odd_multiples_batch(uECC_word_t *tables,
+				  const uECC_word_t *points,
+				  unsigned int num_points, wordcount_t width,
+				  uECC_word_t *z, uECC_word_t *scratch,
+				  uECC_Curve curve)
+{
+	uECC_word_t Xd[NUM_ECC_WORDS];
+	uECC_word_t Yd[NUM_ECC_WORDS];
+	wordcount_t num_words = curve->num_words;
+	unsigned int count = 1u << (width - 2);
+	unsigned int i, j;
+
+	for (j = 0; j < num_points; ++j) {
+		const uECC_word_t *point = points + j * 2 * num_words;
+		uECC_word_t *table = tables + j * count * 2 * num_words;
+		uECC_word_t *zt = z + j * count * num_words;
+
+		/* D = 2P, and P brought to the same Z: */
+		uECC_vli_set(Xd, point, num_words);
+		uECC_vli_set(Yd, point + num_words, num_words);
+		uECC_vli_clear(zt, num_words);
+		zt[0] = 1;
+		curve->double_jacobian(Xd, Yd, zt, curve);
+		uECC_vli_set(table, point, 2 * num_words);
+		apply_z(table, table + num_words, zt, curve);
+
+		/* (2i + 1)P = (2i - 1)P + D with co-Z additions, which scale Z
+		 * by (x2 - x1) at each step and keep D on the new Z: */
+		for (i = 1; i < count; ++i) {
+			uECC_word_t *prev = table + (i - 1) * 2 * num_words;
+			uECC_word_t *cur = table + i * 2 * num_words;
+
+			uECC_vli_set(cur, prev, 2 * num_words);
+			uECC_vli_modSub(zt + i * num_words, cur, Xd, curve->p,
+					num_words);
+			uECC_vli_modMult_fast(zt + i * num_words,
+					      zt + i * num_words,
+					      zt + (i - 1) * num_words, curve);
+			XYcZ_add(Xd, Yd, cur, cur + num_words, curve);
+		}
+	}
+
+	/* back to affine coordinates with a single inversion for all tables: */
+	uECC_vli_modInv_batch(z, scratch, num_points * count, curve->p, curve);
+	for (i = 0; i < num_points * count; ++i) {
+		uECC_word_t *cur = tables + i * 2 * num_words;
+		apply_z(cur, cur + num_words, z + i * num_words, curve);
+	}
+}
+
+void EccPoint_odd_multiples(uECC_word_t *table, const uECC_word_t *point,
+			    wordcount_t width, uECC_Curve curve)
+{
+	uECC_word_t z[(1 << (uECC_WNAF_MAX_WIDTH - 2)) * NUM_ECC_WORDS];
+	uECC_word_t scratch[(1 << (uECC_WNAF_MAX_WIDTH - 2)) * NUM_ECC_WORDS];
+
+	EccPoint_odd_multiples_batch(table, point, 1, width, z, scratch, curve);
+}
+
+const uECC_word_t *EccPoint_odd_multiples_G(uECC_Curve curve,
+					    wordcount_t *width)
+{
+#if uECC_FIXED_BASE_TABLE
+	if (curve->mult_base == &mult_base_secp256r1) {
+		*width = 5;
+		return secp256r1_G_table[0][0];
+	}
+#endif
+	(void)curve;
+	*width = 0;
+	return 0;
+}
+
+bitcount_t wnaf_recode(int_least8_t *naf, const uECC_word_t *scalar,
+		       wordcount_t width, wordcount_t num_words)
+{
+	uECC_word_t k[NUM_ECC_WORDS + 1];
+	uECC_word_t window = (uECC_word_t)1 << width;
+	bitcount_t i = 0;
+
+	uECC_vli_set(k, scalar, num_words);
+	k[num_words] = 0;
+
+	while (!uECC_vli_isZero(k, num_words + 1)) {
+		int d = 0;
+		if (k[0] & 1) {
+			uECC_word_t low = k[0] & (window - 1);
+			if (low >= (window >> 1)) {
+				/* negative digit: k = k + (window - low) */
+				uECC_word_t add = window - low;
+				wordcount_t j;
+				d = (int)low - (int)window;
+				k[0] += add;
+				if (k[0] < add) {
+					for (j = 1; j <= num_words && ++k[j] == 0; ++j) {
+					}
+				}
+			} else {
+				d = (int)low;
+				k[0] -= low;
+			}
+		}
+		naf[i++] = (int_least8_t)d;
+		uECC_vli_rshift1(k, num_words + 1);
+	}
+	return i;
+}
+
+/*
+ * (X1, Y1, Z1) = (X1, Y1, Z1) + (x2, y2), with the second point in affine
+ * coordinates and the first one possibly at infinity (Z1 == 0). Handles every
+ * special case, in variable time.
+ */
+static void add_mixed_var(uECC_word_t *X1, uECC_word_t *Y1, uECC_word_t *Z1,
+			  const uECC_word_t *x2, const uECC_word_t *y2,
+			  uECC_Curve curve)
+{
+	uECC_word_t save[3][NUM_ECC_WORDS];
+	wordcount_t num_words = curve->num_words;
+
+	if (uECC_vli_isZero(Z1, num_words)) {
+		uECC_vli_set(X1, x2, num_words);
+		uECC_vli_set(Y1, y2, num_words);
+		uECC_vli_clear(Z1, num_words);
+		Z1[0] = 1;
+		return;
+	}
+
+	uECC_vli_set(save[0], X1, num_words);
+	uECC_vli_set(save[1], Y1, num_words);
+	uECC_vli_set(save[2], Z1, num_words);
+	if (!add_mixed(X1, Y1, Z1, x2, y2, curve)) {
+		return;
+	}
+
+	/* Same x coordinate: the points are either equal or opposite. */
+	uECC_vli_modMult_fast(save[0], save[2], save[2], curve);
+	uECC_vli_modMult_fast(save[0], save[0], save[2], curve);
+	uECC_vli_modMult_fast(save[0], save[0], y2, curve); /* y2 * z1^3 */
+	if (uECC_vli_equal(save[0], save[1], num_words) == 0) {
+		uECC_vli_set(X1, x2, num_words);
+		uECC_vli_set(Y1, y2, num_words);
+		uECC_vli_clear(Z1, num_words);
+		Z1[0] = 1;
+		curve->double_jacobian(X1, Y1, Z1, curve);
+	} else {
+		uECC_vli_clear(Z1, num_words);
+	}
+}
+
+/* naf holds num_terms rows of uECC_WNAF_DIGITS digits. */
+static void mult_wnaf(uECC_word_t *X, uECC_word_t *Y, uECC_word_t *Z,
+		      const uECC_word_t * const *scalars,
+		      const uECC_word_t * const *tables,
+		      const wordcount_t *widths, unsigned int num_terms,
+		      int_least8_t (*naf)[uECC_WNAF_DIGITS], uECC_Curve curve)
+{
+	uECC_word_t neg_y[NUM_ECC_WORDS];
+	wordcount_t num_words = curve->num_words;
+	bitcount_t num_digits = 0;
+	bitcount_t i;
+	unsigned int t;
+
+	memset(naf, 0, num_terms * sizeof(naf[0]));
+	for (t = 0; t < num_terms; ++t) {
+		bitcount_t len = wnaf_recode(naf[t], scalars[t], widths[t], num_words);
+		if (len > num_digits) {
+			num_digits = len;
+		}
+	}
+
+	/* start at infinity: */
+	uECC_vli_clear(X, num_words);
+	uECC_vli_clear(Y, num_words);
+	uECC_vli_clear(Z, num_words);
+
+	for (i = num_digits - 1; i >= 0; --i) {
+		curve->double_jacobian(X, Y, Z, curve);
+		for (t = 0; t < num_terms; ++t) {
+			int d = naf[t][i];
+			const uECC_word_t *entry;
+			if (d == 0) {
+				continue;
+			}
+			entry = tables[t] + ((d < 0 ? -d : d) >> 1) * 2 * num_words;
+			if (d > 0) {
+				add_mixed_var(X, Y, Z, entry, entry + num_words, curve);
+			} else {
+				uECC_vli_sub(neg_y, curve->p, entry + num_words, num_words);
+				add_mixed_var(X, Y, Z, entry, neg_y, curve);
+			}
+		}
+	}
+}
+
+/* c = round(k * g / 2^384), for k, g < 2^256 */
+static void mul_shift_384(uECC_word_t *c, const uECC_word_t *k,
+			  const uECC_word_t *g)
+{
+	uECC_word_t product[2 * NUM_ECC_WORDS];
+	uECC_word_t one[NUM_ECC_WORDS];
+	wordcount_t shift = 384 / uECC_WORD_BITS;
+
+	uECC_vli_mult(product, k, g, NUM_ECC_WORDS);
+	uECC_vli_clear(c, NUM_ECC_WORDS);
+	uECC_vli_set(c, product + shift, 2 * NUM_ECC_WORDS - shift);
+	uECC_vli_clear(one, NUM_ECC_WORDS);
+	one[0] = uECC_vli_testBit(product, 383) ? 1 : 0;
+	uECC_vli_add(c, c, one, NUM_ECC_WORDS);
+}
+
+/* r = |r| (mod n); returns 1 if r stood for a negative number */
+static unsigned int glv_abs(uECC_word_t *r, uECC_Curve curve)
+{
+	uECC_word_t half[NUM_ECC_WORDS];
+
+	uECC_vli_set(half, curve->n, NUM_ECC_WORDS);
+	uECC_vli_rshift1(half, NUM_ECC_WORDS);
+	if (uECC_vli_cmp_unsafe(r, half, NUM_ECC_WORDS) > 0) {
+		uECC_vli_sub(r, curve->n, r, NUM_ECC_WORDS);
+		return 1;
+	}
+	return 0;
+}
+
+unsigned int EccPoint_glv_split(uECC_word_t *k1, uECC_word_t *k2,
+				const uECC_word_t *k, uECC_Curve curve)
+{
+	const struct uECC_GLV_t *glv = curve->glv;
+	uECC_word_t c1[NUM_ECC_WORDS];
+	uECC_word_t c2[NUM_ECC_WORDS];
+	uECC_word_t r2[NUM_ECC_WORDS];
+	uECC_word_t n_inv;
+
+	/* k2 = -(c1 b1 + c2 b2), k1 = k - k2 lambda, with c1 and c2 the
+	 * rounded coordinates of k in the basis of the lattice. The products
+	 * mod n are Montgomery products, taken back out with R^2: */
+	n_inv = uECC_vli_montInit(r2, curve->n, NUM_ECC_WORDS);
+	mul_shift_384(c1, k, glv->g1);
+	mul_shift_384(c2, k, glv->g2);
+	uECC_vli_montMult(c1, c1, glv->minus_b1, curve->n, n_inv, NUM_ECC_WORDS);
+	uECC_vli_montMult(c2, c2, glv->minus_b2, curve->n, n_inv, NUM_ECC_WORDS);
+	uECC_vli_modAdd(k2, c1, c2, curve->n, NUM_ECC_WORDS);
+	uECC_vli_montMult(k2, k2, r2, curve->n, n_inv, NUM_ECC_WORDS);
+	uECC_vli_montMult(c1, k2, glv->lambda, curve->n, n_inv, NUM_ECC_WORDS);
+	uECC_vli_montMult(c1, c1, r2, curve->n, n_inv, NUM_ECC_WORDS);
+	uECC_vli_modSub(k1, k, c1, curve->n, NUM_ECC_WORDS);
+
+	return glv_abs(k1, curve) | (glv_abs(k2, curve) << 1);
+}
+
+/*
+ * Copies a table of odd multiples of P, applying the endomorphism
+ * (x -> beta x) if endo is set and negating every entry if neg is set.
+ */
+static void glv_table(uECC_word_t *dest, const uECC_word_t *table,
+		      wordcount_t width, unsigned int endo, unsigned int neg,
+		      uECC_Curve curve)
+{
+	wordcount_t num_words = curve->num_words;
+	unsigned int count = 1u << (width - 2);
+	unsigned int i;
+
+	for (i = 0; i < count; ++i) {
+		const uECC_word_t *src = table + i * 2 * num_words;
+		uECC_word_t *dst = dest + i * 2 * num_words;
+
+		if (endo) {
+			uECC_vli_modMult_fast(dst, src, curve->glv->beta, curve);
+		} else {
+			uECC_vli_set(dst, src, num_words);
+		}
+		if (neg) {
+			uECC_vli_sub(dst + num_words, curve->p, src + num_words,
+				     num_words);
+		} else {
+			uECC_vli_set(dst + num_words, src + num_words, num_words);
+		}
+	}
+}
+
+/* Whether EccPoint_mult_wnaf splits the scalars with the endomorphism. */
+static int wnaf_uses_glv(wordcount_t num_terms, uECC_Curve curve)
+{
+	return curve->glv && 2 * num_terms <= uECC_WNAF_MAX_TERMS;
+}
+
+unsigned int EccPoint_mult_wnaf_scratch_words(const wordcount_t *widths,
+					      wordcount_t num_terms,
+					      uECC_Curve curve)
+{
+	unsigned int words = 0;
+	wordcount_t i;
+
+	if (!wnaf_uses_glv(num_terms, curve)) {
+		return uECC_WNAF_NAF_WORDS(num_terms);
+	}
+	/* both halves of every scalar and of every table, then the digits: */
+	for (i = 0; i < num_terms; ++i) {
+		words += 2 * (NUM_ECC_WORDS +
+			      (1u << (widths[i] - 2)) * 2 * NUM_ECC_WORDS);
+	}
+	return words + uECC_WNAF_NAF_WORDS(2 * num_terms);
+}
+
+void EccPoint_mult_wnaf_scratch(uECC_word_t *X, uECC_word_t *Y,
+				uECC_word_t *Z,
+				const uECC_word_t * const *scalars,
+				const uECC_word_t * const *tables,
+				const wordcount_t *widths, wordcount_t num_terms,
+				uECC_word_t *scratch, uECC_Curve curve)
+{
+	const uECC_word_t *glv_scalars[uECC_WNAF_MAX_TERMS];
+	const uECC_word_t *glv_tables[uECC_WNAF_MAX_TERMS];
+	wordcount_t glv_widths[uECC_WNAF_MAX_TERMS];
+	unsigned int signs;
+	wordcount_t i;
+
+	if (!wnaf_uses_glv(num_terms, curve)) {
+		mult_wnaf(X, Y, Z, scalars, tables, widths, num_terms,
+			  (int_least8_t (*)[uECC_WNAF_DIGITS])scratch, curve);
+		return;
+	}
+
+	/* k P = k1 P + k2 lambda(P): twice the terms for half the doublings */
+	for (i = 0; i < num_terms; ++i) {
+		uECC_word_t *k1 = scratch;
+		uECC_word_t *k2 = k1 + NUM_ECC_WORDS;
+		uECC_word_t *t1 = k2 + NUM_ECC_WORDS;
+		uECC_word_t *t2 = t1 + (1u << (widths[i] - 2)) * 2 * NUM_ECC_WORDS;
+
+		scratch = t2 + (1u << (widths[i] - 2)) * 2 * NUM_ECC_WORDS;
+		signs = EccPoint_glv_split(k1, k2, scalars[i], curve);
+		glv_table(t1, tables[i], widths[i], 0, signs & 1, curve);
+		glv_table(t2, tables[i], widths[i], 1, signs >> 1, curve);
+		glv_scalars[2 * i] = k1;
+		glv_scalars[2 * i + 1] = k2;
+		glv_tables[2 * i] = t1;
+		glv_tables[2 * i + 1] = t2;
+		glv_widths[2 * i] = widths[i];
+		glv_widths[2 * i + 1] = widths[i];
+	}
+	mult_wnaf(X, Y, Z, glv_scalars, glv_tables, glv_widths, 2 * num_terms,
+		  (int_least8_t (*)[uECC_WNAF_DIGITS])scratch, curve);
+}
+
+void EccPoint_mult_wnaf(uECC_word_t *X, uECC_word_t *Y, uECC_word_t *Z,
+			const uECC_word_t * const *scalars,
+			const uECC_word_t * const *tables,
+			const wordcount_t *widths, wordcount_t num_terms,
+			uECC_Curve curve)
+{
+	uECC_word_t scratch[uECC_WNAF_SCRATCH_WORDS];
+
+	EccPoint_mult_wnaf_scratch(X, Y, Z, scalars, tables, widths, num_terms,
+				   scratch, curve);
+}
+
+/*
+ * (X1, Y1, Z1) = (X1, Y1, Z1) + (X2, Y2, Z2), both in Jacobian coordinates
+ * and either one possibly at infinity (Z == 0). Handles every special case,
+ * in variable time.
+ */
+static void add_jacobian_var(uECC_word_t *X1, uECC_word_t *Y1,
+			     uECC_word_t *Z1, const uECC_word_t *X2,
+			     const uECC_word_t *Y2, const uECC_word_t *Z2,
+			     uECC_Curve curve)
+{
+	uECC_word_t u1[NUM_ECC_WORDS];
+	uECC_word_t s1[NUM_ECC_WORDS];
+	uECC_word_t h[NUM_ECC_WORDS];
+	uECC_word_t r[NUM_ECC_WORDS];
+	uECC_word_t t[NUM_ECC_WORDS];
+	wordcount_t num_words = curve->num_words;
+
+	if (uECC_vli_isZero(Z2, num_words)) {
+		return;
+	}
+	if (uECC_vli_isZero(Z1, num_words)) {
+		uECC_vli_set(X1, X2, num_words);
+		uECC_vli_set(Y1, Y2, num_words);
+		uECC_vli_set(Z1, Z2, num_words);
+		return;
+	}
+
+	uECC_vli_modSquare_fast(t, Z2, curve); /* t = z2^2 */
+	uECC_vli_modMult_fast(u1, X1, t, curve); /* u1 = x1*z2^2 */
+	uECC_vli_modMult_fast(t, t, Z2, curve); /* t = z2^3 */
+	uECC_vli_modMult_fast(s1, Y1, t, curve); /* s1 = y1*z2^3 */
+	uECC_vli_modSquare_fast(t, Z1, curve); /* t = z1^2 */
+	uECC_vli_modMult_fast(h, X2, t, curve); /* h = x2*z1^2 = u2 */
+	uECC_vli_modMult_fast(t, t, Z1, curve); /* t = z1^3 */
+	uECC_vli_modMult_fast(r, Y2, t, curve); /* r = y2*z1^3 = s2 */
+	uECC_vli_modSub(h, h, u1, curve->p, num_words); /* h = u2 - u1 */
+	uECC_vli_modSub(r, r, s1, curve->p, num_words); /* r = s2 - s1 */
+
+	if (uECC_vli_isZero(h, num_words)) {
+		/* same x coordinate: equal or opposite points */
+		if (uECC_vli_isZero(r, num_words)) {
+			curve->double_jacobian(X1, Y1, Z1, curve);
+		} else {
+			uECC_vli_clear(Z1, num_words);
+		}
+		return;
+	}
+
+	uECC_vli_modMult_fast(Z1, Z1, Z2, curve);
+	uECC_vli_modMult_fast(Z1, Z1, h, curve); /* z3 = z1*z2*h */
+	uECC_vli_modSquare_fast(t, h, curve); /* t = h^2 */
+	uECC_vli_modMult_fast(h, h, t, curve); /* h = h^3 */
+	uECC_vli_modMult_fast(u1, u1, t, curve); /* u1 = u1*h^2 = v */
+
+	uECC_vli_modSquare_fast(X1, r, curve); /* x3 = r^2 */
+	uECC_vli_modSub(X1, X1, h, curve->p, num_words); /* x3 = r^2 - h^3 */
+	uECC_vli_modSub(X1, X1, u1, curve->p, num_words);
+	uECC_vli_modSub(X1, X1, u1, curve->p, num_words); /* x3 -= 2v */
+
+	uECC_vli_modSub(u1, u1, X1, curve->p, num_words); /* u1 = v - x3 */
+	uECC_vli_modMult_fast(u1, u1, r, curve); /* u1 = r*(v - x3) */
+	uECC_vli_modMult_fast(s1, s1, h, curve); /* s1 = s1*h^3 */
+	uECC_vli_modSub(Y1, u1, s1, curve->p, num_words); /* y3 = r*(v - x3) - s1*h^3 */
+}
+
+/* Number of interleaved wNAF terms of msm_straus for num_points points. */
+static unsigned int straus_terms(unsigned int num_points, uECC_Curve curve)
+{
+	return curve->glv ? 2 * num_points : num_points;
+}
+
+/*
+ * Straus: the tables of all points with a single inversion, then one
+ * interleaved wNAF over all terms, split with the endomorphism if the curve
+ * has one (the table of k2 is phi of the table of k1).
+ */
+static void msm_straus(uECC_word_t *X, uECC_word_t *Y, uECC_word_t *Z,
+		       const uECC_word_t *scalars, const uECC_word_t *points,
+		       unsigned int num_points, uECC_word_t *scratch,
+		       uECC_Curve curve)
+{
+	const uECC_word_t *term_scalars[2 * uECC_MSM_STRAUS_MAX];
+	const uECC_word_t *term_tables[2 * uECC_MSM_STRAUS_MAX];
+	wordcount_t widths[2 * uECC_MSM_STRAUS_MAX];
+	wordcount_t num_words = curve->num_words;
+	unsigned int table_words = (1u << (uECC_MSM_WIDTH - 2)) * 2 * num_words;
+	unsigned int num_terms = straus_terms(num_points, curve);
+	uECC_word_t *tables = scratch;
+	uECC_word_t *halves = tables + num_terms * table_words;
+	uECC_word_t *rest = halves + (curve->glv ? num_terms * NUM_ECC_WORDS : 0);
+	unsigned int signs;
+	unsigned int i;
+
+	EccPoint_odd_multiples_batch(tables, points, num_points, uECC_MSM_WIDTH,
+				     rest, rest + num_points * table_words / 2,
+				     curve);
+
+	for (i = 0; i < num_points; ++i) {
+		uECC_word_t *table = tables + i * table_words;
+
+		term_scalars[i] = scalars + i * num_words;
+		term_tables[i] = table;
+		widths[i] = uECC_MSM_WIDTH;
+		if (curve->glv) {
+			uECC_word_t *k1 = halves + i * NUM_ECC_WORDS;
+			uECC_word_t *k2 = halves + (num_points + i) * NUM_ECC_WORDS;
+			uECC_word_t *phi = tables + (num_points + i) * table_words;
+
+			signs = EccPoint_glv_split(k1, k2, scalars + i * num_words,
+						   curve);
+			glv_table(phi, table, uECC_MSM_WIDTH, 1, signs >> 1, curve);
+			glv_table(table, table, uECC_MSM_WIDTH, 0, signs & 1, curve);
+			term_scalars[i] = k1;
+			term_scalars[num_points + i] = k2;
+			term_tables[num_points + i] = phi;
+			widths[num_points + i] = uECC_MSM_WIDTH;
+		}
+	}
+
+	/* the digits take the place of the scratch of the tables: */
+	mult_wnaf(X, Y, Z, term_scalars, term_tables, widths, num_terms,
+		  (int_least8_t (*)[uECC_WNAF_DIGITS])rest, curve);
+}
+
+/* Window width of msm_pippenger for num_points points. */
+static int msm_window(unsigned int num_points, uECC_Curve curve)
+{
+	unsigned long best_cost = ~0ul;
+	int best = 2;
+	int c;
+
+	/*
+	 * windows * (one mixed addition per point + two Jacobian additions
+	 * per bucket), in field multiplications:
+	 */
+	for (c = 2; c <= uECC_MSM_MAX_WINDOW; ++c) {
+		unsigned long cost = (unsigned long)(curve->num_n_bits / c + 1) *
+				     (11ul * num_points + (32ul << (c - 1)));
+		if (cost < best_cost) {
+			best_cost = cost;
+			best = c;
+		}
+	}
+	return best;
+}
+
+/*
+ * Signed digits of scalar (below curve->n) in base 2^c, least significant
+ * first: every digit but the last lies in [-2^(c-1), 2^(c-1)), and the last
+ * one, which holds fewer than c bits and a carry, in [0, 2^(c-1)].
+ */
+static void msm_digits(int_least16_t *digits, const uECC_word_t *scalar,
+		       int num_windows, int c, wordcount_t num_words)
+{
+	uECC_word_t mask = ((uECC_word_t)1 << c) - 1;
+	uECC_word_t carry = 0;
+	int w;
+
+	for (w = 0; w < num_windows; ++w) {
+		bitcount_t bit = (bitcount_t)(w * c);
+		wordcount_t word = bit >> uECC_WORD_BITS_SHIFT;
+		unsigned int shift = bit & uECC_WORD_BITS_MASK;
+		uECC_word_t v = 0;
+
+		if (word < num_words) {
+			v = scalar[word] >> shift;
+			if (shift + c > uECC_WORD_BITS && word + 1 < num_words) {
+				v |= scalar[word + 1] << (uECC_WORD_BITS - shift);
+			}
+		}
+		v = (v & mask) + carry;
+		if (w == num_windows - 1) {
+			digits[w] = (int_least16_t)v;
+			break;
+		}
+		carry = (v + (mask >> 1) + 1) >> c;
+		digits[w] = (int_least16_t)((int)v - (int)(carry << c));
+	}
+}
+
+/* Words of scratch of msm_pippenger before its digits. */
+static unsigned int pippenger_bucket_words(int c, uECC_Curve curve)
+{
+	/* the buckets, then the running sum and the sum of a window: */
+	return ((1u << (c - 1)) + 2) * 3 * curve->num_words;
+}
+
+/*
+ * Pippenger: per window of c bits, from the top, every point is added to the
+ * bucket of its signed digit (negated for negative digits), and the buckets
+ * are summed with weights 1 .. 2^(c-1) by running sums.
+ */
+static void msm_pippenger(uECC_word_t *X, uECC_word_t *Y, uECC_word_t *Z,
+			  const uECC_word_t *scalars, const uECC_word_t *points,
+			  unsigned int num_points, uECC_word_t *scratch,
+			  uECC_Curve curve)
+{
+	uECC_word_t neg_y[NUM_ECC_WORDS];
+	wordcount_t num_words = curve->num_words;
+	int c = msm_window(num_points, curve);
+	int num_windows = curve->num_n_bits / c + 1;
+	unsigned int num_buckets = 1u << (c - 1);
+	unsigned int point_words = 3 * num_words;
+	uECC_word_t *buckets = scratch;
+	uECC_word_t *running = buckets + num_buckets * point_words;
+	uECC_word_t *sum = running + point_words;
+	int_least16_t *digits =
+		(int_least16_t *)(scratch + pippenger_bucket_words(c, curve));
+	unsigned int i, k;
+	int w, j;
+
+	for (i = 0; i < num_points; ++i) {
+		msm_digits(digits + i * num_windows, scalars + i * num_words,
+			   num_windows, c, num_words);
+	}
+
+	/* start at infinity: */
+	uECC_vli_clear(X, num_words);
+	uECC_vli_clear(Y, num_words);
+	uECC_vli_clear(Z, num_words);
+
+	for (w = num_windows - 1; w >= 0; --w) {
+		for (j = 0; j < c; ++j) {
+			curve->double_jacobian(X, Y, Z, curve);
+		}
+
+		for (k = 0; k < num_buckets; ++k) {
+			uECC_vli_clear(buckets + k * point_words + 2 * num_words,
+				       num_words);
+		}
+		for (i = 0; i < num_points; ++i) {
+			int d = digits[i * num_windows + w];
+			const uECC_word_t *point = points + i * 2 * num_words;
+			uECC_word_t *bucket;
+
+			if (d == 0) {
+				continue;
+			}
+			bucket = buckets + ((d < 0 ? -d : d) - 1) * point_words;
+			if (d > 0) {
+				add_mixed_var(bucket, bucket + num_words,
+					      bucket + 2 * num_words, point,
+					      point + num_words, curve);
+			} else {
+				uECC_vli_sub(neg_y, curve->p, point + num_words,
+					     num_words);
+				add_mixed_var(bucket, bucket + num_words,
+					      bucket + 2 * num_words, point,
+					      neg_y, curve);
+			}
+		}
+
+		/* sum = sum of (k + 1) buckets[k]: */
+		uECC_vli_clear(running + 2 * num_words, num_words);
+		uECC_vli_clear(sum + 2 * num_words, num_words);
+		for (k = num_buckets; k-- > 0;) {
+			uECC_word_t *bucket = buckets + k * point_words;
+
+			add_jacobian_var(running, running + num_words,
+					 running + 2 * num_words, bucket,
+					 bucket + num_words, bucket + 2 * num_words,
+					 curve);
+			add_jacobian_var(sum, sum + num_words, sum + 2 * num_words,
+					 running, running + num_words,
+					 running + 2 * num_words, curve);
+		}
+		add_jacobian_var(X, Y, Z, sum, sum + num_words, sum + 2 * num_words,
+				 curve);
+	}
+}
+
+unsigned int EccPoint_mult_multi_scratch_words(unsigned int num_points,
+					       uECC_Curve curve)
+{
+	unsigned int num_terms = straus_terms(num_points, curve);
+	unsigned int table_words;
+	unsigned int rest;
+	int c;
+
+	if (num_points <= uECC_MSM_STRAUS_MAX) {
+		/* the tables, the halves of the scalars, then the largest of the
+		 * scratch of the tables and the digits: */
+		table_words = (1u << (uECC_MSM_WIDTH - 2)) * 2 * curve->num_words;
+		rest = num_points * table_words;
+		if (rest < uECC_WNAF_NAF_WORDS(num_terms)) {
+			rest = uECC_WNAF_NAF_WORDS(num_terms);
+		}
+		return num_terms * table_words +
+		       (curve->glv ? num_terms * NUM_ECC_WORDS : 0) + rest;
+	}
+
+	c = msm_window(num_points, curve);
+	return pippenger_bucket_words(c, curve) +
+	       (num_points * (curve->num_n_bits / c + 1) *
+		sizeof(int_least16_t) + uECC_WORD_SIZE - 1) / uECC_WORD_SIZE;
+}
+
+void EccPoint_mult_multi(uECC_word_t *X, uECC_word_t *Y, uECC_word_t *Z,
+			 const uECC_word_t *scalars, const uECC_word_t *points,
+			 unsigned int num_points, uECC_word_t *scratch,
+			 uECC_Curve curve)
+{
+	if (num_points <= uECC_MSM_STRAUS_MAX) {
+		msm_straus(X, Y, Z, scalars, points, num_points, scratch, curve);
+	} else {
+		msm_pippenger(X, Y, Z, scalars, points, num_points, scratch,
+			      curve);
+	}
+}
+
 /* Converts an integer in uECC native format to big-endian bytes. */
-void uECC_vli_nativeToBytes(uint_least8_t *bytes, int num_bytes,
-			    const uint32_t *native)
+void uECC_vli_wordsToBytes(uint_least8_t *bytes, int num_bytes,
+			   const uECC_word_t *native)
 {
 	wordcount_t i;
 	for (i = 0; i < num_bytes; ++i) {
@@ -822,8 +2694,8 @@ void uECC_vli_nativeToBytes(uint_least8_t *bytes, int num_bytes,
 }
 
 /* Converts big-endian bytes to an integer in uECC native format. */
-void uECC_vli_bytesToNative(uint32_t *native, const uint_least8_t *bytes,
-			    int num_bytes)
+void uECC_vli_bytesToWords(uECC_word_t *native, const uint_least8_t *bytes,
+			   int num_bytes)
 {
 	wordcount_t i;
 	uECC_vli_clear(native, (num_bytes + (uECC_WORD_SIZE - 1)) / uECC_WORD_SIZE);
@@ -834,19 +2706,44 @@ void uECC_vli_bytesToNative(uint32_t *native, const uint_least8_t *bytes,
   	}
 }
 
-int uECC_generate_random_int(uECC_word_t *random, const uECC_word_t *top,
-			     wordcount_t num_words)
+/* The public converters keep 32-bit words whatever uECC_WORD_SIZE is: */
+void uECC_vli_nativeToBytes(uint_least8_t *bytes, int num_bytes,
+			    const uint32_t *native)
+{
+	int i;
+	for (i = 0; i < num_bytes; ++i) {
+		unsigned b = num_bytes - 1 - i;
+		bytes[i] = native[b / 4] >> (8 * (b % 4));
+	}
+}
+
+void uECC_vli_bytesToNative(uint32_t *native, const uint_least8_t *bytes,
+			    int num_bytes)
+{
+	int i;
+	for (i = 0; i < (num_bytes + 3) / 4; ++i) {
+		native[i] = 0;
+	}
+	for (i = 0; i < num_bytes; ++i) {
+		unsigned b = num_bytes - 1 - i;
+		native[b / 4] |= (uint32_t)bytes[i] << (8 * (b % 4));
+	}
+}
+
+int uECC_generate_random_int_ctx(const uECC_Ctx *ctx, uECC_word_t *random,
+				 const uECC_word_t *top, wordcount_t num_words)
 {
 	uECC_word_t mask = (uECC_word_t)-1;
 	uECC_word_t tries;
 	bitcount_t num_bits = uECC_vli_numBits(top, num_words);
 
-	if (!g_rng_function) {
+	if (!uECC_ctx_has_rng(ctx)) {
 		return 0;
 	}
 
 	for (tries = 0; tries < uECC_RNG_MAX_TRIES; ++tries) {
-		if (!g_rng_function((uint_least8_t *)random, num_words * uECC_WORD_SIZE)) {
+		if (!uECC_ctx_random(ctx, (uint_least8_t *)random,
+				     num_words * uECC_WORD_SIZE)) {
       			return 0;
     		}
 		random[num_words - 1] &=
@@ -859,6 +2756,11 @@ int uECC_generate_random_int(uECC_word_t *random, const uECC_word_t *top,
 	return 0;
 }
 
+int uECC_generate_random_int(uECC_word_t *random, const uECC_word_t *top,
+			     wordcount_t num_words)
+{
+	return uECC_generate_random_int_ctx(0, random, top, num_words);
+}
 
 int uECC_valid_point(const uECC_word_t *point, uECC_Curve curve)
 {
@@ -892,8 +2794,8 @@ int uECC_valid_public_key(const uint_least8_t *public_key, uECC_Curve curve)
 
 	uECC_word_t _public[NUM_ECC_WORDS * 2];
 
-	uECC_vli_bytesToNative(_public, public_key, curve->num_bytes);
-	uECC_vli_bytesToNative(
+	uECC_vli_bytesToWords(_public, public_key, curve->num_bytes);
+	uECC_vli_bytesToWords(
 	_public + curve->num_words,
 	public_key + curve->num_bytes,
 	curve->num_bytes);
@@ -905,6 +2807,149 @@ int uECC_valid_public_key(const uint_least8_t *public_key, uECC_Curve curve)
 	return uECC_valid_point(_public, curve);
 }
 
+/*
+ * Big-endian bytes to native words, a whole word at a time: the inner loop
+ * compiles to a byte-swapping load.
+ */
+static void load_be(uECC_word_t *native, const uint_least8_t *bytes,
+		    wordcount_t num_words)
+{
+	wordcount_t i;
+	int j;
+
+	for (i = 0; i < num_words; ++i) {
+		const uint_least8_t *b = bytes + (num_words - 1 - i) * uECC_WORD_SIZE;
+		uECC_word_t w = 0;
+
+		for (j = 0; j < uECC_WORD_SIZE; ++j) {
+			w = (w << 8) | b[j];
+		}
+		native[i] = w;
+	}
+}
+
+unsigned int uECC_valid_public_keys(const uint_least8_t *public_keys,
+				    unsigned int count, uint_least8_t *valid,
+				    uECC_Curve curve)
+{
+	uECC_word_t points[uECC_LANES][NUM_ECC_WORDS * 2];
+	uECC_word_t tmp1[NUM_ECC_WORDS];
+	uECC_word_t tmp2[NUM_ECC_WORDS];
+	uint_least8_t p_bytes[NUM_ECC_BYTES];
+	uint_least8_t g_bytes[NUM_ECC_BYTES * 2];
+	wordcount_t num_words = curve->num_words;
+	wordcount_t num_bytes = curve->num_bytes;
+	unsigned int candidates, on_curve, lanes, num_valid = 0;
+	unsigned int i, l;
+
+	uECC_vli_wordsToBytes(p_bytes, num_bytes, curve->p);
+	uECC_vli_wordsToBytes(g_bytes, num_bytes, curve->G);
+	uECC_vli_wordsToBytes(g_bytes + num_bytes, num_bytes, curve->G + num_words);
+	memset(valid, 0, (count + 7) / 8);
+
+	for (i = 0; i < count; i += lanes) {
+		lanes = count - i < uECC_LANES ? count - i : uECC_LANES;
+		candidates = 0;
+		for (l = 0; l < uECC_LANES; ++l) {
+			/* lanes past the last key are given G, which is skipped: */
+			const uint_least8_t *key = l < lanes ?
+				public_keys + (size_t)(i + l) * 2 * num_bytes :
+				g_bytes;
+
+			/*
+			 * memcmp orders big-endian integers: x and y must be
+			 * below p, and the key must not be G. The point at
+			 * infinity (0, 0) fails the curve equation, as b != 0.
+			 */
+			if (memcmp(key, p_bytes, num_bytes) >= 0 ||
+			    memcmp(key + num_bytes, p_bytes, num_bytes) >= 0 ||
+			    memcmp(key, g_bytes, 2 * num_bytes) == 0) {
+				/* a point on the curve for the unused lane: */
+				uECC_vli_set(points[l], curve->G, 2 * num_words);
+				continue;
+			}
+			load_be(points[l], key, num_words);
+			load_be(points[l] + num_words, key + num_bytes, num_words);
+			candidates |= 1U << l;
+		}
+
+		if (!EccPoint_on_curve_x8(&on_curve, points[0], curve)) {
+			on_curve = 0;
+			for (l = 0; l < lanes; ++l) {
+				if (!(candidates & (1U << l))) {
+					continue;
+				}
+				uECC_vli_modSquare_fast(tmp1, points[l] + num_words,
+							curve);
+				curve->x_side(tmp2, points[l], curve);
+				if (uECC_vli_equal(tmp1, tmp2, num_words) == 0) {
+					on_curve |= 1U << l;
+				}
+			}
+		}
+
+		on_curve &= candidates;
+		for (l = 0; l < lanes; ++l) {
+			if (on_curve & (1U << l)) {
+				valid[(i + l) / 8] |= (uint_least8_t)(1U << ((i + l) % 8));
+				num_valid++;
+			}
+		}
+	}
+	return num_valid;
+}
+
+void uECC_compress(const uint_least8_t *public_key, uint_least8_t *compressed,
+		   uECC_Curve curve)
+{
+	wordcount_t i;
+
+	for (i = 0; i < curve->num_bytes; ++i) {
+		compressed[i + 1] = public_key[i];
+	}
+	compressed[0] = 2 + (public_key[curve->num_bytes * 2 - 1] & 0x01);
+}
+
+int uECC_decompress(const uint_least8_t *compressed, uint_least8_t *public_key,
+		    uECC_Curve curve)
+{
+	uECC_word_t point[NUM_ECC_WORDS * 2];
+	uECC_word_t rhs[NUM_ECC_WORDS];
+	uECC_word_t tmp[NUM_ECC_WORDS];
+	uECC_word_t *y = point + curve->num_words;
+	wordcount_t num_words = curve->num_words;
+
+	if (compressed[0] != 0x02 && compressed[0] != 0x03) {
+		return 0;
+	}
+
+	uECC_vli_bytesToWords(point, compressed + 1, curve->num_bytes);
+	if (uECC_vli_cmp_unsafe(curve->p, point, num_words) != 1) {
+		return 0;
+	}
+
+	/* y = sqrt(x^3 + ax + b), which only exists for points of the curve: */
+	curve->x_side(rhs, point, curve);
+	uECC_vli_set(y, rhs, num_words);
+	curve->mod_sqrt(y, curve);
+	uECC_vli_modSquare_fast(tmp, y, curve);
+	if (uECC_vli_equal(tmp, rhs, num_words) != 0) {
+		return 0;
+	}
+
+	if ((y[0] & 0x01) != (compressed[0] & 0x01)) {
+		if (uECC_vli_isZero(y, num_words)) {
+			return 0;
+		}
+		uECC_vli_sub(y, curve->p, y, num_words);
+	}
+
+	uECC_vli_wordsToBytes(public_key, curve->num_bytes, point);
+	uECC_vli_wordsToBytes(public_key + curve->num_bytes, curve->num_bytes,
+			      y);
+	return 1;
+}
+
 int uECC_compute_public_key(const uint_least8_t *private_key, uint_least8_t *public_key,
 			    uECC_Curve curve)
 {
@@ -912,7 +2957,7 @@ int uECC_compute_public_key(const uint_least8_t *private_key, uint_least8_t *pub
 	uECC_word_t _private[NUM_ECC_WORDS];
 	uECC_word_t _public[NUM_ECC_WORDS * 2];
 
-	uECC_vli_bytesToNative(
+	uECC_vli_bytesToWords(
 	_private,
 	private_key,
 	BITS_TO_BYTES(curve->num_n_bits));
@@ -931,8 +2976,8 @@ int uECC_compute_public_key(const uint_least8_t *private_key, uint_least8_t *pub
 		return 0;
 	}
 
-	uECC_vli_nativeToBytes(public_key, curve->num_bytes, _public);
-	uECC_vli_nativeToBytes(
+	uECC_vli_wordsToBytes(public_key, curve->num_bytes, _public);
+	uECC_vli_wordsToBytes(
 	public_key +
 	curve->num_bytes, curve->num_bytes, _public + curve->num_words);
 	return 1;
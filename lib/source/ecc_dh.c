@@ -66,25 +66,29 @@ int uECC_make_key_with_d(uint_least8_t *public_key, uint_least8_t *private_key,
 
 	uECC_word_t _private[NUM_ECC_WORDS];
 	uECC_word_t _public[NUM_ECC_WORDS * 2];
+	uint_least8_t _d[NUM_ECC_BYTES];
 
 	/* This function is designed for test purposes-only (such as validating NIST
 	 * test vectors) as it uses a provided value for d instead of generating
-	 * it uniformly at random. */
-	memcpy (_private, d, NUM_ECC_BYTES);
+	 * it uniformly at random. d is in 32-bit words whatever uECC_WORD_SIZE
+	 * is. */
+	uECC_vli_nativeToBytes(_d, NUM_ECC_BYTES, d);
+	uECC_vli_bytesToWords(_private, _d, NUM_ECC_BYTES);
+	_set_secure(_d, 0, sizeof(_d));
 
 	/* Computing public-key from private: */
 	if (EccPoint_compute_public_key(_public, _private, curve)) {
 
 		/* Converting buffers to correct bit order: */
-		uECC_vli_nativeToBytes(private_key,
-				       BITS_TO_BYTES(curve->num_n_bits),
-				       _private);
-		uECC_vli_nativeToBytes(public_key,
-				       curve->num_bytes,
-				       _public);
-		uECC_vli_nativeToBytes(public_key + curve->num_bytes,
-				       curve->num_bytes,
-				       _public + curve->num_words);
+		uECC_vli_wordsToBytes(private_key,
+				      BITS_TO_BYTES(curve->num_n_bits),
+				      _private);
+		uECC_vli_wordsToBytes(public_key,
+				      curve->num_bytes,
+				      _public);
+		uECC_vli_wordsToBytes(public_key + curve->num_bytes,
+				      curve->num_bytes,
+				      _public + curve->num_words);
 
 		/* erasing temporary buffer used to store secret: */
 		_set_secure(_private, 0, NUM_ECC_BYTES);
@@ -94,7 +98,8 @@ int uECC_make_key_with_d(uint_least8_t *public_key, uint_least8_t *private_key,
 	return 0;
 }
 
-int uECC_make_key(uint_least8_t *public_key, uint_least8_t *private_key, uECC_Curve curve)
+int uECC_make_key_ctx(const uECC_Ctx *ctx, uint_least8_t *public_key,
+		      uint_least8_t *private_key, uECC_Curve curve)
 {
 
 	uECC_word_t _random[NUM_ECC_WORDS * 2];
@@ -104,9 +109,8 @@ int uECC_make_key(uint_least8_t *public_key, uint_least8_t *private_key, uECC_Cu
 
 	for (tries = 0; tries < uECC_RNG_MAX_TRIES; ++tries) {
 		/* Generating _private uniformly at random: */
-		uECC_RNG_Function rng_function = uECC_get_rng();
-		if (!rng_function ||
-			!rng_function((uint_least8_t *)_random, 2 * NUM_ECC_WORDS*uECC_WORD_SIZE)) {
+		if (!uECC_ctx_random(ctx, (uint_least8_t *)_random,
+				     2 * NUM_ECC_WORDS*uECC_WORD_SIZE)) {
         		return 0;
 		}
 
@@ -117,15 +121,15 @@ int uECC_make_key(uint_least8_t *public_key, uint_least8_t *private_key, uECC_Cu
 		if (EccPoint_compute_public_key(_public, _private, curve)) {
 
 			/* Converting buffers to correct bit order: */
-			uECC_vli_nativeToBytes(private_key,
-					       BITS_TO_BYTES(curve->num_n_bits),
-					       _private);
-			uECC_vli_nativeToBytes(public_key,
-					       curve->num_bytes,
-					       _public);
-			uECC_vli_nativeToBytes(public_key + curve->num_bytes,
+			uECC_vli_wordsToBytes(private_key,
+					      BITS_TO_BYTES(curve->num_n_bits),
+					      _private);
+			uECC_vli_wordsToBytes(public_key,
+					      curve->num_bytes,
+					      _public);
+			uECC_vli_wordsToBytes(public_key + curve->num_bytes,
  					       curve->num_bytes,
-					       _public + curve->num_words);
+					      _public + curve->num_words);
 
 			/* erasing temporary buffer that stored secret: */
 			_set_secure(_private, 0, NUM_ECC_BYTES);
@@ -136,8 +140,88 @@ int uECC_make_key(uint_least8_t *public_key, uint_least8_t *private_key, uECC_Cu
 	return 0;
 }
 
-int uECC_shared_secret(const uint_least8_t *public_key, const uint_least8_t *private_key,
-		       uint_least8_t *secret, uECC_Curve curve)
+int uECC_make_key(uint_least8_t *public_key, uint_least8_t *private_key, uECC_Curve curve)
+{
+	return uECC_make_key_ctx(0, public_key, private_key, curve);
+}
+
+int uECC_make_key_batch_ctx(const uECC_Ctx *ctx, uint_least8_t *public_keys,
+			    uint_least8_t *private_keys, unsigned int count,
+			    uECC_Curve curve)
+{
+	uECC_word_t _random[NUM_ECC_WORDS * 2];
+	uECC_word_t _private[uECC_KEYGEN_BATCH_SIZE][NUM_ECC_WORDS];
+	uECC_word_t _public[uECC_KEYGEN_BATCH_SIZE][NUM_ECC_WORDS * 2];
+	uECC_word_t z[uECC_KEYGEN_BATCH_SIZE][NUM_ECC_WORDS];
+	uECC_word_t scratch[uECC_KEYGEN_BATCH_SIZE][NUM_ECC_WORDS];
+	wordcount_t num_words = curve->num_words;
+	wordcount_t num_bytes = curve->num_bytes;
+	wordcount_t num_n_bytes = BITS_TO_BYTES(curve->num_n_bits);
+	unsigned int done, batch, i;
+	uECC_word_t tries;
+	int r = 1;
+
+	for (done = 0; done < count; done += batch) {
+		batch = count - done;
+		if (batch > uECC_KEYGEN_BATCH_SIZE) {
+			batch = uECC_KEYGEN_BATCH_SIZE;
+		}
+
+		/* Generating the private keys uniformly at random, in [1, n-1]: */
+		for (i = 0; i < batch; ++i) {
+			tries = 0;
+			do {
+				if (tries++ == uECC_RNG_MAX_TRIES ||
+				    !uECC_ctx_random(ctx, (uint_least8_t *)_random,
+						     sizeof(_random))) {
+					r = 0;
+					goto clear_and_out;
+				}
+				/* computing modular reduction of _random (see
+				 * FIPS 186.4 B.4.1): */
+				uECC_vli_mmod(_private[i], _random, curve->n,
+					      BITS_TO_WORDS(curve->num_n_bits));
+			} while (uECC_vli_isZero(_private[i], num_words));
+		}
+
+		EccPoint_compute_public_keys(_public[0], _private[0], batch, z[0],
+					     scratch[0], curve);
+
+		/* Converting buffers to correct bit order: */
+		for (i = 0; i < batch; ++i) {
+			uint_least8_t *public_key =
+				public_keys + (size_t)(done + i) * 2 * num_bytes;
+
+			uECC_vli_wordsToBytes(private_keys +
+					      (size_t)(done + i) * num_n_bytes,
+					      num_n_bytes, _private[i]);
+			uECC_vli_wordsToBytes(public_key, num_bytes,
+					      _public[i]);
+			uECC_vli_wordsToBytes(public_key + num_bytes, num_bytes,
+					      _public[i] + num_words);
+		}
+	}
+
+clear_and_out:
+	/* erasing temporary buffers that stored secrets: */
+	_set_secure(_random, 0, sizeof(_random));
+	_set_secure(_private, 0, sizeof(_private));
+	_set_secure(z, 0, sizeof(z));
+	_set_secure(scratch, 0, sizeof(scratch));
+
+	return r;
+}
+
+int uECC_make_key_batch(uint_least8_t *public_keys, uint_least8_t *private_keys,
+			unsigned int count, uECC_Curve curve)
+{
+	return uECC_make_key_batch_ctx(0, public_keys, private_keys, count,
+				       curve);
+}
+
+int uECC_shared_secret_ctx(const uECC_Ctx *ctx, const uint_least8_t *public_key,
+			   const uint_least8_t *private_key,
+			   uint_least8_t *secret, uECC_Curve curve)
 {
 
 	uECC_word_t _public[NUM_ECC_WORDS * 2];
@@ -152,15 +236,15 @@ int uECC_shared_secret(const uint_least8_t *public_key, const uint_least8_t *pri
 	int r;
 
 	/* Converting buffers to correct bit order: */
-	uECC_vli_bytesToNative(_private,
+	uECC_vli_bytesToWords(_private,
       			       private_key,
-			       BITS_TO_BYTES(curve->num_n_bits));
-	uECC_vli_bytesToNative(_public,
+			      BITS_TO_BYTES(curve->num_n_bits));
+	uECC_vli_bytesToWords(_public,
       			       public_key,
-			       num_bytes);
-	uECC_vli_bytesToNative(_public + num_words,
-			       public_key + num_bytes,
-			       num_bytes);
+			      num_bytes);
+	uECC_vli_bytesToWords(_public + num_words,
+			      public_key + num_bytes,
+			      num_bytes);
 
 	/* Regularize the bitcount for the private key so that attackers cannot use a
 	 * side channel attack to learn the number of leading zeros. */
@@ -168,8 +252,9 @@ int uECC_shared_secret(const uint_least8_t *public_key, const uint_least8_t *pri
 
 	/* If an RNG function was specified, try to get a random initial Z value to
 	 * improve protection against side-channel attacks. */
-	if (uECC_get_rng()) {
-		if (!uECC_generate_random_int(p2[carry], curve->p, num_words)) {
+	if (uECC_ctx_has_rng(ctx)) {
+		if (!uECC_generate_random_int_ctx(ctx, p2[carry], curve->p,
+						  num_words)) {
 			r = 0;
 			goto clear_and_out;
     		}
@@ -179,7 +264,90 @@ int uECC_shared_secret(const uint_least8_t *public_key, const uint_least8_t *pri
 	EccPoint_mult(_public, _public, p2[!carry], initial_Z, curve->num_n_bits + 1,
 		      curve);
 
-	uECC_vli_nativeToBytes(secret, num_bytes, _public);
+	uECC_vli_wordsToBytes(secret, num_bytes, _public);
+	r = !EccPoint_isZero(_public, curve);
+
+clear_and_out:
+	/* erasing temporary buffer used to store secret: */
+	_set_secure(p2, 0, sizeof(p2));
+	_set_secure(tmp, 0, sizeof(tmp));
+	_set_secure(_private, 0, sizeof(_private));
+
+	return r;
+}
+
+int uECC_shared_secret(const uint_least8_t *public_key, const uint_least8_t *private_key,
+		       uint_least8_t *secret, uECC_Curve curve)
+{
+	return uECC_shared_secret_ctx(0, public_key, private_key, secret, curve);
+}
+
+int uECC_prepare_peer_key(uECC_PeerKeyCtx *ctx, const uint_least8_t *public_key,
+			  uECC_Curve curve)
+{
+	uECC_word_t _public[NUM_ECC_WORDS * 2];
+	wordcount_t num_words = curve->num_words;
+	wordcount_t num_bytes = curve->num_bytes;
+
+	/* input sanity check: */
+	if (ctx == (uECC_PeerKeyCtx *) 0 ||
+	    public_key == (const uint_least8_t *) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	ctx->curve = (uECC_Curve) 0;
+	uECC_vli_bytesToWords(_public, public_key, num_bytes);
+	uECC_vli_bytesToWords(_public + num_words, public_key + num_bytes,
+			      num_bytes);
+	if (uECC_valid_point(_public, curve) != 0) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	EccPoint_fixed_table(ctx->table, _public, curve);
+	ctx->curve = curve;
+	return TC_CRYPTO_SUCCESS;
+}
+
+int uECC_shared_secret_prepared(const uECC_PeerKeyCtx *ctx,
+				const uint_least8_t *private_key,
+				uint_least8_t *secret)
+{
+	uECC_word_t _public[NUM_ECC_WORDS * 2];
+	uECC_word_t _private[NUM_ECC_WORDS];
+	uECC_word_t tmp[NUM_ECC_WORDS];
+	uECC_word_t *p2[2] = {_private, tmp};
+	uECC_word_t carry;
+	uECC_Curve curve;
+	wordcount_t num_words;
+	int r;
+
+	/* input sanity check: */
+	if (ctx == (const uECC_PeerKeyCtx *) 0 ||
+	    ctx->curve == (uECC_Curve) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+	curve = ctx->curve;
+	num_words = curve->num_words;
+
+	uECC_vli_bytesToWords(_private, private_key,
+			      BITS_TO_BYTES(curve->num_n_bits));
+
+	/* the comb needs a scalar below n: */
+	if (uECC_vli_isZero(_private, num_words) ||
+	    uECC_vli_cmp(curve->n, _private, num_words) != 1) {
+		r = TC_CRYPTO_FAIL;
+		goto clear_and_out;
+	}
+
+	if (!EccPoint_mult_fixed(_public, _private, ctx->table, curve)) {
+		/* exceptional case of the comb, take the ladder instead: */
+		uECC_vli_set(_public, ctx->table[0][0], 2 * num_words);
+		carry = regularize_k(_private, _private, tmp, curve);
+		EccPoint_mult(_public, _public, p2[!carry], 0,
+			      curve->num_n_bits + 1, curve);
+	}
+
+	uECC_vli_wordsToBytes(secret, curve->num_bytes, _public);
 	r = !EccPoint_isZero(_public, curve);
 
 clear_and_out:
@@ -56,6 +56,20 @@
 #include <tinycrypt/constants.h>
 #include <tinycrypt/ecc.h>
 #include <tinycrypt/ecc_dsa.h>
+#include <tinycrypt/hmac.h>
+#include <tinycrypt/hmac_prng.h>
+#include <tinycrypt/utils.h>
+#include <string.h>
+
+/* words of a table of odd multiples of width uECC_VERIFY_WIDTH: */
+#define VERIFY_TABLE_WORDS ((1 << (uECC_VERIFY_WIDTH - 2)) * 2 * NUM_ECC_WORDS)
+
+/* scratch words of sign_with_k, and of sign_scratch including them: */
+#define SIGN_WITH_K_WORDS (3 * NUM_ECC_WORDS)
+#define SIGN_SCRATCH_WORDS (4 * NUM_ECC_WORDS + SIGN_WITH_K_WORDS)
+
+/* scratch words of verify_scratch, at most: */
+#define VERIFY_SCRATCH_WORDS (uECC_SCRATCH_SIZE / uECC_WORD_SIZE)
 
 
 static void bits2int(uECC_word_t *native, const uint_least8_t *bits,
@@ -72,7 +86,7 @@ static void bits2int(uECC_word_t *native, const uint_least8_t *bits,
 	}
 
 	uECC_vli_clear(native, num_n_words);
-	uECC_vli_bytesToNative(native, bits, bits_size);
+	uECC_vli_bytesToWords(native, bits, bits_size);
 	if (bits_size * 8 <= (uint32_t)curve->num_n_bits) {
 		return;
 	}
@@ -91,19 +105,20 @@ static void bits2int(uECC_word_t *native, const uint_least8_t *bits,
 	}
 }
 
-int uECC_sign_with_k(const uint_least8_t *private_key, const uint_least8_t *message_hash,
-		     uint32_t hash_size, uECC_word_t *k, uint_least8_t *signature,
-		     uECC_Curve curve)
+/*
+ * Signs with the nonce k, using 0 < blind < curve_n to hide k from the
+ * inversion, with SIGN_WITH_K_WORDS words of scratch. Clobbers k and blind.
+ */
+static int sign_with_k(const uint_least8_t *private_key,
+		       const uint_least8_t *message_hash, uint32_t hash_size,
+		       uECC_word_t *k, uECC_word_t *tmp,
+		       uint_least8_t *signature, uECC_word_t *scratch,
+		       uECC_Curve curve)
 {
-
-	uECC_word_t tmp[NUM_ECC_WORDS];
-	uECC_word_t s[NUM_ECC_WORDS];
-	uECC_word_t *k2[2] = {tmp, s};
-	uECC_word_t p[NUM_ECC_WORDS * 2];
-	uECC_word_t carry;
+	uECC_word_t *s = scratch;
+	uECC_word_t *p = s + NUM_ECC_WORDS;
 	wordcount_t num_words = curve->num_words;
 	wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
-	bitcount_t num_n_bits = curve->num_n_bits;
 
 	/* Make sure 0 < k < curve_n */
   	if (uECC_vli_isZero(k, num_words) ||
@@ -111,32 +126,21 @@ int uECC_sign_with_k(const uint_least8_t *private_key, const uint_least8_t *mess
 		return 0;
 	}
 
-	carry = regularize_k(k, tmp, s, curve);
-	EccPoint_mult(p, curve->G, k2[!carry], 0, num_n_bits + 1, curve);
+	EccPoint_mult_base(p, k, curve);
 	if (uECC_vli_isZero(p, num_words)) {
 		return 0;
 	}
 
-	/* If an RNG function was specified, get a random number
-	to prevent side channel analysis of k. */
-	if (!uECC_get_rng()) {
-		uECC_vli_clear(tmp, num_n_words);
-		tmp[0] = 1;
-	}
-	else if (!uECC_generate_random_int(tmp, curve->n, num_n_words)) {
-		return 0;
-	}
-
 	/* Prevent side channel analysis of uECC_vli_modInv() to determine
 	bits of k / the private key by premultiplying by a random number */
 	uECC_vli_modMult(k, k, tmp, curve->n, num_n_words); /* k' = rand * k */
 	uECC_vli_modInv(k, k, curve->n, num_n_words);       /* k = 1 / k' */
 	uECC_vli_modMult(k, k, tmp, curve->n, num_n_words); /* k = 1 / k */
 
-	uECC_vli_nativeToBytes(signature, curve->num_bytes, p); /* store r */
+	uECC_vli_wordsToBytes(signature, curve->num_bytes, p); /* store r */
 
 	/* tmp = d: */
-	uECC_vli_bytesToNative(tmp, private_key, BITS_TO_BYTES(curve->num_n_bits));
+	uECC_vli_bytesToWords(tmp, private_key, BITS_TO_BYTES(curve->num_n_bits));
 
 	s[num_n_words - 1] = 0;
 	uECC_vli_set(s, p, num_words);
@@ -149,73 +153,480 @@ int uECC_sign_with_k(const uint_least8_t *private_key, const uint_least8_t *mess
 		return 0;
 	}
 
-	uECC_vli_nativeToBytes(signature + curve->num_bytes, curve->num_bytes, s);
+	uECC_vli_wordsToBytes(signature + curve->num_bytes, curve->num_bytes, s);
 	return 1;
 }
 
-int uECC_sign(const uint_least8_t *private_key, const uint_least8_t *message_hash,
-	      uint32_t hash_size, uint_least8_t *signature, uECC_Curve curve)
+int uECC_sign_with_k(const uint_least8_t *private_key, const uint_least8_t *message_hash,
+		     uint32_t hash_size, uECC_word_t *k, uint_least8_t *signature,
+		     uECC_Curve curve)
 {
-	      uECC_word_t _random[2*NUM_ECC_WORDS];
-	      uECC_word_t k[NUM_ECC_WORDS];
+	uECC_word_t tmp[NUM_ECC_WORDS];
+	uECC_word_t scratch[SIGN_WITH_K_WORDS];
+	wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+
+	/* If an RNG function was specified, get a random number
+	to prevent side channel analysis of k. */
+	if (!uECC_get_rng()) {
+		uECC_vli_clear(tmp, num_n_words);
+		tmp[0] = 1;
+	}
+	else if (!uECC_generate_random_int(tmp, curve->n, num_n_words)) {
+		return 0;
+	}
+
+	return sign_with_k(private_key, message_hash, hash_size, k, tmp,
+			   signature, scratch, curve);
+}
+
+/* uECC_sign_ctx with SIGN_SCRATCH_WORDS words of scratch. */
+static int sign_scratch(const uECC_Ctx *ctx, const uint_least8_t *private_key,
+			const uint_least8_t *message_hash, uint32_t hash_size,
+			uint_least8_t *signature, uECC_word_t *scratch,
+			uECC_Curve curve)
+{
+	      uECC_word_t *_random = scratch;
+	      uECC_word_t *k = _random + 2*NUM_ECC_WORDS;
+	      uECC_word_t *tmp = k + NUM_ECC_WORDS;
 	      uECC_word_t tries;
+	      wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
 
 	for (tries = 0; tries < uECC_RNG_MAX_TRIES; ++tries) {
 		/* Generating _random uniformly at random: */
-		uECC_RNG_Function rng_function = uECC_get_rng();
-		if (!rng_function ||
-		    !rng_function((uint_least8_t *)_random, 2*NUM_ECC_WORDS*uECC_WORD_SIZE)) {
+		if (!uECC_ctx_random(ctx, (uint_least8_t *)_random,
+				     2*NUM_ECC_WORDS*uECC_WORD_SIZE)) {
 			return 0;
 		}
 
 		// computing k as modular reduction of _random (see FIPS 186.4 B.5.1):
-		uECC_vli_mmod(k, _random, curve->n, BITS_TO_WORDS(curve->num_n_bits));
+		uECC_vli_mmod(k, _random, curve->n, num_n_words);
+
+		/* get a random number to prevent side channel analysis of k: */
+		if (!uECC_generate_random_int_ctx(ctx, tmp, curve->n, num_n_words)) {
+			return 0;
+		}
 
-		if (uECC_sign_with_k(private_key, message_hash, hash_size, k, signature, 
-		    curve)) {
+		if (sign_with_k(private_key, message_hash, hash_size, k, tmp,
+				signature, tmp + NUM_ECC_WORDS, curve)) {
 			return 1;
 		}
 	}
 	return 0;
 }
 
-static bitcount_t smax(bitcount_t a, bitcount_t b)
+int uECC_sign_ctx(const uECC_Ctx *ctx, const uint_least8_t *private_key,
+		  const uint_least8_t *message_hash, uint32_t hash_size,
+		  uint_least8_t *signature, uECC_Curve curve)
 {
-	return (a > b ? a : b);
+	uECC_word_t scratch[SIGN_SCRATCH_WORDS];
+	int result;
+
+	result = sign_scratch(ctx, private_key, message_hash, hash_size,
+			      signature, scratch, curve);
+	_set_secure(scratch, 0, sizeof(scratch));
+	return result;
 }
 
-int uECC_verify(const uint_least8_t *public_key, const uint_least8_t *message_hash,
-		uint32_t hash_size, const uint_least8_t *signature,
-	        uECC_Curve curve)
+int uECC_sign(const uint_least8_t *private_key, const uint_least8_t *message_hash,
+	      uint32_t hash_size, uint_least8_t *signature, uECC_Curve curve)
 {
+	return uECC_sign_ctx(0, private_key, message_hash, hash_size, signature,
+			     curve);
+}
 
-	uECC_word_t u1[NUM_ECC_WORDS], u2[NUM_ECC_WORDS];
-	uECC_word_t z[NUM_ECC_WORDS];
-	uECC_word_t sum[NUM_ECC_WORDS * 2];
-	uECC_word_t rx[NUM_ECC_WORDS];
-	uECC_word_t ry[NUM_ECC_WORDS];
-	uECC_word_t tx[NUM_ECC_WORDS];
-	uECC_word_t ty[NUM_ECC_WORDS];
-	uECC_word_t tz[NUM_ECC_WORDS];
-	const uECC_word_t *points[4];
-	const uECC_word_t *point;
-	bitcount_t num_bits;
-	bitcount_t i;
+int uECC_nonce_make_ctx(const uECC_Ctx *ctx, uECC_Nonce *nonce,
+			uECC_Curve curve)
+{
+	uECC_word_t _random[2 * NUM_ECC_WORDS];
+	uECC_word_t k[NUM_ECC_WORDS];
+	uECC_word_t p[2 * NUM_ECC_WORDS];
+	uECC_word_t r2[NUM_ECC_WORDS];
+	uECC_word_t n_inv;
+	wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+	uECC_word_t tries;
+	int result = 0;
 
-	uECC_word_t _public[NUM_ECC_WORDS * 2];
-	uECC_word_t r[NUM_ECC_WORDS], s[NUM_ECC_WORDS];
+	for (tries = 0; tries < uECC_RNG_MAX_TRIES && !result; ++tries) {
+		if (!uECC_ctx_random(ctx, (uint_least8_t *)_random,
+				     2 * NUM_ECC_WORDS * uECC_WORD_SIZE)) {
+			break;
+		}
+
+		/* k as in uECC_sign (see FIPS 186.4 B.5.1): */
+		uECC_vli_mmod(k, _random, curve->n, num_n_words);
+		if (uECC_vli_isZero(k, num_n_words)) {
+			continue;
+		}
+
+		EccPoint_mult_base(p, k, curve);
+
+		/* r = x mod n, which must not be 0: */
+		nonce->r[num_n_words - 1] = 0;
+		uECC_vli_set(nonce->r, p, curve->num_words);
+		if (uECC_vli_cmp(curve->n, nonce->r, num_n_words) != 1) {
+			uECC_vli_sub(nonce->r, nonce->r, curve->n, num_n_words);
+		}
+		if (uECC_vli_isZero(nonce->r, num_n_words)) {
+			continue;
+		}
+
+		/* uECC_vli_modInv runs in constant time: */
+		uECC_vli_modInv(k, k, curve->n, num_n_words);
+		n_inv = uECC_vli_montInit(r2, curve->n, num_n_words);
+		uECC_vli_montMult(nonce->r_mont, nonce->r, r2, curve->n, n_inv,
+				  num_n_words);
+		uECC_vli_montMult(nonce->k_inv_mont, k, r2, curve->n, n_inv,
+				  num_n_words);
+		result = 1;
+	}
+
+	_set_secure(_random, 0, sizeof(_random));
+	_set_secure(k, 0, sizeof(k));
+	return result;
+}
+
+int uECC_nonce_make(uECC_Nonce *nonce, uECC_Curve curve)
+{
+	return uECC_nonce_make_ctx(0, nonce, curve);
+}
+
+/*
+ * The producer publishes a nonce by storing tail after the nonce itself, and
+ * the consumer frees a slot by storing head after erasing it; each side loads
+ * the other's index with acquire semantics before touching the slot.
+ */
+#if defined(__GNUC__)
+#define pool_load(index) __atomic_load_n((index), __ATOMIC_ACQUIRE)
+#define pool_store(index, value) \
+	__atomic_store_n((index), (value), __ATOMIC_RELEASE)
+#else
+#define pool_load(index) (*(volatile unsigned int *)(index))
+#define pool_store(index, value) (*(volatile unsigned int *)(index) = (value))
+#endif
+
+int uECC_nonce_pool_init(uECC_NoncePool *pool, uECC_Curve curve)
+{
+	uECC_word_t r2[NUM_ECC_WORDS];
+
+	/* input sanity check: */
+	if (pool == (uECC_NoncePool *) 0 || curve == (uECC_Curve) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	_set_secure(pool, 0, sizeof(*pool));
+	pool->curve = curve;
+	pool->n_inv = uECC_vli_montInit(r2, curve->n,
+					BITS_TO_WORDS(curve->num_n_bits));
+	return TC_CRYPTO_SUCCESS;
+}
+
+int uECC_nonce_pool_put(uECC_NoncePool *pool, uECC_Nonce *nonce)
+{
+	unsigned int tail;
+	int result = TC_CRYPTO_FAIL;
+
+	/* input sanity check: */
+	if (nonce == (uECC_Nonce *) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	if (pool != (uECC_NoncePool *) 0) {
+		tail = pool->tail;
+		if (tail - pool_load(&pool->head) < uECC_NONCE_POOL_SIZE) {
+			memcpy(&pool->nonces[tail % uECC_NONCE_POOL_SIZE], nonce,
+			       sizeof(*nonce));
+			pool_store(&pool->tail, tail + 1);
+			result = TC_CRYPTO_SUCCESS;
+		}
+	}
+
+	_set_secure(nonce, 0, sizeof(*nonce));
+	return result;
+}
+
+int uECC_nonce_pool_refill_ctx(const uECC_Ctx *ctx, uECC_NoncePool *pool)
+{
+	uECC_Nonce nonce;
+
+	/* input sanity check: */
+	if (pool == (uECC_NoncePool *) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	while (pool->tail - pool_load(&pool->head) < uECC_NONCE_POOL_SIZE) {
+		if (!uECC_nonce_make_ctx(ctx, &nonce, pool->curve)) {
+			return TC_CRYPTO_FAIL;
+		}
+		(void)uECC_nonce_pool_put(pool, &nonce);
+	}
+	return TC_CRYPTO_SUCCESS;
+}
+
+int uECC_nonce_pool_refill(uECC_NoncePool *pool)
+{
+	return uECC_nonce_pool_refill_ctx(0, pool);
+}
+
+void uECC_nonce_pool_clear(uECC_NoncePool *pool)
+{
+	if (pool != (uECC_NoncePool *) 0) {
+		_set_secure(pool->nonces, 0, sizeof(pool->nonces));
+		pool->head = 0;
+		pool->tail = 0;
+	}
+}
+
+/*
+ * Consumer side: moves the oldest unused nonce out of the pool and erases its
+ * slot before handing the slot back to the producer.
+ */
+static int pool_take(uECC_NoncePool *pool, uECC_Nonce *nonce)
+{
+	unsigned int head = pool->head;
+	uECC_Nonce *slot;
+
+	if (head == pool_load(&pool->tail)) {
+		return 0;
+	}
+	slot = &pool->nonces[head % uECC_NONCE_POOL_SIZE];
+	memcpy(nonce, slot, sizeof(*nonce));
+	_set_secure(slot, 0, sizeof(*slot));
+	pool_store(&pool->head, head + 1);
+	return 1;
+}
+
+int uECC_sign_pooled(uECC_NoncePool *pool, const uint_least8_t *private_key,
+		     const uint_least8_t *message_hash, uint32_t hash_size,
+		     uint_least8_t *signature)
+{
+	uECC_Nonce nonce;
+	uECC_word_t d[NUM_ECC_WORDS];
+	uECC_word_t e[NUM_ECC_WORDS];
+	uECC_word_t s[NUM_ECC_WORDS];
+	uECC_Curve curve;
+	wordcount_t num_n_words;
+	uECC_word_t tries;
+	int result = TC_CRYPTO_FAIL;
+
+	/* input sanity check: */
+	if (pool == (uECC_NoncePool *) 0 || pool->curve == (uECC_Curve) 0 ||
+	    private_key == (const uint_least8_t *) 0 ||
+	    message_hash == (const uint_least8_t *) 0 ||
+	    signature == (uint_least8_t *) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+	curve = pool->curve;
+	num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+
+	d[num_n_words - 1] = 0;
+	uECC_vli_bytesToWords(d, private_key, BITS_TO_BYTES(curve->num_n_bits));
+	bits2int(e, message_hash, hash_size, curve);
+
+	for (tries = 0; tries < uECC_RNG_MAX_TRIES; ++tries) {
+		/* take the nonce out of the pool before using it: */
+		if (!pool_take(pool, &nonce) && !uECC_nonce_make(&nonce, curve)) {
+			break;
+		}
+
+		/* s = (e + r*d) / k, with r and 1/k in the Montgomery domain: */
+		uECC_vli_montMult(s, nonce.r_mont, d, curve->n, pool->n_inv,
+				  num_n_words);
+		uECC_vli_modAdd(s, e, s, curve->n, num_n_words);
+		uECC_vli_montMult(s, nonce.k_inv_mont, s, curve->n, pool->n_inv,
+				  num_n_words);
+
+		if (!uECC_vli_isZero(s, num_n_words)) {
+			uECC_vli_wordsToBytes(signature, curve->num_bytes, nonce.r);
+			uECC_vli_wordsToBytes(signature + curve->num_bytes,
+					      curve->num_bytes, s);
+			result = TC_CRYPTO_SUCCESS;
+			break;
+		}
+	}
+
+	_set_secure(&nonce, 0, sizeof(nonce));
+	_set_secure(d, 0, sizeof(d));
+	_set_secure(s, 0, sizeof(s));
+	return result;
+}
+
+int uECC_deterministic_key_init(uECC_DeterministicKey *key,
+				const uint_least8_t *private_key,
+				uECC_Curve curve)
+{
+	uECC_word_t x[NUM_ECC_WORDS];
+	wordcount_t num_n_words;
+	uint32_t num_n_bytes;
+
+	/* input sanity check: */
+	if (key == (uECC_DeterministicKey *) 0 ||
+	    private_key == (const uint_least8_t *) 0 ||
+	    curve == (uECC_Curve) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+	num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+	num_n_bytes = BITS_TO_BYTES(curve->num_n_bits);
+
+	x[num_n_words - 1] = 0;
+	uECC_vli_bytesToWords(x, private_key, num_n_bytes);
+	if (uECC_vli_isZero(x, num_n_words) ||
+	    uECC_vli_cmp(curve->n, x, num_n_words) != 1) {
+		_set_secure(x, 0, sizeof(x));
+		return TC_CRYPTO_FAIL;
+	}
+
+	key->curve = curve;
+	uECC_vli_wordsToBytes(key->private_key, num_n_bytes, x);
+
+	/* RFC 6979, 3.2 b. to d.: the part of K = HMAC_K(V || 0x00 ||
+	 * int2octets(x) || bits2octets(h1)) that comes before h1 */
+	(void)tc_hmac_prng_instantiate_prefix(&key->prefix, key->private_key,
+					      num_n_bytes);
+
+	_set_secure(x, 0, sizeof(x));
+	return TC_CRYPTO_SUCCESS;
+}
+
+void uECC_deterministic_key_clear(uECC_DeterministicKey *key)
+{
+	if (key != (uECC_DeterministicKey *) 0) {
+		_set_secure(key, 0, sizeof(*key));
+	}
+}
+
+int uECC_sign_deterministic(const uECC_DeterministicKey *key,
+			    const uint_least8_t *message_hash,
+			    uint32_t hash_size, uint_least8_t *signature)
+{
+	struct tc_hmac_prng_struct prng;
+	uint_least8_t h1[NUM_ECC_BYTES];
+	uint_least8_t t[NUM_ECC_BYTES];
+	uECC_word_t k[NUM_ECC_WORDS];
+	uECC_word_t blind[NUM_ECC_WORDS];
+	uECC_word_t scratch[SIGN_WITH_K_WORDS];
+	uECC_Curve curve;
+	wordcount_t num_n_words;
+	uint32_t num_n_bytes;
+	uECC_word_t tries;
+	int result = TC_CRYPTO_FAIL;
+
+	/* input sanity check: */
+	if (key == (const uECC_DeterministicKey *) 0 ||
+	    key->curve == (uECC_Curve) 0 ||
+	    message_hash == (const uint_least8_t *) 0 ||
+	    signature == (uint_least8_t *) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+	curve = key->curve;
+	num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+	num_n_bytes = BITS_TO_BYTES(curve->num_n_bits);
+
+	/* bits2octets(h1): */
+	bits2int(k, message_hash, hash_size, curve);
+	uECC_vli_wordsToBytes(h1, num_n_bytes, k);
+
+	/* b. to g.: an HMAC-DRBG instantiated with int2octets(x) ||
+	 * bits2octets(h1), starting from the prepared key */
+	if (!tc_hmac_prng_instantiate(&prng, &key->prefix, key->private_key,
+				      num_n_bytes, h1, num_n_bytes)) {
+		_set_secure(k, 0, sizeof(k));
+		return TC_CRYPTO_FAIL;
+	}
+
+	/*
+	 * Step h. is the generate function: each call returns the next
+	 * candidate nonce, and nothing else is drawn from the generator, so
+	 * that retries follow the RFC.
+	 */
+	for (tries = 0; tries < uECC_RNG_MAX_TRIES; ++tries) {
+		if (tc_hmac_prng_generate(t, num_n_bytes, &prng) !=
+		    TC_CRYPTO_SUCCESS) {
+			break;
+		}
+		/* k = bits2int(T); qlen is a multiple of 8 on supported curves */
+		k[num_n_words - 1] = 0;
+		uECC_vli_bytesToWords(k, t, num_n_bytes);
+		if (uECC_vli_isZero(k, num_n_words) ||
+		    uECC_vli_cmp(curve->n, k, num_n_words) != 1) {
+			continue;
+		}
+
+		/* the inversion runs in constant time: no blinding needed */
+		uECC_vli_clear(blind, num_n_words);
+		blind[0] = 1;
+
+		if (sign_with_k(key->private_key, message_hash, hash_size, k,
+				blind, signature, scratch, curve)) {
+			result = TC_CRYPTO_SUCCESS;
+			break;
+		}
+	}
+
+	_set_secure(&prng, 0, sizeof(prng));
+	_set_secure(t, 0, sizeof(t));
+	_set_secure(k, 0, sizeof(k));
+	_set_secure(blind, 0, sizeof(blind));
+	_set_secure(scratch, 0, sizeof(scratch));
+	return result;
+}
+
+/*
+ * Accepts the signature iff the x coordinate of the Jacobian point (X, ., Z),
+ * reduced mod n, equals r. Stays in Jacobian coordinates: x = X / Z^2, and
+ * x mod n == r iff X == r * Z^2 or, when r + n < p, X == (r + n) * Z^2.
+ */
+static int check_r(const uECC_word_t *X, const uECC_word_t *Z,
+		   const uECC_word_t *r, uECC_Curve curve)
+{
+	uECC_word_t z2[NUM_ECC_WORDS];
+	uECC_word_t t[NUM_ECC_WORDS];
+	uECC_word_t rn[NUM_ECC_WORDS];
+	wordcount_t num_words = curve->num_words;
+
+	/* the point at infinity has no x coordinate: */
+	if (uECC_vli_isZero(Z, num_words)) {
+		return 0;
+	}
+
+	uECC_vli_modMult_fast(z2, Z, Z, curve);
+	uECC_vli_modMult_fast(t, r, z2, curve);
+	if (uECC_vli_equal(t, X, num_words) == 0) {
+		return 1;
+	}
+
+	uECC_vli_sub(rn, curve->p, curve->n, num_words); /* p - n */
+	if (uECC_vli_cmp_unsafe(rn, r, num_words) != 1) {
+		return 0;
+	}
+	uECC_vli_modAdd(rn, r, curve->n, curve->p, num_words); /* r + n */
+	uECC_vli_modMult_fast(t, rn, z2, curve);
+	return (int)(uECC_vli_equal(t, X, num_words) == 0);
+}
+
+/* Loads a public key into native integers. */
+static void load_public_key(uECC_word_t *_public,
+			    const uint_least8_t *public_key, uECC_Curve curve)
+{
+	uECC_vli_bytesToWords(_public, public_key, curve->num_bytes);
+	uECC_vli_bytesToWords(_public + curve->num_words,
+			      public_key + curve->num_bytes, curve->num_bytes);
+}
+
+/*
+ * Loads the signature (r, s) into native integers. Returns 0 if r or s is out
+ * of range.
+ */
+static int load_signature(uECC_word_t *r, uECC_word_t *s,
+			  const uint_least8_t *signature, uECC_Curve curve)
+{
 	wordcount_t num_words = curve->num_words;
 	wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
 
-	rx[num_n_words - 1] = 0;
 	r[num_n_words - 1] = 0;
 	s[num_n_words - 1] = 0;
 
-	uECC_vli_bytesToNative(_public, public_key, curve->num_bytes);
-	uECC_vli_bytesToNative(_public + num_words, public_key + curve->num_bytes,
-			       curve->num_bytes);
-	uECC_vli_bytesToNative(r, signature, curve->num_bytes);
-	uECC_vli_bytesToNative(s, signature + curve->num_bytes, curve->num_bytes);
+	uECC_vli_bytesToWords(r, signature, curve->num_bytes);
+	uECC_vli_bytesToWords(s, signature + curve->num_bytes, curve->num_bytes);
 
 	/* r, s must not be 0. */
 	if (uECC_vli_isZero(r, num_words) || uECC_vli_isZero(s, num_words)) {
@@ -227,64 +638,484 @@ int uECC_verify(const uint_least8_t *public_key, const uint_least8_t *message_ha
 	    uECC_vli_cmp_unsafe(curve->n, s, num_n_words) != 1) {
 		return 0;
 	}
+	return 1;
+}
+
+/*
+ * Odd multiples of G: static when the curve has a fixed-base table, computed
+ * into buffer otherwise.
+ */
+static const uECC_word_t *g_odd_multiples(uECC_word_t *buffer,
+					  wordcount_t *width, uECC_Curve curve)
+{
+	const uECC_word_t *table = EccPoint_odd_multiples_G(curve, width);
+
+	if (!table) {
+		*width = uECC_VERIFY_WIDTH;
+		EccPoint_odd_multiples(buffer, curve->G, *width, curve);
+		table = buffer;
+	}
+	return table;
+}
+
+/*
+ * Checks r against u1*G + u2*Q, computed with interleaved wNAF, with the
+ * temporaries of EccPoint_mult_wnaf in scratch (0: on the stack).
+ */
+static int verify_u(const uECC_word_t *u1, const uECC_word_t *u2,
+		    const uECC_word_t *g_table, wordcount_t g_width,
+		    const uECC_word_t *q_table, wordcount_t q_width,
+		    const uECC_word_t *r, uECC_word_t *scratch,
+		    uECC_Curve curve)
+{
+	uECC_word_t rx[NUM_ECC_WORDS];
+	uECC_word_t ry[NUM_ECC_WORDS];
+	uECC_word_t z[NUM_ECC_WORDS];
+	const uECC_word_t *scalars[2];
+	const uECC_word_t *tables[2];
+	wordcount_t widths[2];
+
+	scalars[0] = u1;
+	scalars[1] = u2;
+	tables[0] = g_table;
+	tables[1] = q_table;
+	widths[0] = g_width;
+	widths[1] = q_width;
+	if (scratch) {
+		EccPoint_mult_wnaf_scratch(rx, ry, z, scalars, tables, widths, 2,
+					   scratch, curve);
+	} else {
+		EccPoint_mult_wnaf(rx, ry, z, scalars, tables, widths, 2, curve);
+	}
+
+	return check_r(rx, z, r, curve);
+}
+
+/*
+ * Checks up to uECC_LANES signatures at once with the multi-lane engine,
+ * filling unused lanes with copies of the first one. Returns the mask of the
+ * signatures it could decide, with their outcome in results.
+ */
+static unsigned int verify_lanes(uECC_word_t (*u1)[NUM_ECC_WORDS],
+				 uECC_word_t (*u2)[NUM_ECC_WORDS],
+				 const uECC_word_t *g_table, wordcount_t g_width,
+				 const uECC_word_t *q_tables,
+				 uECC_word_t (*r)[NUM_ECC_WORDS],
+				 unsigned int count, int *results,
+				 uECC_Curve curve)
+{
+	uECC_word_t X[uECC_LANES * NUM_ECC_WORDS];
+	uECC_word_t Y[uECC_LANES * NUM_ECC_WORDS];
+	uECC_word_t Z[uECC_LANES * NUM_ECC_WORDS];
+	const uECC_word_t *scalars[uECC_LANES * 2];
+	const uECC_word_t *tables[uECC_LANES * 2];
+	wordcount_t widths[2];
+	unsigned int table_words = (1u << (uECC_VERIFY_WIDTH - 2)) * 2 *
+				   curve->num_words;
+	unsigned int done, l;
+
+	for (l = 0; l < uECC_LANES; ++l) {
+		unsigned int src = l < count ? l : 0;
+		scalars[2 * l] = u1[src];
+		scalars[2 * l + 1] = u2[src];
+		tables[2 * l] = g_table;
+		tables[2 * l + 1] = q_tables + src * table_words;
+	}
+	widths[0] = g_width;
+	widths[1] = uECC_VERIFY_WIDTH;
+
+	done = EccPoint_mult_wnaf_x8(X, Y, Z, scalars, tables, widths, 2, curve);
+	done &= (1u << count) - 1;
+	for (l = 0; l < count; ++l) {
+		if (done & (1u << l)) {
+			results[l] = check_r(X + l * NUM_ECC_WORDS,
+					     Z + l * NUM_ECC_WORDS, r[l], curve);
+		}
+	}
+	return done;
+}
+
+/* u1 = e / s and u2 = r / s, modulo n. */
+static void compute_u(uECC_word_t *u1, uECC_word_t *u2, const uECC_word_t *r,
+		      const uECC_word_t *s, const uint_least8_t *message_hash,
+		      uint32_t hash_size, uECC_Curve curve)
+{
+	uECC_word_t z[NUM_ECC_WORDS];
+	wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
 
-	/* Calculate u1 and u2. */
 	uECC_vli_modInv(z, s, curve->n, num_n_words); /* z = 1/s */
 	u1[num_n_words - 1] = 0;
 	bits2int(u1, message_hash, hash_size, curve);
 	uECC_vli_modMult(u1, u1, z, curve->n, num_n_words); /* u1 = e/s */
 	uECC_vli_modMult(u2, r, z, curve->n, num_n_words); /* u2 = r/s */
+}
+
+/* Scratch words verify_scratch needs for curve. */
+static unsigned int verify_scratch_words(uECC_Curve curve)
+{
+	wordcount_t widths[2];
+	unsigned int num_tables = 1;
+	unsigned int words, tables_words;
+
+	if (!EccPoint_odd_multiples_G(curve, &widths[0])) {
+		widths[0] = uECC_VERIFY_WIDTH;
+		num_tables = 2;
+	}
+	widths[1] = uECC_VERIFY_WIDTH;
+
+	/* the multiplication reuses the scratch of the tables: */
+	words = EccPoint_mult_wnaf_scratch_words(widths, 2, curve);
+	tables_words = num_tables * VERIFY_TABLE_WORDS;
+	if (words < tables_words) {
+		words = tables_words;
+	}
+	return 8 * NUM_ECC_WORDS + tables_words + words;
+}
+
+/*
+ * uECC_verify with every buffer in scratch (see verify_scratch_words). When G
+ * has no static table, its table is computed along with the one of the
+ * public key, sharing the inversion.
+ */
+static int verify_scratch(const uint_least8_t *public_key,
+			  const uint_least8_t *message_hash, uint32_t hash_size,
+			  const uint_least8_t *signature, uECC_word_t *scratch,
+			  uECC_Curve curve)
+{
+	uECC_word_t *u1 = scratch;
+	uECC_word_t *u2 = u1 + NUM_ECC_WORDS;
+	uECC_word_t *r = u2 + NUM_ECC_WORDS;
+	uECC_word_t *s = r + NUM_ECC_WORDS;
+	uECC_word_t *points = s + NUM_ECC_WORDS;
+	uECC_word_t *q_table = points + 4 * NUM_ECC_WORDS;
+	uECC_word_t *rest = q_table + VERIFY_TABLE_WORDS;
+	const uECC_word_t *g_table;
+	wordcount_t g_width;
+	unsigned int num_tables = 1;
+
+	if (!load_signature(r, s, signature, curve)) {
+		return 0;
+	}
+	load_public_key(points, public_key, curve);
+
+	compute_u(u1, u2, r, s, message_hash, hash_size, curve);
+
+	g_table = EccPoint_odd_multiples_G(curve, &g_width);
+	if (!g_table) {
+		uECC_vli_set(points + 2 * NUM_ECC_WORDS, curve->G,
+			     2 * curve->num_words);
+		g_table = rest;
+		g_width = uECC_VERIFY_WIDTH;
+		rest += VERIFY_TABLE_WORDS;
+		num_tables = 2;
+	}
+	EccPoint_odd_multiples_batch(q_table, points, num_tables,
+				     uECC_VERIFY_WIDTH, rest,
+				     rest + num_tables * VERIFY_TABLE_WORDS / 2,
+				     curve);
+
+	return verify_u(u1, u2, g_table, g_width, q_table, uECC_VERIFY_WIDTH, r,
+			rest, curve);
+}
 
-	/* Calculate sum = G + Q. */
-	uECC_vli_set(sum, _public, num_words);
-	uECC_vli_set(sum + num_words, _public + num_words, num_words);
-	uECC_vli_set(tx, curve->G, num_words);
-	uECC_vli_set(ty, curve->G + num_words, num_words);
-	uECC_vli_modSub(z, sum, tx, curve->p, num_words); /* z = x2 - x1 */
-	XYcZ_add(tx, ty, sum, sum + num_words, curve);
-	uECC_vli_modInv(z, z, curve->p, num_words); /* z = 1/z */
-	apply_z(sum, sum + num_words, z, curve);
-
-	/* Use Shamir's trick to calculate u1*G + u2*Q */
-	points[0] = 0;
-	points[1] = curve->G;
-	points[2] = _public;
-	points[3] = sum;
-	num_bits = smax(uECC_vli_numBits(u1, num_n_words),
-	uECC_vli_numBits(u2, num_n_words));
-
-	point = points[(!!uECC_vli_testBit(u1, num_bits - 1)) |
-                       ((!!uECC_vli_testBit(u2, num_bits - 1)) << 1)];
-	uECC_vli_set(rx, point, num_words);
-	uECC_vli_set(ry, point + num_words, num_words);
-	uECC_vli_clear(z, num_words);
-	z[0] = 1;
-
-	for (i = num_bits - 2; i >= 0; --i) {
-		uECC_word_t index;
-		curve->double_jacobian(rx, ry, z, curve);
-
-		index = (!!uECC_vli_testBit(u1, i)) | ((!!uECC_vli_testBit(u2, i)) << 1);
-		point = points[index];
-		if (point) {
-			uECC_vli_set(tx, point, num_words);
-			uECC_vli_set(ty, point + num_words, num_words);
-			apply_z(tx, ty, z, curve);
-			uECC_vli_modSub(tz, rx, tx, curve->p, num_words); /* Z = x2 - x1 */
-			XYcZ_add(tx, ty, rx, ry, curve);
-			uECC_vli_modMult_fast(z, z, tz, curve);
+int uECC_verify(const uint_least8_t *public_key, const uint_least8_t *message_hash,
+		uint32_t hash_size, const uint_least8_t *signature,
+	        uECC_Curve curve)
+{
+	uECC_word_t scratch[VERIFY_SCRATCH_WORDS];
+
+	return verify_scratch(public_key, message_hash, hash_size, signature,
+			      scratch, curve);
+}
+
+unsigned int uECC_scratch_size(uECC_Curve curve)
+{
+	unsigned int words = verify_scratch_words(curve);
+
+	if (words < SIGN_SCRATCH_WORDS) {
+		words = SIGN_SCRATCH_WORDS;
+	}
+	return words * uECC_WORD_SIZE;
+}
+
+int uECC_sign_scratch(const uECC_Ctx *ctx, const uint_least8_t *private_key,
+		      const uint_least8_t *message_hash, uint32_t hash_size,
+		      uint_least8_t *signature, uECC_Curve curve,
+		      uECC_word_t *scratch, unsigned int scratch_size)
+{
+	int result;
+
+	if (scratch == (uECC_word_t *) 0 ||
+	    scratch_size < uECC_scratch_size(curve)) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	result = sign_scratch(ctx, private_key, message_hash, hash_size,
+			      signature, scratch, curve);
+	_set_secure(scratch, 0, SIGN_SCRATCH_WORDS * uECC_WORD_SIZE);
+	return result;
+}
+
+int uECC_verify_scratch(const uint_least8_t *public_key,
+			const uint_least8_t *message_hash, uint32_t hash_size,
+			const uint_least8_t *signature, uECC_Curve curve,
+			uECC_word_t *scratch, unsigned int scratch_size)
+{
+	if (scratch == (uECC_word_t *) 0 ||
+	    scratch_size < verify_scratch_words(curve) * uECC_WORD_SIZE) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	return verify_scratch(public_key, message_hash, hash_size, signature,
+			      scratch, curve);
+}
+
+int uECC_verify_batch(const uint_least8_t * const *public_keys,
+		      const uint_least8_t * const *message_hashes,
+		      uint32_t hash_size,
+		      const uint_least8_t * const *signatures,
+		      unsigned int count, int *results, uECC_Curve curve)
+{
+	uECC_word_t _public[uECC_VERIFY_BATCH_SIZE][NUM_ECC_WORDS * 2];
+	uECC_word_t r[uECC_VERIFY_BATCH_SIZE][NUM_ECC_WORDS];
+	uECC_word_t w[uECC_VERIFY_BATCH_SIZE * NUM_ECC_WORDS];
+	uECC_word_t q_tables[uECC_VERIFY_BATCH_SIZE *
+			     (1 << (uECC_VERIFY_WIDTH - 2)) * 2 * NUM_ECC_WORDS];
+	uECC_word_t z[uECC_VERIFY_BATCH_SIZE *
+		      (1 << (uECC_VERIFY_WIDTH - 2)) * NUM_ECC_WORDS];
+	uECC_word_t scratch[uECC_VERIFY_BATCH_SIZE *
+			    (1 << (uECC_VERIFY_WIDTH - 2)) * NUM_ECC_WORDS];
+	uECC_word_t g_buffer[(1 << (uECC_VERIFY_WIDTH - 2)) * 2 * NUM_ECC_WORDS];
+	uECC_word_t u1[uECC_VERIFY_BATCH_SIZE][NUM_ECC_WORDS];
+	uECC_word_t u2[uECC_VERIFY_BATCH_SIZE][NUM_ECC_WORDS];
+	uECC_word_t r2[NUM_ECC_WORDS];
+	uECC_word_t n_inv;
+	unsigned int index[uECC_VERIFY_BATCH_SIZE];
+	int lane_results[uECC_LANES];
+	unsigned int done;
+	unsigned int table_words = (1u << (uECC_VERIFY_WIDTH - 2)) * 2 *
+				   curve->num_words;
+	const uECC_word_t *g_table;
+	wordcount_t g_width;
+	wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+	unsigned int start, start_lane, i, m;
+	int all_valid = 1;
+
+	/* input sanity check: */
+	if (count == 0) {
+		return 1;
+	}
+	if (public_keys == (const uint_least8_t * const *) 0 ||
+	    message_hashes == (const uint_least8_t * const *) 0 ||
+	    signatures == (const uint_least8_t * const *) 0 ||
+	    results == (int *) 0) {
+		return 0;
+	}
+
+	g_table = g_odd_multiples(g_buffer, &g_width, curve);
+	n_inv = uECC_vli_montInit(r2, curve->n, num_n_words);
+
+	for (start = 0; start < count; start += uECC_VERIFY_BATCH_SIZE) {
+
+		/* Parse the chunk, setting aside malformed signatures and keys
+		 * (a point off the curve could have no affine multiples and
+		 * would spoil the shared inversion): */
+		m = 0;
+		for (i = start; i < count && i < start + uECC_VERIFY_BATCH_SIZE;
+		     ++i) {
+			results[i] = 0;
+			load_public_key(_public[m], public_keys[i], curve);
+			if (!load_signature(r[m], w + m * num_n_words,
+					    signatures[i], curve) ||
+			    uECC_valid_point(_public[m], curve) != 0) {
+				all_valid = 0;
+				continue;
+			}
+			index[m++] = i;
+		}
+		if (m == 0) {
+			continue;
+		}
+
+		/* One inversion mod n for all the 1/s, one inversion mod p for
+		 * all the tables of odd multiples of the public keys: */
+		uECC_vli_modInv_batch(w, scratch, m, curve->n, curve);
+		EccPoint_odd_multiples_batch(q_tables, _public[0], m,
+					     uECC_VERIFY_WIDTH, z, scratch,
+					     curve);
+
+		for (i = 0; i < m; ++i) {
+			uECC_word_t *wi = w + i * num_n_words;
+
+			/* (1/s) R, so that a single Montgomery product gives
+			 * u1 = e/s and u2 = r/s: */
+			uECC_vli_montMult(wi, wi, r2, curve->n, n_inv, num_n_words);
+			u1[i][num_n_words - 1] = 0;
+			bits2int(u1[i], message_hashes[index[i]], hash_size, curve);
+			uECC_vli_montMult(u1[i], u1[i], wi, curve->n, n_inv,
+					  num_n_words);
+			uECC_vli_montMult(u2[i], r[i], wi, curve->n, n_inv,
+					  num_n_words);
+		}
+
+		/* Groups of up to uECC_LANES signatures go through the
+		 * multi-lane engine where the CPU has one (eight lanes cost
+		 * about as much as one scalar verification, so any group of
+		 * two or more gains); a lone signature, and the lanes the
+		 * engine leaves out, through the scalar code: */
+		for (start_lane = 0; start_lane < m; start_lane += uECC_LANES) {
+			unsigned int lanes = m - start_lane;
+
+			if (lanes > uECC_LANES) {
+				lanes = uECC_LANES;
+			}
+			done = 0;
+			if (lanes >= 2) {
+				done = verify_lanes(u1 + start_lane,
+						    u2 + start_lane, g_table,
+						    g_width,
+						    q_tables + start_lane * table_words,
+						    r + start_lane, lanes,
+						    lane_results, curve);
+			}
+			for (i = start_lane; i < m && i < start_lane + uECC_LANES;
+			     ++i) {
+				if (done & (1u << (i - start_lane))) {
+					results[index[i]] =
+						lane_results[i - start_lane];
+				} else {
+					results[index[i]] = verify_u(u1[i], u2[i],
+						g_table, g_width,
+						q_tables + i * table_words,
+						uECC_VERIFY_WIDTH, r[i], 0,
+						curve);
+				}
+				all_valid &= results[index[i]];
+			}
+		}
+	}
+
+	return all_valid;
+}
+
+int uECC_prepare_public_key(uECC_PublicKeyCtx *ctx,
+			    const uint_least8_t *public_key, uECC_Curve curve)
+{
+	uECC_word_t _public[NUM_ECC_WORDS * 2];
+
+	/* input sanity check: */
+	if (ctx == (uECC_PublicKeyCtx *) 0 ||
+	    public_key == (const uint_least8_t *) 0) {
+		return 0;
+	}
+
+	/* the checks of uECC_valid_public_key, which also rejects G: */
+	ctx->curve = (uECC_Curve) 0;
+	if (uECC_valid_public_key(public_key, curve) != 0) {
+		return 0;
+	}
+	load_public_key(_public, public_key, curve);
+
+	memcpy(ctx->key, public_key, 2 * curve->num_bytes);
+	EccPoint_odd_multiples(ctx->table, _public, uECC_PREPARED_WIDTH, curve);
+	ctx->curve = curve;
+	return 1;
+}
+
+int uECC_verify_prepared(const uECC_PublicKeyCtx *ctx,
+			 const uint_least8_t *message_hash, uint32_t hash_size,
+			 const uint_least8_t *signature)
+{
+	uECC_word_t u1[NUM_ECC_WORDS], u2[NUM_ECC_WORDS];
+	uECC_word_t r[NUM_ECC_WORDS], s[NUM_ECC_WORDS];
+	uECC_word_t g_buffer[(1 << (uECC_VERIFY_WIDTH - 2)) * 2 * NUM_ECC_WORDS];
+	const uECC_word_t *g_table;
+	wordcount_t g_width;
+	uECC_Curve curve;
+
+	/* input sanity check: */
+	if (ctx == (const uECC_PublicKeyCtx *) 0 ||
+	    ctx->curve == (uECC_Curve) 0) {
+		return 0;
+	}
+	curve = ctx->curve;
+
+	if (!load_signature(r, s, signature, curve)) {
+		return 0;
+	}
+	compute_u(u1, u2, r, s, message_hash, hash_size, curve);
+
+	g_table = g_odd_multiples(g_buffer, &g_width, curve);
+	return verify_u(u1, u2, g_table, g_width, ctx->table,
+			uECC_PREPARED_WIDTH, r, 0, curve);
+}
+
+void uECC_key_cache_init(uECC_PublicKeyCache *cache)
+{
+	unsigned int i;
+
+	for (i = 0; i < uECC_KEY_CACHE_SIZE; ++i) {
+		cache->entries[i].curve = (uECC_Curve) 0;
+		cache->last_used[i] = 0;
+	}
+	cache->clock = 0;
+}
+
+const uECC_PublicKeyCtx *uECC_key_cache_get(uECC_PublicKeyCache *cache,
+					    const uint_least8_t *public_key,
+					    uECC_Curve curve)
+{
+	uECC_PublicKeyCtx prepared;
+	unsigned int victim = 0;
+	unsigned int i;
+
+	/* input sanity check: */
+	if (cache == (uECC_PublicKeyCache *) 0 ||
+	    public_key == (const uint_least8_t *) 0) {
+		return (const uECC_PublicKeyCtx *) 0;
+	}
+
+	if (++cache->clock == 0) {
+		/* the clock wrapped around: restart the ages of all entries */
+		for (i = 0; i < uECC_KEY_CACHE_SIZE; ++i) {
+			if (cache->last_used[i]) {
+				cache->last_used[i] = 1;
+			}
 		}
-  	}
+		cache->clock = 2;
+	}
 
-	uECC_vli_modInv(z, z, curve->p, num_words); /* Z = 1/Z */
-	apply_z(rx, ry, z, curve);
+	for (i = 0; i < uECC_KEY_CACHE_SIZE; ++i) {
+		uECC_PublicKeyCtx *entry = &cache->entries[i];
 
-	/* v = x1 (mod n) */
-	if (uECC_vli_cmp_unsafe(curve->n, rx, num_n_words) != 1) {
-		uECC_vli_sub(rx, rx, curve->n, num_n_words);
+		if (entry->curve == curve &&
+		    memcmp(entry->key, public_key, 2 * curve->num_bytes) == 0) {
+			cache->last_used[i] = cache->clock;
+			return entry;
+		}
+		/* free entries have last_used == 0 and are taken first: */
+		if (cache->last_used[i] < cache->last_used[victim]) {
+			victim = i;
+		}
 	}
 
-	/* Accept only if v == r. */
-	return (int)(uECC_vli_equal(rx, r, num_words) == 0);
+	/*
+	 * miss: prepare the key aside, and evict the least recently used entry
+	 * only once it is known to be valid
+	 */
+	if (!uECC_prepare_public_key(&prepared, public_key, curve)) {
+		return (const uECC_PublicKeyCtx *) 0;
+	}
+	memcpy(&cache->entries[victim], &prepared, sizeof(prepared));
+	cache->last_used[victim] = cache->clock;
+	return &cache->entries[victim];
 }
 
+int uECC_verify_cached(uECC_PublicKeyCache *cache,
+		       const uint_least8_t *public_key,
+		       const uint_least8_t *message_hash, uint32_t hash_size,
+		       const uint_least8_t *signature, uECC_Curve curve)
+{
+	return uECC_verify_prepared(uECC_key_cache_get(cache, public_key, curve),
+				    message_hash, hash_size, signature);
+}
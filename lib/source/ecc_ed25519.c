@@ -0,0 +1,1022 @@
+/* ecc_ed25519.c - TinyCrypt implementation of Ed25519 signatures */
+
+/*
+ *  Copyright (C) 2017 by Intel Corporation, All Rights Reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *    - Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *    - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ *    - Neither the name of Intel Corporation nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <tinycrypt/constants.h>
+#include <tinycrypt/ecc.h>
+#include <tinycrypt/ecc_ed25519.h>
+#include <tinycrypt/sha512.h>
+#include <tinycrypt/utils.h>
+#include <string.h>
+
+#include "ecc_fe25519.h"
+
+/*
+ * Points of -x^2 + y^2 = 1 + d x^2 y^2, in extended coordinates:
+ * x = X/Z, y = Y/Z and x y = T/Z.
+ */
+typedef struct {
+	fe X, Y, Z, T;
+} ge_p3;
+
+/* Result of an addition or a doubling: x = X/Z, y = Y/T. */
+typedef struct {
+	fe X, Y, Z, T;
+} ge_p1p1;
+
+/* Second operand of an addition: (Y + X, Y - X, Z, 2dT). */
+typedef struct {
+	fe YplusX, YminusX, Z, T2d;
+} ge_cached;
+
+/* Affine second operand of an addition: (y + x, y - x, 2dxy). */
+typedef struct {
+	fe yplusx, yminusx, xy2d;
+} ge_precomp;
+
+/* Constants, little-endian: d = -121665/121666, 2d and sqrt(-1) mod p. */
+static const uint_least8_t ed25519_d[32] = {
+	0xa3, 0x78, 0x59, 0x13, 0xca, 0x4d, 0xeb, 0x75, 0xab, 0xd8, 0x41, 0x41,
+	0x4d, 0x0a, 0x70, 0x00, 0x98, 0xe8, 0x79, 0x77, 0x79, 0x40, 0xc7, 0x8c,
+	0x73, 0xfe, 0x6f, 0x2b, 0xee, 0x6c, 0x03, 0x52
+};
+static const uint_least8_t ed25519_d2[32] = {
+	0x59, 0xf1, 0xb2, 0x26, 0x94, 0x9b, 0xd6, 0xeb, 0x56, 0xb1, 0x83, 0x82,
+	0x9a, 0x14, 0xe0, 0x00, 0x30, 0xd1, 0xf3, 0xee, 0xf2, 0x80, 0x8e, 0x19,
+	0xe7, 0xfc, 0xdf, 0x56, 0xdc, 0xd9, 0x06, 0x24
+};
+static const uint_least8_t ed25519_sqrtm1[32] = {
+	0xb0, 0xa0, 0x0e, 0x4a, 0x27, 0x1b, 0xee, 0xc4, 0x78, 0xe4, 0x2f, 0xad,
+	0x06, 0x18, 0x43, 0x2f, 0xa7, 0xd7, 0xfb, 0x3d, 0x99, 0x00, 0x4d, 0x2b,
+	0x0b, 0xdf, 0xc1, 0x4f, 0x80, 0x24, 0x83, 0x2b
+};
+
+/* Base point B = (x, 4/5) with x even. */
+static const uint_least8_t ed25519_base_x[32] = {
+	0x1a, 0xd5, 0x25, 0x8f, 0x60, 0x2d, 0x56, 0xc9, 0xb2, 0xa7, 0x25, 0x95,
+	0x60, 0xc7, 0x2c, 0x69, 0x5c, 0xdc, 0xd6, 0xfd, 0x31, 0xe2, 0xa4, 0xc0,
+	0xfe, 0x53, 0x6e, 0xcd, 0xd3, 0x36, 0x69, 0x21
+};
+static const uint_least8_t ed25519_base_y[32] = {
+	0x58, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+	0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+	0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66
+};
+
+/* Order of B: L = 2^252 + 27742317777372353535851937790883648493. */
+static const uECC_word_t ed25519_L[NUM_ECC_WORDS] = {
+	BYTES_TO_WORDS_8(ED, D3, F5, 5C, 1A, 63, 12, 58),
+	BYTES_TO_WORDS_8(D6, 9C, F7, A2, DE, F9, DE, 14),
+	BYTES_TO_WORDS_8(00, 00, 00, 00, 00, 00, 00, 00),
+	BYTES_TO_WORDS_8(00, 00, 00, 00, 00, 00, 00, 10)
+};
+
+/* ---- Scalars modulo L, on the vli layer ---- */
+
+static void sc_load(uECC_word_t *w, const uint_least8_t *s, int num_bytes)
+{
+	int i;
+
+	uECC_vli_clear(w, num_bytes / uECC_WORD_SIZE);
+	for (i = 0; i < num_bytes; ++i) {
+		w[i / uECC_WORD_SIZE] |=
+			(uECC_word_t)s[i] << (8 * (i % uECC_WORD_SIZE));
+	}
+}
+
+static void sc_store(uint_least8_t *s, const uECC_word_t *w)
+{
+	int i;
+
+	for (i = 0; i < uECC_ED25519_KEY_SIZE; ++i) {
+		s[i] = (uint_least8_t)(w[i / uECC_WORD_SIZE] >>
+				       (8 * (i % uECC_WORD_SIZE)));
+	}
+}
+
+/* result = SHA-512 digest, read little-endian, mod L */
+static void sc_reduce(uECC_word_t *result, const uint_least8_t *digest)
+{
+	uECC_word_t wide[2 * NUM_ECC_WORDS];
+
+	sc_load(wide, digest, 2 * uECC_ED25519_KEY_SIZE);
+	uECC_vli_mmod(result, wide, ed25519_L, NUM_ECC_WORDS);
+}
+
+/* ---- Group operations ---- */
+
+static void ge_p3_0(ge_p3 *h)
+{
+	memset(h->X, 0, sizeof(fe));
+	fe_one(h->Y);
+	fe_one(h->Z);
+	memset(h->T, 0, sizeof(fe));
+}
+
+/* x = X/Z and y = Y/T to extended coordinates (r->T is left stale). */
+static void ge_p1p1_to_p2(ge_p3 *r, const ge_p1p1 *p)
+{
+	fe_mul(r->X, p->X, p->T);
+	fe_mul(r->Y, p->Y, p->Z);
+	fe_mul(r->Z, p->Z, p->T);
+}
+
+static void ge_p1p1_to_p3(ge_p3 *r, const ge_p1p1 *p)
+{
+	fe_mul(r->X, p->X, p->T);
+	fe_mul(r->Y, p->Y, p->Z);
+	fe_mul(r->Z, p->Z, p->T);
+	fe_mul(r->T, p->X, p->Y);
+}
+
+static void ge_p3_to_cached(ge_cached *r, const ge_p3 *p, const fe d2)
+{
+	fe_add(r->YplusX, p->Y, p->X);
+	fe_sub(r->YminusX, p->Y, p->X);
+	fe_copy(r->Z, p->Z);
+	fe_mul(r->T2d, p->T, d2);
+}
+
+/* r = 2p; only X, Y and Z of p are used. */
+static void ge_dbl(ge_p1p1 *r, const ge_p3 *p)
+{
+	fe t0;
+
+	fe_sq(r->X, p->X);
+	fe_sq(r->Z, p->Y);
+	fe_sq(r->T, p->Z);
+	fe_add(r->T, r->T, r->T);
+	fe_add(r->Y, p->X, p->Y);
+	fe_sq(t0, r->Y);
+	fe_add(r->Y, r->Z, r->X);
+	fe_sub(r->Z, r->Z, r->X);
+	fe_sub(r->X, t0, r->Y);
+	fe_sub(r->T, r->T, r->Z);
+}
+
+/* r = p + q (neg = 0) or p - q (neg = 1); variable time in neg. */
+static void ge_add(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q, int neg)
+{
+	fe t0;
+
+	fe_add(r->X, p->Y, p->X);
+	fe_sub(r->Y, p->Y, p->X);
+	fe_mul(r->Z, r->X, neg ? q->YminusX : q->YplusX);
+	fe_mul(r->Y, r->Y, neg ? q->YplusX : q->YminusX);
+	fe_mul(r->T, q->T2d, p->T);
+	fe_mul(r->X, p->Z, q->Z);
+	fe_add(t0, r->X, r->X);
+	fe_sub(r->X, r->Z, r->Y);
+	fe_add(r->Y, r->Z, r->Y);
+	if (neg) {
+		fe_sub(r->Z, t0, r->T);
+		fe_add(r->T, t0, r->T);
+	} else {
+		fe_add(r->Z, t0, r->T);
+		fe_sub(r->T, t0, r->T);
+	}
+}
+
+/* Same as ge_add, for an affine q. */
+static void ge_madd(ge_p1p1 *r, const ge_p3 *p, const ge_precomp *q, int neg)
+{
+	fe t0;
+
+	fe_add(r->X, p->Y, p->X);
+	fe_sub(r->Y, p->Y, p->X);
+	fe_mul(r->Z, r->X, neg ? q->yminusx : q->yplusx);
+	fe_mul(r->Y, r->Y, neg ? q->yplusx : q->yminusx);
+	fe_mul(r->T, q->xy2d, p->T);
+	fe_add(t0, p->Z, p->Z);
+	fe_sub(r->X, r->Z, r->Y);
+	fe_add(r->Y, r->Z, r->Y);
+	if (neg) {
+		fe_sub(r->Z, t0, r->T);
+		fe_add(r->T, t0, r->T);
+	} else {
+		fe_add(r->Z, t0, r->T);
+		fe_sub(r->T, t0, r->T);
+	}
+}
+
+static void ge_tobytes(uint_least8_t *s, const ge_p3 *h)
+{
+	fe recip, x, y;
+
+	fe_invert(recip, h->Z);
+	fe_mul(x, h->X, recip);
+	fe_mul(y, h->Y, recip);
+	fe_tobytes(s, y);
+	s[31] ^= (uint_least8_t)(fe_isnegative(x) << 7);
+}
+
+/*
+ * Decodes a point (RFC 8032, section 5.1.3) to Z = 1, negated if neg is
+ * set. Fails for y >= p, for x = 0 with the sign bit set, and when no x
+ * exists.
+ */
+static int ge_frombytes(ge_p3 *h, const uint_least8_t *s, int neg)
+{
+	uint_least8_t check[32];
+	fe u, v, v3, vxx, t;
+
+	fe_frombytes(h->Y, s);
+	fe_tobytes(check, h->Y);
+	check[31] |= s[31] & 0x80;
+	if (memcmp(check, s, sizeof(check)) != 0) {
+		return 0;
+	}
+	fe_one(h->Z);
+
+	/* x = u v^3 (u v^7)^((p - 5) / 8), with u = y^2 - 1, v = d y^2 + 1 */
+	fe_sq(u, h->Y);
+	fe_frombytes(t, ed25519_d);
+	fe_mul(v, u, t);
+	fe_sub(u, u, h->Z);
+	fe_add(v, v, h->Z);
+
+	fe_sq(v3, v);
+	fe_mul(v3, v3, v);
+	fe_sq(h->X, v3);
+	fe_mul(h->X, h->X, v);
+	fe_mul(h->X, h->X, u);
+	fe_pow22523(h->X, h->X);
+	fe_mul(h->X, h->X, v3);
+	fe_mul(h->X, h->X, u);
+
+	fe_sq(vxx, h->X);
+	fe_mul(vxx, vxx, v);
+	fe_sub(t, vxx, u);
+	if (!fe_iszero(t)) {
+		fe_add(t, vxx, u);
+		if (!fe_iszero(t)) {
+			return 0;
+		}
+		fe_frombytes(t, ed25519_sqrtm1);
+		fe_mul(h->X, h->X, t);
+	}
+
+	if (fe_iszero(h->X) && (s[31] >> 7)) {
+		return 0;
+	}
+	if (fe_isnegative(h->X) != ((s[31] >> 7) ^ neg)) {
+		fe_neg(h->X, h->X);
+	}
+	fe_mul(h->T, h->X, h->Y);
+	return 1;
+}
+
+static void ge_base(ge_p3 *h)
+{
+	fe_frombytes(h->X, ed25519_base_x);
+	fe_frombytes(h->Y, ed25519_base_y);
+	fe_one(h->Z);
+	fe_mul(h->T, h->X, h->Y);
+}
+
+/* Affine p (Z = 1) as a precomputed addend. */
+static void ge_p3_to_precomp(ge_precomp *r, const ge_p3 *p, const fe d2)
+{
+	fe_add(r->yplusx, p->Y, p->X);
+	fe_sub(r->yminusx, p->Y, p->X);
+	fe_mul(r->xy2d, p->T, d2);
+}
+
+/* Identity check of [8]p, which ignores the small-order component. */
+static int ge_is_small_order(const ge_p3 *p)
+{
+	ge_p1p1 r;
+	ge_p3 q;
+	fe t;
+
+	ge_dbl(&r, p);
+	ge_p1p1_to_p2(&q, &r);
+	ge_dbl(&r, &q);
+	ge_p1p1_to_p2(&q, &r);
+	ge_dbl(&r, &q);
+	ge_p1p1_to_p2(&q, &r);
+
+	fe_sub(t, q.Y, q.Z);
+	return fe_iszero(q.X) && fe_iszero(t);
+}
+
+/* ---- Constant-time multiplication by B (signing) ---- */
+
+static uint64_t ct_equal(uint_least8_t b, uint_least8_t c)
+{
+	uint32_t x = (uint32_t)(b ^ c);
+
+	return (uint64_t)((x - 1) >> 31);
+}
+
+/* t = b * B from table[j] = (j + 1) B, for -8 <= b <= 8. */
+static void ge_select(ge_cached *t, const ge_cached table[8], int b)
+{
+	uint64_t negative = (uint64_t)((unsigned int)b >> (8 * sizeof(int) - 1));
+	/* |b|, computed unsigned: shifting a negative int is undefined */
+	uint_least8_t babs = (uint_least8_t)((unsigned int)b -
+		((((unsigned int)-(int)negative) & (unsigned int)b) << 1));
+	fe minus_t2d;
+	int j;
+
+	fe_one(t->YplusX);
+	fe_one(t->YminusX);
+	fe_one(t->Z);
+	memset(t->T2d, 0, sizeof(fe));
+	for (j = 0; j < 8; ++j) {
+		uint64_t eq = ct_equal(babs, (uint_least8_t)(j + 1));
+
+		fe_cmov(t->YplusX, table[j].YplusX, eq);
+		fe_cmov(t->YminusX, table[j].YminusX, eq);
+		fe_cmov(t->Z, table[j].Z, eq);
+		fe_cmov(t->T2d, table[j].T2d, eq);
+	}
+	fe_cswap(t->YplusX, t->YminusX, negative);
+	fe_neg(minus_t2d, t->T2d);
+	fe_cmov(t->T2d, minus_t2d, negative);
+}
+
+/*
+ * h = a * B for a 32-byte little-endian a below 2^255: signed 4-bit windows,
+ * 252 doublings and 64 additions of constant-time table entries.
+ */
+static void ge_scalarmult_base(ge_p3 *h, const uint_least8_t *a)
+{
+	ge_cached table[8];
+	ge_cached t;
+	ge_p1p1 r;
+	ge_p3 p;
+	fe d2;
+	signed char e[64];
+	int carry = 0;
+	int i;
+
+	for (i = 0; i < 32; ++i) {
+		e[2 * i] = a[i] & 15;
+		e[2 * i + 1] = (a[i] >> 4) & 15;
+	}
+	for (i = 0; i < 63; ++i) {
+		e[i] += carry;
+		carry = (e[i] + 8) >> 4;
+		e[i] -= carry << 4;
+	}
+	e[63] += carry;
+
+	fe_frombytes(d2, ed25519_d2);
+	ge_base(&p);
+	ge_p3_to_cached(&table[0], &p, d2);
+	for (i = 1; i < 8; ++i) {
+		ge_add(&r, &p, &table[0], 0);
+		ge_p1p1_to_p3(&p, &r);
+		ge_p3_to_cached(&table[i], &p, d2);
+	}
+
+	ge_p3_0(h);
+	for (i = 63; i >= 0; --i) {
+		if (i != 63) {
+			ge_dbl(&r, h);
+			ge_p1p1_to_p2(h, &r);
+			ge_dbl(&r, h);
+			ge_p1p1_to_p2(h, &r);
+			ge_dbl(&r, h);
+			ge_p1p1_to_p2(h, &r);
+			ge_dbl(&r, h);
+			ge_p1p1_to_p3(h, &r);
+		}
+		ge_select(&t, table, e[i]);
+		ge_add(&r, h, &t, 0);
+		ge_p1p1_to_p3(h, &r);
+	}
+
+	_set_secure(e, 0, sizeof(e));
+	_set_secure(&t, 0, sizeof(t));
+}
+
+/* ---- Variable-time multi-scalar multiplications (verification) ---- */
+
+/*
+ * Width-5 NAF of a 32-byte little-endian scalar below 2^255: r[i] is odd and
+ * in [-15, 15], or zero.
+ */
+static void slide(signed char *r, const uint_least8_t *a)
+{
+	int i, b, k;
+
+	for (i = 0; i < 256; ++i) {
+		r[i] = 1 & (a[i >> 3] >> (i & 7));
+	}
+
+	for (i = 0; i < 256; ++i) {
+		if (!r[i]) {
+			continue;
+		}
+		for (b = 1; b <= 6 && i + b < 256; ++b) {
+			if (!r[i + b]) {
+				continue;
+			}
+			if (r[i] + (r[i + b] << b) <= 15) {
+				r[i] += r[i + b] << b;
+				r[i + b] = 0;
+			} else if (r[i] - (r[i + b] << b) >= -15) {
+				r[i] -= r[i + b] << b;
+				for (k = i + b; k < 256; ++k) {
+					if (!r[k]) {
+						r[k] = 1;
+						break;
+					}
+					r[k] = 0;
+				}
+			} else {
+				break;
+			}
+		}
+	}
+}
+
+/* table[j] = (2j + 1) p */
+static void ge_odd_multiples(ge_cached table[8], const ge_p3 *p, const fe d2)
+{
+	ge_p1p1 r;
+	ge_p3 p2, q;
+	ge_cached c2;
+	int j;
+
+	ge_p3_to_cached(&table[0], p, d2);
+	ge_dbl(&r, p);
+	ge_p1p1_to_p3(&p2, &r);
+	ge_p3_to_cached(&c2, &p2, d2);
+	q = *p;
+	for (j = 1; j < 8; ++j) {
+		ge_add(&r, &q, &c2, 0);
+		ge_p1p1_to_p3(&q, &r);
+		ge_p3_to_cached(&table[j], &q, d2);
+	}
+}
+
+/* h = a A + b B, Straus' method with width-5 NAFs. */
+static void ge_double_scalarmult_vartime(ge_p3 *h, const uint_least8_t *a,
+					 const ge_p3 *A, const uint_least8_t *b)
+{
+	signed char aslide[256];
+	signed char bslide[256];
+	ge_cached Ai[8];
+	ge_cached Bi[8];
+	ge_p1p1 r;
+	ge_p3 B;
+	fe d2;
+	int i;
+
+	slide(aslide, a);
+	slide(bslide, b);
+
+	fe_frombytes(d2, ed25519_d2);
+	ge_base(&B);
+	ge_odd_multiples(Ai, A, d2);
+	ge_odd_multiples(Bi, &B, d2);
+
+	ge_p3_0(h);
+	for (i = 255; i >= 0 && !aslide[i] && !bslide[i]; --i) {
+	}
+
+	for (; i >= 0; --i) {
+		ge_dbl(&r, h);
+		if (aslide[i]) {
+			ge_p1p1_to_p3(h, &r);
+			ge_add(&r, h, &Ai[(aslide[i] < 0 ? -aslide[i] : aslide[i]) / 2],
+			       aslide[i] < 0);
+		}
+		if (bslide[i]) {
+			ge_p1p1_to_p3(h, &r);
+			ge_add(&r, h, &Bi[(bslide[i] < 0 ? -bslide[i] : bslide[i]) / 2],
+			       bslide[i] < 0);
+		}
+		if (i == 0) {
+			ge_p1p1_to_p3(h, &r);
+		} else {
+			ge_p1p1_to_p2(h, &r);
+		}
+	}
+}
+
+#define MSM_MAX_POINTS (2 * uECC_ED25519_BATCH_SIZE + 1)
+#define MSM_MAX_WINDOWS (253 / 4 + 2)
+#define MSM_MAX_WINDOW 6
+#define MSM_MAX_BUCKETS (1 << (MSM_MAX_WINDOW - 1))
+
+/* Window width of the bucket method for num_points points. */
+static int msm_window(unsigned int num_points)
+{
+	int best = 4;
+	unsigned long best_cost = ~0ul;
+	int c;
+
+	/* windows * (one affine addition per point + two per bucket) */
+	for (c = 4; c <= MSM_MAX_WINDOW; ++c) {
+		unsigned long cost = (unsigned long)(253 / c + 2) *
+				     (7 * num_points + (20ul << (c - 1)));
+		if (cost < best_cost) {
+			best_cost = cost;
+			best = c;
+		}
+	}
+	return best;
+}
+
+/* Signed digits of a 32-byte little-endian scalar below 2^253, in base 2^c. */
+static void msm_digits(signed char *digits, int num_windows,
+		       const uint_least8_t *s, int c)
+{
+	int carry = 0;
+	int w;
+
+	for (w = 0; w < num_windows; ++w) {
+		int bit = w * c;
+		int byte = bit >> 3;
+		unsigned int v = 0;
+
+		if (byte < 32) {
+			v = s[byte];
+		}
+		if (byte + 1 < 32) {
+			v |= (unsigned int)s[byte + 1] << 8;
+		}
+		v = ((v >> (bit & 7)) & ((1u << c) - 1)) + carry;
+		carry = (int)((v + (1u << (c - 1))) >> c);
+		digits[w] = (signed char)((int)v - (carry << c));
+	}
+}
+
+/*
+ * h = sum of scalars[i] points[i] with Pippenger's bucket method: per window
+ * of c bits, every point is added to the bucket of its signed digit, and the
+ * buckets are summed with weights 1 .. 2^(c-1) by running sums.
+ */
+static void ge_multi_scalarmult_vartime(ge_p3 *h, const ge_precomp *points,
+					uint_least8_t (*scalars)[32],
+					unsigned int num_points)
+{
+	signed char digits[MSM_MAX_POINTS][MSM_MAX_WINDOWS];
+	ge_p3 buckets[MSM_MAX_BUCKETS];
+	unsigned char used[MSM_MAX_BUCKETS];
+	ge_p3 running, sum;
+	ge_cached cached;
+	ge_p1p1 r;
+	fe d2;
+	int c = msm_window(num_points);
+	int num_windows = 253 / c + 2;
+	int num_buckets = 1 << (c - 1);
+	int w, j, k;
+	unsigned int i;
+
+	fe_frombytes(d2, ed25519_d2);
+	for (i = 0; i < num_points; ++i) {
+		msm_digits(digits[i], num_windows, scalars[i], c);
+	}
+
+	ge_p3_0(h);
+	for (w = num_windows - 1; w >= 0; --w) {
+		int started = 0;
+
+		for (j = 0; j < c && w != num_windows - 1; ++j) {
+			ge_dbl(&r, h);
+			if (j == c - 1) {
+				ge_p1p1_to_p3(h, &r);
+			} else {
+				ge_p1p1_to_p2(h, &r);
+			}
+		}
+
+		memset(used, 0, (size_t)num_buckets);
+		for (i = 0; i < num_points; ++i) {
+			int d = digits[i][w];
+
+			if (d == 0) {
+				continue;
+			}
+			k = (d < 0 ? -d : d) - 1;
+			if (!used[k]) {
+				ge_p3_0(&buckets[k]);
+				used[k] = 1;
+			}
+			ge_madd(&r, &buckets[k], &points[i], d < 0);
+			ge_p1p1_to_p3(&buckets[k], &r);
+		}
+
+		/* sum = sum of (k + 1) buckets[k] */
+		for (k = num_buckets - 1; k >= 0; --k) {
+			if (used[k]) {
+				if (!started) {
+					running = buckets[k];
+					sum = buckets[k];
+					started = 1;
+					continue;
+				}
+				ge_p3_to_cached(&cached, &buckets[k], d2);
+				ge_add(&r, &running, &cached, 0);
+				ge_p1p1_to_p3(&running, &r);
+			}
+			if (started) {
+				ge_p3_to_cached(&cached, &running, d2);
+				ge_add(&r, &sum, &cached, 0);
+				ge_p1p1_to_p3(&sum, &r);
+			}
+		}
+		if (started) {
+			ge_p3_to_cached(&cached, &sum, d2);
+			ge_add(&r, h, &cached, 0);
+			ge_p1p1_to_p3(h, &r);
+		}
+	}
+}
+
+/* ---- Signatures ---- */
+
+static void hash_ram(uECC_word_t *k, const uint_least8_t *R,
+		     const uint_least8_t *A, const uint_least8_t *message,
+		     size_t message_size)
+{
+	struct tc_sha512_state_struct s;
+	uint_least8_t digest[TC_SHA512_DIGEST_SIZE];
+
+	(void)tc_sha512_init(&s);
+	(void)tc_sha512_update(&s, R, uECC_ED25519_KEY_SIZE);
+	(void)tc_sha512_update(&s, A, uECC_ED25519_KEY_SIZE);
+	if (message_size > 0) {
+		(void)tc_sha512_update(&s, message, message_size);
+	}
+	(void)tc_sha512_final(digest, &s);
+	sc_reduce(k, digest);
+}
+
+/* Expands a private key: clamped scalar in h[0..31], prefix in h[32..63]. */
+static void expand_key(uint_least8_t *h, const uint_least8_t *private_key)
+{
+	struct tc_sha512_state_struct s;
+
+	(void)tc_sha512_init(&s);
+	(void)tc_sha512_update(&s, private_key, uECC_ED25519_KEY_SIZE);
+	(void)tc_sha512_final(h, &s);
+	_set_secure(&s, 0, sizeof(s));
+	h[0] &= 248;
+	h[31] &= 127;
+	h[31] |= 64;
+}
+
+int uECC_ed25519_public_key(uint_least8_t *public_key,
+			    const uint_least8_t *private_key)
+{
+	uint_least8_t h[TC_SHA512_DIGEST_SIZE];
+	ge_p3 A;
+
+	if (public_key == (uint_least8_t *) 0 ||
+	    private_key == (const uint_least8_t *) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	expand_key(h, private_key);
+	ge_scalarmult_base(&A, h);
+	ge_tobytes(public_key, &A);
+
+	_set_secure(h, 0, sizeof(h));
+	return TC_CRYPTO_SUCCESS;
+}
+
+int uECC_ed25519_make_key_ctx(const uECC_Ctx *ctx, uint_least8_t *public_key,
+			      uint_least8_t *private_key)
+{
+	if (public_key == (uint_least8_t *) 0 ||
+	    private_key == (uint_least8_t *) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	if (!uECC_ctx_random(ctx, private_key, uECC_ED25519_KEY_SIZE)) {
+		return TC_CRYPTO_FAIL;
+	}
+	return uECC_ed25519_public_key(public_key, private_key);
+}
+
+int uECC_ed25519_make_key(uint_least8_t *public_key, uint_least8_t *private_key)
+{
+	return uECC_ed25519_make_key_ctx(0, public_key, private_key);
+}
+
+int uECC_ed25519_expand_key(uint_least8_t *expanded,
+			    const uint_least8_t *private_key)
+{
+	ge_p3 A;
+
+	if (expanded == (uint_least8_t *) 0 ||
+	    private_key == (const uint_least8_t *) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	/* a || prefix, then A = a B */
+	expand_key(expanded, private_key);
+	ge_scalarmult_base(&A, expanded);
+	ge_tobytes(expanded + TC_SHA512_DIGEST_SIZE, &A);
+	return TC_CRYPTO_SUCCESS;
+}
+
+int uECC_ed25519_sign_expanded(const uint_least8_t *expanded,
+			       const uint_least8_t *message,
+			       size_t message_size, uint_least8_t *signature)
+{
+	struct tc_sha512_state_struct s;
+	uint_least8_t digest[TC_SHA512_DIGEST_SIZE];
+	uECC_word_t a[NUM_ECC_WORDS];
+	uECC_word_t r[NUM_ECC_WORDS];
+	uECC_word_t k[NUM_ECC_WORDS];
+	ge_p3 P;
+
+	if (expanded == (const uint_least8_t *) 0 ||
+	    (message == (const uint_least8_t *) 0 && message_size > 0) ||
+	    signature == (uint_least8_t *) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	/* r = SHA-512(prefix || M) mod L, R = r B */
+	(void)tc_sha512_init(&s);
+	(void)tc_sha512_update(&s, expanded + 32, 32);
+	if (message_size > 0) {
+		(void)tc_sha512_update(&s, message, message_size);
+	}
+	(void)tc_sha512_final(digest, &s);
+	sc_reduce(r, digest);
+	sc_store(digest, r);
+	ge_scalarmult_base(&P, digest);
+	ge_tobytes(signature, &P);
+
+	/* S = (r + k a) mod L, k = SHA-512(R || A || M) mod L */
+	hash_ram(k, signature, expanded + TC_SHA512_DIGEST_SIZE, message,
+		 message_size);
+	sc_load(a, expanded, uECC_ED25519_KEY_SIZE);
+	uECC_vli_modMult(k, k, a, ed25519_L, NUM_ECC_WORDS);
+	uECC_vli_modAdd(k, k, r, ed25519_L, NUM_ECC_WORDS);
+	sc_store(signature + 32, k);
+
+	_set_secure(&s, 0, sizeof(s));
+	_set_secure(digest, 0, sizeof(digest));
+	_set_secure(a, 0, sizeof(a));
+	_set_secure(r, 0, sizeof(r));
+	_set_secure(k, 0, sizeof(k));
+	_set_secure(&P, 0, sizeof(P));
+	return TC_CRYPTO_SUCCESS;
+}
+
+int uECC_ed25519_sign(const uint_least8_t *private_key,
+		      const uint_least8_t *message, size_t message_size,
+		      uint_least8_t *signature)
+{
+	uint_least8_t expanded[uECC_ED25519_EXPANDED_KEY_SIZE];
+	int result;
+
+	if (private_key == (const uint_least8_t *) 0 ||
+	    (message == (const uint_least8_t *) 0 && message_size > 0) ||
+	    signature == (uint_least8_t *) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	(void)uECC_ed25519_expand_key(expanded, private_key);
+	result = uECC_ed25519_sign_expanded(expanded, message, message_size,
+					    signature);
+	_set_secure(expanded, 0, sizeof(expanded));
+	return result;
+}
+
+/* Checks S < L and decodes -A and -R; k = SHA-512(R || A || M) mod L. */
+static int parse_signature(ge_p3 *minus_A, ge_p3 *minus_R, uECC_word_t *k,
+			   const uint_least8_t *public_key,
+			   const uint_least8_t *message, size_t message_size,
+			   const uint_least8_t *signature)
+{
+	uECC_word_t S[NUM_ECC_WORDS];
+
+	sc_load(S, signature + 32, uECC_ED25519_KEY_SIZE);
+	if (uECC_vli_cmp_unsafe(ed25519_L, S, NUM_ECC_WORDS) != 1) {
+		return 0;
+	}
+	if (!ge_frombytes(minus_A, public_key, 1) ||
+	    !ge_frombytes(minus_R, signature, 1)) {
+		return 0;
+	}
+	hash_ram(k, signature, public_key, message, message_size);
+	return 1;
+}
+
+int uECC_ed25519_verify(const uint_least8_t *public_key,
+			const uint_least8_t *message, size_t message_size,
+			const uint_least8_t *signature)
+{
+	uint_least8_t k_bytes[uECC_ED25519_KEY_SIZE];
+	uECC_word_t k[NUM_ECC_WORDS];
+	ge_p3 minus_A, minus_R, P;
+	ge_cached Rc;
+	ge_p1p1 r;
+	fe d2;
+
+	if (public_key == (const uint_least8_t *) 0 ||
+	    (message == (const uint_least8_t *) 0 && message_size > 0) ||
+	    signature == (const uint_least8_t *) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	if (!parse_signature(&minus_A, &minus_R, k, public_key, message,
+			     message_size, signature)) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	/* [8]([S]B - [k]A - R) = 0 */
+	sc_store(k_bytes, k);
+	ge_double_scalarmult_vartime(&P, k_bytes, &minus_A, signature + 32);
+	fe_frombytes(d2, ed25519_d2);
+	ge_p3_to_cached(&Rc, &minus_R, d2);
+	ge_add(&r, &P, &Rc, 0);
+	ge_p1p1_to_p3(&P, &r);
+
+	return ge_is_small_order(&P) ? TC_CRYPTO_SUCCESS : TC_CRYPTO_FAIL;
+}
+
+/*
+ * Checks n <= uECC_ED25519_BATCH_SIZE signatures with one multi-scalar
+ * multiplication:
+ *   [8]([sum z_i S_i] B - sum [z_i k_i] A_i - sum [z_i] R_i) = 0
+ * The products are Montgomery products, which scales every scalar by the
+ * same 1 / R mod L and leaves the check unchanged.
+ */
+static int verify_batch(const uint_least8_t * const *public_keys,
+			const uint_least8_t * const *messages,
+			const size_t *message_sizes,
+			const uint_least8_t * const *signatures,
+			unsigned int n, int *results)
+{
+	ge_precomp points[MSM_MAX_POINTS];
+	uint_least8_t scalars[MSM_MAX_POINTS][32];
+	struct tc_sha512_state_struct s;
+	uint_least8_t seed[TC_SHA512_DIGEST_SIZE];
+	uint_least8_t z_bytes[TC_SHA512_DIGEST_SIZE];
+	uECC_word_t k[NUM_ECC_WORDS];
+	uECC_word_t z[NUM_ECC_WORDS];
+	uECC_word_t t[NUM_ECC_WORDS];
+	uECC_word_t sum[NUM_ECC_WORDS];
+	uECC_word_t one[NUM_ECC_WORDS];
+	uECC_word_t L_inv;
+	unsigned int num_points = 1;
+	unsigned int i, num_valid = 0;
+	uint32_t counter = 0;
+	ge_p3 minus_A, minus_R, P;
+	fe d2;
+	int all_valid = 1;
+
+	fe_frombytes(d2, ed25519_d2);
+	uECC_vli_clear(sum, NUM_ECC_WORDS);
+
+	/* the coefficients depend on every public key, signature and hash: */
+	(void)tc_sha512_init(&s);
+	for (i = 0; i < n; ++i) {
+		results[i] = parse_signature(&minus_A, &minus_R, k, public_keys[i],
+					     messages[i], message_sizes[i],
+					     signatures[i]);
+		if (!results[i]) {
+			all_valid = 0;
+			continue;
+		}
+		ge_p3_to_precomp(&points[num_points], &minus_A, d2);
+		sc_store(scalars[num_points], k);
+		ge_p3_to_precomp(&points[num_points + 1], &minus_R, d2);
+		num_points += 2;
+
+		(void)tc_sha512_update(&s, public_keys[i], uECC_ED25519_KEY_SIZE);
+		(void)tc_sha512_update(&s, signatures[i],
+				       uECC_ED25519_SIGNATURE_SIZE);
+		(void)tc_sha512_update(&s, scalars[num_points - 2], 32);
+		num_valid++;
+	}
+	(void)tc_sha512_final(seed, &s);
+	if (num_valid == 0) {
+		return all_valid;
+	}
+
+	L_inv = uECC_vli_montInit(t, ed25519_L, NUM_ECC_WORDS);
+	uECC_vli_clear(one, NUM_ECC_WORDS);
+	one[0] = 1;
+	num_valid = 0;
+	for (i = 0; i < n; ++i) {
+		if (!results[i]) {
+			continue;
+		}
+		/* four 128-bit coefficients per hash of the seed: */
+		if ((num_valid & 3) == 0) {
+			uint_least8_t block[4];
+
+			block[0] = (uint_least8_t)counter;
+			block[1] = (uint_least8_t)(counter >> 8);
+			block[2] = (uint_least8_t)(counter >> 16);
+			block[3] = (uint_least8_t)(counter >> 24);
+			counter++;
+			(void)tc_sha512_init(&s);
+			(void)tc_sha512_update(&s, seed, sizeof(seed));
+			(void)tc_sha512_update(&s, block, sizeof(block));
+			(void)tc_sha512_final(z_bytes, &s);
+		}
+		sc_load(z, z_bytes + 16 * (num_valid & 3), 16);
+		uECC_vli_clear(z + 16 / uECC_WORD_SIZE,
+			       NUM_ECC_WORDS - 16 / uECC_WORD_SIZE);
+
+		/* z k for -A, z for -R; sum of z S for B */
+		sc_load(k, scalars[1 + 2 * num_valid], 32);
+		uECC_vli_montMult(k, k, z, ed25519_L, L_inv, NUM_ECC_WORDS);
+		sc_store(scalars[1 + 2 * num_valid], k);
+		uECC_vli_montMult(t, z, one, ed25519_L, L_inv, NUM_ECC_WORDS);
+		sc_store(scalars[2 + 2 * num_valid], t);
+		sc_load(t, signatures[i] + 32, 32);
+		uECC_vli_montMult(t, t, z, ed25519_L, L_inv, NUM_ECC_WORDS);
+		uECC_vli_modAdd(sum, sum, t, ed25519_L, NUM_ECC_WORDS);
+		num_valid++;
+	}
+	ge_base(&P);
+	ge_p3_to_precomp(&points[0], &P, d2);
+	sc_store(scalars[0], sum);
+
+	ge_multi_scalarmult_vartime(&P, points, scalars, num_points);
+	if (ge_is_small_order(&P)) {
+		return all_valid;
+	}
+
+	/* some signature is invalid: find out which */
+	for (i = 0; i < n; ++i) {
+		if (results[i]) {
+			results[i] = uECC_ed25519_verify(public_keys[i],
+							 messages[i],
+							 message_sizes[i],
+							 signatures[i]);
+		}
+	}
+	return TC_CRYPTO_FAIL;
+}
+
+int uECC_ed25519_verify_batch(const uint_least8_t * const *public_keys,
+			      const uint_least8_t * const *messages,
+			      const size_t *message_sizes,
+			      const uint_least8_t * const *signatures,
+			      unsigned int count, int *results)
+{
+	unsigned int i, n;
+	int all_valid = 1;
+
+	if (public_keys == (const uint_least8_t * const *) 0 ||
+	    messages == (const uint_least8_t * const *) 0 ||
+	    message_sizes == (const size_t *) 0 ||
+	    signatures == (const uint_least8_t * const *) 0 ||
+	    results == (int *) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+	for (i = 0; i < count; ++i) {
+		if (public_keys[i] == (const uint_least8_t *) 0 ||
+		    (messages[i] == (const uint_least8_t *) 0 &&
+		     message_sizes[i] > 0) ||
+		    signatures[i] == (const uint_least8_t *) 0) {
+			return TC_CRYPTO_FAIL;
+		}
+	}
+
+	for (i = 0; i < count; i += n) {
+		n = count - i;
+		if (n > uECC_ED25519_BATCH_SIZE) {
+			n = uECC_ED25519_BATCH_SIZE;
+		}
+		if (!verify_batch(public_keys + i, messages + i,
+				  message_sizes + i, signatures + i, n,
+				  results + i)) {
+			all_valid = 0;
+		}
+	}
+	return all_valid ? TC_CRYPTO_SUCCESS : TC_CRYPTO_FAIL;
+}
@@ -0,0 +1,489 @@
+/* ecc_fe25519.h - TinyCrypt arithmetic modulo 2^255 - 19 */
+
+/*
+ *  Copyright (C) 2017 by Intel Corporation, All Rights Reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *    - Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *    - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ *    - Neither the name of Intel Corporation nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Field arithmetic shared by X25519 (ecc_x25519.c) and Ed25519
+ * (ecc_ed25519.c). Everything here is static inline so that each module
+ * gets its own copy, inlined into its ladder or point formulas.
+ */
+
+#ifndef __TC_ECC_FE25519_H__
+#define __TC_ECC_FE25519_H__
+
+#include <tinycrypt/ecc.h>
+#include <tinycrypt/ecc_x25519.h>
+#include <string.h>
+
+/*
+ * Arithmetic modulo p = 2^255 - 19. Each representation provides fe_frombytes
+ * and fe_tobytes (little-endian, the latter fully reduced), fe_one, fe_add,
+ * fe_sub, fe_mul, fe_sq, fe_mul_a24 (multiplication by (486662 - 2) / 4) and
+ * a constant-time fe_cswap.
+ */
+#if uECC_X25519_RADIX51
+
+/* 2^255 - 19 in five 51-bit limbs: f[0] + f[1] 2^51 + ... + f[4] 2^204 */
+typedef uint64_t fe[5];
+
+#define FE_MASK51 (((uint64_t)1 << 51) - 1)
+
+static inline uint64_t load64(const uint_least8_t *s)
+{
+	uint64_t r = 0;
+	int i;
+
+	for (i = 7; i >= 0; --i) {
+		r = (r << 8) | s[i];
+	}
+	return r;
+}
+
+static inline void store64(uint_least8_t *s, uint64_t v)
+{
+	int i;
+
+	for (i = 0; i < 8; ++i) {
+		s[i] = (uint_least8_t)(v >> (8 * i));
+	}
+}
+
+static inline void fe_frombytes(fe h, const uint_least8_t *s)
+{
+	h[0] = load64(s) & FE_MASK51;
+	h[1] = (load64(s + 6) >> 3) & FE_MASK51;
+	h[2] = (load64(s + 12) >> 6) & FE_MASK51;
+	h[3] = (load64(s + 19) >> 1) & FE_MASK51;
+	h[4] = (load64(s + 24) >> 12) & FE_MASK51;
+}
+
+static inline void fe_tobytes(uint_least8_t *s, const fe f)
+{
+	uint64_t h[5];
+	uint64_t q;
+	int i;
+
+	/* limbs below 2^51, then h + 19 >= 2^255 tells whether h >= p: */
+	memcpy(h, f, sizeof(h));
+	for (i = 0; i < 2; ++i) {
+		h[1] += h[0] >> 51; h[0] &= FE_MASK51;
+		h[2] += h[1] >> 51; h[1] &= FE_MASK51;
+		h[3] += h[2] >> 51; h[2] &= FE_MASK51;
+		h[4] += h[3] >> 51; h[3] &= FE_MASK51;
+		h[0] += 19 * (h[4] >> 51); h[4] &= FE_MASK51;
+	}
+	q = (h[0] + 19) >> 51;
+	q = (h[1] + q) >> 51;
+	q = (h[2] + q) >> 51;
+	q = (h[3] + q) >> 51;
+	q = (h[4] + q) >> 51;
+
+	h[0] += 19 * q;
+	h[1] += h[0] >> 51; h[0] &= FE_MASK51;
+	h[2] += h[1] >> 51; h[1] &= FE_MASK51;
+	h[3] += h[2] >> 51; h[2] &= FE_MASK51;
+	h[4] += h[3] >> 51; h[3] &= FE_MASK51;
+	h[4] &= FE_MASK51;
+
+	store64(s, h[0] | (h[1] << 51));
+	store64(s + 8, (h[1] >> 13) | (h[2] << 38));
+	store64(s + 16, (h[2] >> 26) | (h[3] << 25));
+	store64(s + 24, (h[3] >> 39) | (h[4] << 12));
+}
+
+static inline void fe_one(fe h)
+{
+	h[0] = 1;
+	h[1] = h[2] = h[3] = h[4] = 0;
+}
+
+/* Limbs are left unreduced: sums feed multiplications and subtractions. */
+static inline void fe_add(fe h, const fe f, const fe g)
+{
+	h[0] = f[0] + g[0];
+	h[1] = f[1] + g[1];
+	h[2] = f[2] + g[2];
+	h[3] = f[3] + g[3];
+	h[4] = f[4] + g[4];
+}
+
+/* Carries the limbs of h back below 2^51 (plus a small excess in h[1]). */
+static inline void fe_reduce(fe h)
+{
+	uint64_t c;
+
+	c = h[0] >> 51; h[0] &= FE_MASK51; h[1] += c;
+	c = h[1] >> 51; h[1] &= FE_MASK51; h[2] += c;
+	c = h[2] >> 51; h[2] &= FE_MASK51; h[3] += c;
+	c = h[3] >> 51; h[3] &= FE_MASK51; h[4] += c;
+	c = h[4] >> 51; h[4] &= FE_MASK51; h[0] += 19 * c;
+	c = h[0] >> 51; h[0] &= FE_MASK51; h[1] += c;
+}
+
+/* f + 4p - g, reduced, for g with limbs below 2^53 - 76. */
+static inline void fe_sub(fe h, const fe f, const fe g)
+{
+	h[0] = (f[0] + 0x1FFFFFFFFFFFB4ull) - g[0];
+	h[1] = (f[1] + 0x1FFFFFFFFFFFFCull) - g[1];
+	h[2] = (f[2] + 0x1FFFFFFFFFFFFCull) - g[2];
+	h[3] = (f[3] + 0x1FFFFFFFFFFFFCull) - g[3];
+	h[4] = (f[4] + 0x1FFFFFFFFFFFFCull) - g[4];
+	fe_reduce(h);
+}
+
+/* Carries 128-bit column sums back into 51-bit limbs (2^255 = 19 mod p). */
+static inline void fe_carry(fe h, unsigned __int128 t[5])
+{
+	unsigned __int128 c;
+
+	t[1] += (uint64_t)(t[0] >> 51);
+	t[2] += (uint64_t)(t[1] >> 51);
+	t[3] += (uint64_t)(t[2] >> 51);
+	t[4] += (uint64_t)(t[3] >> 51);
+	c = (t[4] >> 51) * 19 + ((uint64_t)t[0] & FE_MASK51);
+
+	h[0] = (uint64_t)c & FE_MASK51;
+	h[1] = ((uint64_t)t[1] & FE_MASK51) + (uint64_t)(c >> 51);
+	h[2] = (uint64_t)t[2] & FE_MASK51;
+	h[3] = (uint64_t)t[3] & FE_MASK51;
+	h[4] = (uint64_t)t[4] & FE_MASK51;
+}
+
+static inline void fe_mul(fe h, const fe f, const fe g)
+{
+	unsigned __int128 t[5];
+	uint64_t g1_19 = 19 * g[1];
+	uint64_t g2_19 = 19 * g[2];
+	uint64_t g3_19 = 19 * g[3];
+	uint64_t g4_19 = 19 * g[4];
+
+	t[0] = (unsigned __int128)f[0] * g[0] + (unsigned __int128)f[1] * g4_19 +
+	       (unsigned __int128)f[2] * g3_19 + (unsigned __int128)f[3] * g2_19 +
+	       (unsigned __int128)f[4] * g1_19;
+	t[1] = (unsigned __int128)f[0] * g[1] + (unsigned __int128)f[1] * g[0] +
+	       (unsigned __int128)f[2] * g4_19 + (unsigned __int128)f[3] * g3_19 +
+	       (unsigned __int128)f[4] * g2_19;
+	t[2] = (unsigned __int128)f[0] * g[2] + (unsigned __int128)f[1] * g[1] +
+	       (unsigned __int128)f[2] * g[0] + (unsigned __int128)f[3] * g4_19 +
+	       (unsigned __int128)f[4] * g3_19;
+	t[3] = (unsigned __int128)f[0] * g[3] + (unsigned __int128)f[1] * g[2] +
+	       (unsigned __int128)f[2] * g[1] + (unsigned __int128)f[3] * g[0] +
+	       (unsigned __int128)f[4] * g4_19;
+	t[4] = (unsigned __int128)f[0] * g[4] + (unsigned __int128)f[1] * g[3] +
+	       (unsigned __int128)f[2] * g[2] + (unsigned __int128)f[3] * g[1] +
+	       (unsigned __int128)f[4] * g[0];
+	fe_carry(h, t);
+}
+
+static inline void fe_sq(fe h, const fe f)
+{
+	unsigned __int128 t[5];
+	uint64_t f0_2 = 2 * f[0];
+	uint64_t f1_2 = 2 * f[1];
+	uint64_t f3_19 = 19 * f[3];
+	uint64_t f4_19 = 19 * f[4];
+
+	t[0] = (unsigned __int128)f[0] * f[0] +
+	       (unsigned __int128)f1_2 * f4_19 +
+	       (unsigned __int128)(2 * f[2]) * f3_19;
+	t[1] = (unsigned __int128)f0_2 * f[1] +
+	       (unsigned __int128)(2 * f[2]) * f4_19 +
+	       (unsigned __int128)f[3] * f3_19;
+	t[2] = (unsigned __int128)f0_2 * f[2] + (unsigned __int128)f[1] * f[1] +
+	       (unsigned __int128)(2 * f[3]) * f4_19;
+	t[3] = (unsigned __int128)f0_2 * f[3] + (unsigned __int128)f1_2 * f[2] +
+	       (unsigned __int128)f[4] * f4_19;
+	t[4] = (unsigned __int128)f0_2 * f[4] + (unsigned __int128)f1_2 * f[3] +
+	       (unsigned __int128)f[2] * f[2];
+	fe_carry(h, t);
+}
+
+static inline void fe_mul_a24(fe h, const fe f)
+{
+	unsigned __int128 t[5];
+	int i;
+
+	for (i = 0; i < 5; ++i) {
+		t[i] = (unsigned __int128)f[i] * 121665;
+	}
+	fe_carry(h, t);
+}
+
+static inline void fe_cswap(fe f, fe g, uint64_t swap)
+{
+	uint64_t mask = (uint64_t)0 - swap;
+	uint64_t x;
+	int i;
+
+	for (i = 0; i < 5; ++i) {
+		x = mask & (f[i] ^ g[i]);
+		f[i] ^= x;
+		g[i] ^= x;
+	}
+}
+
+#else /* !uECC_X25519_RADIX51 */
+
+/*
+ * Generic representation: Montgomery form a R mod p on the vli words of
+ * ecc.c (R = 2^256), fully reduced after every operation.
+ */
+typedef uECC_word_t fe[NUM_ECC_WORDS];
+
+static const uECC_word_t p25519[NUM_ECC_WORDS] = {
+	BYTES_TO_WORDS_8(ED, FF, FF, FF, FF, FF, FF, FF),
+	BYTES_TO_WORDS_8(FF, FF, FF, FF, FF, FF, FF, FF),
+	BYTES_TO_WORDS_8(FF, FF, FF, FF, FF, FF, FF, FF),
+	BYTES_TO_WORDS_8(FF, FF, FF, FF, FF, FF, FF, 7F)
+};
+
+/* 2^256 - p, adding p modulo 2^256 is subtracting it: */
+static const uECC_word_t minus_p25519[NUM_ECC_WORDS] = {
+	BYTES_TO_WORDS_8(13, 00, 00, 00, 00, 00, 00, 00),
+	BYTES_TO_WORDS_8(00, 00, 00, 00, 00, 00, 00, 00),
+	BYTES_TO_WORDS_8(00, 00, 00, 00, 00, 00, 00, 00),
+	BYTES_TO_WORDS_8(00, 00, 00, 00, 00, 00, 00, 80)
+};
+
+/* R^2 mod p = 38^2, and -1 / p mod 2^uECC_WORD_BITS (p = -19 mod 2^64): */
+static const uECC_word_t r2_25519[NUM_ECC_WORDS] = {
+	BYTES_TO_WORDS_8(A4, 05, 00, 00, 00, 00, 00, 00)
+};
+#if (uECC_WORD_SIZE == 8)
+#define FE_MONT_INV ((uECC_word_t)0x86BCA1AF286BCA1Bull)
+#else
+#define FE_MONT_INV ((uECC_word_t)0x286BCA1B)
+#endif
+
+static inline void fe_mul(fe h, const fe f, const fe g)
+{
+	uECC_vli_montMult(h, f, g, p25519, FE_MONT_INV, NUM_ECC_WORDS);
+}
+
+static inline void fe_sq(fe h, const fe f)
+{
+	uECC_vli_montMult(h, f, f, p25519, FE_MONT_INV, NUM_ECC_WORDS);
+}
+
+static inline void fe_frombytes(fe h, const uint_least8_t *s)
+{
+	fe t;
+	int i;
+
+	uECC_vli_clear(t, NUM_ECC_WORDS);
+	for (i = 0; i < uECC_X25519_KEY_SIZE; ++i) {
+		t[i / uECC_WORD_SIZE] |=
+			(uECC_word_t)s[i] << (8 * (i % uECC_WORD_SIZE));
+	}
+	t[NUM_ECC_WORDS - 1] &= ~HIGH_BIT_SET;
+	/* t < 2^255, so t R^2 < p R and the result is reduced: */
+	fe_mul(h, t, r2_25519);
+}
+
+static inline void fe_tobytes(uint_least8_t *s, const fe f)
+{
+	fe t;
+	int i;
+
+	uECC_vli_clear(t, NUM_ECC_WORDS);
+	t[0] = 1;
+	fe_mul(t, f, t);
+	for (i = 0; i < uECC_X25519_KEY_SIZE; ++i) {
+		s[i] = (uint_least8_t)(t[i / uECC_WORD_SIZE] >>
+				       (8 * (i % uECC_WORD_SIZE)));
+	}
+}
+
+static inline void fe_one(fe h)
+{
+	/* R mod p */
+	uECC_vli_clear(h, NUM_ECC_WORDS);
+	h[0] = 38;
+}
+
+/* The modular helpers of ecc.c branch on the carry; these do not. */
+static inline void fe_sub(fe h, const fe f, const fe g)
+{
+	fe t;
+	uECC_word_t mask = (uECC_word_t)0 - uECC_vli_sub(h, f, g, NUM_ECC_WORDS);
+	int i;
+
+	for (i = 0; i < NUM_ECC_WORDS; ++i) {
+		t[i] = minus_p25519[i] & mask;
+	}
+	uECC_vli_sub(h, h, t, NUM_ECC_WORDS);
+}
+
+static inline void fe_add(fe h, const fe f, const fe g)
+{
+	fe t;
+
+	/* f + g = f - (p - g) mod p */
+	uECC_vli_sub(t, p25519, g, NUM_ECC_WORDS);
+	fe_sub(h, f, t);
+}
+
+static inline void fe_mul_a24(fe h, const fe f)
+{
+	/* 121665 R mod p */
+	static const uECC_word_t a24[NUM_ECC_WORDS] = {
+		BYTES_TO_WORDS_8(A6, 8B, 46, 00, 00, 00, 00, 00)
+	};
+
+	fe_mul(h, f, a24);
+}
+
+static inline void fe_cswap(fe f, fe g, uint64_t swap)
+{
+	uECC_word_t mask = (uECC_word_t)0 - (uECC_word_t)swap;
+	uECC_word_t x;
+	int i;
+
+	for (i = 0; i < NUM_ECC_WORDS; ++i) {
+		x = mask & (f[i] ^ g[i]);
+		f[i] ^= x;
+		g[i] ^= x;
+	}
+}
+
+#endif /* uECC_X25519_RADIX51 */
+
+static inline void fe_sq_n(fe h, const fe f, int n)
+{
+	fe_sq(h, f);
+	while (--n > 0) {
+		fe_sq(h, h);
+	}
+}
+
+/* h = z^(p - 2) = 1 / z, with 254 squarings and 11 multiplications. */
+static inline void fe_invert(fe h, const fe z)
+{
+	fe t0, t1, t2, t3;
+
+	fe_sq(t0, z);              /* 2 */
+	fe_sq_n(t1, t0, 2);        /* 8 */
+	fe_mul(t1, z, t1);         /* 9 */
+	fe_mul(t0, t0, t1);        /* 11 */
+	fe_sq(t2, t0);             /* 22 */
+	fe_mul(t1, t1, t2);        /* 2^5 - 1 */
+	fe_sq_n(t2, t1, 5);
+	fe_mul(t1, t2, t1);        /* 2^10 - 1 */
+	fe_sq_n(t2, t1, 10);
+	fe_mul(t2, t2, t1);        /* 2^20 - 1 */
+	fe_sq_n(t3, t2, 20);
+	fe_mul(t2, t3, t2);        /* 2^40 - 1 */
+	fe_sq_n(t2, t2, 10);
+	fe_mul(t1, t2, t1);        /* 2^50 - 1 */
+	fe_sq_n(t2, t1, 50);
+	fe_mul(t2, t2, t1);        /* 2^100 - 1 */
+	fe_sq_n(t3, t2, 100);
+	fe_mul(t2, t3, t2);        /* 2^200 - 1 */
+	fe_sq_n(t2, t2, 50);
+	fe_mul(t1, t2, t1);        /* 2^250 - 1 */
+	fe_sq_n(t1, t1, 5);        /* 2^255 - 2^5 */
+	fe_mul(h, t1, t0);         /* 2^255 - 21 */
+}
+
+static inline void fe_copy(fe h, const fe f)
+{
+	memcpy(h, f, sizeof(fe));
+}
+
+static inline void fe_neg(fe h, const fe f)
+{
+	fe zero;
+
+	memset(zero, 0, sizeof(zero));
+	fe_sub(h, zero, f);
+}
+
+/* f = g if b is 1, unchanged if b is 0, in constant time. */
+static inline void fe_cmov(fe f, const fe g, uint64_t b)
+{
+	fe t;
+
+	fe_copy(t, g);
+	fe_cswap(f, t, b);
+}
+
+static inline int fe_iszero(const fe f)
+{
+	uint_least8_t s[uECC_X25519_KEY_SIZE];
+	uint_least8_t r = 0;
+	int i;
+
+	fe_tobytes(s, f);
+	for (i = 0; i < uECC_X25519_KEY_SIZE; ++i) {
+		r |= s[i];
+	}
+	return r == 0;
+}
+
+/* Least significant bit of the canonical representative of f. */
+static inline int fe_isnegative(const fe f)
+{
+	uint_least8_t s[uECC_X25519_KEY_SIZE];
+
+	fe_tobytes(s, f);
+	return s[0] & 1;
+}
+
+/* h = z^((p - 5) / 8) = z^(2^252 - 3), for square roots. */
+static inline void fe_pow22523(fe h, const fe z)
+{
+	fe t0, t1, t2;
+
+	fe_sq(t0, z);              /* 2 */
+	fe_sq_n(t1, t0, 2);        /* 8 */
+	fe_mul(t1, z, t1);         /* 9 */
+	fe_mul(t0, t0, t1);        /* 11 */
+	fe_sq(t0, t0);             /* 22 */
+	fe_mul(t0, t1, t0);        /* 2^5 - 1 */
+	fe_sq_n(t1, t0, 5);
+	fe_mul(t0, t1, t0);        /* 2^10 - 1 */
+	fe_sq_n(t1, t0, 10);
+	fe_mul(t1, t1, t0);        /* 2^20 - 1 */
+	fe_sq_n(t2, t1, 20);
+	fe_mul(t1, t2, t1);        /* 2^40 - 1 */
+	fe_sq_n(t1, t1, 10);
+	fe_mul(t0, t1, t0);        /* 2^50 - 1 */
+	fe_sq_n(t1, t0, 50);
+	fe_mul(t1, t1, t0);        /* 2^100 - 1 */
+	fe_sq_n(t2, t1, 100);
+	fe_mul(t1, t2, t1);        /* 2^200 - 1 */
+	fe_sq_n(t1, t1, 50);
+	fe_mul(t0, t1, t0);        /* 2^250 - 1 */
+	fe_sq_n(t0, t0, 2);        /* 2^252 - 4 */
+	fe_mul(h, t0, z);          /* 2^252 - 3 */
+}
+
+#endif /* __TC_ECC_FE25519_H__ */
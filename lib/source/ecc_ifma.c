@@ -0,0 +1,582 @@
+/* ecc_ifma.c - TinyCrypt implementation of multi-lane p-256 arithmetic */
+
+/*
+ *  Copyright (C) 2017 by Intel Corporation, All Rights Reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *    - Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *    - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ *    - Neither the name of Intel Corporation nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Eight p-256 computations side by side, one per 64-bit element of the
+ * AVX-512 registers. A field element is held in five 52-bit limbs (radix
+ * 2^52), so that VPMADD52LUQ/VPMADD52HUQ multiply all eight lanes' limbs at
+ * once and accumulate into 64-bit elements without carries. Multiplication is
+ * Montgomery's with R = 2^260: since p = -1 mod 2^52, the per-limb quotient
+ * is just the low limb of the accumulator. Values stay in [0, 2p), which
+ * 4p < R keeps closed under Montgomery products.
+ */
+
+#include <tinycrypt/ecc.h>
+#include <string.h>
+
+#if uECC_ASM_X86_64
+
+#include <immintrin.h>
+
+#define IFMA __attribute__((target("avx512f,avx512ifma")))
+
+#define LIMB_BITS 52
+#define LIMB_MASK 0xfffffffffffffULL
+
+/* p, 2p, R mod p (1 in the Montgomery domain) and R^2 mod p, radix 2^52: */
+static const uint64_t p_52[5] = {
+	0xfffffffffffffULL, 0x00fffffffffffULL, 0x0000000000000ULL,
+	0x0001000000000ULL, 0x0ffffffff0000ULL
+};
+static const uint64_t p2_52[5] = {
+	0xffffffffffffeULL, 0x01fffffffffffULL, 0x0000000000000ULL,
+	0x0002000000000ULL, 0x1fffffffe0000ULL
+};
+static const uint64_t one_52[5] = {
+	0x0000000000010ULL, 0xf000000000000ULL, 0xfffffffffffffULL,
+	0xffeffffffffffULL, 0x00000000fffffULL
+};
+static const uint64_t r2_52[5] = {
+	0x0000000000300ULL, 0xffffffff00000ULL, 0xffffefffffffbULL,
+	0xfdfffffffffffULL, 0x0000004ffffffULL
+};
+
+/* one field element per lane: limb i of every lane in l[i] */
+typedef struct {
+	__m512i l[5];
+} fe8_t;
+
+typedef struct {
+	fe8_t x;
+	fe8_t y;
+	fe8_t z;
+} point8_t;
+
+static IFMA void fe8_set1(fe8_t *r, const uint64_t *limbs)
+{
+	int i;
+
+	for (i = 0; i < 5; ++i) {
+		r->l[i] = _mm512_set1_epi64((long long)limbs[i]);
+	}
+}
+
+static IFMA void fe8_blend(fe8_t *r, __mmask8 mask, const fe8_t *a)
+{
+	int i;
+
+	for (i = 0; i < 5; ++i) {
+		r->l[i] = _mm512_mask_blend_epi64(mask, r->l[i], a->l[i]);
+	}
+}
+
+/* Propagates carries (or borrows) so that limbs 0 to 3 hold 52 bits. */
+#define FE8_CARRY(t0, t1, t2, t3, t4) do { \
+	t1 = _mm512_add_epi64(t1, _mm512_srai_epi64(t0, LIMB_BITS)); \
+	t0 = _mm512_and_si512(t0, mask); \
+	t2 = _mm512_add_epi64(t2, _mm512_srai_epi64(t1, LIMB_BITS)); \
+	t1 = _mm512_and_si512(t1, mask); \
+	t3 = _mm512_add_epi64(t3, _mm512_srai_epi64(t2, LIMB_BITS)); \
+	t2 = _mm512_and_si512(t2, mask); \
+	t4 = _mm512_add_epi64(t4, _mm512_srai_epi64(t3, LIMB_BITS)); \
+	t3 = _mm512_and_si512(t3, mask); \
+} while (0)
+
+/*
+ * r = t - 2p if that is not negative, t otherwise; t holds carried limbs
+ * and is below 4p.
+ */
+static IFMA void fe8_reduce_2p(fe8_t *r, __m512i t0, __m512i t1, __m512i t2,
+			       __m512i t3, __m512i t4)
+{
+	const __m512i mask = _mm512_set1_epi64((long long)LIMB_MASK);
+	__m512i d0 = _mm512_sub_epi64(t0, _mm512_set1_epi64((long long)p2_52[0]));
+	__m512i d1 = _mm512_sub_epi64(t1, _mm512_set1_epi64((long long)p2_52[1]));
+	__m512i d2 = t2;
+	__m512i d3 = _mm512_sub_epi64(t3, _mm512_set1_epi64((long long)p2_52[3]));
+	__m512i d4 = _mm512_sub_epi64(t4, _mm512_set1_epi64((long long)p2_52[4]));
+	__mmask8 borrow;
+
+	FE8_CARRY(d0, d1, d2, d3, d4);
+	borrow = _mm512_cmplt_epi64_mask(d4, _mm512_setzero_si512());
+	r->l[0] = _mm512_mask_blend_epi64(borrow, d0, t0);
+	r->l[1] = _mm512_mask_blend_epi64(borrow, d1, t1);
+	r->l[2] = _mm512_mask_blend_epi64(borrow, d2, t2);
+	r->l[3] = _mm512_mask_blend_epi64(borrow, d3, t3);
+	r->l[4] = _mm512_mask_blend_epi64(borrow, d4, t4);
+}
+
+/* r = a + b */
+static IFMA void fe8_add(fe8_t *r, const fe8_t *a, const fe8_t *b)
+{
+	const __m512i mask = _mm512_set1_epi64((long long)LIMB_MASK);
+	__m512i t0 = _mm512_add_epi64(a->l[0], b->l[0]);
+	__m512i t1 = _mm512_add_epi64(a->l[1], b->l[1]);
+	__m512i t2 = _mm512_add_epi64(a->l[2], b->l[2]);
+	__m512i t3 = _mm512_add_epi64(a->l[3], b->l[3]);
+	__m512i t4 = _mm512_add_epi64(a->l[4], b->l[4]);
+
+	FE8_CARRY(t0, t1, t2, t3, t4);
+	fe8_reduce_2p(r, t0, t1, t2, t3, t4);
+}
+
+/* r = a - b, computed as a + 2p - b */
+static IFMA void fe8_sub(fe8_t *r, const fe8_t *a, const fe8_t *b)
+{
+	const __m512i mask = _mm512_set1_epi64((long long)LIMB_MASK);
+	__m512i t0 = _mm512_sub_epi64(_mm512_add_epi64(a->l[0],
+				      _mm512_set1_epi64((long long)p2_52[0])),
+				      b->l[0]);
+	__m512i t1 = _mm512_sub_epi64(_mm512_add_epi64(a->l[1],
+				      _mm512_set1_epi64((long long)p2_52[1])),
+				      b->l[1]);
+	__m512i t2 = _mm512_sub_epi64(a->l[2], b->l[2]);
+	__m512i t3 = _mm512_sub_epi64(_mm512_add_epi64(a->l[3],
+				      _mm512_set1_epi64((long long)p2_52[3])),
+				      b->l[3]);
+	__m512i t4 = _mm512_sub_epi64(_mm512_add_epi64(a->l[4],
+				      _mm512_set1_epi64((long long)p2_52[4])),
+				      b->l[4]);
+
+	FE8_CARRY(t0, t1, t2, t3, t4);
+	fe8_reduce_2p(r, t0, t1, t2, t3, t4);
+}
+
+/*
+ * One row of the Montgomery product: t += ai * b, then t += m * p with m the
+ * low limb of t, which clears it, and t is shifted down by a limb. Limb 2 of
+ * p is zero.
+ */
+#define FE8_MUL_ROW(ai) do { \
+	__m512i m_; \
+	t0 = _mm512_madd52lo_epu64(t0, ai, b0); \
+	t1 = _mm512_madd52lo_epu64(t1, ai, b1); \
+	t2 = _mm512_madd52lo_epu64(t2, ai, b2); \
+	t3 = _mm512_madd52lo_epu64(t3, ai, b3); \
+	t4 = _mm512_madd52lo_epu64(t4, ai, b4); \
+	t1 = _mm512_madd52hi_epu64(t1, ai, b0); \
+	t2 = _mm512_madd52hi_epu64(t2, ai, b1); \
+	t3 = _mm512_madd52hi_epu64(t3, ai, b2); \
+	t4 = _mm512_madd52hi_epu64(t4, ai, b3); \
+	t5 = _mm512_madd52hi_epu64(t5, ai, b4); \
+	m_ = _mm512_and_si512(t0, mask); \
+	t0 = _mm512_madd52lo_epu64(t0, m_, p0); \
+	t1 = _mm512_madd52lo_epu64(t1, m_, p1); \
+	t3 = _mm512_madd52lo_epu64(t3, m_, p3); \
+	t4 = _mm512_madd52lo_epu64(t4, m_, p4); \
+	t1 = _mm512_madd52hi_epu64(t1, m_, p0); \
+	t2 = _mm512_madd52hi_epu64(t2, m_, p1); \
+	t4 = _mm512_madd52hi_epu64(t4, m_, p3); \
+	t5 = _mm512_madd52hi_epu64(t5, m_, p4); \
+	t0 = _mm512_add_epi64(t1, _mm512_srli_epi64(t0, LIMB_BITS)); \
+	t1 = t2; \
+	t2 = t3; \
+	t3 = t4; \
+	t4 = t5; \
+	t5 = _mm512_setzero_si512(); \
+} while (0)
+
+/* r = a * b / R, for a, b < 2p */
+static IFMA void fe8_mul(fe8_t *r, const fe8_t *a, const fe8_t *b)
+{
+	const __m512i mask = _mm512_set1_epi64((long long)LIMB_MASK);
+	const __m512i p0 = _mm512_set1_epi64((long long)p_52[0]);
+	const __m512i p1 = _mm512_set1_epi64((long long)p_52[1]);
+	const __m512i p3 = _mm512_set1_epi64((long long)p_52[3]);
+	const __m512i p4 = _mm512_set1_epi64((long long)p_52[4]);
+	__m512i b0 = b->l[0], b1 = b->l[1], b2 = b->l[2], b3 = b->l[3];
+	__m512i b4 = b->l[4];
+	__m512i t0 = _mm512_setzero_si512(), t1 = t0, t2 = t0, t3 = t0;
+	__m512i t4 = t0, t5 = t0;
+
+	FE8_MUL_ROW(a->l[0]);
+	FE8_MUL_ROW(a->l[1]);
+	FE8_MUL_ROW(a->l[2]);
+	FE8_MUL_ROW(a->l[3]);
+	FE8_MUL_ROW(a->l[4]);
+
+	FE8_CARRY(t0, t1, t2, t3, t4);
+	r->l[0] = t0;
+	r->l[1] = t1;
+	r->l[2] = t2;
+	r->l[3] = t3;
+	r->l[4] = t4;
+}
+
+/* Lanes where a == 0 (mod p), that is a == 0 or a == p. */
+static IFMA __mmask8 fe8_is_zero(const fe8_t *a)
+{
+	__mmask8 zero = 0xff;
+	__mmask8 is_p = 0xff;
+	int i;
+
+	for (i = 0; i < 5; ++i) {
+		zero &= _mm512_cmpeq_epi64_mask(a->l[i], _mm512_setzero_si512());
+		is_p &= _mm512_cmpeq_epi64_mask(a->l[i],
+				_mm512_set1_epi64((long long)p_52[i]));
+	}
+	return zero | is_p;
+}
+
+/* Loads one value per lane into the Montgomery domain. */
+static IFMA void fe8_from_words(fe8_t *r, const uECC_word_t * const *words)
+{
+	uint64_t limbs[5][uECC_LANES];
+	fe8_t t, r2;
+	int l, i;
+
+	for (l = 0; l < uECC_LANES; ++l) {
+		const uECC_word_t *w = words[l];
+		limbs[0][l] = w[0] & LIMB_MASK;
+		limbs[1][l] = ((w[0] >> 52) | (w[1] << 12)) & LIMB_MASK;
+		limbs[2][l] = ((w[1] >> 40) | (w[2] << 24)) & LIMB_MASK;
+		limbs[3][l] = ((w[2] >> 28) | (w[3] << 36)) & LIMB_MASK;
+		limbs[4][l] = w[3] >> 16;
+	}
+	for (i = 0; i < 5; ++i) {
+		t.l[i] = _mm512_loadu_si512(limbs[i]);
+	}
+	fe8_set1(&r2, r2_52);
+	fe8_mul(r, &t, &r2);
+}
+
+/* Stores one value per lane out of the Montgomery domain, fully reduced. */
+static IFMA void fe8_to_words(uECC_word_t *words, const fe8_t *a)
+{
+	const __m512i mask = _mm512_set1_epi64((long long)LIMB_MASK);
+	uint64_t limbs[5][uECC_LANES];
+	fe8_t one, t;
+	__m512i d0, d1, d2, d3, d4;
+	__mmask8 borrow;
+	int l;
+
+	/* a / R, below 2p; then subtract p where that does not borrow: */
+	memset(&one, 0, sizeof(one));
+	one.l[0] = _mm512_set1_epi64(1);
+	fe8_mul(&t, a, &one);
+	d0 = _mm512_sub_epi64(t.l[0], _mm512_set1_epi64((long long)p_52[0]));
+	d1 = _mm512_sub_epi64(t.l[1], _mm512_set1_epi64((long long)p_52[1]));
+	d2 = t.l[2];
+	d3 = _mm512_sub_epi64(t.l[3], _mm512_set1_epi64((long long)p_52[3]));
+	d4 = _mm512_sub_epi64(t.l[4], _mm512_set1_epi64((long long)p_52[4]));
+	FE8_CARRY(d0, d1, d2, d3, d4);
+	borrow = _mm512_cmplt_epi64_mask(d4, _mm512_setzero_si512());
+	_mm512_storeu_si512(limbs[0], _mm512_mask_blend_epi64(borrow, d0, t.l[0]));
+	_mm512_storeu_si512(limbs[1], _mm512_mask_blend_epi64(borrow, d1, t.l[1]));
+	_mm512_storeu_si512(limbs[2], _mm512_mask_blend_epi64(borrow, d2, t.l[2]));
+	_mm512_storeu_si512(limbs[3], _mm512_mask_blend_epi64(borrow, d3, t.l[3]));
+	_mm512_storeu_si512(limbs[4], _mm512_mask_blend_epi64(borrow, d4, t.l[4]));
+
+	for (l = 0; l < uECC_LANES; ++l) {
+		uECC_word_t *w = words + l * NUM_ECC_WORDS;
+		w[0] = limbs[0][l] | (limbs[1][l] << 52);
+		w[1] = (limbs[1][l] >> 12) | (limbs[2][l] << 40);
+		w[2] = (limbs[2][l] >> 24) | (limbs[3][l] << 28);
+		w[3] = (limbs[3][l] >> 36) | (limbs[4][l] << 16);
+	}
+}
+
+/* P = 2P in every lane (dbl-2001-b, a = -3); infinity stays at Z = 0. */
+static IFMA void point8_double(point8_t *P)
+{
+	fe8_t delta, gamma, beta, alpha, t1, t2;
+
+	fe8_mul(&delta, &P->z, &P->z);
+	fe8_mul(&gamma, &P->y, &P->y);
+	fe8_mul(&beta, &P->x, &gamma);
+	fe8_sub(&t1, &P->x, &delta);
+	fe8_add(&t2, &P->x, &delta);
+	fe8_mul(&t1, &t1, &t2);
+	fe8_add(&alpha, &t1, &t1);
+	fe8_add(&alpha, &alpha, &t1); /* alpha = 3 (x - delta) (x + delta) */
+
+	fe8_add(&t1, &P->y, &P->z);
+	fe8_mul(&t1, &t1, &t1);
+	fe8_sub(&t1, &t1, &gamma);
+	fe8_sub(&P->z, &t1, &delta); /* z3 = (y + z)^2 - gamma - delta */
+
+	fe8_add(&beta, &beta, &beta);
+	fe8_add(&beta, &beta, &beta); /* 4 beta */
+	fe8_mul(&P->x, &alpha, &alpha);
+	fe8_sub(&P->x, &P->x, &beta);
+	fe8_sub(&P->x, &P->x, &beta); /* x3 = alpha^2 - 8 beta */
+
+	fe8_sub(&t1, &beta, &P->x);
+	fe8_mul(&t1, &alpha, &t1);
+	fe8_mul(&gamma, &gamma, &gamma);
+	fe8_add(&gamma, &gamma, &gamma);
+	fe8_add(&gamma, &gamma, &gamma);
+	fe8_add(&gamma, &gamma, &gamma);
+	fe8_sub(&P->y, &t1, &gamma); /* y3 = alpha (4 beta - x3) - 8 gamma^2 */
+}
+
+/*
+ * P += (x2, y2) in the lanes of add (madd-2004-hmv); lanes of P at infinity
+ * take (x2, y2). Returns the lanes where both points had the same x, which
+ * the formulas do not cover.
+ */
+static IFMA __mmask8 point8_add_mixed(point8_t *P, __mmask8 *infinity,
+				      __mmask8 add, const fe8_t *x2,
+				      const fe8_t *y2)
+{
+	fe8_t z1z1, t, h, r, hh, hhh, v, x3, y3, z3;
+	__mmask8 active = add & ~*infinity;
+	__mmask8 first = add & *infinity;
+
+	fe8_mul(&z1z1, &P->z, &P->z);
+	fe8_mul(&h, x2, &z1z1);
+	fe8_sub(&h, &h, &P->x); /* h = x2 z1^2 - x1 */
+	fe8_mul(&t, &P->z, &z1z1);
+	fe8_mul(&r, y2, &t);
+	fe8_sub(&r, &r, &P->y); /* r = y2 z1^3 - y1 */
+
+	fe8_mul(&hh, &h, &h);
+	fe8_mul(&hhh, &h, &hh);
+	fe8_mul(&v, &P->x, &hh);
+	fe8_mul(&x3, &r, &r);
+	fe8_sub(&x3, &x3, &hhh);
+	fe8_sub(&x3, &x3, &v);
+	fe8_sub(&x3, &x3, &v); /* x3 = r^2 - h^3 - 2 x1 h^2 */
+	fe8_sub(&t, &v, &x3);
+	fe8_mul(&y3, &r, &t);
+	fe8_mul(&t, &P->y, &hhh);
+	fe8_sub(&y3, &y3, &t); /* y3 = r (x1 h^2 - x3) - y1 h^3 */
+	fe8_mul(&z3, &P->z, &h);
+
+	fe8_blend(&P->x, active, &x3);
+	fe8_blend(&P->y, active, &y3);
+	fe8_blend(&P->z, active, &z3);
+
+	if (first) {
+		fe8_set1(&t, one_52);
+		fe8_blend(&P->x, first, x2);
+		fe8_blend(&P->y, first, y2);
+		fe8_blend(&P->z, first, &t);
+		*infinity &= ~add;
+	}
+	return active & fe8_is_zero(&h);
+}
+
+/* odd multiples of one term, for all lanes: [entry][x, y][limb][lane] */
+typedef uint64_t lane_table_t[1 << (uECC_WNAF_MAX_WIDTH - 2)][2][5][uECC_LANES];
+
+static IFMA __attribute__((noinline)) unsigned int mult_wnaf_x8(
+	uECC_word_t *X, uECC_word_t *Y, uECC_word_t *Z,
+	const uECC_word_t * const *scalars, const uECC_word_t * const *tables,
+	const wordcount_t *widths, wordcount_t num_terms)
+{
+	lane_table_t lane_tables[uECC_LANES_MAX_TERMS];
+	int_least8_t naf[NUM_ECC_WORDS * uECC_WORD_BITS + 1];
+	int8_t digits[uECC_LANES_MAX_TERMS][NUM_ECC_WORDS * uECC_WORD_BITS + 1]
+		     [uECC_LANES];
+	const uECC_word_t *src[uECC_LANES];
+	const __m512i lane_index = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+	point8_t P;
+	fe8_t x2, y2, neg_y2, zero;
+	__mmask8 infinity = 0xff;
+	__mmask8 failed = 0;
+	bitcount_t num_digits = 0;
+	bitcount_t i;
+	wordcount_t t;
+	int l, e, c, k;
+
+	memset(digits, 0, sizeof(digits));
+	for (t = 0; t < num_terms; ++t) {
+		/* digits, lane by lane: */
+		for (l = 0; l < uECC_LANES; ++l) {
+			bitcount_t len = wnaf_recode(naf,
+						     scalars[l * num_terms + t],
+						     widths[t], NUM_ECC_WORDS);
+			for (i = 0; i < len; ++i) {
+				digits[t][i][l] = naf[i];
+			}
+			if (len > num_digits) {
+				num_digits = len;
+			}
+		}
+
+		/* tables, converted eight entries at a time: */
+		for (e = 0; e < (1 << (widths[t] - 2)); ++e) {
+			for (c = 0; c < 2; ++c) {
+				fe8_t v;
+				for (l = 0; l < uECC_LANES; ++l) {
+					src[l] = tables[l * num_terms + t] +
+						 (2 * e + c) * NUM_ECC_WORDS;
+				}
+				fe8_from_words(&v, src);
+				for (k = 0; k < 5; ++k) {
+					_mm512_storeu_si512(lane_tables[t][e][c][k],
+							    v.l[k]);
+				}
+			}
+		}
+	}
+
+	memset(&P, 0, sizeof(P));
+	memset(&zero, 0, sizeof(zero));
+	for (i = num_digits - 1; i >= 0; --i) {
+		if (infinity != 0xff) {
+			point8_double(&P);
+		}
+		for (t = 0; t < num_terms; ++t) {
+			__m512i d = _mm512_cvtepi8_epi64(
+				_mm_loadl_epi64((const __m128i *)digits[t][i]));
+			__mmask8 add = _mm512_cmpneq_epi64_mask(d,
+						_mm512_setzero_si512());
+			__mmask8 negative;
+			__m512i index;
+
+			if (!add) {
+				continue;
+			}
+			negative = _mm512_cmplt_epi64_mask(d,
+						_mm512_setzero_si512());
+
+			/* element offset of each lane's entry: 80 |d|/2 + lane */
+			index = _mm512_srli_epi64(_mm512_abs_epi64(d), 1);
+			index = _mm512_add_epi64(
+				_mm512_add_epi64(_mm512_slli_epi64(index, 6),
+						 _mm512_slli_epi64(index, 4)),
+				lane_index);
+			for (k = 0; k < 5; ++k) {
+				x2.l[k] = _mm512_i64gather_epi64(index,
+						lane_tables[t][0][0][k], 8);
+				y2.l[k] = _mm512_i64gather_epi64(index,
+						lane_tables[t][0][1][k], 8);
+			}
+			fe8_sub(&neg_y2, &zero, &y2);
+			fe8_blend(&y2, negative, &neg_y2);
+
+			failed |= point8_add_mixed(&P, &infinity, add, &x2, &y2);
+		}
+	}
+
+	fe8_to_words(X, &P.x);
+	fe8_to_words(Y, &P.y);
+	fe8_to_words(Z, &P.z);
+	for (l = 0; l < uECC_LANES; ++l) {
+		if (infinity & (1 << l)) {
+			uECC_vli_clear(Z + l * NUM_ECC_WORDS, NUM_ECC_WORDS);
+		}
+	}
+
+	return (unsigned int)(__mmask8)~failed;
+}
+
+unsigned int EccPoint_mult_wnaf_x8(uECC_word_t *X, uECC_word_t *Y,
+				   uECC_word_t *Z,
+				   const uECC_word_t * const *scalars,
+				   const uECC_word_t * const *tables,
+				   const wordcount_t *widths,
+				   wordcount_t num_terms, uECC_Curve curve)
+{
+	/* nothing may touch AVX-512 state before this check: */
+	if (!(uECC_get_cpu_features() & uECC_CPU_AVX512_IFMA) ||
+	    curve != uECC_secp256r1() || num_terms > uECC_LANES_MAX_TERMS) {
+		return 0;
+	}
+	return mult_wnaf_x8(X, Y, Z, scalars, tables, widths, num_terms);
+}
+
+/* Lanes where y^2 = x^3 - 3x + b, for x, y < p. */
+static IFMA __attribute__((noinline)) unsigned int on_curve_x8(
+	const uECC_word_t *points, uECC_Curve curve)
+{
+	const uECC_word_t *xs[uECC_LANES];
+	const uECC_word_t *ys[uECC_LANES];
+	const uECC_word_t *bs[uECC_LANES];
+	fe8_t x, y, b, t, rhs;
+	int l;
+
+	for (l = 0; l < uECC_LANES; ++l) {
+		xs[l] = points + l * 2 * NUM_ECC_WORDS;
+		ys[l] = xs[l] + NUM_ECC_WORDS;
+		bs[l] = curve->b;
+	}
+	fe8_from_words(&x, xs);
+	fe8_from_words(&y, ys);
+	fe8_from_words(&b, bs);
+
+	fe8_mul(&t, &x, &x);
+	fe8_mul(&rhs, &t, &x);		/* x^3 */
+	fe8_sub(&rhs, &rhs, &x);
+	fe8_sub(&rhs, &rhs, &x);
+	fe8_sub(&rhs, &rhs, &x);	/* x^3 - 3x */
+	fe8_add(&rhs, &rhs, &b);	/* x^3 - 3x + b */
+	fe8_mul(&t, &y, &y);		/* y^2 */
+	fe8_sub(&t, &t, &rhs);
+
+	return (unsigned int)fe8_is_zero(&t);
+}
+
+int EccPoint_on_curve_x8(unsigned int *on_curve, const uECC_word_t *points,
+			 uECC_Curve curve)
+{
+	/* nothing may touch AVX-512 state before this check: */
+	if (!(uECC_get_cpu_features() & uECC_CPU_AVX512_IFMA) ||
+	    curve != uECC_secp256r1()) {
+		return 0;
+	}
+	*on_curve = on_curve_x8(points, curve);
+	return 1;
+}
+
+#else
+
+int EccPoint_on_curve_x8(unsigned int *on_curve, const uECC_word_t *points,
+			 uECC_Curve curve)
+{
+	(void)on_curve;
+	(void)points;
+	(void)curve;
+	return 0;
+}
+
+unsigned int EccPoint_mult_wnaf_x8(uECC_word_t *X, uECC_word_t *Y,
+				   uECC_word_t *Z,
+				   const uECC_word_t * const *scalars,
+				   const uECC_word_t * const *tables,
+				   const wordcount_t *widths,
+				   wordcount_t num_terms, uECC_Curve curve)
+{
+	(void)X;
+	(void)Y;
+	(void)Z;
+	(void)scalars;
+	(void)tables;
+	(void)widths;
+	(void)num_terms;
+	(void)curve;
+	return 0;
+}
+
+#endif /* uECC_ASM_X86_64 */
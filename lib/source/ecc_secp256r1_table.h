@@ -0,0 +1,4278 @@
+/* ecc_secp256r1_table.h - TinyCrypt precomputed multiples of the p-256 generator */
+
+/*
+ *  Copyright (C) 2017 by Intel Corporation, All Rights Reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *    - Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *    - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ *    - Neither the name of Intel Corporation nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Fixed-base table for curve NIST p-256, used by mult_base_secp256r1 in ecc.c.
+ *
+ * Row i holds the affine points (2j + 1) * 16^i * G for j = 0..7, each stored
+ * as x followed by y in uECC native format. Every 4-bit signed window of a
+ * scalar then maps to one entry of its row, so a multiplication by G takes 63
+ * point additions and no doublings.
+ *
+ * The table was generated offline with plain affine arithmetic and is only
+ * meant to be included by ecc.c. It equals EccPoint_fixed_table(table, G), which
+ * the fixed-base test in tests/test_ecc_dh.c checks byte for byte.
+ */
+
+#ifndef __TC_ECC_SECP256R1_TABLE_H__
+#define __TC_ECC_SECP256R1_TABLE_H__
+
+#include <tinycrypt/ecc.h>
+
+static const uECC_word_t secp256r1_G_table[64][8][2 * NUM_ECC_WORDS] = {
+	{ /* (2j + 1) * 16^0 * G */
+		{ BYTES_TO_WORDS_8(96, C2, 98, D8, 45, 39, A1, F4),
+		  BYTES_TO_WORDS_8(A0, 33, EB, 2D, 81, 7D, 03, 77),
+		  BYTES_TO_WORDS_8(F2, 40, A4, 63, E5, E6, BC, F8),
+		  BYTES_TO_WORDS_8(47, 42, 2C, E1, F2, D1, 17, 6B),
+		  BYTES_TO_WORDS_8(F5, 51, BF, 37, 68, 40, B6, CB),
+		  BYTES_TO_WORDS_8(CE, 5E, 31, 6B, 57, 33, CE, 2B),
+		  BYTES_TO_WORDS_8(16, 9E, 0F, 7C, 4A, EB, E7, 8E),
+		  BYTES_TO_WORDS_8(9B, 7F, 1A, FE, E2, 42, E3, 4F) },
+		{ BYTES_TO_WORDS_8(6C, FD, E7, C6, 1B, 66, 41, FB),
+		  BYTES_TO_WORDS_8(85, A9, AD, EF, 21, B7, C6, E6),
+		  BYTES_TO_WORDS_8(65, F1, 4B, 1D, 95, EF, F7, C8),
+		  BYTES_TO_WORDS_8(44, 0A, 33, A6, D1, E4, CB, 5E),
+		  BYTES_TO_WORDS_8(32, 50, 7D, A2, 27, B1, 79, 9A),
+		  BYTES_TO_WORDS_8(3D, B8, 4F, 38, 36, B0, 2A, D8),
+		  BYTES_TO_WORDS_8(EC, A2, 64, 1A, CE, 06, 4B, 37),
+		  BYTES_TO_WORDS_8(7E, FF, 98, 49, 0C, 64, 34, 87) },
+		{ BYTES_TO_WORDS_8(ED, 33, D0, C3, 0D, 4A, 55, 21),
+		  BYTES_TO_WORDS_8(24, E5, 5B, 1F, FD, 82, 8C, EF),
+		  BYTES_TO_WORDS_8(DF, 8F, 66, 08, 56, C8, 84, D7),
+		  BYTES_TO_WORDS_8(D2, 40, 51, 51, 7A, 0B, 59, 51),
+		  BYTES_TO_WORDS_8(A4, 6D, A1, FD, 44, BB, D0, D1),
+		  BYTES_TO_WORDS_8(88, 08, D8, D4, 00, 2F, 01, 0D),
+		  BYTES_TO_WORDS_8(26, 79, 8A, BF, 36, BF, E1, 8A),
+		  BYTES_TO_WORDS_8(7D, 72, 4A, 90, A8, 7D, C1, E0) },
+		{ BYTES_TO_WORDS_8(A3, B2, 87, 31, 70, 28, 06, 30),
+		  BYTES_TO_WORDS_8(5B, EF, 0F, A8, B8, F8, F9, 7E),
+		  BYTES_TO_WORDS_8(60, FB, 01, 7C, 66, 30, BB, 25),
+		  BYTES_TO_WORDS_8(46, 7B, BF, A0, 6F, 3B, 53, 8E),
+		  BYTES_TO_WORDS_8(B4, 00, F4, C1, 86, 1A, 5E, C5),
+		  BYTES_TO_WORDS_8(21, 1B, 04, CB, 33, 36, C7, 53),
+		  BYTES_TO_WORDS_8(00, 90, F5, A6, 83, 9F, 06, 6D),
+		  BYTES_TO_WORDS_8(36, 18, 33, E0, BD, 1D, EB, 73) },
+		{ BYTES_TO_WORDS_8(E0, 9E, 94, 90, 4B, 8A, 9E, D7),
+		  BYTES_TO_WORDS_8(B3, F8, 6D, 2C, 8C, CB, 0A, 9E),
+		  BYTES_TO_WORDS_8(72, F8, 71, 1D, D5, 38, 89, 87),
+		  BYTES_TO_WORDS_8(71, 0B, DF, FE, B6, D7, 68, EA),
+		  BYTES_TO_WORDS_8(FA, 48, D0, 4D, 4A, 22, 5A, E8),
+		  BYTES_TO_WORDS_8(3F, 82, DE, A4, EA, 4F, 71, 4D),
+		  BYTES_TO_WORDS_8(C8, A0, 8E, 4A, 96, 4A, 01, 87),
+		  BYTES_TO_WORDS_8(E7, FC, C9, 72, C9, 44, 27, 2A) },
+		{ BYTES_TO_WORDS_8(D1, 21, BC, 74, D3, 91, 33, 43),
+		  BYTES_TO_WORDS_8(BF, 48, 50, 25, D0, 2E, 74, 16),
+		  BYTES_TO_WORDS_8(DA, 1C, C2, B0, 9D, 37, 38, 06),
+		  BYTES_TO_WORDS_8(59, 4C, 3B, 88, B7, 13, D1, 3E),
+		  BYTES_TO_WORDS_8(40, 37, 2A, E8, FC, EE, F8, E2),
+		  BYTES_TO_WORDS_8(DA, 89, 98, 5E, DA, 04, 0D, 09),
+		  BYTES_TO_WORDS_8(8A, C6, F4, A4, AF, 43, C8, 24),
+		  BYTES_TO_WORDS_8(A2, C8, C4, CC, 9A, 20, 99, 90) },
+		{ BYTES_TO_WORDS_8(01, 2C, 07, 46, 9D, 5D, E1, 98),
+		  BYTES_TO_WORDS_8(8A, D5, EA, 65, 4B, 28, 2E, 79),
+		  BYTES_TO_WORDS_8(FC, E2, 5E, D8, F2, 5D, 80, 61),
+		  BYTES_TO_WORDS_8(5A, 49, AC, E0, 7A, 83, 7C, 17),
+		  BYTES_TO_WORDS_8(D8, BF, C7, EF, E2, BB, 43, 9C),
+		  BYTES_TO_WORDS_8(F3, 4D, FB, A1, C3, 14, EE, 26),
+		  BYTES_TO_WORDS_8(72, 4E, 0F, B4, AD, 91, 40, A2),
+		  BYTES_TO_WORDS_8(58, A5, BE, 4E, CD, 58, BB, 63) },
+		{ BYTES_TO_WORDS_8(5F, 9D, 9B, E5, 63, 8C, 66, 63),
+		  BYTES_TO_WORDS_8(F1, 0E, 3A, DE, 92, AF, 03, AE),
+		  BYTES_TO_WORDS_8(65, 82, 88, 99, 89, 37, FB, AD),
+		  BYTES_TO_WORDS_8(E7, BA, 1A, 97, C6, 4D, 45, F0),
+		  BYTES_TO_WORDS_8(36, 4F, 03, 0D, DE, 9C, E5, 47),
+		  BYTES_TO_WORDS_8(3F, FA, B5, 75, CE, 21, 3B, 2A),
+		  BYTES_TO_WORDS_8(E6, 43, 96, 1F, E5, 94, 65, 4E),
+		  BYTES_TO_WORDS_8(1F, 2D, 2E, 59, E3, 3E, B9, B5) }
+	},
+	{ /* (2j + 1) * 16^1 * G */
+		{ BYTES_TO_WORDS_8(6E, 7C, 27, E1, 87, 47, EB, A5),
+		  BYTES_TO_WORDS_8(38, A0, 6C, FF, 2E, 39, 28, CD),
+		  BYTES_TO_WORDS_8(5F, 31, 36, 98, 62, 1C, 82, 8B),
+		  BYTES_TO_WORDS_8(85, 41, 6B, 8A, 13, 4D, A9, 76),
+		  BYTES_TO_WORDS_8(10, 51, 8C, 4B, 72, DD, 9D, 0E),
+		  BYTES_TO_WORDS_8(AA, 8B, C7, 0F, 04, A0, 99, 85),
+		  BYTES_TO_WORDS_8(20, 87, 1E, E1, B5, A1, B0, 6C),
+		  BYTES_TO_WORDS_8(0E, 26, 1F, 34, 61, FE, 85, A9) },
+		{ BYTES_TO_WORDS_8(CA, 36, 45, 9E, C6, 9D, FB, AB),
+		  BYTES_TO_WORDS_8(61, 1A, 20, 0A, 96, 92, 2E, 1C),
+		  BYTES_TO_WORDS_8(A1, CD, 70, E0, 5B, 74, CE, 8C),
+		  BYTES_TO_WORDS_8(EC, 39, 25, 49, 0E, FB, 82, 94),
+		  BYTES_TO_WORDS_8(C8, C1, 8C, F5, 3B, 86, AD, 1F),
+		  BYTES_TO_WORDS_8(BB, BF, 07, 57, 29, 5E, 3D, F6),
+		  BYTES_TO_WORDS_8(63, 4E, 53, A7, 8C, 63, 5D, 1A),
+		  BYTES_TO_WORDS_8(F9, 57, F1, 45, A7, 9C, 1D, 35) },
+		{ BYTES_TO_WORDS_8(13, FF, EC, 95, E2, DA, B1, 49),
+		  BYTES_TO_WORDS_8(3C, 63, D0, DB, 1C, 4A, 76, 63),
+		  BYTES_TO_WORDS_8(EB, 1E, 08, 53, 51, 5A, 83, 5B),
+		  BYTES_TO_WORDS_8(19, 31, E9, 7A, C1, B7, E1, B2),
+		  BYTES_TO_WORDS_8(44, 7D, 18, B2, 89, 49, BA, A3),
+		  BYTES_TO_WORDS_8(E6, A2, DE, 17, 98, 1A, DA, 87),
+		  BYTES_TO_WORDS_8(C3, 58, D7, AA, A2, A1, 33, F2),
+		  BYTES_TO_WORDS_8(CC, EB, A3, 13, 13, 44, C0, E6) },
+		{ BYTES_TO_WORDS_8(86, 72, F8, EE, 34, B3, BB, 38),
+		  BYTES_TO_WORDS_8(E4, 09, 23, FC, 7D, E8, 03, 07),
+		  BYTES_TO_WORDS_8(34, EE, C6, CB, 7D, 17, 34, CB),
+		  BYTES_TO_WORDS_8(C2, 6B, 1B, 7F, 2E, 46, 33, B4),
+		  BYTES_TO_WORDS_8(D9, 96, 14, 84, F6, 47, C0, 7A),
+		  BYTES_TO_WORDS_8(4B, EA, 2C, 6A, 80, 20, CE, 9D),
+		  BYTES_TO_WORDS_8(6F, 2E, 69, C1, 72, 4E, 3F, 38),
+		  BYTES_TO_WORDS_8(FE, B5, D2, 6E, 52, 54, DA, A0) },
+		{ BYTES_TO_WORDS_8(81, 43, 79, 19, 5B, 6B, 98, 1B),
+		  BYTES_TO_WORDS_8(60, C7, B0, 5E, 87, 58, 91, 18),
+		  BYTES_TO_WORDS_8(19, 7B, 56, B5, 05, E9, 86, C1),
+		  BYTES_TO_WORDS_8(4C, A2, 3D, 4D, CE, 20, 74, A4),
+		  BYTES_TO_WORDS_8(52, 9C, 76, E2, A7, E3, 6C, 69),
+		  BYTES_TO_WORDS_8(78, AC, F6, B9, 8D, C0, A5, F3),
+		  BYTES_TO_WORDS_8(FF, 7A, 96, 19, 36, F9, 3D, E7),
+		  BYTES_TO_WORDS_8(E0, BF, E1, 7B, DF, FF, BB, 2E) },
+		{ BYTES_TO_WORDS_8(5A, 18, A5, 89, 64, 46, 74, EC),
+		  BYTES_TO_WORDS_8(2B, 6F, 5E, 9F, C8, 0A, 87, 5B),
+		  BYTES_TO_WORDS_8(19, A3, 0D, 2B, 01, D4, EC, 5F),
+		  BYTES_TO_WORDS_8(48, 91, D0, B9, 19, 7A, BA, 05),
+		  BYTES_TO_WORDS_8(4E, 3A, DE, 01, 8E, C8, 43, 15),
+		  BYTES_TO_WORDS_8(00, AE, 05, C9, 0B, 22, 06, 76),
+		  BYTES_TO_WORDS_8(8E, D4, E3, 24, 3E, 82, 67, E4),
+		  BYTES_TO_WORDS_8(96, 18, 2C, E8, B5, D2, E0, 30) },
+		{ BYTES_TO_WORDS_8(FE, 85, 9B, F9, B5, 98, A3, 5A),
+		  BYTES_TO_WORDS_8(FD, 5D, 3A, AE, 9A, FE, 0E, 9C),
+		  BYTES_TO_WORDS_8(B7, E0, 83, 80, 91, 8D, 79, 69),
+		  BYTES_TO_WORDS_8(FD, E2, DF, D0, C9, 74, 9F, B2),
+		  BYTES_TO_WORDS_8(DC, 04, A6, 6D, 97, 42, A6, DB),
+		  BYTES_TO_WORDS_8(80, 9E, F5, 0B, D3, 63, EF, 2D),
+		  BYTES_TO_WORDS_8(D9, C6, D7, 96, 2E, 71, D0, D5),
+		  BYTES_TO_WORDS_8(85, 97, C2, A6, C3, 5B, CE, A3) },
+		{ BYTES_TO_WORDS_8(EF, 30, E0, 87, 6E, 45, 67, 27),
+		  BYTES_TO_WORDS_8(96, 0E, D5, 7C, 05, 2B, 6B, 57),
+		  BYTES_TO_WORDS_8(08, 2B, 48, F2, 03, BF, 6C, 07),
+		  BYTES_TO_WORDS_8(F5, BC, 91, 8B, AA, 9B, 29, 99),
+		  BYTES_TO_WORDS_8(9A, AA, D9, D8, 7D, 6B, 8E, 4D),
+		  BYTES_TO_WORDS_8(44, 08, 40, 9F, 49, 2C, C1, 57),
+		  BYTES_TO_WORDS_8(79, AA, CE, A6, 01, 81, 33, BF),
+		  BYTES_TO_WORDS_8(18, 8E, 3F, 33, D3, E3, C2, 5C) }
+	},
+	{ /* (2j + 1) * 16^2 * G */
+		{ BYTES_TO_WORDS_8(1B, 44, D0, 12, 5F, E3, B2, 2D),
+		  BYTES_TO_WORDS_8(4C, 56, 6A, 0D, 71, 0B, 0D, 19),
+		  BYTES_TO_WORDS_8(61, ED, 03, 86, 52, D1, FF, 87),
+		  BYTES_TO_WORDS_8(59, 16, 09, B0, A3, D4, A2, 34),
+		  BYTES_TO_WORDS_8(46, B1, 93, 5E, 84, E7, 24, B4),
+		  BYTES_TO_WORDS_8(1D, D8, DD, DE, B9, 66, D7, E7),
+		  BYTES_TO_WORDS_8(C0, 7F, 77, 6E, 04, 71, CA, 2B),
+		  BYTES_TO_WORDS_8(C2, E3, A1, 53, 6A, ED, AA, BE) },
+		{ BYTES_TO_WORDS_8(24, 84, A0, BD, 33, AE, E4, DC),
+		  BYTES_TO_WORDS_8(A9, 44, F6, 74, AB, B7, BF, 3A),
+		  BYTES_TO_WORDS_8(ED, 23, 5D, A9, FF, C5, 58, 1B),
+		  BYTES_TO_WORDS_8(AA, 59, C3, AD, 07, 0A, 8B, A9),
+		  BYTES_TO_WORDS_8(0C, 80, 31, E8, A0, 87, 12, 36),
+		  BYTES_TO_WORDS_8(2D, 58, DF, A0, 0B, E8, 2B, 75),
+		  BYTES_TO_WORDS_8(20, 13, 1D, 8E, 8C, 9E, 31, E5),
+		  BYTES_TO_WORDS_8(66, 9B, 49, 22, 47, C6, 54, 47) },
+		{ BYTES_TO_WORDS_8(6A, 2D, 3C, 88, 5E, 7E, 2D, B5),
+		  BYTES_TO_WORDS_8(B3, 29, BD, 81, 8D, 91, 2F, D2),
+		  BYTES_TO_WORDS_8(6D, 69, 5A, C8, 78, 6B, 1B, D2),
+		  BYTES_TO_WORDS_8(C5, AA, 8D, C8, 09, F0, 34, A0),
+		  BYTES_TO_WORDS_8(72, 0E, C3, C2, F2, 6E, 33, F4),
+		  BYTES_TO_WORDS_8(7C, 7E, 26, 16, 5F, 03, 06, BE),
+		  BYTES_TO_WORDS_8(06, EB, EC, 5C, 54, B8, CD, B0),
+		  BYTES_TO_WORDS_8(1F, 9C, 89, CA, 36, 00, 1B, FE) },
+		{ BYTES_TO_WORDS_8(78, 8C, BE, 28, DD, 51, 6A, 71),
+		  BYTES_TO_WORDS_8(4D, 3E, 79, 2B, F8, 6C, 09, 4A),
+		  BYTES_TO_WORDS_8(A1, E9, 62, 09, B4, E2, 76, A0),
+		  BYTES_TO_WORDS_8(01, 44, 9D, 31, FF, 26, 22, B5),
+		  BYTES_TO_WORDS_8(03, 69, 68, 51, CA, 67, 33, 20),
+		  BYTES_TO_WORDS_8(F3, 8F, B5, E5, C8, 7F, 9F, 81),
+		  BYTES_TO_WORDS_8(1A, 85, 92, 7E, 69, 36, 1B, CA),
+		  BYTES_TO_WORDS_8(40, F5, 39, F5, C9, E0, 1E, 70) },
+		{ BYTES_TO_WORDS_8(A4, B5, 58, A0, 40, FE, 40, 70),
+		  BYTES_TO_WORDS_8(9B, 97, 31, 79, F8, 64, 44, DE),
+		  BYTES_TO_WORDS_8(13, 47, CC, FC, CC, CE, 68, D9),
+		  BYTES_TO_WORDS_8(B3, 05, 8E, 86, 61, 88, E3, A3),
+		  BYTES_TO_WORDS_8(EF, 3A, 11, E7, 90, 6D, 30, 8F),
+		  BYTES_TO_WORDS_8(94, A2, 71, B7, 5B, 84, EE, 3C),
+		  BYTES_TO_WORDS_8(8F, E6, 97, AE, B3, E6, 48, 38),
+		  BYTES_TO_WORDS_8(2C, D1, F0, 7D, 88, 57, D4, CF) },
+		{ BYTES_TO_WORDS_8(14, 83, A0, 04, C9, 5E, 5F, A0),
+		  BYTES_TO_WORDS_8(F7, DF, C7, 2D, DB, 36, FE, 82),
+		  BYTES_TO_WORDS_8(7A, 19, 21, A2, B9, CA, 3C, 33),
+		  BYTES_TO_WORDS_8(39, A5, 1F, 13, 4A, 54, 99, 20),
+		  BYTES_TO_WORDS_8(CC, 3C, 57, E7, C5, C9, F8, E7),
+		  BYTES_TO_WORDS_8(96, FE, FC, 36, A7, E5, 06, D4),
+		  BYTES_TO_WORDS_8(DF, 48, 90, CB, E5, A8, FB, 90),
+		  BYTES_TO_WORDS_8(18, 3B, A3, 2A, FD, 3D, CF, A5) },
+		{ BYTES_TO_WORDS_8(18, 8C, 07, E9, 4A, F9, 2F, 50),
+		  BYTES_TO_WORDS_8(29, E9, ED, EE, CA, C3, E0, 99),
+		  BYTES_TO_WORDS_8(9B, D3, DF, AA, 72, 6E, 8F, 30),
+		  BYTES_TO_WORDS_8(70, EC, C0, AC, 13, 65, 1D, 75),
+		  BYTES_TO_WORDS_8(67, 0D, CE, CE, 95, 6E, 8D, 99),
+		  BYTES_TO_WORDS_8(C7, 5A, E0, CB, C1, 48, 09, F0),
+		  BYTES_TO_WORDS_8(4E, 2A, 2A, 6A, AF, 4B, 35, 85),
+		  BYTES_TO_WORDS_8(58, 41, 4A, CA, FD, 3F, 9C, BA) },
+		{ BYTES_TO_WORDS_8(00, D9, 86, 9E, 5C, CD, CF, 92),
+		  BYTES_TO_WORDS_8(44, DB, A3, 17, 9D, E0, 5E, 40),
+		  BYTES_TO_WORDS_8(36, 3B, 3A, A0, 08, 83, B4, 17),
+		  BYTES_TO_WORDS_8(11, 80, 47, 5C, 22, F5, E0, 5B),
+		  BYTES_TO_WORDS_8(55, 57, 8A, F5, 9B, D6, CD, C4),
+		  BYTES_TO_WORDS_8(5A, 4F, B3, 41, 52, 72, 21, F9),
+		  BYTES_TO_WORDS_8(3D, 42, B5, E7, A4, E3, 47, D3),
+		  BYTES_TO_WORDS_8(22, C4, F2, DF, E6, D9, D1, 83) }
+	},
+	{ /* (2j + 1) * 16^3 * G */
+		{ BYTES_TO_WORDS_8(3F, 57, 45, A2, DA, E8, 77, F0),
+		  BYTES_TO_WORDS_8(64, 0A, FD, F4, F2, 76, 86, 50),
+		  BYTES_TO_WORDS_8(D2, 6B, 6D, 2E, 67, 89, 77, 99),
+		  BYTES_TO_WORDS_8(4D, 9E, 06, CF, D2, AE, 16, E7),
+		  BYTES_TO_WORDS_8(D1, 18, 92, 46, 6B, C2, 5F, 50),
+		  BYTES_TO_WORDS_8(B3, C9, 07, FA, F2, 0D, 3D, D1),
+		  BYTES_TO_WORDS_8(51, A8, B9, 87, 66, B0, 12, 59),
+		  BYTES_TO_WORDS_8(AB, 72, FC, 94, E6, 63, 36, 35) },
+		{ BYTES_TO_WORDS_8(AC, 08, 70, 65, 30, 79, 98, 7F),
+		  BYTES_TO_WORDS_8(FB, ED, 29, E3, CE, 1E, CE, 19),
+		  BYTES_TO_WORDS_8(2D, A2, 1D, 4C, 8A, 55, E5, 64),
+		  BYTES_TO_WORDS_8(E8, 7C, 50, 6F, 8D, 89, BF, D2),
+		  BYTES_TO_WORDS_8(55, EB, 7B, 72, 4A, 53, 11, 81),
+		  BYTES_TO_WORDS_8(98, 07, FF, B5, 0A, E1, 9C, 67),
+		  BYTES_TO_WORDS_8(56, 0C, A9, 3F, DB, 95, 81, 3F),
+		  BYTES_TO_WORDS_8(AA, 77, 6B, 5A, CB, B1, C0, 69) },
+		{ BYTES_TO_WORDS_8(80, 15, 2F, 78, A9, 7C, 0D, FD),
+		  BYTES_TO_WORDS_8(B7, 3E, 20, 24, EE, DD, E4, B0),
+		  BYTES_TO_WORDS_8(F8, 64, 30, 1F, 39, 57, FA, 87),
+		  BYTES_TO_WORDS_8(60, CE, 83, E5, 4E, 30, 88, 4D),
+		  BYTES_TO_WORDS_8(D7, ED, 16, 56, 6D, B1, 0F, 0C),
+		  BYTES_TO_WORDS_8(11, 1E, EB, 68, BD, A3, FC, AA),
+		  BYTES_TO_WORDS_8(18, 65, FD, 98, 08, 80, D6, E8),
+		  BYTES_TO_WORDS_8(6C, 63, B0, 9A, 70, 4E, A9, 28) },
+		{ BYTES_TO_WORDS_8(11, 8E, C3, E0, DA, C3, 84, 5F),
+		  BYTES_TO_WORDS_8(BA, 26, 6E, EA, 1B, 42, 56, 71),
+		  BYTES_TO_WORDS_8(9E, AF, E5, 02, 92, 39, 67, 32),
+		  BYTES_TO_WORDS_8(EB, 0E, FC, C8, 27, 27, C7, 17),
+		  BYTES_TO_WORDS_8(CD, DE, 90, AE, BB, 66, 83, CD),
+		  BYTES_TO_WORDS_8(E3, DA, 0C, A6, 45, 99, 53, 7E),
+		  BYTES_TO_WORDS_8(2E, 80, 01, E9, CC, 2F, 60, 40),
+		  BYTES_TO_WORDS_8(3C, 4B, 66, FE, F4, A4, C5, 95) },
+		{ BYTES_TO_WORDS_8(EA, 36, 2F, E3, 8A, FD, 55, D9),
+		  BYTES_TO_WORDS_8(C3, 41, 35, 29, A7, 46, 4F, CD),
+		  BYTES_TO_WORDS_8(B3, B8, 4C, C8, CF, B1, 63, 84),
+		  BYTES_TO_WORDS_8(A8, 50, 74, C4, AA, FD, 03, 7E),
+		  BYTES_TO_WORDS_8(AF, B8, 68, 8A, FC, 23, CC, 8A),
+		  BYTES_TO_WORDS_8(D6, 09, 50, 4C, 9A, 97, 9E, 41),
+		  BYTES_TO_WORDS_8(99, AF, 84, 01, 17, 6B, 8E, 66),
+		  BYTES_TO_WORDS_8(DA, 28, 12, 20, F1, D5, F6, DC) },
+		{ BYTES_TO_WORDS_8(A9, BA, 53, D9, A6, 52, 3E, D4),
+		  BYTES_TO_WORDS_8(E8, 8D, E1, 49, 86, AE, 15, 26),
+		  BYTES_TO_WORDS_8(14, B2, A0, DC, C1, 7A, 63, 61),
+		  BYTES_TO_WORDS_8(07, CF, 1B, 4B, 68, DA, E6, 8C),
+		  BYTES_TO_WORDS_8(E5, 89, 26, F5, 28, 5C, E7, 78),
+		  BYTES_TO_WORDS_8(1D, 34, A9, B6, 6B, 98, F3, 07),
+		  BYTES_TO_WORDS_8(68, B5, 61, 00, C9, 3B, 9B, E6),
+		  BYTES_TO_WORDS_8(0B, 12, 93, FA, B8, 4F, 9F, 3D) },
+		{ BYTES_TO_WORDS_8(6A, A9, 22, AF, 53, D8, B8, 4A),
+		  BYTES_TO_WORDS_8(F9, B8, 6A, 9C, 9D, BA, B1, 08),
+		  BYTES_TO_WORDS_8(B0, E2, BA, 75, 49, 35, A5, 20),
+		  BYTES_TO_WORDS_8(4A, 05, DC, 40, 30, E7, 70, B5),
+		  BYTES_TO_WORDS_8(00, 1B, 5D, C8, 61, F6, 33, CB),
+		  BYTES_TO_WORDS_8(9C, CC, 55, 58, 7A, BB, C9, A7),
+		  BYTES_TO_WORDS_8(BD, CF, C0, B5, 69, 37, 8C, 02),
+		  BYTES_TO_WORDS_8(7F, E7, 71, 8F, 63, A2, D8, DC) },
+		{ BYTES_TO_WORDS_8(09, 75, 9A, 58, 94, EB, 40, 9E),
+		  BYTES_TO_WORDS_8(54, 80, FA, 41, 96, 0B, 27, E1),
+		  BYTES_TO_WORDS_8(0D, F2, C7, 75, 3E, 1A, A1, 04),
+		  BYTES_TO_WORDS_8(3B, 94, AB, CB, 23, 43, D9, 44),
+		  BYTES_TO_WORDS_8(34, 72, 43, 60, 9B, 2B, 0A, E2),
+		  BYTES_TO_WORDS_8(26, D1, 4D, F1, FD, E1, 93, 6F),
+		  BYTES_TO_WORDS_8(58, 93, 7B, 27, CD, 3B, 42, 03),
+		  BYTES_TO_WORDS_8(0A, 1F, 40, 08, 80, B3, C5, B2) }
+	},
+	{ /* (2j + 1) * 16^4 * G */
+		{ BYTES_TO_WORDS_8(C4, E3, AD, 6E, 5C, 46, E8, 03),
+		  BYTES_TO_WORDS_8(05, 2A, 05, C9, 49, B7, 4A, 71),
+		  BYTES_TO_WORDS_8(B4, 86, E5, 40, 33, 64, 5C, 8E),
+		  BYTES_TO_WORDS_8(0D, E9, 91, 4E, 6F, 36, 18, A0),
+		  BYTES_TO_WORDS_8(D0, E8, 26, 6B, 02, 42, 5C, F4),
+		  BYTES_TO_WORDS_8(37, 4F, 61, 44, 4E, 28, F7, D5),
+		  BYTES_TO_WORDS_8(69, 83, 9D, 34, 78, E5, 6C, 7C),
+		  BYTES_TO_WORDS_8(16, 0B, 11, 14, 17, EC, BB, E2) },
+		{ BYTES_TO_WORDS_8(06, AF, E0, 59, AC, DE, 1C, 6E),
+		  BYTES_TO_WORDS_8(8D, 95, ED, 62, A5, 98, F3, 92),
+		  BYTES_TO_WORDS_8(5C, 05, 45, 6D, 5A, 3B, BD, 50),
+		  BYTES_TO_WORDS_8(64, 89, 8D, B8, 00, 1F, DF, 9C),
+		  BYTES_TO_WORDS_8(E7, AD, 16, 62, DB, 32, 7A, 8D),
+		  BYTES_TO_WORDS_8(46, A5, 7C, 19, DC, 22, 85, 82),
+		  BYTES_TO_WORDS_8(B0, 94, 8D, DC, BC, 8B, 95, 4D),
+		  BYTES_TO_WORDS_8(66, AD, F2, D3, FE, 25, 6D, 91) },
+		{ BYTES_TO_WORDS_8(7E, 09, 05, 93, 93, 2B, 37, 81),
+		  BYTES_TO_WORDS_8(19, A5, 3B, 84, 0E, 17, D6, 38),
+		  BYTES_TO_WORDS_8(83, 44, 40, 05, 2D, 1B, 6B, AB),
+		  BYTES_TO_WORDS_8(ED, 63, A6, D1, D5, D9, BF, 45),
+		  BYTES_TO_WORDS_8(04, DC, 8D, 90, 8E, 05, BA, 54),
+		  BYTES_TO_WORDS_8(59, C1, D2, BF, 33, 9D, 3B, 68),
+		  BYTES_TO_WORDS_8(08, E9, 0C, 47, 05, 83, D8, BA),
+		  BYTES_TO_WORDS_8(2B, FD, 5A, 85, 12, DC, D1, 09) },
+		{ BYTES_TO_WORDS_8(DF, D6, 3B, B6, A0, F1, 31, CD),
+		  BYTES_TO_WORDS_8(C3, AE, 66, DD, C2, 23, FC, D1),
+		  BYTES_TO_WORDS_8(6F, 5E, 89, 02, 9C, 9F, 1E, 67),
+		  BYTES_TO_WORDS_8(3B, 69, 76, 64, 15, AD, 99, B5),
+		  BYTES_TO_WORDS_8(AC, 09, FA, 8E, A3, CE, A1, 8E),
+		  BYTES_TO_WORDS_8(45, 4B, 13, 91, F6, C4, 40, 6A),
+		  BYTES_TO_WORDS_8(16, C4, 23, 8B, 0B, 36, 37, 46),
+		  BYTES_TO_WORDS_8(32, B3, FA, C4, DE, D1, 79, 69) },
+		{ BYTES_TO_WORDS_8(62, 2D, 14, 27, F3, 13, 86, AF),
+		  BYTES_TO_WORDS_8(6D, C2, 3B, F8, 35, 6A, 9A, 1D),
+		  BYTES_TO_WORDS_8(C1, 54, E8, 27, 12, 2B, 66, 92),
+		  BYTES_TO_WORDS_8(0E, AC, 32, 67, F1, A1, DC, F4),
+		  BYTES_TO_WORDS_8(C9, 8F, 61, 7A, C0, CC, 9E, AC),
+		  BYTES_TO_WORDS_8(7F, 3D, CD, FD, CE, 9A, 97, BB),
+		  BYTES_TO_WORDS_8(59, C6, AB, 91, 1B, 38, 9F, D4),
+		  BYTES_TO_WORDS_8(46, CD, B4, B4, E5, 67, 11, 55) },
+		{ BYTES_TO_WORDS_8(61, AE, 5F, 61, F4, 1F, CB, 1E),
+		  BYTES_TO_WORDS_8(82, 5F, 39, 4F, DC, C7, 15, 7F),
+		  BYTES_TO_WORDS_8(5A, BB, 16, E7, 40, E2, C4, D9),
+		  BYTES_TO_WORDS_8(66, 9B, E0, E6, A0, 78, 72, F0),
+		  BYTES_TO_WORDS_8(F9, 76, 63, 89, 74, CB, D0, F7),
+		  BYTES_TO_WORDS_8(BC, EA, 37, B8, 15, 07, 27, 2C),
+		  BYTES_TO_WORDS_8(D4, F7, 98, 18, 82, A0, D7, F7),
+		  BYTES_TO_WORDS_8(A5, 1E, A7, 14, 2B, 1B, 68, 1A) },
+		{ BYTES_TO_WORDS_8(1F, 59, 66, 24, 15, 04, 4E, 0C),
+		  BYTES_TO_WORDS_8(6A, 8D, C6, FF, A8, 2E, 17, BE),
+		  BYTES_TO_WORDS_8(CC, 58, A8, 3B, 53, AB, 43, F1),
+		  BYTES_TO_WORDS_8(B0, 0D, 0A, AF, 57, 24, C5, 1F),
+		  BYTES_TO_WORDS_8(DB, 8C, 6F, 39, 57, EF, EF, 44),
+		  BYTES_TO_WORDS_8(22, 78, EC, 32, C2, CA, F8, 29),
+		  BYTES_TO_WORDS_8(16, 4E, 43, 5B, FE, 76, EC, E9),
+		  BYTES_TO_WORDS_8(11, BC, 9E, 08, 38, 18, 9C, 48) },
+		{ BYTES_TO_WORDS_8(BC, 8E, 2A, 32, 8C, 0B, 5D, 12),
+		  BYTES_TO_WORDS_8(15, 67, F9, 18, B7, CD, 91, A2),
+		  BYTES_TO_WORDS_8(D5, 56, CA, 30, 5B, 0B, 7F, FD),
+		  BYTES_TO_WORDS_8(F4, C5, 48, 1A, B3, 01, 25, FA),
+		  BYTES_TO_WORDS_8(5B, 77, 8A, AA, B5, 27, D9, 80),
+		  BYTES_TO_WORDS_8(31, 83, BC, 6C, 8E, E0, 58, EA),
+		  BYTES_TO_WORDS_8(CB, A8, 6F, 1A, 66, 1E, 85, 33),
+		  BYTES_TO_WORDS_8(62, 89, 85, 4F, B1, 32, C9, 71) }
+	},
+	{ /* (2j + 1) * 16^5 * G */
+		{ BYTES_TO_WORDS_8(F1, DF, 96, 7D, CB, CE, 7D, 8F),
+		  BYTES_TO_WORDS_8(FE, FC, D5, AA, C1, 31, E4, 30),
+		  BYTES_TO_WORDS_8(D5, 98, CD, 70, B5, A0, F6, FE),
+		  BYTES_TO_WORDS_8(4F, E5, 1F, 14, 85, 38, C7, 0E),
+		  BYTES_TO_WORDS_8(2C, 55, 7B, 7C, AC, 41, C8, 9E),
+		  BYTES_TO_WORDS_8(AA, 78, ED, 87, CE, 64, 52, 1D),
+		  BYTES_TO_WORDS_8(51, 52, 06, 58, EF, C4, AC, 91),
+		  BYTES_TO_WORDS_8(5D, 87, AE, 87, 4E, 4F, 22, D6) },
+		{ BYTES_TO_WORDS_8(E9, 58, 8D, 08, AB, 24, C3, 51),
+		  BYTES_TO_WORDS_8(38, 18, E3, 64, 1C, 5C, 4A, E9),
+		  BYTES_TO_WORDS_8(B6, A7, 42, 7C, 6A, A4, 92, E9),
+		  BYTES_TO_WORDS_8(86, 4A, 06, C7, FD, C3, DA, 96),
+		  BYTES_TO_WORDS_8(5E, BC, BE, AE, 12, 93, 34, 80),
+		  BYTES_TO_WORDS_8(E3, E6, 87, 94, 9B, E8, 5B, 68),
+		  BYTES_TO_WORDS_8(39, C4, 82, 93, 94, C4, 6C, 85),
+		  BYTES_TO_WORDS_8(AD, C1, 46, AD, F3, AF, 1F, CB) },
+		{ BYTES_TO_WORDS_8(92, 9F, B2, 2D, 13, AD, 52, 89),
+		  BYTES_TO_WORDS_8(C5, B2, 47, B9, 71, D2, 21, 1D),
+		  BYTES_TO_WORDS_8(81, 8F, EB, 8A, 37, DC, 05, A1),
+		  BYTES_TO_WORDS_8(12, F3, 14, EB, 3C, B2, 97, E2),
+		  BYTES_TO_WORDS_8(DB, 8D, E5, A5, C8, 94, F2, 60),
+		  BYTES_TO_WORDS_8(41, 41, ED, 85, BB, CE, 23, 12),
+		  BYTES_TO_WORDS_8(49, 91, CD, B8, AB, DB, 80, B4),
+		  BYTES_TO_WORDS_8(B4, 70, CB, F8, 20, 25, 37, E1) },
+		{ BYTES_TO_WORDS_8(33, 8C, D8, 8A, 7B, 3B, 94, FD),
+		  BYTES_TO_WORDS_8(CA, 6B, 74, D9, 94, E3, 1A, D9),
+		  BYTES_TO_WORDS_8(97, DA, 24, 0D, 92, BC, 06, 6B),
+		  BYTES_TO_WORDS_8(B6, 94, 2B, FB, 38, 23, D2, 1C),
+		  BYTES_TO_WORDS_8(B2, B1, 8F, 24, 84, A7, 8E, 62),
+		  BYTES_TO_WORDS_8(49, 1E, CA, 5E, 31, 51, FE, 13),
+		  BYTES_TO_WORDS_8(27, BC, 36, B1, 0A, 64, C8, 96),
+		  BYTES_TO_WORDS_8(B0, 48, AB, 38, F8, CD, 3A, FC) },
+		{ BYTES_TO_WORDS_8(73, AA, 26, 3B, 9C, C8, 3A, F5),
+		  BYTES_TO_WORDS_8(E0, A0, 63, 0C, 1B, E1, F7, CD),
+		  BYTES_TO_WORDS_8(E0, 1E, FB, DF, 30, AD, 1C, CB),
+		  BYTES_TO_WORDS_8(BF, FB, E9, B9, AD, D7, 62, F4),
+		  BYTES_TO_WORDS_8(73, 9E, 47, 78, 17, AC, 5E, 24),
+		  BYTES_TO_WORDS_8(CA, 2C, 50, 00, A3, E0, E8, 49),
+		  BYTES_TO_WORDS_8(7A, 3C, 73, 68, 4A, BA, 53, 0D),
+		  BYTES_TO_WORDS_8(14, 53, 34, 78, 1A, 0D, 6A, 40) },
+		{ BYTES_TO_WORDS_8(E3, 15, D0, BC, 2A, E0, E1, 3E),
+		  BYTES_TO_WORDS_8(27, 02, 65, 7E, 59, E9, 90, AF),
+		  BYTES_TO_WORDS_8(68, 51, 89, CA, B3, BE, BD, 75),
+		  BYTES_TO_WORDS_8(AF, 0C, F7, D3, 25, 89, F6, E0),
+		  BYTES_TO_WORDS_8(CE, 7C, 15, D2, 42, 4D, A2, DA),
+		  BYTES_TO_WORDS_8(BB, 36, 29, 1E, 39, B5, B8, 55),
+		  BYTES_TO_WORDS_8(7C, C7, 74, 72, 6C, 69, 62, 53),
+		  BYTES_TO_WORDS_8(A9, 3A, 48, 0E, 31, 1E, 53, 08) },
+		{ BYTES_TO_WORDS_8(12, 6B, B7, 4B, 11, 43, 6C, 1E),
+		  BYTES_TO_WORDS_8(69, 27, 19, 3E, 77, 76, 8E, EA),
+		  BYTES_TO_WORDS_8(00, 5A, F7, 2A, 31, 2B, D8, C1),
+		  BYTES_TO_WORDS_8(7F, F5, 2B, 55, C1, AD, E4, 28),
+		  BYTES_TO_WORDS_8(BD, 47, 47, EC, A7, 53, E4, 57),
+		  BYTES_TO_WORDS_8(FF, 28, 16, 17, 0F, A6, A0, 03),
+		  BYTES_TO_WORDS_8(F7, A3, 9E, 6B, 5B, B6, E4, F4),
+		  BYTES_TO_WORDS_8(B3, 01, 9A, FD, 4E, 4C, D7, 14) },
+		{ BYTES_TO_WORDS_8(97, F6, 6F, E7, 1F, 80, F5, 8B),
+		  BYTES_TO_WORDS_8(62, 64, 07, 52, 86, 68, 9B, 36),
+		  BYTES_TO_WORDS_8(C6, 97, A0, B3, AB, ED, 71, D2),
+		  BYTES_TO_WORDS_8(5E, 80, BA, 94, 27, BA, A0, 85),
+		  BYTES_TO_WORDS_8(21, 27, 14, 52, DA, D4, 9E, 30),
+		  BYTES_TO_WORDS_8(B9, 58, 0A, 79, FA, 7F, E9, 1D),
+		  BYTES_TO_WORDS_8(55, AA, ED, DC, D3, 90, 47, 55),
+		  BYTES_TO_WORDS_8(4A, E2, C3, EA, 61, 2E, F3, AD) }
+	},
+	{ /* (2j + 1) * 16^6 * G */
+		{ BYTES_TO_WORDS_8(05, D8, 92, E3, DC, C5, 25, 37),
+		  BYTES_TO_WORDS_8(D4, 05, 54, 87, 69, 80, 7A, A8),
+		  BYTES_TO_WORDS_8(9A, 44, A3, FA, AA, 4D, A5, A4),
+		  BYTES_TO_WORDS_8(D7, 93, 6A, 4C, CF, DC, F5, F8),
+		  BYTES_TO_WORDS_8(FA, 02, DA, 6C, 51, 19, 66, 02),
+		  BYTES_TO_WORDS_8(BA, 43, 21, A5, 64, DA, F3, 51),
+		  BYTES_TO_WORDS_8(73, 32, 61, 64, 33, 3E, 9D, 38),
+		  BYTES_TO_WORDS_8(54, 30, D6, 66, CF, 76, 81, E5) },
+		{ BYTES_TO_WORDS_8(F7, 46, A0, 7F, 16, B3, D4, 19),
+		  BYTES_TO_WORDS_8(9D, 30, 07, 02, 39, 0F, 11, 17),
+		  BYTES_TO_WORDS_8(45, 2D, 6E, 94, C8, 4A, 08, 4E),
+		  BYTES_TO_WORDS_8(A9, 83, 58, 86, 4A, 8E, 2C, E1),
+		  BYTES_TO_WORDS_8(AD, 46, 26, A1, 28, 5A, A5, 53),
+		  BYTES_TO_WORDS_8(34, 19, 31, 13, E1, 04, 0C, DD),
+		  BYTES_TO_WORDS_8(F6, 26, 31, 39, D5, 3E, 3B, 43),
+		  BYTES_TO_WORDS_8(F3, A2, D9, 0F, 61, 04, EC, 7C) },
+		{ BYTES_TO_WORDS_8(43, 3C, 85, C2, E8, 27, B1, B9),
+		  BYTES_TO_WORDS_8(66, E4, 22, AE, 57, 6C, 16, 48),
+		  BYTES_TO_WORDS_8(36, 32, D1, E3, EF, E2, 08, 3D),
+		  BYTES_TO_WORDS_8(09, 92, 96, 17, 74, D4, 4B, 39),
+		  BYTES_TO_WORDS_8(9D, 46, 64, A0, CC, 28, 78, B1),
+		  BYTES_TO_WORDS_8(0C, CF, 0F, D9, 12, 67, 2F, D5),
+		  BYTES_TO_WORDS_8(67, 07, D6, F1, C2, 3F, 7E, 20),
+		  BYTES_TO_WORDS_8(B9, C6, 1D, 15, 52, 6D, 4D, 2B) },
+		{ BYTES_TO_WORDS_8(94, 2E, 72, FC, 39, D7, 2D, EC),
+		  BYTES_TO_WORDS_8(61, 89, 05, 6D, 39, 10, D8, 4E),
+		  BYTES_TO_WORDS_8(33, 04, 94, C5, 56, 66, 5C, 44),
+		  BYTES_TO_WORDS_8(E9, 82, DE, 38, DF, 38, 85, CA),
+		  BYTES_TO_WORDS_8(27, A5, 49, 10, DF, 62, 0A, 3A),
+		  BYTES_TO_WORDS_8(A4, 26, 8B, A4, A8, 53, 09, F2),
+		  BYTES_TO_WORDS_8(12, 9F, FB, A1, 26, 31, E7, 11),
+		  BYTES_TO_WORDS_8(C3, 05, 9E, EB, 42, FC, 27, 3B) },
+		{ BYTES_TO_WORDS_8(09, 63, AD, DC, 29, 46, 17, 87),
+		  BYTES_TO_WORDS_8(48, FF, 39, F2, C2, 1F, 1A, D3),
+		  BYTES_TO_WORDS_8(3D, 7B, A6, 4C, 62, 74, BB, A1),
+		  BYTES_TO_WORDS_8(75, 7B, 35, F2, 59, 1A, 3E, 66),
+		  BYTES_TO_WORDS_8(28, 1F, 98, 89, A3, 6B, 28, 53),
+		  BYTES_TO_WORDS_8(BD, 52, EB, 02, 44, D4, 07, B9),
+		  BYTES_TO_WORDS_8(18, F9, 1C, CB, 83, C1, 02, C1),
+		  BYTES_TO_WORDS_8(C3, A8, 66, 80, 3B, B7, 2F, 29) },
+		{ BYTES_TO_WORDS_8(03, 3D, C2, 22, 45, B2, 75, 92),
+		  BYTES_TO_WORDS_8(24, FF, C7, 8F, 4D, B0, A1, 3B),
+		  BYTES_TO_WORDS_8(AB, EE, 7B, 70, 23, 6C, C3, 96),
+		  BYTES_TO_WORDS_8(70, 66, 63, 30, E7, EF, D9, A2),
+		  BYTES_TO_WORDS_8(74, DB, 85, F0, 04, 4C, 2E, 10),
+		  BYTES_TO_WORDS_8(45, DF, 39, 58, E9, A7, 09, EA),
+		  BYTES_TO_WORDS_8(92, 1B, 10, C7, 36, 04, 53, 15),
+		  BYTES_TO_WORDS_8(8F, 1B, 84, CC, 28, 52, C8, 1C) },
+		{ BYTES_TO_WORDS_8(D1, C6, D4, 07, 67, F9, 55, 17),
+		  BYTES_TO_WORDS_8(FB, FF, D9, 9A, 51, CD, 62, F6),
+		  BYTES_TO_WORDS_8(D0, 35, 3F, 27, B5, 10, B9, E0),
+		  BYTES_TO_WORDS_8(EF, A9, B1, 48, 2B, E1, 57, 56),
+		  BYTES_TO_WORDS_8(EC, BD, 06, 81, 29, 3F, 30, 88),
+		  BYTES_TO_WORDS_8(41, C1, 52, 14, 5A, A3, F9, BF),
+		  BYTES_TO_WORDS_8(0A, 6A, AE, 33, 0F, 39, FB, AC),
+		  BYTES_TO_WORDS_8(F9, 49, DD, B8, F4, BE, B5, 72) },
+		{ BYTES_TO_WORDS_8(4A, 56, 33, 59, D5, 4D, 65, F8),
+		  BYTES_TO_WORDS_8(44, AF, E3, ED, FA, B4, 68, 7A),
+		  BYTES_TO_WORDS_8(2B, 8D, 6D, 67, C6, ED, 64, 08),
+		  BYTES_TO_WORDS_8(01, E0, 0A, D4, 15, 62, 68, 5B),
+		  BYTES_TO_WORDS_8(63, EF, 04, 82, 58, 04, 5F, 3B),
+		  BYTES_TO_WORDS_8(9F, 86, 78, 88, 22, EE, 2A, 39),
+		  BYTES_TO_WORDS_8(DE, 95, 9D, D1, 54, 0C, D3, 52),
+		  BYTES_TO_WORDS_8(45, 26, 3A, CF, 69, EA, B5, 76) }
+	},
+	{ /* (2j + 1) * 16^7 * G */
+		{ BYTES_TO_WORDS_8(BD, 2D, 92, 6F, 17, 23, 4A, 98),
+		  BYTES_TO_WORDS_8(8F, 21, 99, 1F, 16, 31, A6, 1C),
+		  BYTES_TO_WORDS_8(B9, 71, 4D, 8E, AD, EA, 85, 3F),
+		  BYTES_TO_WORDS_8(31, AF, 4D, FD, BF, B6, 28, 6D),
+		  BYTES_TO_WORDS_8(FF, 3C, EF, A0, 02, FF, AB, 44),
+		  BYTES_TO_WORDS_8(99, A2, 4D, B8, F0, E9, 24, 4C),
+		  BYTES_TO_WORDS_8(1C, 4A, CB, 1C, A6, E1, FB, 40),
+		  BYTES_TO_WORDS_8(FA, D2, 1D, 14, 05, D9, 39, AF) },
+		{ BYTES_TO_WORDS_8(64, 8B, 16, 9B, F9, DF, 90, B5),
+		  BYTES_TO_WORDS_8(40, C8, 86, C5, 2A, D0, 53, A1),
+		  BYTES_TO_WORDS_8(7E, 46, 14, FC, 05, 09, DF, D3),
+		  BYTES_TO_WORDS_8(DD, E3, BF, 7F, 7A, 15, D3, 7C),
+		  BYTES_TO_WORDS_8(6B, B1, BB, 5A, 2B, 0D, 6C, 85),
+		  BYTES_TO_WORDS_8(35, 2E, E0, 72, 9B, 4D, AC, 13),
+		  BYTES_TO_WORDS_8(FB, FA, DB, BC, 78, 8E, 56, 20),
+		  BYTES_TO_WORDS_8(62, 2C, 29, 17, 21, 8D, A0, 9C) },
+		{ BYTES_TO_WORDS_8(E8, 29, EF, 06, FA, C6, B1, B2),
+		  BYTES_TO_WORDS_8(E3, AE, D9, 09, 4B, 55, DC, 64),
+		  BYTES_TO_WORDS_8(62, 35, 45, 9D, 19, 43, B2, 56),
+		  BYTES_TO_WORDS_8(C4, F8, 2D, 5F, DB, 0B, 86, ED),
+		  BYTES_TO_WORDS_8(8F, 0F, B9, B9, 49, 1C, 1A, 50),
+		  BYTES_TO_WORDS_8(33, AA, 8D, 2D, 5C, 0F, 63, E7),
+		  BYTES_TO_WORDS_8(B1, 7B, 41, 40, B3, F6, 6B, 7C),
+		  BYTES_TO_WORDS_8(FD, A7, D5, 75, 43, E7, 37, B8) },
+		{ BYTES_TO_WORDS_8(17, E6, 36, F6, B3, 18, F9, 9D),
+		  BYTES_TO_WORDS_8(59, CF, F1, C1, 3B, D0, DC, 47),
+		  BYTES_TO_WORDS_8(9D, 2C, 27, 7E, 2E, 1C, 5E, 73),
+		  BYTES_TO_WORDS_8(43, 12, D2, D1, 8F, CC, 68, 68),
+		  BYTES_TO_WORDS_8(27, 3D, BB, FC, F3, DC, 8D, 1C),
+		  BYTES_TO_WORDS_8(D7, 4C, 38, A4, C8, 30, FE, 60),
+		  BYTES_TO_WORDS_8(0A, 3F, 31, 79, 38, 90, C5, B3),
+		  BYTES_TO_WORDS_8(E6, F9, 1B, B9, A5, 08, D0, EE) },
+		{ BYTES_TO_WORDS_8(34, 2A, 3E, 11, A6, A2, 9D, C7),
+		  BYTES_TO_WORDS_8(E2, 11, 3A, CE, 65, 2E, 1D, 29),
+		  BYTES_TO_WORDS_8(18, D3, AF, 10, 9F, B4, 5C, 2C),
+		  BYTES_TO_WORDS_8(20, FE, C8, EA, 60, B3, 03, EC),
+		  BYTES_TO_WORDS_8(D6, 66, 45, B8, EE, 43, 22, A4),
+		  BYTES_TO_WORDS_8(B7, 36, A1, 65, 6E, 15, A8, 8A),
+		  BYTES_TO_WORDS_8(72, 22, 21, 01, 21, DE, EF, 7B),
+		  BYTES_TO_WORDS_8(43, 58, A0, 60, FB, 0F, 02, 86) },
+		{ BYTES_TO_WORDS_8(18, 1B, 7C, C8, E5, 0C, AE, 5E),
+		  BYTES_TO_WORDS_8(A2, 91, 49, 48, B5, 2C, 1E, 10),
+		  BYTES_TO_WORDS_8(FA, 56, 10, 59, 5A, 03, A3, E6),
+		  BYTES_TO_WORDS_8(0D, B9, 78, 9E, A3, 64, 94, A7),
+		  BYTES_TO_WORDS_8(9A, 80, 94, 7B, 09, 85, B5, BE),
+		  BYTES_TO_WORDS_8(21, 28, 56, 71, 9C, DE, 98, 0D),
+		  BYTES_TO_WORDS_8(F6, 89, 9A, 9E, 87, 57, 9A, 24),
+		  BYTES_TO_WORDS_8(CC, 58, 28, F7, E3, F4, 61, 13) },
+		{ BYTES_TO_WORDS_8(26, 0D, D1, DE, C6, 28, 4E, 59),
+		  BYTES_TO_WORDS_8(F6, 95, E5, 29, F8, BE, 9A, 5A),
+		  BYTES_TO_WORDS_8(CC, 0C, F3, 94, B6, 1F, E9, 90),
+		  BYTES_TO_WORDS_8(C7, BC, 8F, AA, 80, F2, 4E, 54),
+		  BYTES_TO_WORDS_8(C2, FC, DA, 76, 72, 4F, C2, 2F),
+		  BYTES_TO_WORDS_8(AE, 06, 2C, 6E, 97, 6F, 3D, 68),
+		  BYTES_TO_WORDS_8(D3, 70, 8D, 8D, FE, 1D, 6B, 9D),
+		  BYTES_TO_WORDS_8(CE, C2, 5A, C4, 9D, 1C, B9, 95) },
+		{ BYTES_TO_WORDS_8(E6, 18, AD, B7, F8, 79, 94, 24),
+		  BYTES_TO_WORDS_8(5E, AD, 3C, 8D, 79, 3E, AD, 57),
+		  BYTES_TO_WORDS_8(9B, FF, 4A, 6B, 84, 3C, E5, 4D),
+		  BYTES_TO_WORDS_8(21, C6, 34, 5F, 88, 6C, C2, E2),
+		  BYTES_TO_WORDS_8(AD, CF, 54, A5, 1A, E5, AF, AD),
+		  BYTES_TO_WORDS_8(E4, 1D, 98, 71, CA, 15, C5, 3B),
+		  BYTES_TO_WORDS_8(11, BA, 17, A1, 6E, 26, CE, 51),
+		  BYTES_TO_WORDS_8(88, 81, 48, 4F, 28, 1B, 12, B2) }
+	},
+	{ /* (2j + 1) * 16^8 * G */
+		{ BYTES_TO_WORDS_8(43, 59, 5A, 18, 22, 9E, 5A, 3A),
+		  BYTES_TO_WORDS_8(B6, DF, 65, 5C, 36, 19, B9, 1A),
+		  BYTES_TO_WORDS_8(DA, 71, 2C, 26, 32, 6B, 65, 21),
+		  BYTES_TO_WORDS_8(89, AF, 22, AF, 40, 6B, E3, 7F),
+		  BYTES_TO_WORDS_8(01, A1, 9C, 69, 2C, 15, 0D, D5),
+		  BYTES_TO_WORDS_8(12, F2, 8A, 7B, 86, D5, B3, 74),
+		  BYTES_TO_WORDS_8(F1, A6, DC, 07, 04, F4, 09, 9F),
+		  BYTES_TO_WORDS_8(24, 36, B6, 25, 58, D4, 97, E6) },
+		{ BYTES_TO_WORDS_8(A8, 22, 09, DF, 91, 80, A7, 76),
+		  BYTES_TO_WORDS_8(D9, F8, 5C, 54, D2, E9, 90, 8E),
+		  BYTES_TO_WORDS_8(80, 8B, 2F, 02, 56, 4E, 92, 80),
+		  BYTES_TO_WORDS_8(73, 2D, 4E, 5B, 40, 6A, 65, 4B),
+		  BYTES_TO_WORDS_8(BB, 80, 9A, 99, C5, CA, AD, 4D),
+		  BYTES_TO_WORDS_8(69, 0F, 85, B9, E2, B9, 73, D4),
+		  BYTES_TO_WORDS_8(D6, C4, D8, 55, C2, 4C, D0, 20),
+		  BYTES_TO_WORDS_8(39, 78, E7, 12, 1D, A3, 1E, EE) },
+		{ BYTES_TO_WORDS_8(9E, 7E, D0, 69, 88, F8, 04, B5),
+		  BYTES_TO_WORDS_8(36, 0C, A6, F6, A1, 7C, 9E, A0),
+		  BYTES_TO_WORDS_8(5E, 8E, 3D, FB, E0, 2B, DB, 93),
+		  BYTES_TO_WORDS_8(3D, E1, 65, BD, 6E, 95, 78, 9D),
+		  BYTES_TO_WORDS_8(EE, C8, D8, C3, 5A, 61, DD, F4),
+		  BYTES_TO_WORDS_8(B2, C7, 94, 3B, DA, A2, 60, 74),
+		  BYTES_TO_WORDS_8(CE, 10, 32, 1D, 9C, A8, 42, 65),
+		  BYTES_TO_WORDS_8(CD, A8, 8E, F4, 6E, 9E, 14, D5) },
+		{ BYTES_TO_WORDS_8(0F, 95, C4, 7D, 86, 50, 77, 66),
+		  BYTES_TO_WORDS_8(07, 42, 39, BD, AD, B2, 41, 57),
+		  BYTES_TO_WORDS_8(16, 63, DB, E4, 46, 68, 23, 57),
+		  BYTES_TO_WORDS_8(A9, 3F, 35, E1, 72, 12, CB, 4A),
+		  BYTES_TO_WORDS_8(DF, B4, D8, 63, 44, E4, C6, 66),
+		  BYTES_TO_WORDS_8(C5, 6A, 86, B5, 80, 42, 9E, DF),
+		  BYTES_TO_WORDS_8(9F, E2, 71, CC, F6, 98, F2, 8C),
+		  BYTES_TO_WORDS_8(AD, CD, 43, B7, 0F, D2, 6C, 72) },
+		{ BYTES_TO_WORDS_8(BD, 8C, 7E, ED, 7B, 7A, 0C, F4),
+		  BYTES_TO_WORDS_8(16, D8, 07, F0, 8A, 7F, 66, 2A),
+		  BYTES_TO_WORDS_8(4A, 46, 81, 0C, 55, 53, 44, 23),
+		  BYTES_TO_WORDS_8(B4, 17, 6B, 1A, BF, 5E, 0C, 64),
+		  BYTES_TO_WORDS_8(DB, A5, C5, BE, 3C, 90, E2, 06),
+		  BYTES_TO_WORDS_8(02, 9B, FF, 8C, B1, 9F, 06, BA),
+		  BYTES_TO_WORDS_8(9E, AB, 1E, 70, EB, C6, E9, 2A),
+		  BYTES_TO_WORDS_8(2F, FD, 9C, 82, FD, 88, AE, D6) },
+		{ BYTES_TO_WORDS_8(DC, BD, 86, 7E, B0, 04, 0A, F7),
+		  BYTES_TO_WORDS_8(D5, E3, 5C, 97, 97, 6B, D2, F1),
+		  BYTES_TO_WORDS_8(9B, 6B, DB, 0D, C9, 62, 15, 45),
+		  BYTES_TO_WORDS_8(32, 4B, 28, B4, B1, 04, BA, 8B),
+		  BYTES_TO_WORDS_8(C4, 49, E3, E9, A1, C5, 23, 52),
+		  BYTES_TO_WORDS_8(5F, 6E, 19, F4, E4, FD, AC, C6),
+		  BYTES_TO_WORDS_8(7A, 43, 99, 66, 21, F9, 9B, 65),
+		  BYTES_TO_WORDS_8(BF, 8E, 20, 9C, C0, 99, 40, C3) },
+		{ BYTES_TO_WORDS_8(82, F5, 57, 42, 80, E7, 70, D1),
+		  BYTES_TO_WORDS_8(58, A2, C3, DE, EA, 09, 99, 1F),
+		  BYTES_TO_WORDS_8(E4, 5F, 5A, 7C, 3F, 94, A6, 10),
+		  BYTES_TO_WORDS_8(E2, 37, CD, FE, 44, 57, 0A, 8B),
+		  BYTES_TO_WORDS_8(4B, 2D, 37, 37, DF, FE, 17, 48),
+		  BYTES_TO_WORDS_8(66, 07, 16, 7B, BA, 46, DB, 56),
+		  BYTES_TO_WORDS_8(46, 7D, E3, 37, A1, 15, 2A, 66),
+		  BYTES_TO_WORDS_8(39, C7, D6, C0, 4E, A4, 57, 9E) },
+		{ BYTES_TO_WORDS_8(7E, 79, 5E, 98, F9, 49, 14, 3F),
+		  BYTES_TO_WORDS_8(68, 31, 3C, 2E, 4F, 22, 6E, F0),
+		  BYTES_TO_WORDS_8(A6, 78, 96, 3D, 49, 6F, 85, 1F),
+		  BYTES_TO_WORDS_8(97, 78, 64, C2, 97, FF, 13, 0A),
+		  BYTES_TO_WORDS_8(6F, 66, 9D, 53, 9F, AB, 27, 83),
+		  BYTES_TO_WORDS_8(92, C3, 80, 75, 0A, 6F, 7F, F2),
+		  BYTES_TO_WORDS_8(3F, DC, A1, 8F, 8E, 81, 7D, 91),
+		  BYTES_TO_WORDS_8(D5, 83, 5C, 22, 4B, 96, 1A, EB) }
+	},
+	{ /* (2j + 1) * 16^9 * G */
+		{ BYTES_TO_WORDS_8(45, 34, DE, FD, E1, 4F, FF, 7A),
+		  BYTES_TO_WORDS_8(81, A7, AE, A2, DD, A9, BB, 76),
+		  BYTES_TO_WORDS_8(9E, 51, 26, FF, E7, 1F, 37, 85),
+		  BYTES_TO_WORDS_8(E6, 61, 70, 4D, 38, B6, 65, 69),
+		  BYTES_TO_WORDS_8(13, 51, 85, 18, 9E, 38, C4, 7C),
+		  BYTES_TO_WORDS_8(D9, 99, 5F, 1A, 05, E6, 7C, F4),
+		  BYTES_TO_WORDS_8(BE, 2D, 73, 38, 66, 49, 5E, 32),
+		  BYTES_TO_WORDS_8(11, 25, 48, 9C, E3, DA, BC, D1) },
+		{ BYTES_TO_WORDS_8(C5, CF, 8A, 88, 96, 0F, E4, F5),
+		  BYTES_TO_WORDS_8(89, 97, 68, 36, 9B, 58, EF, B1),
+		  BYTES_TO_WORDS_8(71, 1A, 09, D4, DB, 7D, 7E, 02),
+		  BYTES_TO_WORDS_8(DA, C7, 75, DE, 1D, C5, CB, E1),
+		  BYTES_TO_WORDS_8(25, A2, 49, A2, D5, FE, C5, 3B),
+		  BYTES_TO_WORDS_8(52, BA, BF, EE, 2B, 29, D3, E7),
+		  BYTES_TO_WORDS_8(3C, E2, B9, FD, 4F, 76, 12, B3),
+		  BYTES_TO_WORDS_8(ED, DA, E7, CD, 97, 83, 67, EC) },
+		{ BYTES_TO_WORDS_8(C6, CC, 07, E1, 3F, A5, 8E, 75),
+		  BYTES_TO_WORDS_8(28, 82, 3C, 54, E1, 97, 38, 1D),
+		  BYTES_TO_WORDS_8(48, 00, A9, 45, 28, 9D, 1E, 73),
+		  BYTES_TO_WORDS_8(A1, 8A, 13, 71, 79, 26, 3F, 9C),
+		  BYTES_TO_WORDS_8(52, 91, EA, 3D, CD, 94, 07, 84),
+		  BYTES_TO_WORDS_8(86, B1, F9, 95, 4E, FD, A8, 51),
+		  BYTES_TO_WORDS_8(CA, 6E, 3E, BF, F4, 75, E3, 8B),
+		  BYTES_TO_WORDS_8(9C, 1D, B5, 64, 1B, 0C, EE, DA) },
+		{ BYTES_TO_WORDS_8(E7, 49, A4, 95, 43, EB, C5, 21),
+		  BYTES_TO_WORDS_8(E4, 2B, 3C, E5, 34, A0, A2, 2F),
+		  BYTES_TO_WORDS_8(2B, 92, 40, B1, 17, AC, 6F, 79),
+		  BYTES_TO_WORDS_8(72, 2D, 6B, 7C, 57, D9, 30, 5C),
+		  BYTES_TO_WORDS_8(D0, 77, 26, AE, 81, A4, 0E, 77),
+		  BYTES_TO_WORDS_8(0E, 79, CE, C3, 53, 40, 5E, B7),
+		  BYTES_TO_WORDS_8(D0, 92, C5, 99, F7, 65, 4B, 16),
+		  BYTES_TO_WORDS_8(92, 1B, 8E, B0, B5, E3, 25, 80) },
+		{ BYTES_TO_WORDS_8(07, EB, 8C, 8B, 02, 8C, 55, FA),
+		  BYTES_TO_WORDS_8(1C, 27, EE, FF, 2B, 25, 79, 53),
+		  BYTES_TO_WORDS_8(95, D9, A8, 7E, B0, E2, E4, AF),
+		  BYTES_TO_WORDS_8(82, 96, 8E, 0C, 23, BF, 3B, AA),
+		  BYTES_TO_WORDS_8(84, 39, D8, 9F, 2E, 46, A8, 99),
+		  BYTES_TO_WORDS_8(EB, F9, B3, 7A, BC, B2, 71, 3B),
+		  BYTES_TO_WORDS_8(EC, 62, 91, 4C, FE, B0, DC, 44),
+		  BYTES_TO_WORDS_8(68, C2, 1E, 9C, B0, 0C, 32, E6) },
+		{ BYTES_TO_WORDS_8(F1, D1, BF, 83, 55, A5, 0E, E4),
+		  BYTES_TO_WORDS_8(32, 57, D6, 15, 35, DC, 36, 3A),
+		  BYTES_TO_WORDS_8(94, 01, 40, 91, C9, 0F, E6, 79),
+		  BYTES_TO_WORDS_8(81, 41, 33, 13, 51, 32, 4A, AB),
+		  BYTES_TO_WORDS_8(33, C2, E1, C8, 10, 96, 13, 21),
+		  BYTES_TO_WORDS_8(CF, 98, 9E, 27, 24, 93, 7D, A5),
+		  BYTES_TO_WORDS_8(57, E0, 2F, 41, D0, 3B, EB, B4),
+		  BYTES_TO_WORDS_8(68, 86, 6C, 03, BB, 64, 6C, EA) },
+		{ BYTES_TO_WORDS_8(3F, 6D, 1D, 0B, 78, 6D, 40, 08),
+		  BYTES_TO_WORDS_8(89, BB, EE, 4E, 8A, 66, 37, 5F),
+		  BYTES_TO_WORDS_8(10, A8, A5, D8, 5C, 7F, 33, F7),
+		  BYTES_TO_WORDS_8(77, 5D, ED, DD, 59, B2, A9, DB),
+		  BYTES_TO_WORDS_8(33, 81, CD, 89, 82, 92, 2E, C4),
+		  BYTES_TO_WORDS_8(3C, D9, 2B, 51, C4, 9B, BD, 48),
+		  BYTES_TO_WORDS_8(14, 87, EB, 4F, 4F, 99, CA, 5A),
+		  BYTES_TO_WORDS_8(7B, 5B, 53, 57, 3F, 2D, 86, B3) },
+		{ BYTES_TO_WORDS_8(6A, 2A, FA, 31, 80, 03, 9A, 67),
+		  BYTES_TO_WORDS_8(25, 4B, 0E, 5B, 58, 1D, FC, 34),
+		  BYTES_TO_WORDS_8(FE, CD, A3, B1, 42, D7, AD, 07),
+		  BYTES_TO_WORDS_8(45, 27, 98, 2E, C4, F4, 98, 19),
+		  BYTES_TO_WORDS_8(42, 51, 41, C6, 4B, DB, 7E, 60),
+		  BYTES_TO_WORDS_8(B5, 58, 72, 7B, 38, 02, 6C, 4C),
+		  BYTES_TO_WORDS_8(E9, A1, 78, 8B, 00, F8, 00, 97),
+		  BYTES_TO_WORDS_8(10, FA, 0A, 19, 6D, 41, BB, 2E) }
+	},
+	{ /* (2j + 1) * 16^10 * G */
+		{ BYTES_TO_WORDS_8(BD, EF, 9A, 4D, 6C, CA, 8F, 25),
+		  BYTES_TO_WORDS_8(75, 57, B9, 73, B2, 47, FE, 1E),
+		  BYTES_TO_WORDS_8(DC, 43, BC, 41, 0D, 9F, CA, 32),
+		  BYTES_TO_WORDS_8(76, 9D, 66, 8C, 1C, 34, BC, 0F),
+		  BYTES_TO_WORDS_8(A0, 1C, E7, D3, A9, 6E, 3B, ED),
+		  BYTES_TO_WORDS_8(F1, 9F, 0A, 20, 9E, 06, 0B, 95),
+		  BYTES_TO_WORDS_8(D3, D3, 57, 49, 1D, 4B, 01, E4),
+		  BYTES_TO_WORDS_8(3F, 0E, 36, 2F, 63, 22, 80, BD) },
+		{ BYTES_TO_WORDS_8(37, 48, 43, E9, FE, DF, 96, 87),
+		  BYTES_TO_WORDS_8(BB, C1, 20, 86, 0B, 14, B3, AD),
+		  BYTES_TO_WORDS_8(6D, B0, 4F, FB, 6F, 1C, 34, B1),
+		  BYTES_TO_WORDS_8(ED, 7A, A8, C4, AB, 18, 6D, D7),
+		  BYTES_TO_WORDS_8(4C, 5B, 21, BB, F9, 04, AA, 4F),
+		  BYTES_TO_WORDS_8(C2, CC, B7, 75, E7, 58, A4, 90),
+		  BYTES_TO_WORDS_8(32, 93, AB, F7, 14, 42, 0E, DE),
+		  BYTES_TO_WORDS_8(44, 66, D9, 2E, A3, 4D, BC, F6) },
+		{ BYTES_TO_WORDS_8(22, F2, 07, 9C, 21, 9F, E8, 02),
+		  BYTES_TO_WORDS_8(7D, FE, 60, AC, 63, 1C, E2, C5),
+		  BYTES_TO_WORDS_8(D1, 53, 17, 1F, 1A, 1D, 48, 4F),
+		  BYTES_TO_WORDS_8(60, FF, 67, 61, 50, C6, C0, D5),
+		  BYTES_TO_WORDS_8(57, FD, 6F, 0C, 1E, 69, EF, E2),
+		  BYTES_TO_WORDS_8(86, 3A, 81, 78, 1A, F5, F3, BA),
+		  BYTES_TO_WORDS_8(B9, 75, 9F, F4, 77, 0C, DE, 0C),
+		  BYTES_TO_WORDS_8(85, B8, 17, 08, 86, 0B, A3, 15) },
+		{ BYTES_TO_WORDS_8(A6, BF, 93, 4E, A2, 16, 47, 4A),
+		  BYTES_TO_WORDS_8(2A, 36, A1, 09, 5A, 29, 9D, D3),
+		  BYTES_TO_WORDS_8(E0, 9F, 4C, 6B, A6, CB, 49, E5),
+		  BYTES_TO_WORDS_8(2C, F6, 46, 4A, 4E, 36, 4C, 73),
+		  BYTES_TO_WORDS_8(74, 07, D1, 98, 99, A7, 6F, FC),
+		  BYTES_TO_WORDS_8(C4, 97, 02, 89, 20, 36, A1, EC),
+		  BYTES_TO_WORDS_8(48, 5F, 0C, 52, E3, 81, E9, 9D),
+		  BYTES_TO_WORDS_8(04, 9D, A7, AA, 03, 15, 95, 09) },
+		{ BYTES_TO_WORDS_8(AE, 94, A1, 5F, 7F, 51, EB, F0),
+		  BYTES_TO_WORDS_8(EC, 4A, 05, 9A, 1D, 29, 40, 06),
+		  BYTES_TO_WORDS_8(49, B1, 9E, 2A, 9D, 5D, 17, 01),
+		  BYTES_TO_WORDS_8(89, 6A, B6, 07, DA, D9, A3, 79),
+		  BYTES_TO_WORDS_8(4B, 63, CF, 9F, 9C, 5E, C6, 4F),
+		  BYTES_TO_WORDS_8(4D, BC, 79, 2F, F3, 25, D4, 6B),
+		  BYTES_TO_WORDS_8(D8, 03, AF, 58, B8, 71, 36, 4B),
+		  BYTES_TO_WORDS_8(B3, B1, 54, 72, CA, DB, E1, 84) },
+		{ BYTES_TO_WORDS_8(FE, B7, E8, 21, 00, 06, C9, 6A),
+		  BYTES_TO_WORDS_8(6A, B2, 85, 77, E1, E2, D0, 5D),
+		  BYTES_TO_WORDS_8(E0, 98, FC, DC, AA, 4C, 3E, 8A),
+		  BYTES_TO_WORDS_8(82, 05, 5B, 4D, 09, FD, 93, 33),
+		  BYTES_TO_WORDS_8(21, 68, 3C, 02, 42, 24, 14, 0C),
+		  BYTES_TO_WORDS_8(B7, 94, 9B, 8A, 0A, B3, 56, 8E),
+		  BYTES_TO_WORDS_8(8D, 66, 5A, 9C, ED, EA, AF, 2E),
+		  BYTES_TO_WORDS_8(B8, BE, 67, C8, BE, 37, 04, 13) },
+		{ BYTES_TO_WORDS_8(F6, 8C, 52, 61, D5, 79, 95, A0),
+		  BYTES_TO_WORDS_8(4E, 69, 50, F6, 0A, 25, A0, E6),
+		  BYTES_TO_WORDS_8(52, 0A, 5B, EE, 86, 45, 1B, 5E),
+		  BYTES_TO_WORDS_8(E1, 27, 46, 13, 86, 28, 6B, A1),
+		  BYTES_TO_WORDS_8(3B, 3F, E9, FC, F9, 20, B9, 80),
+		  BYTES_TO_WORDS_8(13, 80, CC, 13, C8, FB, 93, 34),
+		  BYTES_TO_WORDS_8(F4, 50, 11, D8, 79, ED, 3C, 91),
+		  BYTES_TO_WORDS_8(99, AD, 37, 85, AE, 98, 05, F4) },
+		{ BYTES_TO_WORDS_8(E0, B2, 8D, 8C, 6B, A6, 10, 35),
+		  BYTES_TO_WORDS_8(58, 73, 0D, 5F, C1, BD, 3C, 47),
+		  BYTES_TO_WORDS_8(F6, 74, 5A, A9, AB, 89, 6C, BF),
+		  BYTES_TO_WORDS_8(4C, 47, E3, 18, 20, CE, 17, D3),
+		  BYTES_TO_WORDS_8(A9, C9, 4B, 27, 2B, 4A, B3, A5),
+		  BYTES_TO_WORDS_8(F3, 60, B8, 22, D0, 74, A2, CA),
+		  BYTES_TO_WORDS_8(36, 91, 97, E3, E8, C3, C2, 99),
+		  BYTES_TO_WORDS_8(4B, 84, 93, 90, 0A, 21, 1A, D6) }
+	},
+	{ /* (2j + 1) * 16^11 * G */
+		{ BYTES_TO_WORDS_8(B2, 67, FE, A3, 7A, 19, E3, C6),
+		  BYTES_TO_WORDS_8(38, 33, 2E, 0A, E7, BF, A8, 34),
+		  BYTES_TO_WORDS_8(B2, 23, 73, A9, 9B, 6B, 66, BC),
+		  BYTES_TO_WORDS_8(DC, 85, 3C, 77, 43, C2, 08, 66),
+		  BYTES_TO_WORDS_8(28, 7A, B4, E5, 5C, FE, 23, 19),
+		  BYTES_TO_WORDS_8(08, 43, C5, 40, 9F, 15, 2B, C2),
+		  BYTES_TO_WORDS_8(3F, E0, 46, A7, 0D, 64, 6F, 84),
+		  BYTES_TO_WORDS_8(68, C1, 21, C5, BE, 16, A9, A1) },
+		{ BYTES_TO_WORDS_8(02, 3E, C7, 2B, AD, EA, E6, 13),
+		  BYTES_TO_WORDS_8(2C, 31, 65, EB, 4E, 61, 96, 84),
+		  BYTES_TO_WORDS_8(31, 86, 57, 7D, 11, 98, 6A, 20),
+		  BYTES_TO_WORDS_8(23, DC, C5, A6, E2, 6A, 95, F0),
+		  BYTES_TO_WORDS_8(9D, 21, 11, 86, 99, F6, 2C, 2D),
+		  BYTES_TO_WORDS_8(57, 94, AE, BB, 8D, 04, 2D, 67),
+		  BYTES_TO_WORDS_8(56, 93, 83, F2, 8A, 05, E2, 76),
+		  BYTES_TO_WORDS_8(3C, E0, 44, 11, 60, E6, 3F, 43) },
+		{ BYTES_TO_WORDS_8(5C, E4, 5F, 1C, E5, 2D, E2, 7D),
+		  BYTES_TO_WORDS_8(59, 0F, 7C, 38, A8, 81, B2, 88),
+		  BYTES_TO_WORDS_8(34, 28, F7, 7C, 9D, 24, 2F, A5),
+		  BYTES_TO_WORDS_8(0C, A6, A2, 3C, EA, EB, 98, DB),
+		  BYTES_TO_WORDS_8(22, 5A, F4, 3E, C4, 01, A7, 44),
+		  BYTES_TO_WORDS_8(1C, 0E, 48, AA, 4F, 20, 83, E9),
+		  BYTES_TO_WORDS_8(8C, 2C, 91, D8, 9D, 12, 15, DE),
+		  BYTES_TO_WORDS_8(A2, 85, BD, 75, 0B, F3, C0, E0) },
+		{ BYTES_TO_WORDS_8(AC, 8E, 12, E2, 0D, E6, 59, AF),
+		  BYTES_TO_WORDS_8(CB, 1C, AF, CC, D5, 58, 47, 0C),
+		  BYTES_TO_WORDS_8(69, 51, 6A, 7D, 3B, 6B, BA, 21),
+		  BYTES_TO_WORDS_8(F4, A5, DD, 0A, 16, C0, 73, 0A),
+		  BYTES_TO_WORDS_8(0D, 18, F1, 64, 1D, 29, 59, 38),
+		  BYTES_TO_WORDS_8(CA, D9, 55, 77, F1, 59, 37, 79),
+		  BYTES_TO_WORDS_8(7C, 0A, F5, 94, DD, B6, 5C, A5),
+		  BYTES_TO_WORDS_8(8C, 83, 4E, 04, 56, DA, 3F, 44) },
+		{ BYTES_TO_WORDS_8(30, BC, CC, 63, 31, 93, 5A, C6),
+		  BYTES_TO_WORDS_8(18, 96, 34, 1D, D2, E5, DF, 9E),
+		  BYTES_TO_WORDS_8(24, 97, 09, 7A, 66, 37, ED, 70),
+		  BYTES_TO_WORDS_8(23, 4F, CB, 47, C3, 20, 87, 37),
+		  BYTES_TO_WORDS_8(9E, 72, 15, 13, 7F, 32, 20, 6A),
+		  BYTES_TO_WORDS_8(84, 8F, 34, D1, 55, F9, BC, 16),
+		  BYTES_TO_WORDS_8(6D, 9B, A7, AA, C0, 8A, 11, 93),
+		  BYTES_TO_WORDS_8(8C, 53, 72, CF, B9, DD, 1B, 8F) },
+		{ BYTES_TO_WORDS_8(6B, 1B, BB, 43, E5, 8D, 4A, A6),
+		  BYTES_TO_WORDS_8(FA, 2B, 7C, F4, 32, EF, 5F, 57),
+		  BYTES_TO_WORDS_8(21, A6, 55, 10, 8C, 11, 98, 9D),
+		  BYTES_TO_WORDS_8(61, 1A, 8B, B7, 1D, D2, 8F, FE),
+		  BYTES_TO_WORDS_8(93, AF, EA, 30, BA, D9, B5, 97),
+		  BYTES_TO_WORDS_8(89, F8, AB, F0, CF, DD, 14, 0F),
+		  BYTES_TO_WORDS_8(C0, 13, AD, F5, 95, 8E, E2, 69),
+		  BYTES_TO_WORDS_8(37, 6E, 25, C3, AE, 22, 1E, 79) },
+		{ BYTES_TO_WORDS_8(EA, 7C, 4B, B4, 9C, 59, 05, E8),
+		  BYTES_TO_WORDS_8(7D, F8, 6C, 91, 40, 69, 44, 47),
+		  BYTES_TO_WORDS_8(CA, DC, B3, 78, 22, 40, 20, E8),
+		  BYTES_TO_WORDS_8(2E, 7E, FB, 79, D5, 1F, 33, 2C),
+		  BYTES_TO_WORDS_8(C2, C9, D1, D5, 6A, B4, C2, 7F),
+		  BYTES_TO_WORDS_8(07, 94, 30, F1, 1F, 51, 92, 61),
+		  BYTES_TO_WORDS_8(50, D6, BD, C3, D8, F3, F3, FC),
+		  BYTES_TO_WORDS_8(76, 1E, 06, CE, 1C, 7B, 56, 20) },
+		{ BYTES_TO_WORDS_8(8C, 27, 12, 81, 37, 9B, 92, 8F),
+		  BYTES_TO_WORDS_8(15, 9A, 8D, 0A, 9D, 64, 01, DD),
+		  BYTES_TO_WORDS_8(66, 4B, 84, 7F, C8, B4, 48, A3),
+		  BYTES_TO_WORDS_8(20, A3, 51, 46, 6C, C0, 9B, 50),
+		  BYTES_TO_WORDS_8(66, 8F, 17, 8E, 98, 5C, 87, EC),
+		  BYTES_TO_WORDS_8(45, F9, 35, E7, 86, FE, 65, 0F),
+		  BYTES_TO_WORDS_8(57, 64, 8F, 7B, F1, F4, 60, 17),
+		  BYTES_TO_WORDS_8(EC, 46, 22, B7, C2, 68, B1, B4) }
+	},
+	{ /* (2j + 1) * 16^12 * G */
+		{ BYTES_TO_WORDS_8(04, 51, E5, 17, 80, AF, EB, C2),
+		  BYTES_TO_WORDS_8(71, 9C, 8E, BB, 5F, 83, 3A, F7),
+		  BYTES_TO_WORDS_8(1C, 56, 8B, 4D, C3, 93, DE, 63),
+		  BYTES_TO_WORDS_8(37, 87, B7, 27, 52, 76, DE, D8),
+		  BYTES_TO_WORDS_8(CD, 08, 2E, E5, 80, EF, 02, 2A),
+		  BYTES_TO_WORDS_8(1B, DB, 40, 19, CE, 3F, F7, C2),
+		  BYTES_TO_WORDS_8(24, F9, DC, D1, 8A, 62, 4C, 5C),
+		  BYTES_TO_WORDS_8(D1, F2, 13, BE, 65, 94, D2, 2F) },
+		{ BYTES_TO_WORDS_8(D3, BF, 87, E9, C7, C2, 39, 69),
+		  BYTES_TO_WORDS_8(4C, 28, C4, F4, 2F, 47, C5, 87),
+		  BYTES_TO_WORDS_8(91, D1, DD, FA, EA, FB, 1D, 55),
+		  BYTES_TO_WORDS_8(33, 8E, 51, BD, 6F, 78, A5, E3),
+		  BYTES_TO_WORDS_8(7D, 3E, C2, 8C, 6C, 1B, D3, 7E),
+		  BYTES_TO_WORDS_8(81, E0, 28, D9, EC, F2, DC, A3),
+		  BYTES_TO_WORDS_8(0C, 21, D8, 4A, FF, B9, 77, 84),
+		  BYTES_TO_WORDS_8(E6, 40, 58, 53, 09, AD, 4B, F7) },
+		{ BYTES_TO_WORDS_8(6E, 05, D5, 22, D2, 51, 79, B6),
+		  BYTES_TO_WORDS_8(7C, A0, 47, E2, A7, B5, DC, 0E),
+		  BYTES_TO_WORDS_8(48, 5E, 6E, E9, FC, 5F, 52, 11),
+		  BYTES_TO_WORDS_8(D4, 20, A5, EC, 41, 70, A9, 42),
+		  BYTES_TO_WORDS_8(11, DB, F7, B0, C8, 4D, 41, 48),
+		  BYTES_TO_WORDS_8(FD, D1, 9F, 6E, 3D, 48, 4E, B6),
+		  BYTES_TO_WORDS_8(26, 3B, 56, 6B, D2, 6D, C3, 6E),
+		  BYTES_TO_WORDS_8(06, 87, 00, CF, 66, 7F, FC, F2) },
+		{ BYTES_TO_WORDS_8(3B, FD, DA, D3, 91, 5F, 74, C6),
+		  BYTES_TO_WORDS_8(56, 39, CB, 2D, F0, 99, B8, 6F),
+		  BYTES_TO_WORDS_8(D6, 79, 53, D6, 2E, 2C, 23, FE),
+		  BYTES_TO_WORDS_8(4C, 96, 27, 1C, 1B, A7, 6C, 0D),
+		  BYTES_TO_WORDS_8(E8, E6, 6F, 1A, 42, F1, AD, D6),
+		  BYTES_TO_WORDS_8(1A, 77, 88, EE, AB, 48, 22, A0),
+		  BYTES_TO_WORDS_8(58, DE, 07, 27, A0, 94, E4, 9F),
+		  BYTES_TO_WORDS_8(3D, 29, DE, 8F, B3, 30, 51, A8) },
+		{ BYTES_TO_WORDS_8(8B, 1F, 13, F1, 7F, 9C, BF, F6),
+		  BYTES_TO_WORDS_8(4D, 0D, A2, CF, 60, 69, 64, 69),
+		  BYTES_TO_WORDS_8(B4, 1F, 43, 9C, DF, 22, 4C, 7D),
+		  BYTES_TO_WORDS_8(D9, A3, 65, D8, 7A, CA, ED, 05),
+		  BYTES_TO_WORDS_8(9F, 77, 6F, BA, 19, 0B, CF, 0E),
+		  BYTES_TO_WORDS_8(49, 9D, E8, F0, 05, 50, 52, 33),
+		  BYTES_TO_WORDS_8(BE, 71, 02, 5F, 1B, D7, C9, 01),
+		  BYTES_TO_WORDS_8(BC, 86, E8, 48, 1E, 88, 58, 9E) },
+		{ BYTES_TO_WORDS_8(4D, 7E, 59, EB, 41, 9F, 8F, 9C),
+		  BYTES_TO_WORDS_8(31, 1A, 7D, E7, 25, F3, 74, 49),
+		  BYTES_TO_WORDS_8(11, 1C, 77, 3B, A3, 45, 1B, 12),
+		  BYTES_TO_WORDS_8(A4, A0, C7, 0B, 56, C0, 13, 5A),
+		  BYTES_TO_WORDS_8(E0, 56, 18, E4, 69, 48, 7E, AF),
+		  BYTES_TO_WORDS_8(64, 66, 13, 59, AB, 87, DE, 7B),
+		  BYTES_TO_WORDS_8(CE, 73, 2D, F2, A0, 18, FD, 51),
+		  BYTES_TO_WORDS_8(FF, 97, 0F, 89, 13, 3C, E7, C9) },
+		{ BYTES_TO_WORDS_8(F0, FA, 60, 42, 61, 89, A7, DA),
+		  BYTES_TO_WORDS_8(35, 59, E9, 97, 45, D3, BB, A2),
+		  BYTES_TO_WORDS_8(2E, 27, 0F, 68, 1A, 4E, 14, 43),
+		  BYTES_TO_WORDS_8(75, 6E, 7B, 01, 56, 56, B2, 96),
+		  BYTES_TO_WORDS_8(12, D4, 66, E3, 20, 25, E4, C0),
+		  BYTES_TO_WORDS_8(5A, 4F, 7D, 70, 98, BF, 0B, 89),
+		  BYTES_TO_WORDS_8(E1, 99, BF, 33, 57, 8E, AD, 00),
+		  BYTES_TO_WORDS_8(AC, 7C, B3, 01, A0, A6, F8, DC) },
+		{ BYTES_TO_WORDS_8(76, 32, D1, AA, E4, 1B, 9A, A4),
+		  BYTES_TO_WORDS_8(C7, 43, C0, E9, EA, 50, 63, CA),
+		  BYTES_TO_WORDS_8(A3, 71, 77, 38, 2B, 2B, F1, 26),
+		  BYTES_TO_WORDS_8(24, DE, 1C, C4, 10, 19, 97, 0B),
+		  BYTES_TO_WORDS_8(DB, DA, 84, 0A, 42, F3, 38, B3),
+		  BYTES_TO_WORDS_8(E3, FA, 70, 82, 29, 79, 3D, 59),
+		  BYTES_TO_WORDS_8(1F, 81, F6, 3B, 5B, E4, E2, D4),
+		  BYTES_TO_WORDS_8(FB, EE, 06, F0, 6E, 48, 28, AC) }
+	},
+	{ /* (2j + 1) * 16^13 * G */
+		{ BYTES_TO_WORDS_8(83, 5C, 1E, 07, 92, BC, A6, EE),
+		  BYTES_TO_WORDS_8(BE, A0, 42, 85, 19, 7F, D2, 8B),
+		  BYTES_TO_WORDS_8(B1, E5, 58, 2A, B7, 45, A8, 20),
+		  BYTES_TO_WORDS_8(3F, D7, 26, 50, 41, C9, CC, 54),
+		  BYTES_TO_WORDS_8(A1, 16, 09, 14, F7, 8E, D0, CF),
+		  BYTES_TO_WORDS_8(96, E4, 8E, 5D, CC, 0B, 9E, 92),
+		  BYTES_TO_WORDS_8(22, BF, D2, DA, 15, 87, 8F, 3A),
+		  BYTES_TO_WORDS_8(32, 45, 51, B4, 45, 3F, 43, 1C) },
+		{ BYTES_TO_WORDS_8(7C, 16, 76, AF, 22, 36, 5E, 4C),
+		  BYTES_TO_WORDS_8(39, 67, 74, C4, 2C, 42, 2F, 2F),
+		  BYTES_TO_WORDS_8(F2, D9, CC, 2D, 69, 2C, C2, 39),
+		  BYTES_TO_WORDS_8(95, FF, 3E, B7, DC, 2E, 58, 87),
+		  BYTES_TO_WORDS_8(F6, 7F, 4D, 6F, 61, BB, 6F, 6C),
+		  BYTES_TO_WORDS_8(E8, 7B, 19, 77, 06, 8F, 02, 88),
+		  BYTES_TO_WORDS_8(A8, 36, 72, C3, C3, 02, E1, FD),
+		  BYTES_TO_WORDS_8(7B, 4A, D6, 0A, 35, 94, 5B, 07) },
+		{ BYTES_TO_WORDS_8(11, 66, DE, 74, E8, 3E, 72, 46),
+		  BYTES_TO_WORDS_8(B0, 1F, 82, 4B, 39, 57, F6, 33),
+		  BYTES_TO_WORDS_8(1E, F1, 66, 35, 36, B7, 25, 1C),
+		  BYTES_TO_WORDS_8(DB, 36, 27, 1F, CA, 7A, 10, 4A),
+		  BYTES_TO_WORDS_8(FE, 05, A8, 58, EE, EB, 58, 03),
+		  BYTES_TO_WORDS_8(AC, 32, 21, 5C, 7A, 54, 5D, 07),
+		  BYTES_TO_WORDS_8(2E, 05, 00, F7, E8, 64, CE, 34),
+		  BYTES_TO_WORDS_8(39, EF, 63, 00, 51, 26, 9B, 80) },
+		{ BYTES_TO_WORDS_8(B0, EC, CF, 6D, D0, 4E, BA, FC),
+		  BYTES_TO_WORDS_8(46, D8, A8, 30, 1D, FD, 83, E9),
+		  BYTES_TO_WORDS_8(F6, 49, BF, 49, 0D, 0E, 4A, 65),
+		  BYTES_TO_WORDS_8(C9, DF, AA, 72, B3, 2E, 40, FD),
+		  BYTES_TO_WORDS_8(E8, 8D, A0, ED, 3D, 3F, 59, 10),
+		  BYTES_TO_WORDS_8(79, 5E, E6, BD, 24, 4C, 4B, 1A),
+		  BYTES_TO_WORDS_8(6B, A8, AB, 9B, 38, 26, A6, E9),
+		  BYTES_TO_WORDS_8(22, 3A, A6, DD, 30, 40, B3, D6) },
+		{ BYTES_TO_WORDS_8(ED, 59, 46, 55, 0F, D6, 4D, 5B),
+		  BYTES_TO_WORDS_8(6E, 96, 5D, 19, 22, 3D, AE, 7F),
+		  BYTES_TO_WORDS_8(A0, D0, C9, FE, 07, 8E, FB, 5D),
+		  BYTES_TO_WORDS_8(15, 75, 18, 46, 46, B3, 7B, 46),
+		  BYTES_TO_WORDS_8(83, CF, 00, 28, 0B, 7D, 20, 9B),
+		  BYTES_TO_WORDS_8(00, 3E, 01, CD, 0D, C1, 1B, 70),
+		  BYTES_TO_WORDS_8(D3, 2C, B8, 6D, 58, CD, F2, A1),
+		  BYTES_TO_WORDS_8(E8, 78, A9, 5A, D0, FF, 1E, D0) },
+		{ BYTES_TO_WORDS_8(15, E5, 97, DC, 4A, 98, 64, EE),
+		  BYTES_TO_WORDS_8(5F, 5A, 88, 39, C3, D6, 14, 69),
+		  BYTES_TO_WORDS_8(E5, C7, 9E, 0E, 63, 9B, 87, 6C),
+		  BYTES_TO_WORDS_8(E4, C0, DD, 8C, 8F, B9, 66, CF),
+		  BYTES_TO_WORDS_8(51, 8A, 6C, 80, EA, 14, 82, 95),
+		  BYTES_TO_WORDS_8(3A, 03, 90, D9, 58, 74, F0, 33),
+		  BYTES_TO_WORDS_8(7B, 6A, EC, 34, 10, B4, 25, 1C),
+		  BYTES_TO_WORDS_8(21, 61, 44, 90, 7B, 71, 70, 0A) },
+		{ BYTES_TO_WORDS_8(E5, 54, 61, 18, 10, 2A, A5, 3B),
+		  BYTES_TO_WORDS_8(DD, A0, AF, 9A, 66, 2A, 40, 86),
+		  BYTES_TO_WORDS_8(70, 67, 48, AD, 53, 89, 1C, 75),
+		  BYTES_TO_WORDS_8(34, AA, BF, 0F, C6, 52, 92, 3D),
+		  BYTES_TO_WORDS_8(A2, A8, 03, 96, F6, 93, FC, 77),
+		  BYTES_TO_WORDS_8(07, D7, 7D, 7C, 7D, FB, A1, AE),
+		  BYTES_TO_WORDS_8(F3, 4C, 6B, 89, 42, 33, 49, C4),
+		  BYTES_TO_WORDS_8(7F, 9D, FA, D2, DC, 01, 0D, 3D) },
+		{ BYTES_TO_WORDS_8(AA, 8D, 4A, AA, 62, 3B, B6, D3),
+		  BYTES_TO_WORDS_8(A3, 5C, 8A, F2, 0E, 60, 10, E5),
+		  BYTES_TO_WORDS_8(8C, 96, 4A, 8F, B4, B5, 0E, 76),
+		  BYTES_TO_WORDS_8(9C, 76, 89, 68, B2, 38, BE, 2B),
+		  BYTES_TO_WORDS_8(9B, E4, 36, 92, 4E, 77, 08, 7E),
+		  BYTES_TO_WORDS_8(7D, 6E, EB, E3, A4, B3, 02, 99),
+		  BYTES_TO_WORDS_8(50, 08, 96, 1F, F9, FE, 2C, 5E),
+		  BYTES_TO_WORDS_8(6F, B3, D3, 00, F6, 07, 57, F8) }
+	},
+	{ /* (2j + 1) * 16^14 * G */
+		{ BYTES_TO_WORDS_8(36, 29, D3, 22, 71, B7, 0F, C3),
+		  BYTES_TO_WORDS_8(01, 7F, 84, 32, 2E, D0, 0C, E4),
+		  BYTES_TO_WORDS_8(38, 7F, 3D, 51, D1, C7, 6C, 9F),
+		  BYTES_TO_WORDS_8(7D, A4, 14, 78, 59, 0C, 44, C5),
+		  BYTES_TO_WORDS_8(D4, BF, CA, 47, 37, FA, 42, 9A),
+		  BYTES_TO_WORDS_8(5D, 1E, E4, 31, 86, D2, A6, D8),
+		  BYTES_TO_WORDS_8(AC, F4, EC, 23, 1D, 1E, DC, 2E),
+		  BYTES_TO_WORDS_8(A7, 1F, 3E, 38, BA, E9, 7E, D2) },
+		{ BYTES_TO_WORDS_8(E1, A8, 89, 79, EC, 01, 85, 7D),
+		  BYTES_TO_WORDS_8(DD, 4B, EE, 74, F3, 96, 1D, 7C),
+		  BYTES_TO_WORDS_8(0A, FE, 9C, 9B, 47, E0, 00, 75),
+		  BYTES_TO_WORDS_8(9B, A7, DF, 5C, C4, 03, 4D, 3E),
+		  BYTES_TO_WORDS_8(0A, 24, 1C, 44, 88, 13, 79, 98),
+		  BYTES_TO_WORDS_8(40, 67, BD, F3, D5, 18, AF, FF),
+		  BYTES_TO_WORDS_8(19, A7, CA, D7, CA, 17, C1, AA),
+		  BYTES_TO_WORDS_8(75, 64, 5A, 81, D0, 44, F7, 12) },
+		{ BYTES_TO_WORDS_8(02, 79, BB, D9, D0, A8, 39, 69),
+		  BYTES_TO_WORDS_8(3F, C7, B7, 86, 72, 6C, C2, D8),
+		  BYTES_TO_WORDS_8(9F, 5E, 48, 94, 9E, 24, 9A, 9A),
+		  BYTES_TO_WORDS_8(35, 10, D6, B3, 49, 84, B6, 01),
+		  BYTES_TO_WORDS_8(53, E6, 3E, E0, B1, 44, 7F, CD),
+		  BYTES_TO_WORDS_8(82, 66, 83, 71, 04, 26, EB, FC),
+		  BYTES_TO_WORDS_8(81, 15, 6D, C3, E5, 98, F1, 0B),
+		  BYTES_TO_WORDS_8(3E, 9C, 37, E9, A1, 63, 90, E5) },
+		{ BYTES_TO_WORDS_8(FE, D9, 71, C3, D4, 56, 9B, C2),
+		  BYTES_TO_WORDS_8(BB, D6, 99, 19, 6C, 35, 4B, F0),
+		  BYTES_TO_WORDS_8(4C, 3A, AB, C3, A7, 55, 59, 33),
+		  BYTES_TO_WORDS_8(A2, 9C, CC, AC, B1, 3C, 2C, 95),
+		  BYTES_TO_WORDS_8(3F, A1, 89, 41, D2, E6, 6C, D7),
+		  BYTES_TO_WORDS_8(5E, C7, 08, 18, F1, 64, 44, 66),
+		  BYTES_TO_WORDS_8(D0, E5, EC, F6, 36, 91, DF, A7),
+		  BYTES_TO_WORDS_8(06, 2F, D6, F7, 46, 85, B9, 59) },
+		{ BYTES_TO_WORDS_8(85, C8, C2, 8B, 76, FC, 7F, 84),
+		  BYTES_TO_WORDS_8(7C, E5, 64, 52, 77, EE, 51, 15),
+		  BYTES_TO_WORDS_8(E5, CD, 97, 0B, 45, 80, 89, 85),
+		  BYTES_TO_WORDS_8(AC, 6E, 16, 5B, E1, 4E, CB, DF),
+		  BYTES_TO_WORDS_8(2E, D9, 45, 13, 43, A6, D4, 75),
+		  BYTES_TO_WORDS_8(75, E9, AB, 7B, 94, 38, 77, 1C),
+		  BYTES_TO_WORDS_8(41, 0F, 2C, C8, 26, FC, C4, 53),
+		  BYTES_TO_WORDS_8(A1, 13, 06, 55, 95, 23, 6A, 53) },
+		{ BYTES_TO_WORDS_8(8E, 20, 10, F5, 2B, 85, 8B, 73),
+		  BYTES_TO_WORDS_8(38, 94, D7, 84, 2D, CE, 8C, DB),
+		  BYTES_TO_WORDS_8(BB, 97, 7C, 04, 3A, AF, 87, 8A),
+		  BYTES_TO_WORDS_8(0C, 50, E6, 9B, C0, 66, 79, 15),
+		  BYTES_TO_WORDS_8(57, 73, 20, 0D, 25, EE, 0E, D6),
+		  BYTES_TO_WORDS_8(DF, 43, DA, 32, 44, C6, 8F, 00),
+		  BYTES_TO_WORDS_8(07, BE, 8C, BB, B7, F7, DF, AB),
+		  BYTES_TO_WORDS_8(4E, 26, 12, B7, 5A, 6D, 44, 40) },
+		{ BYTES_TO_WORDS_8(13, FE, 96, 8B, BE, CC, 9F, 1C),
+		  BYTES_TO_WORDS_8(A8, 2E, 85, B4, D3, 4A, 92, E4),
+		  BYTES_TO_WORDS_8(23, 6E, 3F, 81, FF, A8, E1, D6),
+		  BYTES_TO_WORDS_8(0A, 99, 1E, 4B, 3C, 1E, B2, C6),
+		  BYTES_TO_WORDS_8(17, 14, BB, F7, 6A, B9, 06, A0),
+		  BYTES_TO_WORDS_8(D6, D2, E6, 79, 91, 50, 65, FF),
+		  BYTES_TO_WORDS_8(A2, 28, EB, 34, 1E, 78, 4B, E5),
+		  BYTES_TO_WORDS_8(48, 4D, 33, C3, D8, CD, 5B, 33) },
+		{ BYTES_TO_WORDS_8(65, 65, 93, C3, 9A, 81, 65, C3),
+		  BYTES_TO_WORDS_8(C7, A4, 7F, 97, 6D, B3, A7, 97),
+		  BYTES_TO_WORDS_8(D9, 22, 95, 53, 9D, CA, 4B, 0B),
+		  BYTES_TO_WORDS_8(6F, 29, C7, 78, C4, E4, 31, A2),
+		  BYTES_TO_WORDS_8(19, 5F, EC, 35, 06, 6A, E5, 8A),
+		  BYTES_TO_WORDS_8(26, 54, F1, 96, 00, 6E, A5, 2B),
+		  BYTES_TO_WORDS_8(94, CF, 03, 88, C6, 4E, D9, C0),
+		  BYTES_TO_WORDS_8(91, BE, 7F, EC, 8B, C9, E0, 80) }
+	},
+	{ /* (2j + 1) * 16^15 * G */
+		{ BYTES_TO_WORDS_8(48, FD, 66, B0, 72, 41, 9F, BF),
+		  BYTES_TO_WORDS_8(83, 15, 97, B8, 1C, 10, 37, 1C),
+		  BYTES_TO_WORDS_8(A6, DC, BA, A6, 97, 9B, C7, 06),
+		  BYTES_TO_WORDS_8(C5, F1, 27, 42, 7A, 56, 1C, 24),
+		  BYTES_TO_WORDS_8(08, 7B, 85, 92, 67, 2C, 7D, 7F),
+		  BYTES_TO_WORDS_8(05, 66, A3, AE, 38, 71, A8, 8E),
+		  BYTES_TO_WORDS_8(A4, 03, 32, 04, 7C, 81, 63, 93),
+		  BYTES_TO_WORDS_8(4B, 2D, 30, D4, 93, 2D, A6, 40) },
+		{ BYTES_TO_WORDS_8(1D, 59, F9, 0D, B9, 7D, 1F, 86),
+		  BYTES_TO_WORDS_8(2A, C8, B4, 42, C2, 3A, EC, DC),
+		  BYTES_TO_WORDS_8(18, 72, 32, AB, C4, D3, A0, CB),
+		  BYTES_TO_WORDS_8(E9, 78, 69, 82, 3B, D2, 2F, DE),
+		  BYTES_TO_WORDS_8(84, AD, 57, 04, 3D, 97, E1, B4),
+		  BYTES_TO_WORDS_8(A4, 36, C0, 88, 1F, 8A, 9A, DA),
+		  BYTES_TO_WORDS_8(BB, 2E, B9, 84, EC, B7, EC, 05),
+		  BYTES_TO_WORDS_8(F3, 43, 62, 3B, 13, 71, 0D, 40) },
+		{ BYTES_TO_WORDS_8(2C, 28, 62, F5, 4A, 25, A8, 2E),
+		  BYTES_TO_WORDS_8(77, C3, FB, 38, F9, 3A, 2F, F0),
+		  BYTES_TO_WORDS_8(40, 13, E1, 24, B0, 48, 39, 99),
+		  BYTES_TO_WORDS_8(DD, CB, 4C, 30, B0, 89, F8, 8D),
+		  BYTES_TO_WORDS_8(CD, 95, D1, 61, D9, AB, 56, 72),
+		  BYTES_TO_WORDS_8(15, BB, F9, CE, 44, 70, 7F, 24),
+		  BYTES_TO_WORDS_8(5E, F3, 8A, 18, 63, 1E, 74, 6C),
+		  BYTES_TO_WORDS_8(ED, CE, 05, 32, 67, 5B, 52, 74) },
+		{ BYTES_TO_WORDS_8(DD, B2, DD, 0D, 95, 28, D5, F9),
+		  BYTES_TO_WORDS_8(A6, 0D, 2C, CC, CD, 64, 88, 07),
+		  BYTES_TO_WORDS_8(45, F2, 52, F1, 0C, B8, 1F, 00),
+		  BYTES_TO_WORDS_8(F8, 80, 8B, D9, 8C, 75, FD, A0),
+		  BYTES_TO_WORDS_8(B2, E6, ED, 73, F8, 4F, D9, 7F),
+		  BYTES_TO_WORDS_8(7C, 9A, 40, 89, 6F, E9, 8C, 1C),
+		  BYTES_TO_WORDS_8(31, 8F, B0, 13, D3, 1F, 69, F8),
+		  BYTES_TO_WORDS_8(D5, 68, 33, C1, 35, D8, E5, 53) },
+		{ BYTES_TO_WORDS_8(36, 2E, 54, 4F, A0, BA, 8C, E0),
+		  BYTES_TO_WORDS_8(C2, 15, 34, A1, AF, FF, 22, 4E),
+		  BYTES_TO_WORDS_8(D8, 35, 63, 94, 67, 92, E5, 7D),
+		  BYTES_TO_WORDS_8(F6, A0, D1, 72, 84, C5, 70, 31),
+		  BYTES_TO_WORDS_8(B5, 88, 32, F6, AE, 75, C4, C6),
+		  BYTES_TO_WORDS_8(1B, BE, 99, 59, 69, 75, 6F, 00),
+		  BYTES_TO_WORDS_8(3D, 77, B9, FE, 93, 50, 51, 37),
+		  BYTES_TO_WORDS_8(E2, 7F, 3A, FC, 12, 36, 08, B2) },
+		{ BYTES_TO_WORDS_8(E9, 48, 75, DC, A5, 23, 9B, 79),
+		  BYTES_TO_WORDS_8(4C, D5, 92, 08, 07, A8, DD, D8),
+		  BYTES_TO_WORDS_8(E5, 3F, 06, 4F, 69, 81, B4, 9D),
+		  BYTES_TO_WORDS_8(02, 3E, 2D, 0A, A9, B0, FA, 92),
+		  BYTES_TO_WORDS_8(8F, 75, 17, 49, D0, 2C, 71, 8C),
+		  BYTES_TO_WORDS_8(48, 08, 2D, EF, 68, DC, A0, C8),
+		  BYTES_TO_WORDS_8(FF, 79, 26, 0C, 4E, 71, 31, F4),
+		  BYTES_TO_WORDS_8(BC, 46, B2, 0C, 68, B4, E7, 55) },
+		{ BYTES_TO_WORDS_8(F8, F7, 98, 94, 0B, 05, D8, E0),
+		  BYTES_TO_WORDS_8(22, 16, 41, 26, D3, 67, DF, C4),
+		  BYTES_TO_WORDS_8(12, 87, 2C, 19, 1B, E1, 0B, 9D),
+		  BYTES_TO_WORDS_8(17, 55, 03, 18, BE, 65, B0, 91),
+		  BYTES_TO_WORDS_8(5B, 19, 23, 3F, 9E, 0D, 74, 3C),
+		  BYTES_TO_WORDS_8(9E, 63, 89, 57, 42, 7B, 2C, DF),
+		  BYTES_TO_WORDS_8(64, E2, 17, 00, 49, F3, 9F, FF),
+		  BYTES_TO_WORDS_8(20, 16, 67, FB, 77, 6F, 5B, 03) },
+		{ BYTES_TO_WORDS_8(22, E3, 60, 40, E2, BE, DC, 51),
+		  BYTES_TO_WORDS_8(4B, D1, C4, A9, 37, C7, CD, 3E),
+		  BYTES_TO_WORDS_8(92, B9, 9A, 48, 97, 06, 39, 9C),
+		  BYTES_TO_WORDS_8(3A, CB, C9, CA, 4C, 1F, 4A, 8E),
+		  BYTES_TO_WORDS_8(D7, 19, 46, 90, CD, 83, 21, 4E),
+		  BYTES_TO_WORDS_8(E0, BF, 4F, 95, 8D, A9, 00, FB),
+		  BYTES_TO_WORDS_8(C4, 7B, 6E, 40, D2, 5E, B0, 2F),
+		  BYTES_TO_WORDS_8(75, D7, 28, B3, 5E, B7, 36, 49) }
+	},
+	{ /* (2j + 1) * 16^16 * G */
+		{ BYTES_TO_WORDS_8(63, DB, 14, 8E, B4, 5C, E7, 90),
+		  BYTES_TO_WORDS_8(7E, 1F, 65, AD, AA, 3B, 49, 29),
+		  BYTES_TO_WORDS_8(DE, 25, 6E, 32, 2E, 59, 92, 84),
+		  BYTES_TO_WORDS_8(A5, AA, 11, 28, BC, 22, A8, 0F),
+		  BYTES_TO_WORDS_8(E7, 2E, 46, 5F, 54, 24, 11, E4),
+		  BYTES_TO_WORDS_8(F5, 82, FE, 50, 50, A6, B1, 34),
+		  BYTES_TO_WORDS_8(8B, 18, DF, B3, BC, D4, 4A, 6F),
+		  BYTES_TO_WORDS_8(0D, A8, DB, F5, E8, 4A, F4, BF) },
+		{ BYTES_TO_WORDS_8(EC, CD, B3, 7D, 3F, 45, 2C, 75),
+		  BYTES_TO_WORDS_8(F5, EB, 28, B2, 12, 3A, EF, DB),
+		  BYTES_TO_WORDS_8(C8, 4B, EA, 7B, 5E, 64, 96, E5),
+		  BYTES_TO_WORDS_8(5C, 2F, 91, FF, 64, C0, B2, 85),
+		  BYTES_TO_WORDS_8(1F, F8, 03, 4A, 20, 08, 4D, 8F),
+		  BYTES_TO_WORDS_8(E0, F8, 4C, E6, 34, 0B, 98, DC),
+		  BYTES_TO_WORDS_8(00, 6D, CC, 2F, 2D, FA, C7, 63),
+		  BYTES_TO_WORDS_8(36, 15, D1, 39, 8F, 27, 4B, F6) },
+		{ BYTES_TO_WORDS_8(30, B0, 07, 86, E4, 5A, 8A, 28),
+		  BYTES_TO_WORDS_8(73, D6, 84, E5, 63, FF, DA, 24),
+		  BYTES_TO_WORDS_8(9C, F2, 16, EC, AC, FB, 51, 78),
+		  BYTES_TO_WORDS_8(67, 14, 02, C4, 76, 03, 0B, 11),
+		  BYTES_TO_WORDS_8(3A, 7C, 61, B3, 12, A1, 3A, F4),
+		  BYTES_TO_WORDS_8(49, 87, 29, FB, 56, 15, BE, 87),
+		  BYTES_TO_WORDS_8(0C, C7, 61, 84, 9F, B8, 6E, 4C),
+		  BYTES_TO_WORDS_8(73, E6, 8E, 31, 85, 2B, 43, 84) },
+		{ BYTES_TO_WORDS_8(08, 6F, A7, 75, 1C, D8, ED, 54),
+		  BYTES_TO_WORDS_8(4E, ED, BB, 8B, 53, F2, 95, 32),
+		  BYTES_TO_WORDS_8(F8, AA, 1C, 2B, 24, E1, F6, 14),
+		  BYTES_TO_WORDS_8(D7, 71, 64, 9F, 44, 4E, 78, 18),
+		  BYTES_TO_WORDS_8(93, 49, 82, 6B, 5D, 60, 39, 0B),
+		  BYTES_TO_WORDS_8(32, 25, 0A, A6, A7, 74, 9D, FC),
+		  BYTES_TO_WORDS_8(71, E6, 71, AC, FD, A8, 77, 17),
+		  BYTES_TO_WORDS_8(E7, 1A, 1E, 4A, 7F, ED, 76, 8D) },
+		{ BYTES_TO_WORDS_8(81, AD, 6F, FA, C9, 33, 8E, CE),
+		  BYTES_TO_WORDS_8(3E, B0, 0C, 8C, 74, 65, 33, 9C),
+		  BYTES_TO_WORDS_8(7D, 03, 3A, 70, D7, 6D, F5, AE),
+		  BYTES_TO_WORDS_8(B9, E6, 05, 7D, E0, F9, A2, 58),
+		  BYTES_TO_WORDS_8(94, 95, 10, 3B, 5E, 61, 00, 54),
+		  BYTES_TO_WORDS_8(82, 0B, 30, 2D, D3, B2, 8B, 79),
+		  BYTES_TO_WORDS_8(BD, A6, 7F, 71, F8, 82, B6, C1),
+		  BYTES_TO_WORDS_8(E0, 60, 55, AC, C5, 64, AB, 06) },
+		{ BYTES_TO_WORDS_8(83, 25, B5, 9E, 1F, F1, 22, FB),
+		  BYTES_TO_WORDS_8(3A, C1, 0C, C1, CE, 99, 8A, EA),
+		  BYTES_TO_WORDS_8(6F, 67, 8F, 27, BB, 6D, EE, 40),
+		  BYTES_TO_WORDS_8(A2, BB, 7E, CE, DC, 20, F0, 1E),
+		  BYTES_TO_WORDS_8(AE, 17, 3F, 7A, 19, 78, B2, 55),
+		  BYTES_TO_WORDS_8(CB, D4, 12, 70, F9, 00, C3, 6A),
+		  BYTES_TO_WORDS_8(30, 95, 96, 4B, 0F, 6C, 7F, 09),
+		  BYTES_TO_WORDS_8(B0, 14, 7A, 5A, B2, 76, 44, 59) },
+		{ BYTES_TO_WORDS_8(8F, 95, A1, F0, C1, 3E, C2, B5),
+		  BYTES_TO_WORDS_8(43, 66, B5, 6F, 24, B5, 39, 4F),
+		  BYTES_TO_WORDS_8(2C, A3, BF, FA, 4C, 14, DD, 95),
+		  BYTES_TO_WORDS_8(13, A2, D6, C1, 63, 81, 4A, 4E),
+		  BYTES_TO_WORDS_8(8A, 6F, 63, 48, 51, 3F, 3B, A4),
+		  BYTES_TO_WORDS_8(66, 3D, C4, B2, 5F, 08, 04, 40),
+		  BYTES_TO_WORDS_8(A8, 6F, 9C, E2, 3E, 4A, 3F, 03),
+		  BYTES_TO_WORDS_8(D1, C8, E8, 79, 5B, A4, 74, 25) },
+		{ BYTES_TO_WORDS_8(B5, 5D, 93, 64, 84, 5A, 27, E8),
+		  BYTES_TO_WORDS_8(0E, DB, 6B, 1C, 26, 98, 17, 28),
+		  BYTES_TO_WORDS_8(9E, 51, 94, D5, 0E, 7E, 32, E3),
+		  BYTES_TO_WORDS_8(04, 11, D6, AD, 16, 6A, 96, F6),
+		  BYTES_TO_WORDS_8(38, 68, 16, 1D, 6C, 83, 34, 3A),
+		  BYTES_TO_WORDS_8(01, BF, 01, 44, A3, 53, 74, 2D),
+		  BYTES_TO_WORDS_8(5E, 75, 3C, 2C, 57, EE, A5, C1),
+		  BYTES_TO_WORDS_8(B2, 1D, 03, A9, 07, E3, 0D, BA) }
+	},
+	{ /* (2j + 1) * 16^17 * G */
+		{ BYTES_TO_WORDS_8(87, 69, 6A, B7, 05, 13, F4, 68),
+		  BYTES_TO_WORDS_8(FF, 43, DA, 43, B4, 1A, 48, 2B),
+		  BYTES_TO_WORDS_8(3F, 1B, EE, D7, 88, 69, DC, 7D),
+		  BYTES_TO_WORDS_8(54, 99, 98, A9, D7, 18, BC, 54),
+		  BYTES_TO_WORDS_8(49, AE, 9A, 5B, D0, 7C, 45, FE),
+		  BYTES_TO_WORDS_8(19, B1, 73, BB, D4, 8E, EB, 52),
+		  BYTES_TO_WORDS_8(FD, E2, 73, BA, 51, B8, 91, 73),
+		  BYTES_TO_WORDS_8(F3, EA, E6, 11, 12, 8C, 2C, 4B) },
+		{ BYTES_TO_WORDS_8(20, D8, 1F, FD, F5, 47, BF, 38),
+		  BYTES_TO_WORDS_8(00, 75, 76, 48, 46, 85, 87, 78),
+		  BYTES_TO_WORDS_8(1B, 27, B1, 62, 22, 50, 63, A8),
+		  BYTES_TO_WORDS_8(2A, C5, C1, 80, F6, BC, FB, BA),
+		  BYTES_TO_WORDS_8(F0, 74, F0, 1B, 52, AD, ED, EA),
+		  BYTES_TO_WORDS_8(D6, CA, 1F, 23, A1, 34, 1C, E8),
+		  BYTES_TO_WORDS_8(FD, C0, 9B, C8, 5A, BF, E7, 2C),
+		  BYTES_TO_WORDS_8(81, DD, B4, 9D, 7C, 99, 87, 14) },
+		{ BYTES_TO_WORDS_8(7E, 9B, 29, 94, 12, 08, 17, E9),
+		  BYTES_TO_WORDS_8(D0, E0, 86, 09, 2D, 9F, E7, 24),
+		  BYTES_TO_WORDS_8(EC, 20, C2, 75, FC, 3B, 3C, 2A),
+		  BYTES_TO_WORDS_8(FE, 89, 33, 10, F7, 38, 19, 9B),
+		  BYTES_TO_WORDS_8(DE, 84, 7B, 44, 57, 28, 7B, C5),
+		  BYTES_TO_WORDS_8(32, 82, 6B, F8, 51, E8, CD, 0A),
+		  BYTES_TO_WORDS_8(C9, 3E, AA, 1C, 8E, E9, 40, 31),
+		  BYTES_TO_WORDS_8(83, 02, 71, F1, 6E, AA, 12, FB) },
+		{ BYTES_TO_WORDS_8(C4, C4, 0C, D1, 40, 07, 41, FD),
+		  BYTES_TO_WORDS_8(A0, 3D, A5, C4, A2, 35, 1D, B7),
+		  BYTES_TO_WORDS_8(2C, 1B, 76, 06, DC, 1F, 38, 7C),
+		  BYTES_TO_WORDS_8(90, 75, 01, CC, 85, 19, 77, A6),
+		  BYTES_TO_WORDS_8(70, 65, 97, 7C, 23, 3B, 0F, C2),
+		  BYTES_TO_WORDS_8(94, 30, FF, A6, 73, 57, 74, BC),
+		  BYTES_TO_WORDS_8(3D, 9C, 5D, 1E, 60, D6, 9B, F2),
+		  BYTES_TO_WORDS_8(98, DD, 50, F7, 85, 61, 50, 85) },
+		{ BYTES_TO_WORDS_8(28, 2A, 24, 54, 2D, 80, 10, 54),
+		  BYTES_TO_WORDS_8(71, A7, 3C, 25, 21, CB, 5B, 45),
+		  BYTES_TO_WORDS_8(CA, 4E, 77, 4B, 78, AF, E8, 09),
+		  BYTES_TO_WORDS_8(C1, AF, 0E, 6B, 53, ED, B7, 88),
+		  BYTES_TO_WORDS_8(CE, D8, 4E, 79, EC, 81, 96, FB),
+		  BYTES_TO_WORDS_8(47, E3, 83, 8F, 1C, 6A, 36, 4E),
+		  BYTES_TO_WORDS_8(93, BD, 87, 35, DD, F9, FB, 47),
+		  BYTES_TO_WORDS_8(5E, 34, 45, 62, 20, 53, B0, 22) },
+		{ BYTES_TO_WORDS_8(4C, A9, C1, 9B, EC, 44, 61, 01),
+		  BYTES_TO_WORDS_8(F8, DA, 71, 3E, 2B, 1D, 67, 51),
+		  BYTES_TO_WORDS_8(57, 87, 5E, 22, B0, 72, 2D, 05),
+		  BYTES_TO_WORDS_8(D2, B3, 86, 2A, 01, 14, 71, 03),
+		  BYTES_TO_WORDS_8(3C, 07, C2, EF, 6C, 0B, 0C, 8C),
+		  BYTES_TO_WORDS_8(83, 24, C4, 2A, 36, 8C, 51, C8),
+		  BYTES_TO_WORDS_8(35, 53, D0, 4A, A5, 21, 8C, EF),
+		  BYTES_TO_WORDS_8(90, 73, DD, 51, 3D, 69, 1D, 4D) },
+		{ BYTES_TO_WORDS_8(BA, 88, 7F, 87, 09, 1E, BD, EF),
+		  BYTES_TO_WORDS_8(36, ED, 9B, EE, 79, 07, 98, 50),
+		  BYTES_TO_WORDS_8(C3, 2C, EA, 84, 2E, A3, B5, 34),
+		  BYTES_TO_WORDS_8(3E, 29, 84, 89, 4C, 21, 98, CC),
+		  BYTES_TO_WORDS_8(78, 52, 88, 87, FC, 2E, 46, 0A),
+		  BYTES_TO_WORDS_8(4E, 4C, 35, EF, 7E, 0E, F6, EF),
+		  BYTES_TO_WORDS_8(AB, 63, 7D, 67, 64, 4A, 4C, 11),
+		  BYTES_TO_WORDS_8(A9, AF, 25, E5, E8, B4, EB, 04) },
+		{ BYTES_TO_WORDS_8(7C, 18, 70, FD, 4D, 19, 73, 15),
+		  BYTES_TO_WORDS_8(7F, 0C, 64, 9B, 62, C8, 1A, 75),
+		  BYTES_TO_WORDS_8(F8, 5B, 0F, 29, E0, E5, 14, 98),
+		  BYTES_TO_WORDS_8(0F, A1, 42, 9A, 02, AE, D3, 0A),
+		  BYTES_TO_WORDS_8(A7, 75, C7, 3F, 4B, CF, FF, 7D),
+		  BYTES_TO_WORDS_8(F6, A0, 62, 16, 08, FB, 34, D0),
+		  BYTES_TO_WORDS_8(3D, B3, AB, 5F, F0, 55, 5C, 78),
+		  BYTES_TO_WORDS_8(E3, 46, 88, 75, D4, 40, F0, 2A) }
+	},
+	{ /* (2j + 1) * 16^18 * G */
+		{ BYTES_TO_WORDS_8(31, E2, AA, 70, D1, FA, AA, 60),
+		  BYTES_TO_WORDS_8(7C, 6B, F9, 79, 52, B8, 94, 51),
+		  BYTES_TO_WORDS_8(6F, 75, 67, 92, 23, 48, F2, 85),
+		  BYTES_TO_WORDS_8(F2, E3, 61, 97, 69, C9, 35, 1D),
+		  BYTES_TO_WORDS_8(71, AC, D6, CC, 3A, 06, 67, 58),
+		  BYTES_TO_WORDS_8(F1, 66, 9A, 72, A4, 8A, F5, ED),
+		  BYTES_TO_WORDS_8(10, F8, EB, 22, B6, 0A, 66, 1D),
+		  BYTES_TO_WORDS_8(23, 08, F6, 2D, B6, 6C, 22, C7) },
+		{ BYTES_TO_WORDS_8(AC, 3F, FA, 8C, E1, 3F, 0D, CE),
+		  BYTES_TO_WORDS_8(93, 81, 2B, C3, 9F, 86, AD, 23),
+		  BYTES_TO_WORDS_8(30, 80, 0D, D6, 45, BB, CE, E2),
+		  BYTES_TO_WORDS_8(4C, 23, D2, A6, 47, 40, 3D, DF),
+		  BYTES_TO_WORDS_8(19, D4, C7, 8F, 93, 6D, 62, F4),
+		  BYTES_TO_WORDS_8(75, 29, 88, 96, E4, 3C, D6, AF),
+		  BYTES_TO_WORDS_8(BF, 9D, 0F, 9C, F2, 21, AA, 24),
+		  BYTES_TO_WORDS_8(DB, 40, FD, 29, 52, 6F, FA, 48) },
+		{ BYTES_TO_WORDS_8(D4, 22, 13, 1F, AE, 25, D9, AE),
+		  BYTES_TO_WORDS_8(BB, DC, CC, 4A, 40, 69, 0A, CB),
+		  BYTES_TO_WORDS_8(22, F8, 11, A3, 4C, 6C, 1E, EA),
+		  BYTES_TO_WORDS_8(44, 61, F9, B1, 6A, AF, B2, DB),
+		  BYTES_TO_WORDS_8(11, 53, 8C, 4A, 4F, 2B, 49, AA),
+		  BYTES_TO_WORDS_8(5F, 3A, 7E, 7B, 78, C9, 9F, 9A),
+		  BYTES_TO_WORDS_8(9D, 3F, 43, D6, 1E, 0D, B6, A1),
+		  BYTES_TO_WORDS_8(1A, 56, 13, 2F, B9, 75, AE, EB) },
+		{ BYTES_TO_WORDS_8(7B, 8F, 13, A1, 3C, A3, 69, F0),
+		  BYTES_TO_WORDS_8(F2, E8, F2, 2D, 3E, C9, C1, C4),
+		  BYTES_TO_WORDS_8(0B, 5F, 9B, 7F, 26, 8A, FA, CA),
+		  BYTES_TO_WORDS_8(D4, 1F, 26, 7F, 59, 7B, BA, 1D),
+		  BYTES_TO_WORDS_8(68, F2, 9B, A3, C7, D8, 82, DC),
+		  BYTES_TO_WORDS_8(C0, 32, 82, 99, B7, E6, 36, 81),
+		  BYTES_TO_WORDS_8(F5, 07, 80, BB, 06, 90, E1, 3A),
+		  BYTES_TO_WORDS_8(C6, EF, E7, 5D, 3E, 7D, AF, 6A) },
+		{ BYTES_TO_WORDS_8(AF, 70, 9A, 17, 70, 77, A8, 8D),
+		  BYTES_TO_WORDS_8(28, DF, 64, 9B, 9A, 42, 9D, EC),
+		  BYTES_TO_WORDS_8(C6, 05, 53, 5F, 2D, E8, BB, 31),
+		  BYTES_TO_WORDS_8(9D, 91, 26, 26, 44, 2E, 8A, 34),
+		  BYTES_TO_WORDS_8(82, 6E, B6, 87, 14, 86, 84, CA),
+		  BYTES_TO_WORDS_8(5A, 3E, E1, B7, C5, C2, A7, B2),
+		  BYTES_TO_WORDS_8(05, 01, 23, 00, CE, 7B, 74, 8C),
+		  BYTES_TO_WORDS_8(80, 3E, 5A, F5, 79, FA, B9, A1) },
+		{ BYTES_TO_WORDS_8(01, A2, D3, C4, 76, 6D, 47, C7),
+		  BYTES_TO_WORDS_8(EF, 9E, 9B, FD, A4, 26, E9, 36),
+		  BYTES_TO_WORDS_8(5F, DF, 1A, 93, BF, 4F, 6A, A8),
+		  BYTES_TO_WORDS_8(1C, 9E, 9C, 99, 51, C8, 4E, 3A),
+		  BYTES_TO_WORDS_8(89, 5F, 63, 68, F7, 96, 85, DD),
+		  BYTES_TO_WORDS_8(5B, D5, 3C, F7, 5A, 1E, D3, 27),
+		  BYTES_TO_WORDS_8(8B, 4A, 77, A4, 11, 3C, E0, 69),
+		  BYTES_TO_WORDS_8(DE, 62, 62, 2F, F8, 2E, 9A, C9) },
+		{ BYTES_TO_WORDS_8(67, 85, 97, DC, 2F, E7, FA, 1E),
+		  BYTES_TO_WORDS_8(98, 1F, DC, 40, 88, A6, 5D, E1),
+		  BYTES_TO_WORDS_8(0B, F6, F1, 2F, D6, 35, E9, 84),
+		  BYTES_TO_WORDS_8(57, D4, 34, 83, D8, 52, BA, B1),
+		  BYTES_TO_WORDS_8(91, C2, 2D, 36, 2A, 48, FA, 77),
+		  BYTES_TO_WORDS_8(0A, D4, FC, BA, B0, 6C, A4, D9),
+		  BYTES_TO_WORDS_8(8F, B7, DB, 13, F7, 7C, 5F, 7C),
+		  BYTES_TO_WORDS_8(A7, 43, 69, A8, C7, AE, 6B, A4) },
+		{ BYTES_TO_WORDS_8(A1, 0D, 35, 12, A5, EE, 28, D2),
+		  BYTES_TO_WORDS_8(43, F0, 75, C1, 77, 4C, 41, 19),
+		  BYTES_TO_WORDS_8(2F, 2C, 61, 69, B9, B7, 18, 27),
+		  BYTES_TO_WORDS_8(FD, AA, F2, 8E, 3D, EB, E6, 0A),
+		  BYTES_TO_WORDS_8(C3, 4B, A1, 70, F3, 09, 3E, C7),
+		  BYTES_TO_WORDS_8(4B, DA, 43, ED, F0, 68, D4, 66),
+		  BYTES_TO_WORDS_8(B5, 89, 41, FC, F7, 34, D0, 2D),
+		  BYTES_TO_WORDS_8(AE, 6C, 00, B6, 9F, EE, CD, 99) }
+	},
+	{ /* (2j + 1) * 16^19 * G */
+		{ BYTES_TO_WORDS_8(5F, 4F, 0E, 75, A8, AE, 72, 55),
+		  BYTES_TO_WORDS_8(E6, E0, 67, A5, 9A, CA, F5, CB),
+		  BYTES_TO_WORDS_8(9A, F2, 02, AA, F7, F0, 8F, 38),
+		  BYTES_TO_WORDS_8(EF, 5A, 4B, 84, 59, A9, D9, 55),
+		  BYTES_TO_WORDS_8(B0, 7D, A9, BC, 76, EB, 58, C8),
+		  BYTES_TO_WORDS_8(15, 1B, AD, 33, C6, 10, 98, 4C),
+		  BYTES_TO_WORDS_8(52, EC, C8, BC, 4F, 57, 6D, 76),
+		  BYTES_TO_WORDS_8(03, D2, DA, A5, 9A, 7F, CB, 69) },
+		{ BYTES_TO_WORDS_8(E9, 42, B1, FE, 87, 98, 6A, C0),
+		  BYTES_TO_WORDS_8(FB, FC, 07, 46, 06, EB, 76, C1),
+		  BYTES_TO_WORDS_8(80, D4, AE, 8F, 83, 86, 4D, 79),
+		  BYTES_TO_WORDS_8(11, 3E, 6F, E4, EB, 43, 00, 4B),
+		  BYTES_TO_WORDS_8(52, 85, C6, 62, 2D, C5, B2, 04),
+		  BYTES_TO_WORDS_8(88, 58, 12, 3A, 0F, 29, 23, 0F),
+		  BYTES_TO_WORDS_8(87, 2D, 22, 36, 46, 88, 17, DB),
+		  BYTES_TO_WORDS_8(1A, AC, 0D, A3, 23, CF, 3C, 17) },
+		{ BYTES_TO_WORDS_8(96, AA, F1, 17, E7, 4A, DD, F6),
+		  BYTES_TO_WORDS_8(81, 64, FF, 34, F7, A5, D7, 13),
+		  BYTES_TO_WORDS_8(C5, 63, 34, B7, CB, 8D, 72, 32),
+		  BYTES_TO_WORDS_8(C2, 6F, AD, 92, 79, D2, EA, 79),
+		  BYTES_TO_WORDS_8(B7, 3F, 0A, 4B, CE, 71, BA, 80),
+		  BYTES_TO_WORDS_8(5A, 95, B3, 11, 11, D7, 84, DE),
+		  BYTES_TO_WORDS_8(42, 65, 25, 56, 93, 43, 6E, 1A),
+		  BYTES_TO_WORDS_8(BF, DA, AA, FB, CF, E9, 5D, A9) },
+		{ BYTES_TO_WORDS_8(E6, 9A, 3A, F9, 72, CA, 05, C8),
+		  BYTES_TO_WORDS_8(AD, F8, 77, 9C, 05, AA, E0, 8E),
+		  BYTES_TO_WORDS_8(3F, 74, AD, 31, 36, 9E, 27, B5),
+		  BYTES_TO_WORDS_8(CE, A1, 4D, F2, 50, 00, 8E, 31),
+		  BYTES_TO_WORDS_8(79, 7D, 44, DC, 94, 56, 4B, 18),
+		  BYTES_TO_WORDS_8(EE, A8, D3, AE, DB, 6F, 53, 94),
+		  BYTES_TO_WORDS_8(D0, 4B, 50, 1E, A5, 7C, D1, F4),
+		  BYTES_TO_WORDS_8(99, 92, CE, 19, 11, EE, 92, 27) },
+		{ BYTES_TO_WORDS_8(5A, 58, 30, DD, B4, 45, 79, 13),
+		  BYTES_TO_WORDS_8(95, 14, 50, A3, 1A, 8A, FF, 95),
+		  BYTES_TO_WORDS_8(B4, A4, C0, 90, F4, 32, 80, B8),
+		  BYTES_TO_WORDS_8(3B, E4, F1, D2, 71, 54, BC, 6B),
+		  BYTES_TO_WORDS_8(F3, 05, 8B, 34, EF, 7E, F9, 6A),
+		  BYTES_TO_WORDS_8(D9, EA, F9, 02, 81, 42, F0, 09),
+		  BYTES_TO_WORDS_8(BE, 26, 22, 5F, B1, E2, 9E, 4A),
+		  BYTES_TO_WORDS_8(F0, 29, 15, 0C, 9B, 18, 7B, 46) },
+		{ BYTES_TO_WORDS_8(75, 62, 13, C0, 08, F8, 24, 26),
+		  BYTES_TO_WORDS_8(35, 75, 87, 73, 01, C0, 47, A6),
+		  BYTES_TO_WORDS_8(78, 0D, 76, F7, 90, 1A, B5, 89),
+		  BYTES_TO_WORDS_8(11, FD, C1, 10, C6, 48, 01, 94),
+		  BYTES_TO_WORDS_8(47, AA, 97, 59, 11, A1, 63, 5D),
+		  BYTES_TO_WORDS_8(42, 1A, 4E, 60, E5, 3A, 4B, 5D),
+		  BYTES_TO_WORDS_8(69, D6, 05, B5, 4A, 4C, A2, 7A),
+		  BYTES_TO_WORDS_8(F7, A4, 67, 13, 5F, F9, 67, 69) },
+		{ BYTES_TO_WORDS_8(50, E8, 0F, 9F, D3, 3D, A1, C3),
+		  BYTES_TO_WORDS_8(BD, A7, 11, E5, 0B, 23, 4D, 86),
+		  BYTES_TO_WORDS_8(8E, F9, A5, 8D, 92, 6C, B5, 91),
+		  BYTES_TO_WORDS_8(9C, B4, 39, 60, 92, 33, 18, C4),
+		  BYTES_TO_WORDS_8(6D, 66, 38, BD, 46, F4, 58, 13),
+		  BYTES_TO_WORDS_8(F0, 0A, 1A, E0, C9, 7E, 5A, 06),
+		  BYTES_TO_WORDS_8(58, D5, AF, 26, D4, 95, 80, EB),
+		  BYTES_TO_WORDS_8(7A, 0F, D4, C8, C9, FE, 37, 35) },
+		{ BYTES_TO_WORDS_8(BE, 7F, 93, 74, 37, 41, E4, CF),
+		  BYTES_TO_WORDS_8(6E, BA, 51, F0, DD, 4D, B0, C0),
+		  BYTES_TO_WORDS_8(46, F5, 96, AF, 01, 40, C1, E0),
+		  BYTES_TO_WORDS_8(70, 7D, C6, 27, F6, A3, AB, 2B),
+		  BYTES_TO_WORDS_8(F4, 1D, 3A, 57, 57, E5, 90, 93),
+		  BYTES_TO_WORDS_8(10, 81, AC, 90, B1, C4, 2D, EC),
+		  BYTES_TO_WORDS_8(C9, AB, 4E, 92, CD, B0, 83, D7),
+		  BYTES_TO_WORDS_8(88, 8B, 20, B2, 65, C7, E5, 77) }
+	},
+	{ /* (2j + 1) * 16^20 * G */
+		{ BYTES_TO_WORDS_8(4C, 96, 51, 43, DE, D2, D3, D4),
+		  BYTES_TO_WORDS_8(C1, 12, 54, 6F, 37, 24, 69, 34),
+		  BYTES_TO_WORDS_8(08, 5C, 75, 85, A1, BC, 5A, AE),
+		  BYTES_TO_WORDS_8(7F, C4, 28, BE, 59, F9, 29, 6E),
+		  BYTES_TO_WORDS_8(8F, D8, 3F, 56, BD, 24, 88, 11),
+		  BYTES_TO_WORDS_8(63, FB, 0B, 7A, 52, 0C, 64, EF),
+		  BYTES_TO_WORDS_8(6D, 24, 84, C1, 6C, EC, 52, 50),
+		  BYTES_TO_WORDS_8(F6, 32, 0F, 50, 9F, 5D, 56, 34) },
+		{ BYTES_TO_WORDS_8(CC, 49, 0E, 8C, 03, 01, 95, 3F),
+		  BYTES_TO_WORDS_8(0D, 40, C5, 5B, A8, 2D, 23, 41),
+		  BYTES_TO_WORDS_8(ED, 40, B7, CB, DE, 88, 82, DD),
+		  BYTES_TO_WORDS_8(6E, 0F, 97, 78, A9, D4, 91, D6),
+		  BYTES_TO_WORDS_8(52, 41, 0F, D0, C1, B4, 0B, DD),
+		  BYTES_TO_WORDS_8(F2, 43, D0, 2A, D0, E1, 5B, AC),
+		  BYTES_TO_WORDS_8(52, 0C, 3E, 76, B5, BD, FB, F7),
+		  BYTES_TO_WORDS_8(97, F3, 78, 4B, 87, E7, 79, 7A) },
+		{ BYTES_TO_WORDS_8(0A, 93, 9B, 2B, 9F, 6B, 87, 3D),
+		  BYTES_TO_WORDS_8(8F, F5, 30, 45, 2A, 35, B1, DE),
+		  BYTES_TO_WORDS_8(49, BC, 7B, 7A, DF, B7, E5, DE),
+		  BYTES_TO_WORDS_8(C5, D7, E0, A2, 46, 68, 5D, 2A),
+		  BYTES_TO_WORDS_8(CA, AE, 2C, 3B, 5F, 34, FF, 86),
+		  BYTES_TO_WORDS_8(85, 16, 27, 5E, 43, 73, 5B, EA),
+		  BYTES_TO_WORDS_8(58, AB, C4, 03, 39, F0, CC, E5),
+		  BYTES_TO_WORDS_8(6D, 47, 76, 68, 09, 7C, 3D, DC) },
+		{ BYTES_TO_WORDS_8(EF, 59, 69, 81, D2, CB, 7D, FA),
+		  BYTES_TO_WORDS_8(9A, B5, 1D, 74, 56, D0, 79, 76),
+		  BYTES_TO_WORDS_8(F8, 5D, 27, 2E, 41, 31, 04, 2F),
+		  BYTES_TO_WORDS_8(26, B5, 9B, 38, 6A, 49, 64, 87),
+		  BYTES_TO_WORDS_8(10, 50, CD, E0, CB, 11, 03, 66),
+		  BYTES_TO_WORDS_8(F1, E3, F9, 72, 41, AD, 56, 28),
+		  BYTES_TO_WORDS_8(1F, 96, ED, 96, 27, 41, 0B, 9E),
+		  BYTES_TO_WORDS_8(FD, 2F, 00, 1D, D6, 69, 9B, 59) },
+		{ BYTES_TO_WORDS_8(84, 0F, EF, 3A, CE, 09, 94, 63),
+		  BYTES_TO_WORDS_8(B9, 75, 1C, 87, 6A, 50, BB, B0),
+		  BYTES_TO_WORDS_8(CA, B8, AD, 17, AC, 3F, DE, 33),
+		  BYTES_TO_WORDS_8(B1, 71, 24, 81, BC, 93, D3, 94),
+		  BYTES_TO_WORDS_8(C1, A7, 8B, 37, B9, 61, AE, 85),
+		  BYTES_TO_WORDS_8(2A, F1, AC, 50, 26, 40, 3F, DD),
+		  BYTES_TO_WORDS_8(07, 9A, 23, 6B, 38, BC, 1C, 1E),
+		  BYTES_TO_WORDS_8(F2, 63, 4B, EB, B4, 6A, 82, 5A) },
+		{ BYTES_TO_WORDS_8(B7, D1, FE, EF, 84, 57, 45, ED),
+		  BYTES_TO_WORDS_8(B4, A3, 4A, 56, 26, D1, DB, E2),
+		  BYTES_TO_WORDS_8(2E, BD, 34, 2D, 70, 09, 75, D1),
+		  BYTES_TO_WORDS_8(2D, 4E, 9E, 88, A0, B5, 72, 4A),
+		  BYTES_TO_WORDS_8(5F, DC, 01, 96, D8, 9F, F2, B5),
+		  BYTES_TO_WORDS_8(45, 98, 4D, C7, 8E, 4B, E6, 85),
+		  BYTES_TO_WORDS_8(96, EA, C8, 47, C0, 3F, C3, C8),
+		  BYTES_TO_WORDS_8(E2, 20, 1D, 4A, EA, E6, 31, 35) },
+		{ BYTES_TO_WORDS_8(17, 73, 46, D0, 25, 3F, 04, 02),
+		  BYTES_TO_WORDS_8(6A, 18, D9, D8, 41, DC, 41, 91),
+		  BYTES_TO_WORDS_8(00, 79, DE, FA, F2, 66, 86, A7),
+		  BYTES_TO_WORDS_8(15, 1E, 37, 5A, FC, 1C, F0, D7),
+		  BYTES_TO_WORDS_8(4E, 01, 7D, CF, D5, 57, B9, 5C),
+		  BYTES_TO_WORDS_8(89, BD, 7F, 69, 43, 17, A0, 28),
+		  BYTES_TO_WORDS_8(57, EF, 15, 6C, 40, 61, 73, EC),
+		  BYTES_TO_WORDS_8(26, 6C, 72, 87, D9, BB, 8D, 88) },
+		{ BYTES_TO_WORDS_8(C1, 02, EA, 7D, 0A, 59, D7, 3B),
+		  BYTES_TO_WORDS_8(7C, 08, 74, C7, B7, B9, FB, E4),
+		  BYTES_TO_WORDS_8(06, 12, E3, 91, 9D, BF, 80, BE),
+		  BYTES_TO_WORDS_8(1B, 37, 7C, F7, B9, A0, 50, 7E),
+		  BYTES_TO_WORDS_8(01, C2, 45, ED, DF, 46, C9, 33),
+		  BYTES_TO_WORDS_8(28, 1B, 8E, 15, 4F, 93, 23, 74),
+		  BYTES_TO_WORDS_8(17, 95, 8B, DB, 1D, 6F, 6C, 61),
+		  BYTES_TO_WORDS_8(9C, E2, 0F, 4E, 3C, 5D, 40, C3) }
+	},
+	{ /* (2j + 1) * 16^21 * G */
+		{ BYTES_TO_WORDS_8(80, 12, B7, 0C, 11, D4, A7, 28),
+		  BYTES_TO_WORDS_8(11, 63, 45, A8, 59, C2, 41, C1),
+		  BYTES_TO_WORDS_8(8E, 45, 6F, 79, F0, 2E, 0F, C0),
+		  BYTES_TO_WORDS_8(D9, EE, BF, B2, 9E, 6A, 04, FF),
+		  BYTES_TO_WORDS_8(19, 39, C3, 5E, 1F, 27, C3, 7E),
+		  BYTES_TO_WORDS_8(7A, 48, 28, BD, 6E, 6E, 2B, 01),
+		  BYTES_TO_WORDS_8(C9, FC, 4C, DD, DB, ED, 01, 0A),
+		  BYTES_TO_WORDS_8(17, 3A, 95, C0, AC, 55, 2F, 43) },
+		{ BYTES_TO_WORDS_8(E3, 3C, CA, 33, AA, 82, 27, 5F),
+		  BYTES_TO_WORDS_8(E2, 77, 6A, AB, 65, 18, 2B, EF),
+		  BYTES_TO_WORDS_8(1F, 23, 12, 53, 1F, BC, 95, 1A),
+		  BYTES_TO_WORDS_8(D3, DC, D3, 14, 5D, C4, 17, F7),
+		  BYTES_TO_WORDS_8(E9, 88, ED, 50, DB, CC, 94, 68),
+		  BYTES_TO_WORDS_8(F0, 6D, 17, DC, BD, E2, 53, AF),
+		  BYTES_TO_WORDS_8(55, EE, AD, 0A, ED, 54, 9B, CA),
+		  BYTES_TO_WORDS_8(2D, 51, 99, 8C, 76, 40, 2C, 42) },
+		{ BYTES_TO_WORDS_8(88, CD, 28, 5B, 0D, 43, 68, C3),
+		  BYTES_TO_WORDS_8(9A, BD, A9, 02, 75, 09, 8E, 73),
+		  BYTES_TO_WORDS_8(2C, B3, 91, 7F, 62, B5, FE, C2),
+		  BYTES_TO_WORDS_8(20, 0B, 37, F3, B4, 69, E2, 60),
+		  BYTES_TO_WORDS_8(6C, 06, E2, 2B, A4, A8, 9B, E2),
+		  BYTES_TO_WORDS_8(B0, 46, C8, C6, 38, 61, 45, 02),
+		  BYTES_TO_WORDS_8(76, DF, 28, 97, 88, 11, 92, 60),
+		  BYTES_TO_WORDS_8(A9, F0, 79, 65, 5A, 17, 00, FE) },
+		{ BYTES_TO_WORDS_8(94, C5, 1C, 86, 32, 19, 3B, 15),
+		  BYTES_TO_WORDS_8(6B, 53, D0, 04, 17, DD, 4B, 96),
+		  BYTES_TO_WORDS_8(55, 68, B4, FC, 05, BA, A5, 0A),
+		  BYTES_TO_WORDS_8(49, 99, 73, E6, A1, 97, 92, 79),
+		  BYTES_TO_WORDS_8(9E, 30, 8D, 0F, 92, 10, 91, 9E),
+		  BYTES_TO_WORDS_8(90, 6E, AC, 0B, AE, 86, DA, 27),
+		  BYTES_TO_WORDS_8(01, E5, 9F, 78, 18, 91, 06, E1),
+		  BYTES_TO_WORDS_8(B0, C9, 23, D5, 8C, F1, 2F, 13) },
+		{ BYTES_TO_WORDS_8(BA, 0A, 2D, 57, A2, 47, 8C, DC),
+		  BYTES_TO_WORDS_8(16, 1B, 7E, C7, AD, 90, D1, D8),
+		  BYTES_TO_WORDS_8(1D, 24, 01, 55, EB, 0E, EE, 79),
+		  BYTES_TO_WORDS_8(70, 80, 42, FE, 4E, E9, 9B, 2D),
+		  BYTES_TO_WORDS_8(76, 08, FA, 31, FB, 31, F7, F8),
+		  BYTES_TO_WORDS_8(E6, 10, B7, 88, 79, C6, D1, BA),
+		  BYTES_TO_WORDS_8(1B, D9, 19, B6, 34, F9, 5E, 29),
+		  BYTES_TO_WORDS_8(A2, 98, E8, E9, B5, 8D, 70, A9) },
+		{ BYTES_TO_WORDS_8(32, 87, 5E, 35, 48, 7B, C0, E0),
+		  BYTES_TO_WORDS_8(31, 1E, 6D, 50, DE, 2E, A6, CF),
+		  BYTES_TO_WORDS_8(43, C2, 92, 14, 53, C6, CB, 60),
+		  BYTES_TO_WORDS_8(16, 42, 82, C8, 9E, 03, 27, 21),
+		  BYTES_TO_WORDS_8(07, CC, CA, 60, F4, 35, 92, D5),
+		  BYTES_TO_WORDS_8(68, BD, D7, BA, F3, F3, 93, D6),
+		  BYTES_TO_WORDS_8(5C, 0A, 7F, BB, DB, B9, 94, 01),
+		  BYTES_TO_WORDS_8(AA, 35, AE, 23, 6F, 9C, 21, 85) },
+		{ BYTES_TO_WORDS_8(47, 33, 08, F2, 0C, 34, 91, 60),
+		  BYTES_TO_WORDS_8(22, 53, 1A, 77, E6, E3, 1A, 9E),
+		  BYTES_TO_WORDS_8(2B, B4, 02, BA, 5A, 0F, AD, 97),
+		  BYTES_TO_WORDS_8(EB, E0, D8, 2B, 4B, B5, B5, FA),
+		  BYTES_TO_WORDS_8(2F, FD, 38, 3D, D8, 9C, CC, 9C),
+		  BYTES_TO_WORDS_8(FA, 9A, A6, 16, A6, 37, 5E, C0),
+		  BYTES_TO_WORDS_8(AF, 3E, 0A, 26, F2, AA, 87, 3C),
+		  BYTES_TO_WORDS_8(50, 41, 6D, 18, 16, D1, 58, 57) },
+		{ BYTES_TO_WORDS_8(54, 25, 57, FF, 14, 26, 67, 3F),
+		  BYTES_TO_WORDS_8(B7, DA, F4, 18, 47, 2E, 84, F3),
+		  BYTES_TO_WORDS_8(6F, A5, 7E, 0B, 77, 96, 90, 57),
+		  BYTES_TO_WORDS_8(CA, 1F, 97, 27, 57, 27, 5D, 68),
+		  BYTES_TO_WORDS_8(03, 9E, 97, A0, D0, F6, 1A, B7),
+		  BYTES_TO_WORDS_8(A4, CC, F4, C0, 2A, AA, 8A, C5),
+		  BYTES_TO_WORDS_8(7C, 37, E0, 41, 80, 9C, E3, 06),
+		  BYTES_TO_WORDS_8(FC, 45, AB, 20, C2, 89, 2F, A8) }
+	},
+	{ /* (2j + 1) * 16^22 * G */
+		{ BYTES_TO_WORDS_8(50, 2E, 85, C5, 4C, B2, D0, C7),
+		  BYTES_TO_WORDS_8(C5, 0C, 57, CF, 63, 7E, 2C, 8B),
+		  BYTES_TO_WORDS_8(FF, 7E, EE, 49, 23, AA, F9, C1),
+		  BYTES_TO_WORDS_8(58, B0, AB, FE, DF, C7, 86, E4),
+		  BYTES_TO_WORDS_8(7D, 10, CF, AE, AD, 3C, BA, 66),
+		  BYTES_TO_WORDS_8(D8, EB, 92, 33, D6, 63, 44, 69),
+		  BYTES_TO_WORDS_8(5A, E0, 51, 9F, 5C, 8A, E8, 9E),
+		  BYTES_TO_WORDS_8(2E, A1, 06, 56, ED, 75, FD, 51) },
+		{ BYTES_TO_WORDS_8(07, 19, 88, 5C, 45, A6, 6A, C6),
+		  BYTES_TO_WORDS_8(DA, B1, 00, 5B, 73, 86, 2C, 14),
+		  BYTES_TO_WORDS_8(15, 04, AE, 66, CC, 05, 41, 96),
+		  BYTES_TO_WORDS_8(7C, FB, 2F, 8E, BB, 44, CF, 4A),
+		  BYTES_TO_WORDS_8(FC, DA, 3C, F6, 56, B4, 26, 29),
+		  BYTES_TO_WORDS_8(25, 4B, D8, 7C, 2F, 2B, 35, 99),
+		  BYTES_TO_WORDS_8(57, 54, 0A, D1, 5A, 28, 44, 35),
+		  BYTES_TO_WORDS_8(7B, 58, FD, 0F, FE, A8, 99, AD) },
+		{ BYTES_TO_WORDS_8(3F, 38, 39, 74, 69, E0, BA, 82),
+		  BYTES_TO_WORDS_8(AA, A2, 01, B6, 62, A5, FF, 34),
+		  BYTES_TO_WORDS_8(EC, 4E, 23, C8, 92, A2, 7A, DD),
+		  BYTES_TO_WORDS_8(49, A6, 88, 41, 83, 22, DF, 4D),
+		  BYTES_TO_WORDS_8(37, 23, D5, 23, 18, A8, 2F, 63),
+		  BYTES_TO_WORDS_8(69, 82, 1F, 13, 45, D0, D5, 3D),
+		  BYTES_TO_WORDS_8(6B, 0C, 8C, D3, 97, AE, AB, 74),
+		  BYTES_TO_WORDS_8(3D, 88, 91, 0D, 7B, 62, 1C, E7) },
+		{ BYTES_TO_WORDS_8(F4, B4, 22, 58, 15, 88, DC, 26),
+		  BYTES_TO_WORDS_8(8F, DF, 65, F8, FC, 3A, 35, A5),
+		  BYTES_TO_WORDS_8(9B, F3, 7B, 79, E0, E9, 34, 13),
+		  BYTES_TO_WORDS_8(9E, 87, 79, 13, 79, 65, B0, 58),
+		  BYTES_TO_WORDS_8(CA, FB, 60, 0C, 21, A8, 07, 66),
+		  BYTES_TO_WORDS_8(59, 52, 4E, FC, 76, A0, A4, 1C),
+		  BYTES_TO_WORDS_8(6C, 83, 62, 02, 5F, A5, 7C, 02),
+		  BYTES_TO_WORDS_8(37, 2C, 5A, 14, A4, 8A, A9, 55) },
+		{ BYTES_TO_WORDS_8(B0, 39, FE, 34, 0C, D1, 2B, 4B),
+		  BYTES_TO_WORDS_8(D1, DE, B4, 74, CD, 73, 31, 8A),
+		  BYTES_TO_WORDS_8(35, 1F, 38, 23, 1C, 44, 3A, 76),
+		  BYTES_TO_WORDS_8(29, 35, 4B, A6, 58, E0, 45, A3),
+		  BYTES_TO_WORDS_8(DC, 79, AF, AB, 0B, 48, 09, 37),
+		  BYTES_TO_WORDS_8(F5, 9D, 36, AB, 75, 6A, 8C, CE),
+		  BYTES_TO_WORDS_8(49, D9, F9, 28, 5B, 85, F0, 91),
+		  BYTES_TO_WORDS_8(0F, A7, CA, D5, A6, D5, 6D, 7C) },
+		{ BYTES_TO_WORDS_8(FB, 95, 66, 92, B9, 07, BE, 3F),
+		  BYTES_TO_WORDS_8(E1, DE, 3A, E4, 9F, BB, D0, AF),
+		  BYTES_TO_WORDS_8(B6, CC, D6, 46, 87, CB, 1A, 20),
+		  BYTES_TO_WORDS_8(C8, A2, 90, 01, 83, BF, 10, 3A),
+		  BYTES_TO_WORDS_8(47, 7E, EB, A4, B2, 72, 5C, 75),
+		  BYTES_TO_WORDS_8(88, 52, D4, 43, 6C, EA, 8F, F2),
+		  BYTES_TO_WORDS_8(C5, 65, 8A, 68, 48, 38, 20, 76),
+		  BYTES_TO_WORDS_8(15, 27, 1A, EC, B3, 85, D5, B5) },
+		{ BYTES_TO_WORDS_8(14, 86, 2C, 7D, 96, 8E, 1A, 24),
+		  BYTES_TO_WORDS_8(96, 45, 58, 60, 0A, 96, B0, A7),
+		  BYTES_TO_WORDS_8(76, 28, 91, 30, AC, F5, 5C, CA),
+		  BYTES_TO_WORDS_8(33, 04, 01, C9, FA, DD, FB, 12),
+		  BYTES_TO_WORDS_8(74, B1, B0, 58, 1D, BC, 77, F0),
+		  BYTES_TO_WORDS_8(95, F4, 19, 9C, 23, 58, 42, 4D),
+		  BYTES_TO_WORDS_8(B5, CF, D2, 8C, 42, 91, FD, 33),
+		  BYTES_TO_WORDS_8(68, 80, 27, 90, D2, 20, FF, A5) },
+		{ BYTES_TO_WORDS_8(AF, EE, 9A, 2D, 30, 64, F7, 53),
+		  BYTES_TO_WORDS_8(86, FC, 5A, A0, 4C, 79, D0, 05),
+		  BYTES_TO_WORDS_8(30, 9A, F9, FA, A1, E3, 8A, 7B),
+		  BYTES_TO_WORDS_8(77, 78, B9, A2, 59, E8, EC, 8B),
+		  BYTES_TO_WORDS_8(5E, EB, F9, 85, 3C, DA, A0, 55),
+		  BYTES_TO_WORDS_8(F7, 80, 89, 6F, 8F, 03, 22, BB),
+		  BYTES_TO_WORDS_8(68, C3, FF, 0E, 0B, 91, B8, FB),
+		  BYTES_TO_WORDS_8(FC, 51, 06, C5, C4, 33, F9, 35) }
+	},
+	{ /* (2j + 1) * 16^23 * G */
+		{ BYTES_TO_WORDS_8(78, 91, 51, 2B, EC, B8, B6, 84),
+		  BYTES_TO_WORDS_8(C5, 1F, 3D, A4, 98, 99, 3B, B6),
+		  BYTES_TO_WORDS_8(0A, EE, E2, B5, F8, 8C, E0, CF),
+		  BYTES_TO_WORDS_8(30, 04, E5, B5, 4B, 7F, 1D, F4),
+		  BYTES_TO_WORDS_8(51, 35, 6A, CA, 5D, 66, A1, A7),
+		  BYTES_TO_WORDS_8(F9, E1, 19, 69, C3, AC, 49, AB),
+		  BYTES_TO_WORDS_8(47, 23, A8, FA, E3, 6D, 04, F1),
+		  BYTES_TO_WORDS_8(D6, F8, 9A, BD, BE, 69, A6, E6) },
+		{ BYTES_TO_WORDS_8(D9, 01, 35, 1E, 3E, 31, 71, 1A),
+		  BYTES_TO_WORDS_8(8B, FC, 61, BB, E1, 2C, E8, 1B),
+		  BYTES_TO_WORDS_8(61, 3E, 2D, D6, 91, D6, 32, 33),
+		  BYTES_TO_WORDS_8(7F, 4E, 2D, D6, 7E, 82, 5F, D6),
+		  BYTES_TO_WORDS_8(9E, 75, 55, EB, C6, 46, 94, AB),
+		  BYTES_TO_WORDS_8(E1, 0B, 73, 5D, AD, 3A, C1, 61),
+		  BYTES_TO_WORDS_8(FC, 87, 6B, 16, A5, 7C, 7B, 53),
+		  BYTES_TO_WORDS_8(FE, 90, 9A, F0, FC, 60, 4B, F2) },
+		{ BYTES_TO_WORDS_8(4E, D8, 2E, 0F, 24, FE, 62, CB),
+		  BYTES_TO_WORDS_8(12, EA, E2, 5F, F3, 4D, 99, E7),
+		  BYTES_TO_WORDS_8(AD, C0, 2C, 78, B5, C8, E6, 5E),
+		  BYTES_TO_WORDS_8(38, 5C, B0, DE, B6, B5, A9, 55),
+		  BYTES_TO_WORDS_8(A3, 95, 64, 54, 50, C5, 9D, 57),
+		  BYTES_TO_WORDS_8(F0, D8, A0, 12, D7, B4, FF, E8),
+		  BYTES_TO_WORDS_8(3A, F4, D7, 0E, 19, 4D, 17, 29),
+		  BYTES_TO_WORDS_8(AB, 19, 9F, AC, 96, 21, F2, C4) },
+		{ BYTES_TO_WORDS_8(A2, 95, 54, 07, 87, CF, D2, 9B),
+		  BYTES_TO_WORDS_8(B2, 00, BC, 48, B6, 1E, DE, 9F),
+		  BYTES_TO_WORDS_8(C4, 8B, 54, 62, 0A, D6, 7E, 1F),
+		  BYTES_TO_WORDS_8(DA, 71, DB, C7, 6D, 57, DE, 79),
+		  BYTES_TO_WORDS_8(B8, 6F, EC, AA, 6A, 8C, 2C, 80),
+		  BYTES_TO_WORDS_8(46, A7, 93, 64, 09, F5, 14, 83),
+		  BYTES_TO_WORDS_8(C6, 79, DC, 47, AE, 6D, 5E, 78),
+		  BYTES_TO_WORDS_8(02, 6A, 18, 6B, 0E, 3D, 2D, 3B) },
+		{ BYTES_TO_WORDS_8(BB, E7, D1, 82, CC, 2A, E9, EE),
+		  BYTES_TO_WORDS_8(4C, 96, 11, 35, 90, FF, C3, 24),
+		  BYTES_TO_WORDS_8(55, E5, 57, 59, 69, B3, 64, E2),
+		  BYTES_TO_WORDS_8(B6, 04, 24, 16, 32, 4E, E0, 8F),
+		  BYTES_TO_WORDS_8(4F, E8, 62, DA, D0, 9A, 75, DA),
+		  BYTES_TO_WORDS_8(8C, 6A, 04, 6F, 64, 64, 91, 5B),
+		  BYTES_TO_WORDS_8(4E, B3, 8D, 7A, A5, CE, D6, E5),
+		  BYTES_TO_WORDS_8(8F, 35, F6, 22, 50, DB, 87, 39) },
+		{ BYTES_TO_WORDS_8(60, C3, F7, 69, EC, 4A, 1A, 10),
+		  BYTES_TO_WORDS_8(C2, 85, 80, E4, 77, D5, FC, 4E),
+		  BYTES_TO_WORDS_8(E2, 24, D2, 68, 63, 4A, A9, 50),
+		  BYTES_TO_WORDS_8(F1, F8, ED, 57, 09, 99, F4, 3A),
+		  BYTES_TO_WORDS_8(7B, 7A, 7D, 68, AA, C2, 9D, D3),
+		  BYTES_TO_WORDS_8(5C, 89, 60, 27, D6, 4D, 55, 48),
+		  BYTES_TO_WORDS_8(33, 3C, 73, 2E, 48, 86, 1F, 53),
+		  BYTES_TO_WORDS_8(1D, D9, B1, D3, 30, 60, 70, D1) },
+		{ BYTES_TO_WORDS_8(BE, 73, 03, 77, AE, 23, A5, 39),
+		  BYTES_TO_WORDS_8(B5, D3, 63, 12, 22, 06, 3D, 21),
+		  BYTES_TO_WORDS_8(4E, 7C, 22, FE, F3, 82, A5, C1),
+		  BYTES_TO_WORDS_8(76, 80, 3C, 62, 5C, E0, A7, 31),
+		  BYTES_TO_WORDS_8(A8, 50, 09, E9, 90, 87, D7, 8E),
+		  BYTES_TO_WORDS_8(30, 54, A2, 51, 99, 2B, E8, 8C),
+		  BYTES_TO_WORDS_8(1E, DB, 23, 34, AE, 0A, 1B, 02),
+		  BYTES_TO_WORDS_8(67, DE, D1, F8, F3, 2E, 3D, C2) },
+		{ BYTES_TO_WORDS_8(45, 3B, 92, CB, ED, 10, 26, B4),
+		  BYTES_TO_WORDS_8(BD, 24, 3E, F1, BF, 9F, 3A, A3),
+		  BYTES_TO_WORDS_8(58, 84, D9, 2D, 46, 13, 55, D1),
+		  BYTES_TO_WORDS_8(3E, D2, 56, 13, 48, 66, 0A, 74),
+		  BYTES_TO_WORDS_8(5F, AA, EC, 51, 38, 3E, C1, A8),
+		  BYTES_TO_WORDS_8(0B, 48, C8, 07, 39, 99, 97, A8),
+		  BYTES_TO_WORDS_8(CF, 06, 56, A7, 88, 47, 4E, 2F),
+		  BYTES_TO_WORDS_8(3F, 52, CD, 25, 8C, 04, 6D, 7F) }
+	},
+	{ /* (2j + 1) * 16^24 * G */
+		{ BYTES_TO_WORDS_8(8E, 21, 12, 75, 39, A9, 4A, A8),
+		  BYTES_TO_WORDS_8(41, 01, CA, 74, B0, 21, A5, E9),
+		  BYTES_TO_WORDS_8(02, E9, A2, 18, 3A, 0B, 88, 57),
+		  BYTES_TO_WORDS_8(A6, 77, A6, 12, 66, 50, 5B, 4A),
+		  BYTES_TO_WORDS_8(40, 38, 4F, 4C, 7A, DA, EA, 0B),
+		  BYTES_TO_WORDS_8(9D, 6D, E2, 19, 54, B1, 6D, 62),
+		  BYTES_TO_WORDS_8(40, 7D, 62, E1, FB, 04, 26, C4),
+		  BYTES_TO_WORDS_8(F1, 89, C0, EA, 1C, 46, 13, EB) },
+		{ BYTES_TO_WORDS_8(FD, 73, 84, 51, E2, 40, EF, 52),
+		  BYTES_TO_WORDS_8(91, 33, 97, C6, 6B, 02, B9, BB),
+		  BYTES_TO_WORDS_8(E3, A9, 28, 97, B9, 2A, 29, 85),
+		  BYTES_TO_WORDS_8(A0, 8B, 31, 33, 32, 06, 64, 10),
+		  BYTES_TO_WORDS_8(05, F8, 5C, 78, 2E, 16, A6, AF),
+		  BYTES_TO_WORDS_8(39, D0, 21, 0C, 0D, 19, BE, CF),
+		  BYTES_TO_WORDS_8(3C, 88, 85, 65, 9E, 82, E7, C8),
+		  BYTES_TO_WORDS_8(D8, A2, 8B, 3B, 82, 32, 68, 9C) },
+		{ BYTES_TO_WORDS_8(F3, 30, 3F, 65, C8, EE, 67, 35),
+		  BYTES_TO_WORDS_8(DD, 38, A2, ED, D2, 3E, 42, 2B),
+		  BYTES_TO_WORDS_8(21, 3F, 08, 54, 0D, 41, DA, 5E),
+		  BYTES_TO_WORDS_8(BF, 27, 5F, F0, 8F, AD, C8, 38),
+		  BYTES_TO_WORDS_8(7B, 21, E9, EB, 49, E7, 60, A0),
+		  BYTES_TO_WORDS_8(37, DF, 59, 29, 98, FA, 83, 65),
+		  BYTES_TO_WORDS_8(1F, 64, BD, DD, 54, 96, 90, F3),
+		  BYTES_TO_WORDS_8(16, B1, DC, 76, 78, 61, C2, 83) },
+		{ BYTES_TO_WORDS_8(84, 15, EF, B6, 11, 69, 3E, 54),
+		  BYTES_TO_WORDS_8(BF, 0C, 92, 8F, A3, A2, A9, 77),
+		  BYTES_TO_WORDS_8(42, 18, 35, FD, E3, FB, 58, 58),
+		  BYTES_TO_WORDS_8(09, BB, 60, E8, BC, 8C, CB, 6F),
+		  BYTES_TO_WORDS_8(F2, 10, 31, 1D, C2, F7, C9, C3),
+		  BYTES_TO_WORDS_8(25, 43, 8A, 92, D6, F6, 92, 59),
+		  BYTES_TO_WORDS_8(9D, 45, 30, AC, 23, 08, 4C, D5),
+		  BYTES_TO_WORDS_8(76, 1D, 72, 8B, 3D, A8, F1, A8) },
+		{ BYTES_TO_WORDS_8(EF, 55, 22, 46, 40, 13, F5, E8),
+		  BYTES_TO_WORDS_8(8C, 07, 64, 67, 34, 1D, D7, 50),
+		  BYTES_TO_WORDS_8(EE, B0, 45, DE, 90, 5C, 51, 73),
+		  BYTES_TO_WORDS_8(BD, E2, 76, 3F, B9, D0, 11, 78),
+		  BYTES_TO_WORDS_8(2E, 25, E3, 1B, 9B, EF, 8B, A5),
+		  BYTES_TO_WORDS_8(68, 37, D4, 3A, 51, D0, 1E, F5),
+		  BYTES_TO_WORDS_8(32, 51, B8, 01, 94, 2E, C0, 54),
+		  BYTES_TO_WORDS_8(7A, AC, B5, 0B, 37, 76, BB, 99) },
+		{ BYTES_TO_WORDS_8(A7, 2E, 3D, 35, F1, 10, E1, 93),
+		  BYTES_TO_WORDS_8(50, 86, FA, A3, 23, 08, ED, 9E),
+		  BYTES_TO_WORDS_8(2A, 6F, 81, 5F, 9D, 72, 7B, 0C),
+		  BYTES_TO_WORDS_8(CE, 50, 8B, 4A, 94, 3D, 58, C3),
+		  BYTES_TO_WORDS_8(BD, 7B, 66, 0B, 9E, 3E, 18, 2B),
+		  BYTES_TO_WORDS_8(43, 1C, 5F, 51, A6, 25, C9, D6),
+		  BYTES_TO_WORDS_8(CD, CC, 9F, F8, 7E, 62, 64, 59),
+		  BYTES_TO_WORDS_8(0F, E9, 91, 93, C0, 7A, 96, 53) },
+		{ BYTES_TO_WORDS_8(99, 30, 2E, 50, E0, F0, DD, 8E),
+		  BYTES_TO_WORDS_8(65, 01, 84, 62, A6, 13, F2, 53),
+		  BYTES_TO_WORDS_8(0D, D0, 7A, BB, 18, F0, A0, F3),
+		  BYTES_TO_WORDS_8(01, E5, DE, 3C, 28, CF, 91, D5),
+		  BYTES_TO_WORDS_8(AF, C5, 5A, 45, 65, 27, BC, 33),
+		  BYTES_TO_WORDS_8(D6, 6F, 11, 8B, F8, EF, F2, 5C),
+		  BYTES_TO_WORDS_8(82, C5, 0B, 35, 0D, 33, 51, 4E),
+		  BYTES_TO_WORDS_8(E4, E6, 78, C4, CF, E5, EB, 87) },
+		{ BYTES_TO_WORDS_8(A5, 40, A9, 32, 46, 56, 26, 2B),
+		  BYTES_TO_WORDS_8(B1, E6, 14, A4, B5, 5E, 43, 4A),
+		  BYTES_TO_WORDS_8(71, E8, F9, A4, E1, 41, 12, C0),
+		  BYTES_TO_WORDS_8(C4, 35, 32, 2F, 61, 0D, AA, A0),
+		  BYTES_TO_WORDS_8(22, 04, 95, 8B, A6, 82, F8, 93),
+		  BYTES_TO_WORDS_8(93, BF, D1, A7, DD, 1C, 69, 6C),
+		  BYTES_TO_WORDS_8(3E, 1F, 18, A0, F9, 4C, B3, 19),
+		  BYTES_TO_WORDS_8(28, 64, F7, 76, BA, 0E, 34, 22) }
+	},
+	{ /* (2j + 1) * 16^25 * G */
+		{ BYTES_TO_WORDS_8(F0, 2D, 8E, 00, 37, D8, 28, 66),
+		  BYTES_TO_WORDS_8(F7, E5, 28, 43, 57, B2, C3, 32),
+		  BYTES_TO_WORDS_8(50, 0F, BE, 8B, DF, 29, 2C, 01),
+		  BYTES_TO_WORDS_8(95, B9, 2A, DE, 0B, 91, B3, 2E),
+		  BYTES_TO_WORDS_8(AE, EA, 74, D2, 4E, CC, 10, 09),
+		  BYTES_TO_WORDS_8(49, 5F, F6, EC, 20, D1, 40, 95),
+		  BYTES_TO_WORDS_8(9F, 99, A4, 8D, 34, 7D, D3, 77),
+		  BYTES_TO_WORDS_8(3A, 4B, 47, 37, 23, C0, 29, 3F) },
+		{ BYTES_TO_WORDS_8(F0, 67, 28, 68, 4B, B8, 02, BF),
+		  BYTES_TO_WORDS_8(39, 0A, 19, 1B, E2, 26, 14, A2),
+		  BYTES_TO_WORDS_8(F0, 00, 09, 78, 6A, D1, AB, 2A),
+		  BYTES_TO_WORDS_8(E2, 7C, 4C, E6, 88, DB, E9, F6),
+		  BYTES_TO_WORDS_8(EA, 61, 18, 0F, F1, 3A, 5B, 47),
+		  BYTES_TO_WORDS_8(23, B6, 70, F9, A5, 1B, 04, 27),
+		  BYTES_TO_WORDS_8(B1, D5, C0, E8, 76, 3B, D9, 81),
+		  BYTES_TO_WORDS_8(74, AB, D2, 7A, 0B, 79, CA, 53) },
+		{ BYTES_TO_WORDS_8(02, 61, 0D, F2, 38, 04, DD, 9A),
+		  BYTES_TO_WORDS_8(40, 39, 45, A3, 78, 53, 6D, F0),
+		  BYTES_TO_WORDS_8(5E, 9A, 19, B6, B9, 15, 5C, 78),
+		  BYTES_TO_WORDS_8(9D, 44, 0E, 76, 38, DB, 1D, FD),
+		  BYTES_TO_WORDS_8(7C, 3B, 00, AE, 91, 64, 0A, DA),
+		  BYTES_TO_WORDS_8(83, 39, 51, 11, 12, 19, 3E, 16),
+		  BYTES_TO_WORDS_8(00, B7, 83, 78, 1F, 1F, AA, ED),
+		  BYTES_TO_WORDS_8(8A, 63, 50, 90, 73, B8, 54, CB) },
+		{ BYTES_TO_WORDS_8(B7, 7C, C7, C2, 1D, 34, F7, F3),
+		  BYTES_TO_WORDS_8(B6, 15, DC, 02, 09, 94, 6D, EF),
+		  BYTES_TO_WORDS_8(8F, 69, EE, 65, 3E, A7, E4, 9F),
+		  BYTES_TO_WORDS_8(1D, 90, 99, 25, C2, 73, A2, 61),
+		  BYTES_TO_WORDS_8(ED, 25, DB, 1D, F8, 11, 46, 85),
+		  BYTES_TO_WORDS_8(74, 1F, AE, 70, 9A, AD, C5, C5),
+		  BYTES_TO_WORDS_8(C9, 0C, EB, 5E, 9F, 21, EA, F4),
+		  BYTES_TO_WORDS_8(D3, D3, 3A, 4D, 33, CD, BA, 5B) },
+		{ BYTES_TO_WORDS_8(76, 89, 7D, 37, 6E, D5, 98, B9),
+		  BYTES_TO_WORDS_8(2D, 29, 0F, E3, 38, 3A, 17, 5E),
+		  BYTES_TO_WORDS_8(B5, 04, 9D, 22, 98, 2C, B0, 4C),
+		  BYTES_TO_WORDS_8(B6, 01, 76, EF, 65, 8E, 2E, CD),
+		  BYTES_TO_WORDS_8(22, BC, 67, C8, 41, 6F, 69, 11),
+		  BYTES_TO_WORDS_8(05, 8C, 42, 35, 0F, DE, 0E, F6),
+		  BYTES_TO_WORDS_8(68, FF, 46, 2D, 8F, CE, 31, FC),
+		  BYTES_TO_WORDS_8(1F, A3, 42, 23, 36, AD, 8E, F5) },
+		{ BYTES_TO_WORDS_8(98, C9, 67, 2C, 6C, 30, 9B, 60),
+		  BYTES_TO_WORDS_8(86, 1B, CF, A3, EA, 07, 9B, 9A),
+		  BYTES_TO_WORDS_8(25, 4C, 30, A4, A8, 5E, 22, 40),
+		  BYTES_TO_WORDS_8(FB, 3E, 22, 38, 9C, 1F, D6, 9B),
+		  BYTES_TO_WORDS_8(14, 95, 19, 28, 9C, AF, 40, C3),
+		  BYTES_TO_WORDS_8(18, 4B, 42, 90, 1E, 9C, 7D, 92),
+		  BYTES_TO_WORDS_8(FA, 50, 94, 96, 96, 20, 8F, 5C),
+		  BYTES_TO_WORDS_8(5C, 6F, 6C, 91, 09, 04, B2, 77) },
+		{ BYTES_TO_WORDS_8(68, A5, AF, EA, 7B, E1, 45, 6A),
+		  BYTES_TO_WORDS_8(76, 22, 1E, 70, 97, 7A, CD, B4),
+		  BYTES_TO_WORDS_8(16, A0, 17, 11, A4, 27, AE, 12),
+		  BYTES_TO_WORDS_8(75, 77, 70, 79, 4F, EB, FA, 7A),
+		  BYTES_TO_WORDS_8(DF, F2, C1, 81, 2F, 3A, D5, 3E),
+		  BYTES_TO_WORDS_8(23, 90, D3, 29, 43, 69, 2E, 97),
+		  BYTES_TO_WORDS_8(5A, 36, 41, 50, 13, 14, 5D, 89),
+		  BYTES_TO_WORDS_8(7D, D2, FB, 33, 19, E6, EF, C6) },
+		{ BYTES_TO_WORDS_8(EB, DD, 59, 0E, E5, 03, E7, B7),
+		  BYTES_TO_WORDS_8(A8, 98, 1E, AD, 9C, 62, 3E, 48),
+		  BYTES_TO_WORDS_8(3B, 0C, 6B, 49, C1, 94, 1D, 06),
+		  BYTES_TO_WORDS_8(F9, 12, 24, 7E, 22, 02, A0, D9),
+		  BYTES_TO_WORDS_8(A4, F5, 0A, 0F, F8, 3F, 39, 5F),
+		  BYTES_TO_WORDS_8(CE, 18, 5F, AB, BC, A8, 62, 85),
+		  BYTES_TO_WORDS_8(81, 05, 67, 43, 8A, 0F, C6, 43),
+		  BYTES_TO_WORDS_8(2C, 02, 7A, 3B, F9, B2, 5E, 97) }
+	},
+	{ /* (2j + 1) * 16^26 * G */
+		{ BYTES_TO_WORDS_8(E0, A7, CC, 3E, EA, A5, 39, C7),
+		  BYTES_TO_WORDS_8(3E, 33, 43, 67, 8F, C9, D2, A7),
+		  BYTES_TO_WORDS_8(28, 94, 4D, 22, 35, 63, EF, 0F),
+		  BYTES_TO_WORDS_8(0C, 2A, 79, 5C, 3C, EE, F2, 7E),
+		  BYTES_TO_WORDS_8(94, C0, 2A, 55, DD, 22, 2B, 30),
+		  BYTES_TO_WORDS_8(20, 3D, BD, DF, 50, 14, B2, 81),
+		  BYTES_TO_WORDS_8(DB, 09, E6, D5, 51, 7F, F6, A4),
+		  BYTES_TO_WORDS_8(11, C0, AC, 30, 27, 86, B6, AF) },
+		{ BYTES_TO_WORDS_8(FA, 0F, 3F, A3, 3D, 58, F3, 72),
+		  BYTES_TO_WORDS_8(41, 7A, 80, 11, C6, CA, E4, CA),
+		  BYTES_TO_WORDS_8(41, C6, D9, C9, 76, A5, 24, 76),
+		  BYTES_TO_WORDS_8(CD, 7A, 88, 16, 27, 57, 04, 37),
+		  BYTES_TO_WORDS_8(AC, 35, FA, 60, C6, 3F, ED, 5F),
+		  BYTES_TO_WORDS_8(FC, F2, 8B, AA, B7, 3E, BA, 57),
+		  BYTES_TO_WORDS_8(4C, FF, 95, 88, BB, B4, 1B, 84),
+		  BYTES_TO_WORDS_8(4F, E7, 71, 1A, C6, 08, 64, 5C) },
+		{ BYTES_TO_WORDS_8(13, 35, 60, 32, 65, 98, 6F, 3C),
+		  BYTES_TO_WORDS_8(95, 00, 4A, 81, C6, 4D, C6, F6),
+		  BYTES_TO_WORDS_8(97, B6, 8B, C0, 42, AA, 1E, 2D),
+		  BYTES_TO_WORDS_8(72, DB, 98, 42, E5, 79, A9, C2),
+		  BYTES_TO_WORDS_8(B9, 05, 35, 3C, 2C, 5B, 75, 95),
+		  BYTES_TO_WORDS_8(49, 14, 15, 48, DF, 66, C6, 8C),
+		  BYTES_TO_WORDS_8(7E, CE, 5B, 93, 81, 80, 27, 54),
+		  BYTES_TO_WORDS_8(C8, B5, 6E, 1E, 4A, D7, 9D, EF) },
+		{ BYTES_TO_WORDS_8(3E, EE, FD, D9, B1, FF, 46, E6),
+		  BYTES_TO_WORDS_8(01, 2E, 30, 6C, 71, 97, 1F, 68),
+		  BYTES_TO_WORDS_8(B9, AF, 17, DB, 5C, B1, 2B, 17),
+		  BYTES_TO_WORDS_8(E1, 59, FC, B1, 6A, 18, F4, C9),
+		  BYTES_TO_WORDS_8(E7, 22, ED, CC, C5, 6C, E6, 51),
+		  BYTES_TO_WORDS_8(4F, DF, 58, 7B, 1C, 53, E1, 44),
+		  BYTES_TO_WORDS_8(43, 21, 83, B8, 42, 31, F7, 0D),
+		  BYTES_TO_WORDS_8(41, A3, B3, 3C, 7F, 0A, 42, 09) },
+		{ BYTES_TO_WORDS_8(17, F2, 14, 48, 67, 3E, CB, F0),
+		  BYTES_TO_WORDS_8(FA, CF, 56, 87, 7B, 3F, DA, A9),
+		  BYTES_TO_WORDS_8(A4, B6, 3B, F8, 24, 00, 8A, B0),
+		  BYTES_TO_WORDS_8(56, 02, 48, 80, 5B, F5, DC, 27),
+		  BYTES_TO_WORDS_8(4C, ED, F2, 8C, 58, 4B, C9, 14),
+		  BYTES_TO_WORDS_8(BF, C3, 1F, 19, AB, 8F, 4E, 0A),
+		  BYTES_TO_WORDS_8(38, 2A, A0, 94, B0, BA, C8, 0B),
+		  BYTES_TO_WORDS_8(EE, 5D, 8D, 54, 4F, F5, 18, BE) },
+		{ BYTES_TO_WORDS_8(0C, 31, 9E, 5B, FD, A4, A2, 75),
+		  BYTES_TO_WORDS_8(4A, FD, 4C, B8, B9, E5, 3C, 31),
+		  BYTES_TO_WORDS_8(87, 91, 95, 33, AC, 24, 8D, 9C),
+		  BYTES_TO_WORDS_8(4B, EA, 56, B2, 03, 02, 8B, 3B),
+		  BYTES_TO_WORDS_8(9B, FC, 19, AD, 05, 66, 41, 99),
+		  BYTES_TO_WORDS_8(83, 05, B3, 82, 4B, 80, FF, A8),
+		  BYTES_TO_WORDS_8(A6, 17, 41, 7C, 37, 6E, 17, D6),
+		  BYTES_TO_WORDS_8(5B, 61, 33, B0, 4E, 7C, 11, 91) },
+		{ BYTES_TO_WORDS_8(36, 5B, 61, A7, 2B, 1E, 1E, 8F),
+		  BYTES_TO_WORDS_8(5F, C1, F3, C7, E8, F1, 4F, 2A),
+		  BYTES_TO_WORDS_8(37, C3, 14, F9, 06, 24, 5C, 10),
+		  BYTES_TO_WORDS_8(3A, 10, CC, 5B, 8C, 39, E7, A5),
+		  BYTES_TO_WORDS_8(80, 6D, 13, 49, 39, 2E, 98, 4D),
+		  BYTES_TO_WORDS_8(C0, 13, B6, 70, 93, C1, FF, 47),
+		  BYTES_TO_WORDS_8(C5, F8, 15, 2A, EF, 8D, 43, 46),
+		  BYTES_TO_WORDS_8(CE, E4, 74, C9, 8D, F5, 3F, 1F) },
+		{ BYTES_TO_WORDS_8(DB, 10, 3E, ED, 32, 04, 7B, BB),
+		  BYTES_TO_WORDS_8(59, 71, B8, C8, 1A, 2E, 73, 47),
+		  BYTES_TO_WORDS_8(FA, 61, EB, F4, 3F, 44, E0, DE),
+		  BYTES_TO_WORDS_8(2B, 53, C9, 5A, 35, 18, D2, AA),
+		  BYTES_TO_WORDS_8(B3, 5F, A0, 6F, BD, 5A, 53, 63),
+		  BYTES_TO_WORDS_8(27, BA, 1C, B3, 72, 27, 03, 72),
+		  BYTES_TO_WORDS_8(4A, 8B, 5F, FD, 28, DE, 7D, 3A),
+		  BYTES_TO_WORDS_8(3B, 2E, F8, BA, EE, 1E, 3B, 79) }
+	},
+	{ /* (2j + 1) * 16^27 * G */
+		{ BYTES_TO_WORDS_8(53, E8, 49, EC, 90, F0, 01, 67),
+		  BYTES_TO_WORDS_8(4A, E0, 75, 99, 52, 53, CB, A9),
+		  BYTES_TO_WORDS_8(7A, A7, 5F, EB, 54, 25, 80, 57),
+		  BYTES_TO_WORDS_8(EB, 0A, 64, 21, 64, 41, 51, 0E),
+		  BYTES_TO_WORDS_8(B2, 5C, 40, 76, 13, 3D, 6E, 33),
+		  BYTES_TO_WORDS_8(36, EE, C9, 90, 41, 39, 68, F5),
+		  BYTES_TO_WORDS_8(0D, 03, 91, 3A, A5, B4, 8E, 27),
+		  BYTES_TO_WORDS_8(69, 54, 90, 65, EA, 1C, 33, CF) },
+		{ BYTES_TO_WORDS_8(AD, AF, C6, 1D, 1C, 3F, A2, C4),
+		  BYTES_TO_WORDS_8(46, 0F, F8, 95, 22, D9, D3, 1B),
+		  BYTES_TO_WORDS_8(77, C6, C0, 64, 5F, D2, 8E, DE),
+		  BYTES_TO_WORDS_8(25, CF, CA, 65, 67, A0, 7B, 97),
+		  BYTES_TO_WORDS_8(09, AA, 7F, 1D, C5, CD, 62, 4D),
+		  BYTES_TO_WORDS_8(15, 1A, DA, 1D, 24, A1, 75, 2F),
+		  BYTES_TO_WORDS_8(99, D9, 81, D0, A0, FA, 33, 88),
+		  BYTES_TO_WORDS_8(A2, 8F, DB, AE, 43, BC, C3, 1B) },
+		{ BYTES_TO_WORDS_8(3B, 98, 81, DD, D7, 45, F7, 65),
+		  BYTES_TO_WORDS_8(78, AB, 8E, 2F, D0, 0F, 22, 10),
+		  BYTES_TO_WORDS_8(CC, FA, FF, 71, 07, B6, 3C, 4C),
+		  BYTES_TO_WORDS_8(BE, 3A, 12, 2A, 61, 28, C3, 3B),
+		  BYTES_TO_WORDS_8(B6, 37, A6, 11, 85, F2, 99, BD),
+		  BYTES_TO_WORDS_8(8D, 84, BB, 8F, 5A, 88, 34, 43),
+		  BYTES_TO_WORDS_8(7F, 0A, F0, AA, 5C, 30, 0B, 25),
+		  BYTES_TO_WORDS_8(20, 8A, 0C, ED, 6D, 82, B5, A6) },
+		{ BYTES_TO_WORDS_8(7B, 53, C8, F7, 1F, 6C, F7, 75),
+		  BYTES_TO_WORDS_8(61, 80, 1F, 44, B7, AC, 8C, CA),
+		  BYTES_TO_WORDS_8(21, 6C, F9, CA, E1, EF, BA, 51),
+		  BYTES_TO_WORDS_8(AC, 04, EC, E9, E8, A4, CB, 67),
+		  BYTES_TO_WORDS_8(DA, 26, 57, 38, 57, 50, EB, 1C),
+		  BYTES_TO_WORDS_8(6E, 3F, 40, D0, 3E, 04, DF, 7B),
+		  BYTES_TO_WORDS_8(04, CC, B1, 2F, 1F, C6, E1, A1),
+		  BYTES_TO_WORDS_8(84, 89, 1C, EA, ED, ED, 65, 5B) },
+		{ BYTES_TO_WORDS_8(26, 12, 6A, 4B, CE, 28, 82, 36),
+		  BYTES_TO_WORDS_8(39, 65, 54, AB, C8, E9, F9, 2A),
+		  BYTES_TO_WORDS_8(92, F3, 68, 64, 68, 3D, 07, 1A),
+		  BYTES_TO_WORDS_8(93, 99, 74, D5, A6, 8E, 95, C5),
+		  BYTES_TO_WORDS_8(D4, 61, 69, C6, 88, 06, 10, 1C),
+		  BYTES_TO_WORDS_8(B9, 08, 21, BA, BE, 6D, 87, 96),
+		  BYTES_TO_WORDS_8(82, BD, 45, 9D, 71, 19, BE, EC),
+		  BYTES_TO_WORDS_8(D7, 7D, 0F, F7, 82, A8, 31, A0) },
+		{ BYTES_TO_WORDS_8(52, 3A, 71, B3, 85, 3F, DE, E4),
+		  BYTES_TO_WORDS_8(17, 54, 3C, 68, 8C, 5B, C7, 25),
+		  BYTES_TO_WORDS_8(A0, 5F, 4A, C7, C3, C0, FC, C1),
+		  BYTES_TO_WORDS_8(A7, 5C, 42, 2E, F8, 7B, F0, 83),
+		  BYTES_TO_WORDS_8(B6, FF, B0, 9F, 3F, 27, 11, A1),
+		  BYTES_TO_WORDS_8(D2, 45, FB, E1, 60, B7, B5, CA),
+		  BYTES_TO_WORDS_8(CF, D3, C7, 12, C9, 94, 97, 04),
+		  BYTES_TO_WORDS_8(B9, 8B, 5B, A2, 10, 4F, EC, F2) },
+		{ BYTES_TO_WORDS_8(B0, 21, BA, 21, 91, A0, D9, 9A),
+		  BYTES_TO_WORDS_8(53, 65, C2, 00, D2, D8, 55, D8),
+		  BYTES_TO_WORDS_8(76, 00, AE, 6E, 68, 80, F6, E6),
+		  BYTES_TO_WORDS_8(D4, 42, 5A, 9B, 4F, BA, 8D, 93),
+		  BYTES_TO_WORDS_8(25, 43, 5B, 4D, 5E, 99, 4D, 37),
+		  BYTES_TO_WORDS_8(7C, 69, 2B, 3F, EE, BB, F1, CB),
+		  BYTES_TO_WORDS_8(0B, B9, 36, D1, BD, AD, 9A, 6E),
+		  BYTES_TO_WORDS_8(56, 56, F7, 9A, A8, C0, AF, 48) },
+		{ BYTES_TO_WORDS_8(F1, 24, 2B, 3F, A6, 49, 3E, B5),
+		  BYTES_TO_WORDS_8(CF, 6B, E7, 5F, 4F, C6, AE, CF),
+		  BYTES_TO_WORDS_8(79, 97, B4, F3, AC, DA, 81, 3A),
+		  BYTES_TO_WORDS_8(E7, 31, A0, 6C, B7, 89, FA, 7E),
+		  BYTES_TO_WORDS_8(83, 4B, 8E, AF, D4, C5, 5D, D6),
+		  BYTES_TO_WORDS_8(55, A4, 54, C5, 3A, DF, BA, 1D),
+		  BYTES_TO_WORDS_8(21, AB, 16, FC, 22, D2, CE, 78),
+		  BYTES_TO_WORDS_8(FF, AE, F4, 61, EC, F3, 9F, A9) }
+	},
+	{ /* (2j + 1) * 16^28 * G */
+		{ BYTES_TO_WORDS_8(34, B7, F2, E2, F9, 9B, 69, F0),
+		  BYTES_TO_WORDS_8(67, D2, 01, 55, 5B, BB, C3, 79),
+		  BYTES_TO_WORDS_8(57, 44, 16, F1, 86, A7, 34, 06),
+		  BYTES_TO_WORDS_8(9A, C9, EC, 9E, 29, 02, 4A, 22),
+		  BYTES_TO_WORDS_8(DF, 7F, EC, 91, 54, 58, 0F, 84),
+		  BYTES_TO_WORDS_8(D0, AF, C7, 73, B6, 04, B7, 07),
+		  BYTES_TO_WORDS_8(FF, 7F, 1D, 87, AD, 08, 9A, 14),
+		  BYTES_TO_WORDS_8(B4, 22, 6D, 9B, D2, A8, 41, FA) },
+		{ BYTES_TO_WORDS_8(33, 40, 25, 5D, 47, 2F, E9, C9),
+		  BYTES_TO_WORDS_8(7A, 70, A4, C2, 80, 82, 36, 78),
+		  BYTES_TO_WORDS_8(40, F2, B6, 88, A6, DF, DA, FC),
+		  BYTES_TO_WORDS_8(59, EC, 3C, 15, EE, 02, 35, E6),
+		  BYTES_TO_WORDS_8(3F, 5E, F0, 68, 89, A8, 8A, 7E),
+		  BYTES_TO_WORDS_8(60, F3, FC, 4B, 0C, 5A, 91, 2C),
+		  BYTES_TO_WORDS_8(48, CE, 09, 07, 0F, E8, 74, AD),
+		  BYTES_TO_WORDS_8(11, 1E, 62, 1F, 7B, 83, C5, A7) },
+		{ BYTES_TO_WORDS_8(33, 8F, E0, E1, AF, 09, 96, 2B),
+		  BYTES_TO_WORDS_8(CA, 2C, 98, CB, 1D, 63, FD, B1),
+		  BYTES_TO_WORDS_8(E2, 00, F0, 33, C5, 45, AB, 12),
+		  BYTES_TO_WORDS_8(87, 96, EB, 72, C2, DE, 48, 56),
+		  BYTES_TO_WORDS_8(C9, F1, 69, 42, AC, D9, EE, 26),
+		  BYTES_TO_WORDS_8(51, 79, 11, E0, F2, BB, 72, 3E),
+		  BYTES_TO_WORDS_8(69, A2, 77, 4D, C6, F5, 78, F4),
+		  BYTES_TO_WORDS_8(43, 70, 8F, 70, 70, DC, FD, 95) },
+		{ BYTES_TO_WORDS_8(43, 8C, B9, FA, 0B, 20, B8, E3),
+		  BYTES_TO_WORDS_8(A4, 8A, 3E, 7E, 75, 57, BA, C5),
+		  BYTES_TO_WORDS_8(03, 8F, EC, CB, 8E, 2F, 15, 95),
+		  BYTES_TO_WORDS_8(26, ED, 80, 33, 9F, C1, 41, 19),
+		  BYTES_TO_WORDS_8(17, E2, AB, 22, DA, 10, A2, 8F),
+		  BYTES_TO_WORDS_8(39, 56, DF, B8, 3D, 2D, F6, D8),
+		  BYTES_TO_WORDS_8(53, 8C, FB, 48, 2A, DB, B6, E2),
+		  BYTES_TO_WORDS_8(B6, B2, 5D, 59, 34, B8, 66, 8E) },
+		{ BYTES_TO_WORDS_8(F4, C2, D8, 42, 10, 0D, 67, E6),
+		  BYTES_TO_WORDS_8(89, 01, 9C, F7, B9, 21, 33, D7),
+		  BYTES_TO_WORDS_8(0B, 8A, 4D, 36, DE, 3B, A7, 7F),
+		  BYTES_TO_WORDS_8(D6, 4B, 0B, D1, 31, 64, 58, FC),
+		  BYTES_TO_WORDS_8(4A, 27, FD, FC, 8F, C8, 18, 01),
+		  BYTES_TO_WORDS_8(B4, 38, C3, EB, 05, CB, E2, 29),
+		  BYTES_TO_WORDS_8(AB, B4, BD, E6, 79, C2, 33, 4A),
+		  BYTES_TO_WORDS_8(56, D9, 8A, CE, 52, DE, FA, 99) },
+		{ BYTES_TO_WORDS_8(18, 0F, FF, D1, F1, 77, B0, 12),
+		  BYTES_TO_WORDS_8(2D, A4, 49, 05, E7, BC, E0, 07),
+		  BYTES_TO_WORDS_8(C2, D6, F2, 9A, CF, BA, BF, A9),
+		  BYTES_TO_WORDS_8(DE, F1, C4, B0, A6, 3B, 99, EE),
+		  BYTES_TO_WORDS_8(AD, 82, 07, A5, 6C, 87, 13, 80),
+		  BYTES_TO_WORDS_8(B1, 2C, 0F, F7, 0D, C8, 35, B4),
+		  BYTES_TO_WORDS_8(FE, BC, 85, CE, 58, 5D, 6C, 1F),
+		  BYTES_TO_WORDS_8(2C, DB, 78, 45, D9, D4, 7F, D8) },
+		{ BYTES_TO_WORDS_8(FC, E3, DD, 4F, 75, 7F, 7A, E4),
+		  BYTES_TO_WORDS_8(C9, 8C, 62, 05, 9E, 88, A8, E5),
+		  BYTES_TO_WORDS_8(FB, 31, 2F, A5, 41, DC, A0, 8D),
+		  BYTES_TO_WORDS_8(42, E2, 9F, AE, 7A, 51, 49, BA),
+		  BYTES_TO_WORDS_8(01, 7D, CB, EF, 32, D2, EF, A3),
+		  BYTES_TO_WORDS_8(AA, 2C, 29, E3, 81, 1C, DE, DF),
+		  BYTES_TO_WORDS_8(9A, 35, 13, 60, 37, E4, 4E, 0B),
+		  BYTES_TO_WORDS_8(95, 55, 94, CA, E1, B6, 8F, A8) },
+		{ BYTES_TO_WORDS_8(68, DA, 14, 7D, 2F, 2A, 89, 78),
+		  BYTES_TO_WORDS_8(73, 01, D2, 4D, F8, C1, 64, 4A),
+		  BYTES_TO_WORDS_8(B5, 12, 76, 73, 82, CF, E2, 4D),
+		  BYTES_TO_WORDS_8(BA, F1, 2A, 42, 17, 8F, 39, D3),
+		  BYTES_TO_WORDS_8(3D, 0E, A9, 55, 1B, 63, 07, 3F),
+		  BYTES_TO_WORDS_8(3A, 45, 41, 2D, 92, A7, C7, AF),
+		  BYTES_TO_WORDS_8(20, B0, A2, E8, D1, 52, 72, EB),
+		  BYTES_TO_WORDS_8(60, 3D, FD, D1, D4, D4, 4A, A3) }
+	},
+	{ /* (2j + 1) * 16^29 * G */
+		{ BYTES_TO_WORDS_8(4D, B8, 89, 77, AD, 65, 60, EA),
+		  BYTES_TO_WORDS_8(E2, 1C, 04, D1, E4, 5E, 7D, 16),
+		  BYTES_TO_WORDS_8(FE, 93, 64, B5, 11, D1, B5, CD),
+		  BYTES_TO_WORDS_8(4C, 4B, 37, 57, 14, A6, 89, 4A),
+		  BYTES_TO_WORDS_8(A8, 3E, 8E, 01, 7F, 7D, 9B, EF),
+		  BYTES_TO_WORDS_8(99, 19, 71, 34, 06, 28, 2E, A7),
+		  BYTES_TO_WORDS_8(E6, 77, E6, 9F, 97, EA, C2, 08),
+		  BYTES_TO_WORDS_8(5C, 0D, 48, ED, 87, 4E, B0, 45) },
+		{ BYTES_TO_WORDS_8(34, 4C, E1, 42, 37, B2, 76, 6E),
+		  BYTES_TO_WORDS_8(93, 75, 32, 07, BE, 5E, 4C, 83),
+		  BYTES_TO_WORDS_8(C9, 77, 13, 78, 0E, B3, A9, A2),
+		  BYTES_TO_WORDS_8(92, EF, 70, A8, 48, 96, 9F, CC),
+		  BYTES_TO_WORDS_8(6B, 55, BE, 94, 7A, 15, 92, 88),
+		  BYTES_TO_WORDS_8(05, 7E, 8C, 82, F1, 17, 99, 29),
+		  BYTES_TO_WORDS_8(DB, 89, E6, DB, 33, 66, 11, 43),
+		  BYTES_TO_WORDS_8(6F, C9, F8, B5, 2C, FF, 9B, 82) },
+		{ BYTES_TO_WORDS_8(37, 48, DE, 95, 85, 6C, DE, 87),
+		  BYTES_TO_WORDS_8(4E, E7, E5, 2D, C8, 86, 42, 8D),
+		  BYTES_TO_WORDS_8(75, 8A, D9, 0A, 1D, 8C, F5, F4),
+		  BYTES_TO_WORDS_8(1A, 04, AD, FA, A1, 8D, 61, 5C),
+		  BYTES_TO_WORDS_8(EE, 7D, 4A, 63, 3B, 58, B8, C0),
+		  BYTES_TO_WORDS_8(CA, 78, 22, 64, 49, 66, D3, EC),
+		  BYTES_TO_WORDS_8(71, 96, FD, 49, 38, 0E, B8, 88),
+		  BYTES_TO_WORDS_8(9D, A1, F3, BC, 17, 91, 71, 4C) },
+		{ BYTES_TO_WORDS_8(96, 53, 63, 56, 26, 34, 89, 25),
+		  BYTES_TO_WORDS_8(0C, 6C, 8A, 36, 5A, E1, CA, F2),
+		  BYTES_TO_WORDS_8(1E, C1, 71, E6, DD, E2, 85, E5),
+		  BYTES_TO_WORDS_8(A2, 06, 5A, 91, 6A, 88, 8A, AB),
+		  BYTES_TO_WORDS_8(23, 2C, C9, 3F, 6A, FA, 38, 7E),
+		  BYTES_TO_WORDS_8(AD, D6, D2, F7, 83, 05, 36, B9),
+		  BYTES_TO_WORDS_8(AB, D5, BC, 48, 82, FF, 68, 56),
+		  BYTES_TO_WORDS_8(19, 43, A8, 7D, 7C, CF, 73, E7) },
+		{ BYTES_TO_WORDS_8(C3, 49, DF, 81, 58, 3E, 24, AC),
+		  BYTES_TO_WORDS_8(35, 9A, 06, 6D, 86, 90, E8, A9),
+		  BYTES_TO_WORDS_8(4A, 60, 95, B6, B8, 64, C6, DE),
+		  BYTES_TO_WORDS_8(8C, 83, 41, 42, 51, C8, B7, 62),
+		  BYTES_TO_WORDS_8(21, 1C, 34, F6, 0F, 68, E3, 9B),
+		  BYTES_TO_WORDS_8(50, B5, 7C, 38, 61, 3B, B5, 8F),
+		  BYTES_TO_WORDS_8(DB, 22, 49, 8D, AE, 96, 48, 59),
+		  BYTES_TO_WORDS_8(35, 03, AE, 52, 21, D6, 1E, A7) },
+		{ BYTES_TO_WORDS_8(D0, 47, 4F, E4, E2, 46, F1, 3A),
+		  BYTES_TO_WORDS_8(2F, 00, 9F, 94, DE, F5, 59, 1B),
+		  BYTES_TO_WORDS_8(79, C9, DF, 69, 08, 1F, 75, F9),
+		  BYTES_TO_WORDS_8(C5, 89, 5C, A4, BF, BD, 97, 48),
+		  BYTES_TO_WORDS_8(BF, 20, 13, CE, AA, 01, E5, 81),
+		  BYTES_TO_WORDS_8(95, 11, F0, A8, 01, A0, 6D, 52),
+		  BYTES_TO_WORDS_8(3F, 09, 7B, 41, A9, EC, E8, 34),
+		  BYTES_TO_WORDS_8(8C, 13, FC, 7A, 0F, C2, 7D, E7) },
+		{ BYTES_TO_WORDS_8(D3, 1B, 58, 71, 9B, CE, 1B, E6),
+		  BYTES_TO_WORDS_8(86, 07, 19, F6, 8D, 31, FA, CB),
+		  BYTES_TO_WORDS_8(2E, 2F, 72, DA, 7B, E0, 51, C4),
+		  BYTES_TO_WORDS_8(76, 65, 48, 56, B5, FC, 1C, EB),
+		  BYTES_TO_WORDS_8(09, 8A, D9, 5C, 98, 8D, CE, 5B),
+		  BYTES_TO_WORDS_8(64, 1A, BD, C5, 19, F3, 9C, B3),
+		  BYTES_TO_WORDS_8(3C, 6E, 4D, BE, 5E, 00, 44, 50),
+		  BYTES_TO_WORDS_8(20, 4D, F9, 71, 75, CE, 47, FD) },
+		{ BYTES_TO_WORDS_8(11, 31, 3A, 67, DB, 2B, 12, 90),
+		  BYTES_TO_WORDS_8(8F, 81, 4C, 7B, 41, 2E, B8, 18),
+		  BYTES_TO_WORDS_8(A0, 76, 25, E7, C2, 4A, D5, C0),
+		  BYTES_TO_WORDS_8(09, 1E, 8E, E4, BB, 8B, FD, A1),
+		  BYTES_TO_WORDS_8(EF, 04, C7, B8, 50, E6, 87, B8),
+		  BYTES_TO_WORDS_8(69, 11, D5, BF, 45, 49, EC, C7),
+		  BYTES_TO_WORDS_8(C0, 16, 09, BC, 07, 7E, D7, 9B),
+		  BYTES_TO_WORDS_8(56, 08, A3, 34, 8A, 5D, 21, AD) }
+	},
+	{ /* (2j + 1) * 16^30 * G */
+		{ BYTES_TO_WORDS_8(A0, 05, BD, 72, 4A, C8, 38, 34),
+		  BYTES_TO_WORDS_8(0D, C8, 1F, 0B, 7D, 33, 82, BA),
+		  BYTES_TO_WORDS_8(90, 1F, 6D, F3, 95, F9, C2, ED),
+		  BYTES_TO_WORDS_8(5C, 88, 31, 3A, 36, 92, E8, E5),
+		  BYTES_TO_WORDS_8(5D, 9F, A6, E1, 2B, DE, 36, C9),
+		  BYTES_TO_WORDS_8(AE, 99, D0, 9C, 5B, 99, 73, CA),
+		  BYTES_TO_WORDS_8(3E, 5C, 9B, E7, 01, EB, 01, 13),
+		  BYTES_TO_WORDS_8(D2, 87, 1B, DA, E4, 9D, 43, 77) },
+		{ BYTES_TO_WORDS_8(6B, 7D, 46, 01, 81, 52, 09, 4F),
+		  BYTES_TO_WORDS_8(51, 4B, A2, 52, 29, 71, 7D, 35),
+		  BYTES_TO_WORDS_8(D8, F1, 2C, 64, 11, 86, 01, D1),
+		  BYTES_TO_WORDS_8(F5, CC, 35, 94, DF, 93, 23, 5D),
+		  BYTES_TO_WORDS_8(58, 54, BC, B1, C6, 73, C6, 07),
+		  BYTES_TO_WORDS_8(A8, 73, 04, 51, A7, 07, A7, 72),
+		  BYTES_TO_WORDS_8(6D, F4, 5A, 2D, 5B, D8, CB, 7A),
+		  BYTES_TO_WORDS_8(7D, 0F, FD, 63, F2, 63, 6E, E6) },
+		{ BYTES_TO_WORDS_8(7A, 9F, 15, 9D, 3C, E9, B1, F0),
+		  BYTES_TO_WORDS_8(90, E5, 42, F2, 9C, 3A, F9, EC),
+		  BYTES_TO_WORDS_8(3F, 87, FF, D2, 2B, FB, DC, 3A),
+		  BYTES_TO_WORDS_8(3F, 89, AB, 3A, A5, 57, 36, 45),
+		  BYTES_TO_WORDS_8(78, FB, 02, 8A, 70, 2B, C2, 99),
+		  BYTES_TO_WORDS_8(5D, DA, 1D, E8, D4, 9B, 94, 6F),
+		  BYTES_TO_WORDS_8(28, C7, 01, 3A, 91, F0, 2E, DA),
+		  BYTES_TO_WORDS_8(C5, 3D, 02, 88, FF, AE, B5, BF) },
+		{ BYTES_TO_WORDS_8(2A, B4, 6C, D4, F3, ED, ED, 31),
+		  BYTES_TO_WORDS_8(93, 90, 23, A7, 53, 28, 05, BC),
+		  BYTES_TO_WORDS_8(E7, 73, 3D, A1, EA, AD, 14, 4D),
+		  BYTES_TO_WORDS_8(46, 4C, B0, 07, CB, 54, 5B, 43),
+		  BYTES_TO_WORDS_8(D0, 2D, F7, DA, ED, 4D, E2, B7),
+		  BYTES_TO_WORDS_8(A6, 49, 39, 43, 79, 4C, DC, 5E),
+		  BYTES_TO_WORDS_8(5D, 58, E0, C1, 4C, A5, F4, 49),
+		  BYTES_TO_WORDS_8(1A, 8A, 71, E4, 31, C0, 26, D7) },
+		{ BYTES_TO_WORDS_8(63, C2, 2F, 1D, 1B, 94, 7D, A9),
+		  BYTES_TO_WORDS_8(7B, D5, 65, 5B, 3E, 81, CF, 89),
+		  BYTES_TO_WORDS_8(0E, DA, 13, 4E, 7C, C4, FB, 19),
+		  BYTES_TO_WORDS_8(7E, DD, 4E, E1, 19, B8, 05, 18),
+		  BYTES_TO_WORDS_8(C7, 0E, 87, F0, B4, 70, 64, 26),
+		  BYTES_TO_WORDS_8(AF, EC, 51, E5, F8, 1A, 8C, 9C),
+		  BYTES_TO_WORDS_8(48, 31, CB, 6B, A8, DA, 58, 58),
+		  BYTES_TO_WORDS_8(71, 81, 43, 09, 28, 64, 1F, 10) },
+		{ BYTES_TO_WORDS_8(DF, D1, 76, C0, 70, 1B, 2B, 9A),
+		  BYTES_TO_WORDS_8(B3, A1, 7F, 42, 81, 20, 1E, F4),
+		  BYTES_TO_WORDS_8(45, 5F, 77, 2A, 8A, 7A, 61, 40),
+		  BYTES_TO_WORDS_8(4F, 19, D3, 66, 43, AF, 3A, C7),
+		  BYTES_TO_WORDS_8(05, 66, AD, E5, 16, D5, 79, D2),
+		  BYTES_TO_WORDS_8(20, 37, 89, 1D, A5, 57, 5B, F7),
+		  BYTES_TO_WORDS_8(FE, DC, BC, 3B, BE, 01, CE, F9),
+		  BYTES_TO_WORDS_8(6E, 91, CF, EC, 69, EC, 01, 92) },
+		{ BYTES_TO_WORDS_8(C7, 45, A7, 85, 79, 3F, 68, D3),
+		  BYTES_TO_WORDS_8(07, AC, 7E, C1, 38, 27, 8A, BC),
+		  BYTES_TO_WORDS_8(C1, 52, 1D, F6, 6A, 9B, 18, 77),
+		  BYTES_TO_WORDS_8(D2, 36, 5C, 7D, 8F, EE, DD, E3),
+		  BYTES_TO_WORDS_8(C2, FC, 8E, 77, 40, 09, 9F, A3),
+		  BYTES_TO_WORDS_8(B1, 27, D0, 7B, F1, C2, 28, 7C),
+		  BYTES_TO_WORDS_8(F4, D8, 7B, AA, 86, 1B, E5, 1B),
+		  BYTES_TO_WORDS_8(87, 2B, 93, 91, D3, 99, 71, 48) },
+		{ BYTES_TO_WORDS_8(B3, 70, 41, 4D, E8, 33, C7, F4),
+		  BYTES_TO_WORDS_8(87, 35, 3A, FC, 56, 41, 14, 40),
+		  BYTES_TO_WORDS_8(D5, A1, C0, 86, 11, AA, 68, AF),
+		  BYTES_TO_WORDS_8(E5, F1, 35, 20, DC, 8D, C7, 45),
+		  BYTES_TO_WORDS_8(1D, AA, 1F, 51, ED, A3, EF, 16),
+		  BYTES_TO_WORDS_8(73, CC, 20, 64, 60, 46, B0, 2C),
+		  BYTES_TO_WORDS_8(51, 3A, FB, 44, D1, A9, E1, B0),
+		  BYTES_TO_WORDS_8(0C, 5C, 8D, 23, 46, 99, AF, 11) }
+	},
+	{ /* (2j + 1) * 16^31 * G */
+		{ BYTES_TO_WORDS_8(CF, C2, B5, FA, 92, 99, 57, 21),
+		  BYTES_TO_WORDS_8(DE, 84, B0, 1F, C2, F0, 12, 53),
+		  BYTES_TO_WORDS_8(A4, 90, FA, 04, 41, 47, E7, 71),
+		  BYTES_TO_WORDS_8(50, 1F, 22, 1E, 43, 7E, 10, E4),
+		  BYTES_TO_WORDS_8(2B, 5C, 95, 2B, 3F, 40, 28, D0),
+		  BYTES_TO_WORDS_8(10, 24, 7B, FF, DC, 92, 78, 3C),
+		  BYTES_TO_WORDS_8(32, 2B, 1C, 74, 68, C6, 48, 39),
+		  BYTES_TO_WORDS_8(9A, 1C, 70, CF, E6, 11, 5F, 1E) },
+		{ BYTES_TO_WORDS_8(7E, 7B, B6, 09, 3C, B6, B5, 5B),
+		  BYTES_TO_WORDS_8(48, 3D, 1C, 91, 2B, 7B, 6B, 76),
+		  BYTES_TO_WORDS_8(42, 11, BC, DE, 01, 97, CF, AA),
+		  BYTES_TO_WORDS_8(7D, 9F, 17, EE, 65, 9A, DF, 85),
+		  BYTES_TO_WORDS_8(E3, 36, 0A, 83, 9E, 86, B3, 88),
+		  BYTES_TO_WORDS_8(A5, 6E, BC, 1F, 9D, 94, FA, 86),
+		  BYTES_TO_WORDS_8(73, 29, 0E, FF, 5E, 7D, 6B, BB),
+		  BYTES_TO_WORDS_8(08, 63, AF, 39, AA, B7, B4, A6) },
+		{ BYTES_TO_WORDS_8(D3, 10, 35, 0B, E6, FD, 7C, 12),
+		  BYTES_TO_WORDS_8(E4, D6, A1, 04, 67, 16, D3, 85),
+		  BYTES_TO_WORDS_8(28, 29, 2D, 5C, 86, A1, D8, A8),
+		  BYTES_TO_WORDS_8(08, CD, 9F, 7F, FE, 93, C4, 23),
+		  BYTES_TO_WORDS_8(47, 9A, E8, 3A, C4, 2E, 46, 13),
+		  BYTES_TO_WORDS_8(D7, DB, B9, 26, 5E, E3, 99, F7),
+		  BYTES_TO_WORDS_8(D8, E6, FF, 4E, 9E, 5D, 27, 0C),
+		  BYTES_TO_WORDS_8(23, 14, 34, E4, A9, 56, F4, AD) },
+		{ BYTES_TO_WORDS_8(1F, A7, 49, 8B, 80, 91, C6, AC),
+		  BYTES_TO_WORDS_8(39, 7C, 22, 64, 6C, EB, 36, AC),
+		  BYTES_TO_WORDS_8(DD, 35, F2, AA, EB, 93, 59, DE),
+		  BYTES_TO_WORDS_8(ED, D0, 4D, 31, 0B, 6D, 40, 94),
+		  BYTES_TO_WORDS_8(A9, 49, B2, D0, 44, 19, 1C, 47),
+		  BYTES_TO_WORDS_8(94, CF, 63, CA, 61, 72, E2, D0),
+		  BYTES_TO_WORDS_8(97, E8, 6F, 90, 90, 7C, 20, CD),
+		  BYTES_TO_WORDS_8(79, F1, 4D, 86, 7E, E7, AA, 61) },
+		{ BYTES_TO_WORDS_8(32, 0C, E5, 60, 3C, E3, CD, E5),
+		  BYTES_TO_WORDS_8(3F, 87, C6, E8, 72, 09, F1, 77),
+		  BYTES_TO_WORDS_8(38, 8D, EE, 5B, DF, 36, 71, 33),
+		  BYTES_TO_WORDS_8(14, 6C, 88, DE, 43, BF, 2E, 3C),
+		  BYTES_TO_WORDS_8(24, C1, 93, CA, 17, 89, 2F, 9E),
+		  BYTES_TO_WORDS_8(98, C9, E8, 9A, C3, 08, 2D, BE),
+		  BYTES_TO_WORDS_8(E7, 28, 2E, 20, 3D, B9, 25, 65),
+		  BYTES_TO_WORDS_8(9C, 39, E8, C5, A6, D9, 03, A7) },
+		{ BYTES_TO_WORDS_8(5A, 35, A2, C3, DE, D9, 83, 70),
+		  BYTES_TO_WORDS_8(90, 49, 60, 5C, F3, 1B, 65, 99),
+		  BYTES_TO_WORDS_8(12, 5F, C5, 9E, B8, E5, 91, F3),
+		  BYTES_TO_WORDS_8(B9, 0E, 94, 27, D7, 36, 75, 98),
+		  BYTES_TO_WORDS_8(76, 52, D0, 1B, 4C, 5C, C7, F0),
+		  BYTES_TO_WORDS_8(CD, DC, 3A, 68, 7C, 6C, 5F, B8),
+		  BYTES_TO_WORDS_8(48, 7B, E5, 49, C1, B1, E0, 43),
+		  BYTES_TO_WORDS_8(72, 11, F1, 74, D6, 9A, F1, 12) },
+		{ BYTES_TO_WORDS_8(22, EC, F3, 52, 7C, 54, F0, B0),
+		  BYTES_TO_WORDS_8(A6, F8, A8, 71, CF, 6D, F8, D1),
+		  BYTES_TO_WORDS_8(DD, DD, F2, 7E, B1, 38, 9D, F1),
+		  BYTES_TO_WORDS_8(68, 44, 4C, 9A, 40, AC, 15, D5),
+		  BYTES_TO_WORDS_8(3B, 86, A2, 25, EB, 62, 14, CA),
+		  BYTES_TO_WORDS_8(6E, 80, 1B, 03, F0, 7D, D5, 4C),
+		  BYTES_TO_WORDS_8(46, BD, 52, 00, 84, E4, A5, 1E),
+		  BYTES_TO_WORDS_8(2E, 9B, 44, 22, 14, 48, C0, 51) },
+		{ BYTES_TO_WORDS_8(57, C8, 71, 59, 9A, 1E, 9A, A5),
+		  BYTES_TO_WORDS_8(3F, 09, E6, AB, 6D, 9E, C9, DE),
+		  BYTES_TO_WORDS_8(3D, CF, 61, 8B, C3, 3C, 45, E2),
+		  BYTES_TO_WORDS_8(BA, B0, E5, 85, 49, 9D, 0B, 07),
+		  BYTES_TO_WORDS_8(C1, DF, C8, CA, 3D, B6, 9C, FF),
+		  BYTES_TO_WORDS_8(AA, 61, 54, EC, A1, 3D, A8, 33),
+		  BYTES_TO_WORDS_8(FB, 3C, 37, 46, AE, 10, B8, 86),
+		  BYTES_TO_WORDS_8(50, 62, 4B, FF, 1B, 46, 80, ED) }
+	},
+	{ /* (2j + 1) * 16^32 * G */
+		{ BYTES_TO_WORDS_8(85, BD, 89, D7, C9, 4F, C8, 57),
+		  BYTES_TO_WORDS_8(C3, EA, 97, C2, 7D, FF, 35, FC),
+		  BYTES_TO_WORDS_8(6E, 76, C6, 88, D5, 2F, 98, FB),
+		  BYTES_TO_WORDS_8(67, 5E, DB, EE, 9B, 73, 7D, 44),
+		  BYTES_TO_WORDS_8(32, 5B, E2, 72, C9, 33, 7E, 0C),
+		  BYTES_TO_WORDS_8(00, E5, FA, A7, 95, 9B, 34, 3D),
+		  BYTES_TO_WORDS_8(F7, AF, 4A, 3A, 95, 9D, 2E, E1),
+		  BYTES_TO_WORDS_8(EE, 31, 41, 83, AB, 25, 48, 2D) },
+		{ BYTES_TO_WORDS_8(68, DB, A6, DE, 8E, 99, E1, 73),
+		  BYTES_TO_WORDS_8(C2, 32, 26, 08, 56, D8, FA, DD),
+		  BYTES_TO_WORDS_8(F6, F4, DE, 65, F9, 4D, B1, 58),
+		  BYTES_TO_WORDS_8(7F, 01, CA, 03, 3E, 53, B6, F8),
+		  BYTES_TO_WORDS_8(A9, 0D, 76, AE, B0, 25, BD, 69),
+		  BYTES_TO_WORDS_8(ED, A0, 5C, 9C, DD, 70, BD, 6B),
+		  BYTES_TO_WORDS_8(C6, 3E, AA, 50, DA, 6D, 04, 2F),
+		  BYTES_TO_WORDS_8(86, 54, 44, EC, F5, 4E, 0F, C3) },
+		{ BYTES_TO_WORDS_8(53, E7, 24, F9, EB, D4, D5, 66),
+		  BYTES_TO_WORDS_8(7C, 72, F8, 2C, 07, 73, 01, 5F),
+		  BYTES_TO_WORDS_8(75, FB, ED, 29, 87, F1, 8E, 54),
+		  BYTES_TO_WORDS_8(7C, 84, 82, 55, D3, 89, 52, F3),
+		  BYTES_TO_WORDS_8(0C, A2, 13, EB, C2, B5, 45, AA),
+		  BYTES_TO_WORDS_8(04, 0F, 2D, 29, 57, FC, 62, C5),
+		  BYTES_TO_WORDS_8(D8, 1B, 0E, B5, A1, 08, DF, 93),
+		  BYTES_TO_WORDS_8(FB, 13, EC, C5, 1E, 78, C1, 75) },
+		{ BYTES_TO_WORDS_8(7E, 01, 18, 30, 67, CB, 95, 23),
+		  BYTES_TO_WORDS_8(D7, 23, DF, D6, FF, 1F, 14, AF),
+		  BYTES_TO_WORDS_8(01, 4E, 73, B6, 5F, 18, 34, 48),
+		  BYTES_TO_WORDS_8(16, 17, 44, DA, 74, 6B, D0, CF),
+		  BYTES_TO_WORDS_8(50, FF, 0D, CE, E4, 7B, AE, A0),
+		  BYTES_TO_WORDS_8(77, 97, 77, 6B, 78, 30, 30, 00),
+		  BYTES_TO_WORDS_8(50, 79, DA, 87, 95, B3, 03, 81),
+		  BYTES_TO_WORDS_8(13, A9, 2B, B7, A9, B7, 47, B6) },
+		{ BYTES_TO_WORDS_8(60, B8, 2D, 79, 05, 19, C8, 04),
+		  BYTES_TO_WORDS_8(7B, 24, 9A, 32, 88, 92, 08, 81),
+		  BYTES_TO_WORDS_8(E9, DB, 15, 8F, D0, D6, 12, 15),
+		  BYTES_TO_WORDS_8(D1, DC, D5, 4A, 4C, E7, 55, 07),
+		  BYTES_TO_WORDS_8(49, 98, D0, A0, DB, 00, 66, 7D),
+		  BYTES_TO_WORDS_8(7A, 77, C2, CF, 64, 74, 93, B2),
+		  BYTES_TO_WORDS_8(C2, 5B, 81, 23, D8, B2, 49, D2),
+		  BYTES_TO_WORDS_8(4D, 9E, AD, 53, A7, AF, 16, FE) },
+		{ BYTES_TO_WORDS_8(6B, BA, 26, EA, 55, 69, EF, A9),
+		  BYTES_TO_WORDS_8(C3, 12, DA, 96, A4, A2, 2C, DD),
+		  BYTES_TO_WORDS_8(DE, BB, B0, 7E, 0D, 0C, A1, 68),
+		  BYTES_TO_WORDS_8(69, C9, 72, C3, 4C, A8, FB, 88),
+		  BYTES_TO_WORDS_8(F8, 72, 49, E4, 81, 47, 41, 80),
+		  BYTES_TO_WORDS_8(CE, FD, 0C, E0, 28, 9E, 4A, 48),
+		  BYTES_TO_WORDS_8(8D, 78, 14, B5, 45, DA, 66, D2),
+		  BYTES_TO_WORDS_8(0F, BE, 39, 9D, 64, EF, 2A, 51) },
+		{ BYTES_TO_WORDS_8(AB, 0C, 72, 94, 42, 8A, C4, 39),
+		  BYTES_TO_WORDS_8(7E, B1, 39, 17, D4, A5, 1E, 1A),
+		  BYTES_TO_WORDS_8(2C, 6F, 5C, 55, E7, F6, 50, 8E),
+		  BYTES_TO_WORDS_8(EB, 5B, 05, EC, CB, AC, A0, E1),
+		  BYTES_TO_WORDS_8(C9, 85, B1, 74, F5, 53, D4, A6),
+		  BYTES_TO_WORDS_8(4E, 25, 80, D0, 71, 2A, 4A, 08),
+		  BYTES_TO_WORDS_8(BF, BC, EE, 77, 30, F8, 36, 18),
+		  BYTES_TO_WORDS_8(54, C8, 98, 7E, FB, 68, 79, E0) },
+		{ BYTES_TO_WORDS_8(2A, C4, 26, EC, DF, 8F, 82, 2A),
+		  BYTES_TO_WORDS_8(B6, 1B, B1, 46, 7E, FB, 9B, 24),
+		  BYTES_TO_WORDS_8(A0, E6, E7, 31, 89, 35, DB, 50),
+		  BYTES_TO_WORDS_8(7E, 3C, A7, E6, 86, 3B, E9, 0A),
+		  BYTES_TO_WORDS_8(CA, 08, F8, B9, 43, 33, 06, 91),
+		  BYTES_TO_WORDS_8(64, DB, AA, F5, EE, 39, 8A, 27),
+		  BYTES_TO_WORDS_8(37, 0B, E2, C1, ED, E3, 42, A9),
+		  BYTES_TO_WORDS_8(13, 7E, 78, 14, DD, F6, 28, 70) }
+	},
+	{ /* (2j + 1) * 16^33 * G */
+		{ BYTES_TO_WORDS_8(36, E7, 7D, 13, AC, 8B, BD, 1E),
+		  BYTES_TO_WORDS_8(24, CE, 88, 86, 61, D5, F8, A2),
+		  BYTES_TO_WORDS_8(8E, C1, DE, 8C, 2B, 54, 37, 89),
+		  BYTES_TO_WORDS_8(3E, CF, 9C, 94, 14, E3, 22, 90),
+		  BYTES_TO_WORDS_8(CC, 2E, C4, 44, 08, 5C, EF, F4),
+		  BYTES_TO_WORDS_8(57, 76, EA, 44, 6C, 36, 49, 7F),
+		  BYTES_TO_WORDS_8(08, CE, 26, 52, 04, BB, D0, 66),
+		  BYTES_TO_WORDS_8(94, A3, 04, 29, 4F, 5E, AE, 2F) },
+		{ BYTES_TO_WORDS_8(F5, 01, 9B, D0, B8, 6C, 70, 91),
+		  BYTES_TO_WORDS_8(51, C0, 73, 32, 18, 35, 3F, F7),
+		  BYTES_TO_WORDS_8(7A, 85, F7, 1A, 3F, 2D, 0F, FB),
+		  BYTES_TO_WORDS_8(45, E9, 6F, 07, E3, 72, 58, 6E),
+		  BYTES_TO_WORDS_8(DE, 5F, CD, AB, D9, 58, 07, C3),
+		  BYTES_TO_WORDS_8(A7, 85, 9A, E0, D4, 79, 31, C1),
+		  BYTES_TO_WORDS_8(EB, F0, BE, F3, 4A, 1D, CC, 80),
+		  BYTES_TO_WORDS_8(71, 71, D7, C8, 2E, C0, 13, 42) },
+		{ BYTES_TO_WORDS_8(1F, 5B, E4, EF, 47, B7, 39, B5),
+		  BYTES_TO_WORDS_8(C2, 68, 61, 2E, FB, 55, D1, 7B),
+		  BYTES_TO_WORDS_8(82, DF, 17, 4C, 34, 1E, FD, 4A),
+		  BYTES_TO_WORDS_8(50, 3F, DA, A5, B1, 20, 22, 29),
+		  BYTES_TO_WORDS_8(26, B0, 4B, 53, 8B, 0B, E4, 5F),
+		  BYTES_TO_WORDS_8(04, 41, DD, 4C, 30, 44, C3, F7),
+		  BYTES_TO_WORDS_8(7F, 8D, E9, FA, 5F, 79, 7C, E3),
+		  BYTES_TO_WORDS_8(AE, 75, F1, 2B, 53, A0, 16, E3) },
+		{ BYTES_TO_WORDS_8(40, D5, AB, A3, 62, 06, 85, 3E),
+		  BYTES_TO_WORDS_8(E4, 6D, 16, 4B, 65, 40, 80, 0E),
+		  BYTES_TO_WORDS_8(34, 3A, 09, 21, 87, 4F, 22, C3),
+		  BYTES_TO_WORDS_8(0A, 4F, A4, 07, 48, E1, 44, 36),
+		  BYTES_TO_WORDS_8(31, A6, 5D, D5, 1C, FE, C6, E1),
+		  BYTES_TO_WORDS_8(4D, A1, 6F, A6, ED, 7C, 17, 00),
+		  BYTES_TO_WORDS_8(93, E2, A1, 9F, 30, 85, C2, 11),
+		  BYTES_TO_WORDS_8(76, 79, C2, DB, 50, 91, 5A, EC) },
+		{ BYTES_TO_WORDS_8(CB, 2C, 14, 89, 1E, D2, 2F, 1A),
+		  BYTES_TO_WORDS_8(E3, ED, 87, C6, 5A, 0A, 92, 4C),
+		  BYTES_TO_WORDS_8(82, B4, 3B, 99, F4, 38, 5B, E5),
+		  BYTES_TO_WORDS_8(38, D8, FC, 17, AE, 7D, FE, ED),
+		  BYTES_TO_WORDS_8(75, 3D, 59, AC, 31, 1D, 95, BB),
+		  BYTES_TO_WORDS_8(2E, 14, 51, 9D, B6, 42, A4, 1D),
+		  BYTES_TO_WORDS_8(B8, BE, 55, 4F, 2B, 5D, 85, 61),
+		  BYTES_TO_WORDS_8(21, AF, 0D, 2E, 12, 92, 86, C8) },
+		{ BYTES_TO_WORDS_8(08, B2, 41, 4A, C6, 71, DA, F3),
+		  BYTES_TO_WORDS_8(00, 70, E2, DE, 5C, 47, F7, E7),
+		  BYTES_TO_WORDS_8(E8, 0D, EA, BC, 26, 40, 71, 98),
+		  BYTES_TO_WORDS_8(95, A6, 59, 40, 8B, 96, 11, 53),
+		  BYTES_TO_WORDS_8(69, 4B, 8E, 04, 9E, 1F, 1E, 69),
+		  BYTES_TO_WORDS_8(7F, 87, 36, 24, C0, 1D, 3C, 3B),
+		  BYTES_TO_WORDS_8(11, DA, B3, 33, 1E, 58, C6, A6),
+		  BYTES_TO_WORDS_8(78, 29, C2, 3D, 2B, 73, 8D, B7) },
+		{ BYTES_TO_WORDS_8(E7, AA, 5D, 49, 5C, 1B, D0, B3),
+		  BYTES_TO_WORDS_8(BC, 33, 70, 7C, EC, E6, 46, AF),
+		  BYTES_TO_WORDS_8(D5, E1, 60, F5, F6, 2B, A2, F7),
+		  BYTES_TO_WORDS_8(94, A5, FB, 2F, F2, D1, 5D, F6),
+		  BYTES_TO_WORDS_8(38, 67, 55, C2, 99, 5A, 4E, 8D),
+		  BYTES_TO_WORDS_8(B2, D9, AC, 9E, 0F, 18, 06, EB),
+		  BYTES_TO_WORDS_8(D0, 4C, FC, 7C, 63, FE, E6, 20),
+		  BYTES_TO_WORDS_8(E8, 66, 1B, CE, 20, B8, 71, 9D) },
+		{ BYTES_TO_WORDS_8(EE, F1, FC, 3A, 5E, C1, EF, AB),
+		  BYTES_TO_WORDS_8(11, 9A, 06, 72, 04, A8, FA, 0A),
+		  BYTES_TO_WORDS_8(C6, 07, A8, AA, 80, F4, 1B, B4),
+		  BYTES_TO_WORDS_8(48, E2, CA, DC, 7E, 0E, 67, A6),
+		  BYTES_TO_WORDS_8(C8, 7F, C6, E0, AB, 70, 88, 37),
+		  BYTES_TO_WORDS_8(8A, F3, 3C, C9, 91, 98, F3, 1E),
+		  BYTES_TO_WORDS_8(13, AC, 57, 49, 2F, F7, 95, A3),
+		  BYTES_TO_WORDS_8(F3, C2, 51, 3A, C9, 14, FD, A7) }
+	},
+	{ /* (2j + 1) * 16^34 * G */
+		{ BYTES_TO_WORDS_8(97, 33, CD, 44, C1, 45, 11, 74),
+		  BYTES_TO_WORDS_8(B5, 5E, 51, 19, 06, C1, 34, DC),
+		  BYTES_TO_WORDS_8(ED, 6D, 15, B5, F2, 6C, 38, 89),
+		  BYTES_TO_WORDS_8(23, A7, ED, 19, 04, FF, BA, 73),
+		  BYTES_TO_WORDS_8(E4, B8, DC, 9A, 13, 2A, EF, 41),
+		  BYTES_TO_WORDS_8(49, 13, 26, F8, 2C, F9, 9E, 77),
+		  BYTES_TO_WORDS_8(5E, 82, 8F, C1, E8, D1, 00, 6A),
+		  BYTES_TO_WORDS_8(5F, AC, 77, 49, 63, DE, 97, 1E) },
+		{ BYTES_TO_WORDS_8(13, B9, 1F, 16, 52, F9, B0, 7E),
+		  BYTES_TO_WORDS_8(97, 12, D3, 56, 61, 24, 10, 3E),
+		  BYTES_TO_WORDS_8(4E, D0, BE, 44, DE, 88, 43, 34),
+		  BYTES_TO_WORDS_8(18, 0A, E6, 33, 0C, 33, F8, 45),
+		  BYTES_TO_WORDS_8(BC, C3, 15, 0C, 7C, 81, D4, 70),
+		  BYTES_TO_WORDS_8(73, 33, FC, F6, 79, 08, 6D, F0),
+		  BYTES_TO_WORDS_8(60, 77, BA, D8, 76, 80, 0E, F8),
+		  BYTES_TO_WORDS_8(6E, 90, D6, BF, 6D, CF, 12, C2) },
+		{ BYTES_TO_WORDS_8(54, 36, 39, EE, 91, 96, EF, 5A),
+		  BYTES_TO_WORDS_8(C7, D7, ED, F3, E1, 4B, 5D, 96),
+		  BYTES_TO_WORDS_8(91, 59, CD, 8B, 1C, A0, F5, 65),
+		  BYTES_TO_WORDS_8(AB, BD, D7, AC, 49, DC, 44, 55),
+		  BYTES_TO_WORDS_8(6F, 20, 53, 8F, BF, 0B, 61, 23),
+		  BYTES_TO_WORDS_8(73, 8E, D5, 03, 97, FE, 1E, 24),
+		  BYTES_TO_WORDS_8(92, 51, 93, B8, B5, 05, 4C, C0),
+		  BYTES_TO_WORDS_8(4A, FD, 87, 50, 89, 85, 3E, ED) },
+		{ BYTES_TO_WORDS_8(FD, 5D, A1, 28, 94, 59, F3, 13),
+		  BYTES_TO_WORDS_8(55, 9E, FA, 25, C0, BA, 1D, 74),
+		  BYTES_TO_WORDS_8(95, F6, E2, 5A, D5, 2E, 3D, 4B),
+		  BYTES_TO_WORDS_8(73, E7, 9E, 61, 90, B7, 57, 27),
+		  BYTES_TO_WORDS_8(41, C3, 42, F0, 0C, 84, 8E, FC),
+		  BYTES_TO_WORDS_8(6D, 15, A7, 3C, 8A, 97, 68, 17),
+		  BYTES_TO_WORDS_8(0D, 50, D5, 3C, 21, 75, C9, 5C),
+		  BYTES_TO_WORDS_8(2E, B1, C2, 54, D5, D2, 46, DF) },
+		{ BYTES_TO_WORDS_8(5B, 0A, 84, BF, 26, F4, ED, EF),
+		  BYTES_TO_WORDS_8(84, 49, AD, D3, A5, AD, 8C, 14),
+		  BYTES_TO_WORDS_8(CD, 3C, 14, C1, CC, 21, 84, D9),
+		  BYTES_TO_WORDS_8(C8, 2B, 0E, E5, 7D, 43, 72, E8),
+		  BYTES_TO_WORDS_8(6A, E8, 77, 13, 55, 58, 4E, B8),
+		  BYTES_TO_WORDS_8(64, 64, 39, F9, 6C, 34, 3A, AC),
+		  BYTES_TO_WORDS_8(F5, 8B, 24, 66, 1F, C9, 3B, 59),
+		  BYTES_TO_WORDS_8(16, 96, 72, 12, 89, BC, 84, F9) },
+		{ BYTES_TO_WORDS_8(6A, FD, 6A, B3, B8, A9, 56, 49),
+		  BYTES_TO_WORDS_8(3D, 1E, 78, A1, 50, FC, 61, 92),
+		  BYTES_TO_WORDS_8(4A, 33, F3, E6, D5, F6, 2E, 39),
+		  BYTES_TO_WORDS_8(C0, 75, D7, A4, AB, DC, 6C, C5),
+		  BYTES_TO_WORDS_8(26, 7C, F8, F3, EE, 6B, 08, E6),
+		  BYTES_TO_WORDS_8(23, C7, 8C, 56, B2, 83, F4, 66),
+		  BYTES_TO_WORDS_8(F5, 4E, 59, 7F, B1, DE, 2E, CD),
+		  BYTES_TO_WORDS_8(70, B0, 86, F3, E2, 56, 60, D1) },
+		{ BYTES_TO_WORDS_8(D0, 2C, FD, 2C, 0D, 98, AD, 1D),
+		  BYTES_TO_WORDS_8(13, 0C, 9C, 41, 34, 13, 94, 23),
+		  BYTES_TO_WORDS_8(B1, AB, 48, 3E, 58, 28, FD, 9C),
+		  BYTES_TO_WORDS_8(86, F2, 3F, 8F, 73, E6, D6, D3),
+		  BYTES_TO_WORDS_8(DC, E2, 4A, 79, 77, 9C, 57, 4C),
+		  BYTES_TO_WORDS_8(F1, F8, F6, C2, 68, A5, 1F, 00),
+		  BYTES_TO_WORDS_8(9B, E5, 7D, 73, FF, A8, 6D, 53),
+		  BYTES_TO_WORDS_8(68, 9B, 15, CD, 5F, 8F, 44, FF) },
+		{ BYTES_TO_WORDS_8(4C, A6, B7, DA, 55, 88, 58, 09),
+		  BYTES_TO_WORDS_8(7A, AB, 09, 3A, 6A, 8D, 50, 56),
+		  BYTES_TO_WORDS_8(06, D4, 37, 22, D7, 32, 31, B0),
+		  BYTES_TO_WORDS_8(07, 5C, E4, 56, 88, 77, F9, 88),
+		  BYTES_TO_WORDS_8(03, F1, 75, 15, E1, 98, 5E, A0),
+		  BYTES_TO_WORDS_8(73, 26, 6D, 21, 92, 00, C3, 36),
+		  BYTES_TO_WORDS_8(58, 9E, 96, 57, F2, 1A, 53, 34),
+		  BYTES_TO_WORDS_8(74, 5C, B5, 46, DD, 5C, 74, 4A) }
+	},
+	{ /* (2j + 1) * 16^35 * G */
+		{ BYTES_TO_WORDS_8(3C, E3, A4, 1F, B3, 5F, 2E, 0E),
+		  BYTES_TO_WORDS_8(B3, 8C, 09, 8B, C7, BE, 83, 26),
+		  BYTES_TO_WORDS_8(98, FB, 76, 29, 6C, 44, 74, C9),
+		  BYTES_TO_WORDS_8(BB, 25, 4C, 1A, B9, 46, F6, 9C),
+		  BYTES_TO_WORDS_8(63, 45, 0D, 0E, 06, 5E, C4, 19),
+		  BYTES_TO_WORDS_8(32, 60, C1, EB, 27, 58, 20, 9E),
+		  BYTES_TO_WORDS_8(31, 1F, 82, 8B, 25, 8E, 40, 1E),
+		  BYTES_TO_WORDS_8(89, 5A, F6, C1, 4D, 62, B0, 37) },
+		{ BYTES_TO_WORDS_8(67, 1E, BF, C6, 8C, 61, 8B, E9),
+		  BYTES_TO_WORDS_8(63, AF, 5C, FE, 49, 67, 56, 4C),
+		  BYTES_TO_WORDS_8(0F, 4E, 76, 27, 38, 65, 7A, 9D),
+		  BYTES_TO_WORDS_8(99, 64, 1B, 15, DE, 43, CB, 83),
+		  BYTES_TO_WORDS_8(97, CC, 9A, 09, B3, E8, 7E, A2),
+		  BYTES_TO_WORDS_8(9E, 16, D1, BD, 2C, 42, 74, 28),
+		  BYTES_TO_WORDS_8(F8, 18, 44, 62, 6E, 80, B1, EF),
+		  BYTES_TO_WORDS_8(F8, F6, 98, 4B, A2, 8C, E2, BC) },
+		{ BYTES_TO_WORDS_8(7E, 05, 0F, DC, 48, D7, 0A, 23),
+		  BYTES_TO_WORDS_8(D8, 3D, D5, 01, 87, 62, E8, 84),
+		  BYTES_TO_WORDS_8(24, 02, 25, 5E, C1, 0F, 34, 03),
+		  BYTES_TO_WORDS_8(8C, B0, CE, 60, E5, B3, F3, 3F),
+		  BYTES_TO_WORDS_8(5E, 96, 17, A8, DA, F7, 41, 2D),
+		  BYTES_TO_WORDS_8(62, 17, 70, C4, 6E, 23, 10, A0),
+		  BYTES_TO_WORDS_8(43, 78, 86, 57, 70, D1, 7F, 6F),
+		  BYTES_TO_WORDS_8(8F, 57, B6, 3B, 6F, AD, 17, 7F) },
+		{ BYTES_TO_WORDS_8(F1, 69, 5E, 32, 40, 4B, 11, 15),
+		  BYTES_TO_WORDS_8(B5, BC, 22, D4, F2, A8, 67, 63),
+		  BYTES_TO_WORDS_8(99, AF, D6, 73, E1, 9D, A1, DD),
+		  BYTES_TO_WORDS_8(3F, D8, FF, D8, 2D, DB, 9E, 6E),
+		  BYTES_TO_WORDS_8(9B, 7E, 2B, 40, E3, 17, 0E, 72),
+		  BYTES_TO_WORDS_8(1B, 28, 9F, 79, 54, 74, 72, 1C),
+		  BYTES_TO_WORDS_8(F6, BF, F3, 65, AB, 56, 35, AB),
+		  BYTES_TO_WORDS_8(4E, 95, FF, CE, 16, 22, 82, C0) },
+		{ BYTES_TO_WORDS_8(38, F0, 88, A2, 66, 2F, 25, BF),
+		  BYTES_TO_WORDS_8(20, F8, 5F, EB, 94, 68, 87, F0),
+		  BYTES_TO_WORDS_8(32, 2D, EC, E6, 9D, C1, AB, EF),
+		  BYTES_TO_WORDS_8(4B, 1C, C4, 04, E8, 80, E2, 5E),
+		  BYTES_TO_WORDS_8(6E, EE, F1, B6, 86, AB, 5A, 1C),
+		  BYTES_TO_WORDS_8(F4, C6, E6, 98, 3A, 83, D7, 11),
+		  BYTES_TO_WORDS_8(C0, EE, C9, EC, 6F, 58, C0, 84),
+		  BYTES_TO_WORDS_8(92, E3, 77, 46, F9, 69, D9, BC) },
+		{ BYTES_TO_WORDS_8(C8, 08, C7, C0, 56, 32, BF, A0),
+		  BYTES_TO_WORDS_8(6A, A8, 70, 2F, 4F, 30, 34, 2C),
+		  BYTES_TO_WORDS_8(8C, 28, FE, 91, 5D, 36, FE, 6D),
+		  BYTES_TO_WORDS_8(73, 05, C2, 05, 6E, 16, F0, E1),
+		  BYTES_TO_WORDS_8(38, ED, 96, 38, 3B, D7, 18, E7),
+		  BYTES_TO_WORDS_8(0A, A0, B5, EF, 22, 5F, 65, FB),
+		  BYTES_TO_WORDS_8(16, 30, A3, E8, 2B, 63, 44, 04),
+		  BYTES_TO_WORDS_8(52, 3B, 6C, 91, 3E, 65, 47, E6) },
+		{ BYTES_TO_WORDS_8(FB, DE, 6E, 47, CA, 09, 0F, 7E),
+		  BYTES_TO_WORDS_8(5D, 7D, 0E, 10, 80, BD, 58, DD),
+		  BYTES_TO_WORDS_8(BA, C7, 79, 29, B4, 1A, 12, 7F),
+		  BYTES_TO_WORDS_8(5C, 34, F6, AB, 87, 96, 08, 28),
+		  BYTES_TO_WORDS_8(E0, 0A, 1B, 9D, 22, 57, F4, 2E),
+		  BYTES_TO_WORDS_8(12, 92, 03, BE, 07, 1B, D3, 4D),
+		  BYTES_TO_WORDS_8(C4, 41, 05, D9, EB, 19, 7E, A6),
+		  BYTES_TO_WORDS_8(91, 31, 3B, 3D, F3, 1C, 07, 5D) },
+		{ BYTES_TO_WORDS_8(7A, 89, 44, F3, BC, 99, 2D, D1),
+		  BYTES_TO_WORDS_8(9D, 26, 4C, 5A, 07, D3, 9E, 7B),
+		  BYTES_TO_WORDS_8(AB, ED, 25, 24, 85, 5E, 58, 70),
+		  BYTES_TO_WORDS_8(CB, 04, 19, 28, DE, B0, 15, EB),
+		  BYTES_TO_WORDS_8(EE, E7, BF, E5, 3C, E8, 9D, AD),
+		  BYTES_TO_WORDS_8(82, 0B, 7D, F9, B2, 98, 46, 81),
+		  BYTES_TO_WORDS_8(85, 2F, 73, CD, F8, AA, 98, 08),
+		  BYTES_TO_WORDS_8(71, 60, 26, 9C, 16, DD, 6C, 09) }
+	},
+	{ /* (2j + 1) * 16^36 * G */
+		{ BYTES_TO_WORDS_8(6D, 71, 3B, 52, C0, AD, 6F, 82),
+		  BYTES_TO_WORDS_8(6B, 1A, 4E, F7, 66, 89, 23, 0D),
+		  BYTES_TO_WORDS_8(9E, DF, 18, 8D, 93, C7, A5, E8),
+		  BYTES_TO_WORDS_8(34, A5, 8C, 8B, E3, 5B, 1F, F8),
+		  BYTES_TO_WORDS_8(01, 24, 63, 12, F5, 02, 40, 46),
+		  BYTES_TO_WORDS_8(30, 83, 87, 3A, 50, 58, 07, 66),
+		  BYTES_TO_WORDS_8(28, 03, 0E, 38, 9D, D2, 56, 1D),
+		  BYTES_TO_WORDS_8(DF, 06, 1F, 9C, 32, 49, 7F, DC) },
+		{ BYTES_TO_WORDS_8(8A, 9D, D1, 39, 50, 68, C5, 84),
+		  BYTES_TO_WORDS_8(15, 52, A5, 51, 89, 27, 41, 3B),
+		  BYTES_TO_WORDS_8(0A, 49, 6D, C1, 35, EC, F6, 5A),
+		  BYTES_TO_WORDS_8(38, 86, 12, FB, 50, 84, 00, A6),
+		  BYTES_TO_WORDS_8(4F, 2C, 0D, 59, B3, DB, 95, FD),
+		  BYTES_TO_WORDS_8(3D, 57, 26, A7, 8F, 00, FE, F0),
+		  BYTES_TO_WORDS_8(84, CA, E9, 7B, 5E, D4, F6, C8),
+		  BYTES_TO_WORDS_8(72, 7C, A3, 67, C0, 79, 4B, 7B) },
+		{ BYTES_TO_WORDS_8(9F, AC, 6C, 49, 39, 7B, 98, 26),
+		  BYTES_TO_WORDS_8(72, DE, 44, 5C, EA, 8C, E3, 59),
+		  BYTES_TO_WORDS_8(1C, 0E, EB, 8F, 79, 09, 4C, C6),
+		  BYTES_TO_WORDS_8(54, F3, 7D, 96, B1, 82, 53, DE),
+		  BYTES_TO_WORDS_8(D3, 73, A4, AF, FD, 82, E0, 7C),
+		  BYTES_TO_WORDS_8(15, 41, D8, 73, 94, E2, E3, C2),
+		  BYTES_TO_WORDS_8(2B, 9F, CF, 91, 09, B0, C3, 62),
+		  BYTES_TO_WORDS_8(85, 91, 9C, B6, 78, B6, 47, 9C) },
+		{ BYTES_TO_WORDS_8(23, 7A, 80, 86, 37, 96, B2, 7C),
+		  BYTES_TO_WORDS_8(3E, FF, 25, 6A, 51, 20, 00, 40),
+		  BYTES_TO_WORDS_8(C8, 4E, 19, 51, 9D, B9, 44, 53),
+		  BYTES_TO_WORDS_8(08, A9, F2, 07, 08, 7B, 22, A7),
+		  BYTES_TO_WORDS_8(94, 58, 11, D4, 83, 19, 47, 1C),
+		  BYTES_TO_WORDS_8(C9, CD, 28, B7, 57, 81, BF, E7),
+		  BYTES_TO_WORDS_8(AB, 75, A0, 20, 79, 84, DA, 45),
+		  BYTES_TO_WORDS_8(E8, 39, 5D, D4, 25, 75, 50, F5) },
+		{ BYTES_TO_WORDS_8(C0, 14, 4D, 04, C2, 7F, 79, 5A),
+		  BYTES_TO_WORDS_8(5E, F3, A8, A1, 5F, AB, 5C, 00),
+		  BYTES_TO_WORDS_8(39, 1D, 66, A3, 73, BE, 5A, 46),
+		  BYTES_TO_WORDS_8(96, 45, 34, 42, 8D, 2E, 2B, CD),
+		  BYTES_TO_WORDS_8(15, 63, 49, 22, F2, AC, 60, A5),
+		  BYTES_TO_WORDS_8(CE, CE, AC, B9, 0C, 6F, DB, FD),
+		  BYTES_TO_WORDS_8(71, F6, C0, DA, ED, 5E, 50, 4D),
+		  BYTES_TO_WORDS_8(A2, 70, 08, 9B, DF, 12, 30, F1) },
+		{ BYTES_TO_WORDS_8(66, 15, 9A, 39, 12, EB, F4, 66),
+		  BYTES_TO_WORDS_8(69, 8F, 22, FF, 5A, 65, 5C, F2),
+		  BYTES_TO_WORDS_8(D8, 9D, DF, 83, 9B, BC, EF, 4C),
+		  BYTES_TO_WORDS_8(EB, F7, 0D, 8F, 4C, E8, B2, 11),
+		  BYTES_TO_WORDS_8(73, BB, 56, 5C, C0, B3, A4, 59),
+		  BYTES_TO_WORDS_8(68, 09, D8, 0C, 84, 55, 4B, 82),
+		  BYTES_TO_WORDS_8(CC, 05, 74, 79, 98, D6, 42, D0),
+		  BYTES_TO_WORDS_8(75, 31, A2, BC, 9D, 76, 03, 61) },
+		{ BYTES_TO_WORDS_8(4A, F3, A6, DB, 28, EB, 09, 7D),
+		  BYTES_TO_WORDS_8(F8, C6, 45, E2, 0F, 6A, 28, 31),
+		  BYTES_TO_WORDS_8(85, 14, 99, EF, A3, A0, 9D, 75),
+		  BYTES_TO_WORDS_8(70, A0, 2B, 5F, 29, 19, 6D, FB),
+		  BYTES_TO_WORDS_8(52, 04, CF, 2B, 82, 3C, 5F, 9B),
+		  BYTES_TO_WORDS_8(1F, 5B, 68, C9, 2D, FA, FC, EC),
+		  BYTES_TO_WORDS_8(B9, 91, A7, C4, D4, 8F, 38, 9E),
+		  BYTES_TO_WORDS_8(DD, 46, BF, D7, 29, 2D, 9B, F2) },
+		{ BYTES_TO_WORDS_8(27, 54, 43, 0A, 2A, 2D, CA, 74),
+		  BYTES_TO_WORDS_8(50, DB, E4, 27, 98, 10, 90, A6),
+		  BYTES_TO_WORDS_8(51, 66, 90, 0D, 65, 67, AF, 0A),
+		  BYTES_TO_WORDS_8(C1, 13, 3C, 10, CC, 9F, 42, FF),
+		  BYTES_TO_WORDS_8(24, 38, 85, 39, 0D, 45, 50, 8E),
+		  BYTES_TO_WORDS_8(A2, 0D, 3A, 4A, 53, EE, 5B, 20),
+		  BYTES_TO_WORDS_8(76, 68, 18, 56, C8, 09, D4, 94),
+		  BYTES_TO_WORDS_8(B0, CD, 4E, 8A, 66, F9, DD, 2A) }
+	},
+	{ /* (2j + 1) * 16^37 * G */
+		{ BYTES_TO_WORDS_8(7A, 4B, 35, 87, E7, C7, D9, 8E),
+		  BYTES_TO_WORDS_8(97, 5C, 91, C3, 56, CA, 2E, 02),
+		  BYTES_TO_WORDS_8(1D, DE, 3C, E5, 63, F4, 97, 23),
+		  BYTES_TO_WORDS_8(48, 08, 7E, D7, 74, 54, 68, 85),
+		  BYTES_TO_WORDS_8(C6, 04, 6E, D1, 2B, 40, 54, 89),
+		  BYTES_TO_WORDS_8(BD, FD, D6, 1F, DC, 91, A8, 06),
+		  BYTES_TO_WORDS_8(87, 72, 6F, 2A, 3B, 91, BC, EE),
+		  BYTES_TO_WORDS_8(B6, 87, F5, 0B, B5, 0E, B5, 20) },
+		{ BYTES_TO_WORDS_8(5D, 16, 26, 7B, FA, C7, 6C, AF),
+		  BYTES_TO_WORDS_8(7E, 13, 77, F6, 15, A2, 13, A7),
+		  BYTES_TO_WORDS_8(DE, 92, CC, 2F, 09, D2, E9, 49),
+		  BYTES_TO_WORDS_8(65, 3E, B2, 52, C7, 44, 73, 61),
+		  BYTES_TO_WORDS_8(86, A2, B2, 86, CB, FD, 9B, C4),
+		  BYTES_TO_WORDS_8(A4, 71, 71, E3, 16, AC, 99, 98),
+		  BYTES_TO_WORDS_8(B2, 20, 82, D1, 0B, D1, B7, 49),
+		  BYTES_TO_WORDS_8(5A, 83, 37, A4, 17, 16, 90, E9) },
+		{ BYTES_TO_WORDS_8(70, 27, 44, 50, 66, F7, 1B, 02),
+		  BYTES_TO_WORDS_8(D1, BA, 01, E1, A6, F7, 18, 90),
+		  BYTES_TO_WORDS_8(2E, FC, 40, 9E, DA, C1, 04, DA),
+		  BYTES_TO_WORDS_8(22, 6A, FB, 55, EE, 03, AC, F8),
+		  BYTES_TO_WORDS_8(2D, C8, 00, 1B, F1, 64, 28, 3A),
+		  BYTES_TO_WORDS_8(02, 1D, 04, 95, BF, 02, 76, A9),
+		  BYTES_TO_WORDS_8(17, 6D, 4E, B3, 51, C7, 36, A4),
+		  BYTES_TO_WORDS_8(8E, 1E, 9D, 59, 65, 8E, 35, 5A) },
+		{ BYTES_TO_WORDS_8(DE, 60, 54, F6, 86, 6D, E0, FB),
+		  BYTES_TO_WORDS_8(B8, 77, BF, AA, D0, F8, 73, 0C),
+		  BYTES_TO_WORDS_8(A6, 8E, CC, 30, BE, BC, 6C, 6C),
+		  BYTES_TO_WORDS_8(C6, 95, BC, 25, B5, 1F, 73, 8A),
+		  BYTES_TO_WORDS_8(07, C2, 8D, FF, 1D, 9A, 85, E9),
+		  BYTES_TO_WORDS_8(E3, 8E, 50, 52, 3C, 7E, 86, 35),
+		  BYTES_TO_WORDS_8(C4, 4D, B0, FF, 4B, 95, 52, 8F),
+		  BYTES_TO_WORDS_8(19, 63, AB, E2, C5, 55, 58, 58) },
+		{ BYTES_TO_WORDS_8(A5, 34, 16, B5, DF, BA, 2A, 64),
+		  BYTES_TO_WORDS_8(4E, 52, ED, 35, 78, 0A, F9, 3C),
+		  BYTES_TO_WORDS_8(7F, 96, D7, 2C, A0, 6B, 0A, BF),
+		  BYTES_TO_WORDS_8(24, F2, A8, 32, 61, 60, 0B, A2),
+		  BYTES_TO_WORDS_8(AD, AF, 26, F2, 95, 37, C1, 26),
+		  BYTES_TO_WORDS_8(DF, 5E, D4, 3C, 7E, 75, 74, C6),
+		  BYTES_TO_WORDS_8(5B, 31, 3B, 37, E8, 5F, 3D, AD),
+		  BYTES_TO_WORDS_8(9D, B9, 7D, 69, 9F, CE, 43, 9C) },
+		{ BYTES_TO_WORDS_8(A8, 54, BA, B3, 44, 22, 43, 70),
+		  BYTES_TO_WORDS_8(70, A9, 3A, 60, 35, 26, 8B, B5),
+		  BYTES_TO_WORDS_8(0A, CC, C5, 4F, C3, 8E, 43, 91),
+		  BYTES_TO_WORDS_8(09, 67, 25, F1, 93, 1F, 6F, 01),
+		  BYTES_TO_WORDS_8(89, 28, 4F, 66, FA, 61, 7C, ED),
+		  BYTES_TO_WORDS_8(E6, B4, A3, 46, 75, F2, 3A, D9),
+		  BYTES_TO_WORDS_8(58, E6, 9C, E4, 1B, B1, 29, 6F),
+		  BYTES_TO_WORDS_8(57, 51, 89, 15, 41, D3, BC, 08) },
+		{ BYTES_TO_WORDS_8(94, 6D, C1, E7, 3C, 49, EE, DE),
+		  BYTES_TO_WORDS_8(FD, 45, 28, A0, 0A, 1D, 58, E2),
+		  BYTES_TO_WORDS_8(1F, C3, CE, CC, 67, FD, 08, 8C),
+		  BYTES_TO_WORDS_8(78, 34, D0, 0B, 67, 86, 15, E6),
+		  BYTES_TO_WORDS_8(AB, 10, 48, B1, 9A, D1, 4E, FB),
+		  BYTES_TO_WORDS_8(BB, 43, A4, 47, 1E, CD, 65, 4E),
+		  BYTES_TO_WORDS_8(EE, F0, B6, F4, 93, 2B, 5B, 8C),
+		  BYTES_TO_WORDS_8(BE, 24, 71, 9E, AE, 03, CA, 65) },
+		{ BYTES_TO_WORDS_8(8D, 72, CE, 53, 66, CA, 6D, CD),
+		  BYTES_TO_WORDS_8(0B, CD, 71, 28, 7E, 90, CD, F4),
+		  BYTES_TO_WORDS_8(47, 53, C8, 16, A2, 08, 5A, 55),
+		  BYTES_TO_WORDS_8(26, 6A, D5, 38, 0B, 7F, D3, DC),
+		  BYTES_TO_WORDS_8(CB, CB, CA, 97, 69, 13, 7D, 8D),
+		  BYTES_TO_WORDS_8(EB, AB, 9D, D2, 46, D3, AC, CA),
+		  BYTES_TO_WORDS_8(F3, D6, C6, B3, 62, 7B, C3, 72),
+		  BYTES_TO_WORDS_8(18, 4C, DA, 7C, D7, DB, 74, 65) }
+	},
+	{ /* (2j + 1) * 16^38 * G */
+		{ BYTES_TO_WORDS_8(16, 8C, 37, 12, 1B, DC, C6, DD),
+		  BYTES_TO_WORDS_8(2A, 62, 15, 46, 55, 07, 36, 9E),
+		  BYTES_TO_WORDS_8(7D, 59, F9, 6B, 2D, E5, 19, B3),
+		  BYTES_TO_WORDS_8(11, 3B, 2B, C1, 59, B7, 36, 11),
+		  BYTES_TO_WORDS_8(27, 81, 48, B3, D0, 9B, F5, 79),
+		  BYTES_TO_WORDS_8(E3, CC, 51, E7, 28, AA, 14, 96),
+		  BYTES_TO_WORDS_8(B2, EC, E9, 0F, C6, AB, F0, 09),
+		  BYTES_TO_WORDS_8(DD, 8F, 16, 45, CF, 0F, EC, 7D) },
+		{ BYTES_TO_WORDS_8(40, 97, 29, 7B, 82, 6D, 0E, 97),
+		  BYTES_TO_WORDS_8(34, B1, 3D, 71, 7D, 46, 0F, F4),
+		  BYTES_TO_WORDS_8(48, AD, FA, 93, 37, D1, 4A, CC),
+		  BYTES_TO_WORDS_8(36, 43, DD, 1C, B7, 3E, 89, 53),
+		  BYTES_TO_WORDS_8(09, 75, FF, 3F, 1B, 6F, EA, 51),
+		  BYTES_TO_WORDS_8(CD, E8, FD, 21, EF, 32, A1, D8),
+		  BYTES_TO_WORDS_8(8D, DC, 75, EA, 28, CE, 41, 38),
+		  BYTES_TO_WORDS_8(D8, FB, 85, 94, 7E, 8A, 72, 27) },
+		{ BYTES_TO_WORDS_8(FC, 00, 80, 73, 56, C9, B3, 30),
+		  BYTES_TO_WORDS_8(C1, 3B, F0, 7B, 70, 27, 1E, 4E),
+		  BYTES_TO_WORDS_8(60, E5, FA, F1, BA, 76, E3, 57),
+		  BYTES_TO_WORDS_8(27, DA, 4C, 75, DD, E9, 64, DD),
+		  BYTES_TO_WORDS_8(12, AC, F4, DD, 50, 1C, AA, BF),
+		  BYTES_TO_WORDS_8(F8, 48, 1E, B9, 22, D0, 45, BE),
+		  BYTES_TO_WORDS_8(FF, 79, CA, 19, 3E, 9E, F8, 6D),
+		  BYTES_TO_WORDS_8(C9, 32, 29, 0C, EB, 93, 21, 43) },
+		{ BYTES_TO_WORDS_8(4A, 8C, 87, 33, 17, 15, 82, EF),
+		  BYTES_TO_WORDS_8(55, C0, 51, 85, 3C, D0, 83, D8),
+		  BYTES_TO_WORDS_8(21, 1B, A9, E4, 60, 9C, C6, F2),
+		  BYTES_TO_WORDS_8(16, D5, FF, 7E, A8, 45, 98, FF),
+		  BYTES_TO_WORDS_8(68, DF, 88, 74, 7D, 84, A6, 6B),
+		  BYTES_TO_WORDS_8(BC, FE, 5C, B6, 46, 37, F3, F1),
+		  BYTES_TO_WORDS_8(DD, E8, F5, DF, 8E, A4, D8, 8F),
+		  BYTES_TO_WORDS_8(8F, 42, E2, A4, F4, 9A, 5B, 83) },
+		{ BYTES_TO_WORDS_8(24, 15, F5, 40, 81, B8, A9, 8C),
+		  BYTES_TO_WORDS_8(FC, 86, AF, 5B, A1, B6, AE, 5F),
+		  BYTES_TO_WORDS_8(DE, 93, 52, 84, 30, 7A, 76, E8),
+		  BYTES_TO_WORDS_8(9C, 60, 91, BB, E8, 13, 4E, 95),
+		  BYTES_TO_WORDS_8(69, 0A, E3, 45, D9, B3, FD, E9),
+		  BYTES_TO_WORDS_8(BD, 7C, 1E, 14, 31, A4, EE, A9),
+		  BYTES_TO_WORDS_8(CF, CB, 9E, 47, 43, 62, 3C, D9),
+		  BYTES_TO_WORDS_8(41, 40, 2A, F9, 3F, 36, C8, EC) },
+		{ BYTES_TO_WORDS_8(87, 72, F7, C4, 53, 8D, 79, 1F),
+		  BYTES_TO_WORDS_8(E3, D9, 30, 69, C3, 53, 29, 41),
+		  BYTES_TO_WORDS_8(97, 04, D8, C1, C5, 50, CD, DF),
+		  BYTES_TO_WORDS_8(93, FB, 41, FA, F6, 7E, 21, B2),
+		  BYTES_TO_WORDS_8(DA, B5, E7, 24, 77, 4A, A0, 97),
+		  BYTES_TO_WORDS_8(CB, 93, 5E, 9C, 73, DC, 09, D7),
+		  BYTES_TO_WORDS_8(43, C8, 38, 8D, F8, BC, DF, B5),
+		  BYTES_TO_WORDS_8(A2, F3, 7C, CE, E0, 53, 51, FB) },
+		{ BYTES_TO_WORDS_8(E9, 23, C7, 85, 6C, 39, F5, 8A),
+		  BYTES_TO_WORDS_8(71, 81, A7, 9A, AA, 3B, 97, 1F),
+		  BYTES_TO_WORDS_8(35, 5C, 5D, 91, AE, 6E, 2C, 12),
+		  BYTES_TO_WORDS_8(AD, BD, 79, 7B, B1, 50, 39, 3C),
+		  BYTES_TO_WORDS_8(63, 47, 83, 76, 5F, 77, 38, 5E),
+		  BYTES_TO_WORDS_8(AE, 06, 49, 7C, B5, AC, 1D, B0),
+		  BYTES_TO_WORDS_8(B0, A8, 86, A1, 7E, BB, 94, B4),
+		  BYTES_TO_WORDS_8(DB, 10, 91, 20, 62, 73, 9B, B9) },
+		{ BYTES_TO_WORDS_8(EB, AB, 18, 3C, E2, D6, 17, 37),
+		  BYTES_TO_WORDS_8(2A, D6, 25, 07, 19, CD, 9D, D5),
+		  BYTES_TO_WORDS_8(44, A9, BA, 44, F8, D2, DE, D1),
+		  BYTES_TO_WORDS_8(DA, 1C, 96, CF, 2C, 7A, 3C, 80),
+		  BYTES_TO_WORDS_8(78, FA, 9B, E2, F0, 9B, 43, 6A),
+		  BYTES_TO_WORDS_8(CD, 21, 67, 2A, 3C, 44, 7C, ED),
+		  BYTES_TO_WORDS_8(09, 44, 4B, 9C, 16, CF, 1A, 6B),
+		  BYTES_TO_WORDS_8(28, E9, 96, A7, 40, 50, FB, 83) }
+	},
+	{ /* (2j + 1) * 16^39 * G */
+		{ BYTES_TO_WORDS_8(2A, 83, 3E, 94, F1, 2E, 76, 9C),
+		  BYTES_TO_WORDS_8(70, DF, 86, 17, B0, 0A, E5, 07),
+		  BYTES_TO_WORDS_8(8E, F1, 89, 25, A8, 73, F5, 90),
+		  BYTES_TO_WORDS_8(1A, A5, C2, A7, 8B, F2, 2B, 0D),
+		  BYTES_TO_WORDS_8(7C, D3, 20, 5B, F1, 3A, 26, 48),
+		  BYTES_TO_WORDS_8(46, 14, 55, 60, B9, 9D, EC, 27),
+		  BYTES_TO_WORDS_8(ED, E7, B4, 94, 0A, A1, 87, 70),
+		  BYTES_TO_WORDS_8(AC, 00, BD, 13, 43, 3F, AC, 0C) },
+		{ BYTES_TO_WORDS_8(66, 96, 2C, 11, BC, C4, EA, 61),
+		  BYTES_TO_WORDS_8(F3, CD, FF, 65, C3, C6, F8, 1C),
+		  BYTES_TO_WORDS_8(1B, 53, D9, B7, 35, CC, 9B, FD),
+		  BYTES_TO_WORDS_8(2C, F8, 67, B9, 5E, E8, E5, 34),
+		  BYTES_TO_WORDS_8(66, 36, 2A, 99, 3C, 85, A1, B5),
+		  BYTES_TO_WORDS_8(26, A5, E3, C1, 63, ED, 47, 0F),
+		  BYTES_TO_WORDS_8(33, 46, BC, CC, 75, 65, 84, 82),
+		  BYTES_TO_WORDS_8(6B, A3, 21, 32, 31, 68, CE, C0) },
+		{ BYTES_TO_WORDS_8(02, 95, 20, 51, E3, 2B, 65, C1),
+		  BYTES_TO_WORDS_8(65, 26, D9, 25, 00, 72, 41, 59),
+		  BYTES_TO_WORDS_8(54, E1, 19, 09, EF, 93, C4, A6),
+		  BYTES_TO_WORDS_8(63, D8, F4, 59, CC, 62, 73, 72),
+		  BYTES_TO_WORDS_8(0D, 2B, 04, D7, D3, D1, 77, C6),
+		  BYTES_TO_WORDS_8(BB, 60, 27, BB, F9, 37, 8D, A1),
+		  BYTES_TO_WORDS_8(20, 1D, E9, 2C, 8C, 0B, 10, 9F),
+		  BYTES_TO_WORDS_8(58, AB, AB, 9B, 22, F4, B0, 17) },
+		{ BYTES_TO_WORDS_8(59, F9, 47, A4, 28, 79, 5E, 45),
+		  BYTES_TO_WORDS_8(68, D3, 71, 82, BA, DA, 47, F9),
+		  BYTES_TO_WORDS_8(E9, EE, 49, BB, C4, 14, 3A, 97),
+		  BYTES_TO_WORDS_8(EC, 6C, 4A, 05, 60, F2, C3, A0),
+		  BYTES_TO_WORDS_8(1F, 67, 8B, 96, 48, D2, 39, B0),
+		  BYTES_TO_WORDS_8(C9, 72, D2, 58, 02, 54, B5, B1),
+		  BYTES_TO_WORDS_8(08, 82, 62, CB, 10, 8C, 2F, 38),
+		  BYTES_TO_WORDS_8(4F, 2C, 4B, 0E, 09, 73, 8C, 50) },
+		{ BYTES_TO_WORDS_8(D3, E1, 37, 5B, 02, 9F, 1F, 02),
+		  BYTES_TO_WORDS_8(23, DE, E4, 3C, E1, 1B, 76, 10),
+		  BYTES_TO_WORDS_8(04, FD, 15, E4, 3B, 43, CB, 40),
+		  BYTES_TO_WORDS_8(7A, CA, 95, F7, 31, B2, 81, 7E),
+		  BYTES_TO_WORDS_8(1A, 68, 55, 41, 26, CA, 5F, 3F),
+		  BYTES_TO_WORDS_8(E0, E0, C2, B1, F2, 4B, C8, 4E),
+		  BYTES_TO_WORDS_8(4E, 7C, 6C, EE, 6C, 89, 5E, 12),
+		  BYTES_TO_WORDS_8(13, ED, 9B, 0E, 1B, 5A, 85, F3) },
+		{ BYTES_TO_WORDS_8(A0, 51, C0, 56, 5F, 71, 97, C4),
+		  BYTES_TO_WORDS_8(6D, 3E, 5B, 6F, 24, 29, DF, DC),
+		  BYTES_TO_WORDS_8(BD, 2A, 0F, DB, E6, D8, 36, 4A),
+		  BYTES_TO_WORDS_8(D8, 26, 80, 7D, 1C, E2, 35, 80),
+		  BYTES_TO_WORDS_8(12, DD, D0, B2, 2F, BB, 1E, 60),
+		  BYTES_TO_WORDS_8(35, 62, 8B, 09, 63, DC, E7, B3),
+		  BYTES_TO_WORDS_8(18, D3, BD, 37, 68, BE, 5D, 37),
+		  BYTES_TO_WORDS_8(EF, 2B, 7A, 4B, A4, 10, 88, 0B) },
+		{ BYTES_TO_WORDS_8(9E, C6, 12, FF, 09, C3, 00, CE),
+		  BYTES_TO_WORDS_8(63, 19, 65, 89, F5, AE, E5, AF),
+		  BYTES_TO_WORDS_8(EC, FC, 04, 02, 01, F0, BA, 06),
+		  BYTES_TO_WORDS_8(33, A5, 18, D6, DF, 08, 69, 19),
+		  BYTES_TO_WORDS_8(31, 48, 11, 1D, 04, 19, 33, 8D),
+		  BYTES_TO_WORDS_8(6B, 88, FB, 1F, 37, E3, B2, B6),
+		  BYTES_TO_WORDS_8(4E, 05, 21, DD, EA, 1D, EE, 0B),
+		  BYTES_TO_WORDS_8(04, 6E, 91, 2F, 6B, BF, 65, 3F) },
+		{ BYTES_TO_WORDS_8(ED, C5, 89, CB, 1F, E0, 98, E4),
+		  BYTES_TO_WORDS_8(C7, 78, 7A, 79, CF, 30, B5, 77),
+		  BYTES_TO_WORDS_8(35, 0F, AD, 10, D2, E1, E6, 46),
+		  BYTES_TO_WORDS_8(AF, A2, 61, 89, EB, FC, 77, DB),
+		  BYTES_TO_WORDS_8(6E, B4, 25, ED, 7E, 1C, FF, 59),
+		  BYTES_TO_WORDS_8(FA, 9A, 89, 68, AB, C7, 16, 1F),
+		  BYTES_TO_WORDS_8(41, AD, 99, 4C, BE, 39, F3, EC),
+		  BYTES_TO_WORDS_8(CE, E5, CE, 71, 38, DC, D1, 7F) }
+	},
+	{ /* (2j + 1) * 16^40 * G */
+		{ BYTES_TO_WORDS_8(2A, 2F, F8, F7, 5D, C7, E9, AE),
+		  BYTES_TO_WORDS_8(3A, F4, FD, 4A, 87, 35, 4C, 9E),
+		  BYTES_TO_WORDS_8(26, 13, 37, 37, F4, 2D, 62, F5),
+		  BYTES_TO_WORDS_8(17, 36, C7, 6E, 56, 5F, 53, 8A),
+		  BYTES_TO_WORDS_8(B7, 94, 30, 22, AC, A0, F9, C5),
+		  BYTES_TO_WORDS_8(69, 76, 8C, 4C, 86, 33, E5, CD),
+		  BYTES_TO_WORDS_8(BF, 92, 5A, 08, 19, 28, E0, 37),
+		  BYTES_TO_WORDS_8(D7, 8B, B0, 68, 84, C0, 55, 04) },
+		{ BYTES_TO_WORDS_8(A0, 8F, 34, AB, 17, F2, 14, FB),
+		  BYTES_TO_WORDS_8(DD, 41, 15, 05, 59, 24, FE, E0),
+		  BYTES_TO_WORDS_8(BC, B4, 24, 6C, 23, 23, A2, C2),
+		  BYTES_TO_WORDS_8(2D, 88, EB, DD, 3D, C9, EA, 86),
+		  BYTES_TO_WORDS_8(EE, 1C, A5, 4D, 95, 80, E3, 4E),
+		  BYTES_TO_WORDS_8(8A, EE, CF, 51, 63, D9, 26, 6C),
+		  BYTES_TO_WORDS_8(71, 46, 6F, 8D, 9E, 6F, 43, 5A),
+		  BYTES_TO_WORDS_8(8D, 4D, BC, CB, 53, 38, 8F, 94) },
+		{ BYTES_TO_WORDS_8(03, 2C, 22, 99, FC, 1F, F4, 7A),
+		  BYTES_TO_WORDS_8(03, E1, E5, 87, 7E, E7, 8C, 94),
+		  BYTES_TO_WORDS_8(07, F4, 59, 48, 78, 7D, 5E, 3F),
+		  BYTES_TO_WORDS_8(AE, 3A, FB, F9, BA, 9E, F0, 8B),
+		  BYTES_TO_WORDS_8(54, BB, 72, EA, 42, F7, 45, A1),
+		  BYTES_TO_WORDS_8(D4, E1, 20, DE, E1, C0, 9E, 9C),
+		  BYTES_TO_WORDS_8(30, BA, E5, E7, DB, B1, 48, 3B),
+		  BYTES_TO_WORDS_8(73, 7A, E2, E2, AF, BA, 9C, 50) },
+		{ BYTES_TO_WORDS_8(00, 93, AE, D1, C1, A2, 53, B4),
+		  BYTES_TO_WORDS_8(80, 82, C4, 75, 04, 47, 1C, 5E),
+		  BYTES_TO_WORDS_8(5B, 73, F3, A2, AD, 0B, 13, 19),
+		  BYTES_TO_WORDS_8(C6, 0F, E7, B7, CB, 2D, 5E, E8),
+		  BYTES_TO_WORDS_8(5E, E2, 46, 15, DD, DF, A0, 72),
+		  BYTES_TO_WORDS_8(BB, 31, 8C, DF, 85, E1, B7, DE),
+		  BYTES_TO_WORDS_8(07, 27, 3C, 82, 5B, 7B, BA, C7),
+		  BYTES_TO_WORDS_8(BF, E0, 1C, D5, A6, AF, 1A, 45) },
+		{ BYTES_TO_WORDS_8(B8, 0C, 26, 05, 56, D5, 25, 25),
+		  BYTES_TO_WORDS_8(2F, 15, B2, CE, 80, 4A, 6F, 83),
+		  BYTES_TO_WORDS_8(F6, DB, A7, 1B, DA, 27, F0, A3),
+		  BYTES_TO_WORDS_8(82, 2F, C9, 28, F2, B0, 5F, 3F),
+		  BYTES_TO_WORDS_8(64, C9, 52, 18, 44, 4B, FB, 72),
+		  BYTES_TO_WORDS_8(32, C3, 5E, FC, 51, 87, 3E, FA),
+		  BYTES_TO_WORDS_8(F2, 83, 67, 36, 15, DE, 38, 0E),
+		  BYTES_TO_WORDS_8(87, 99, 49, DA, DA, 34, 58, C5) },
+		{ BYTES_TO_WORDS_8(0F, D6, 1C, DA, 42, 44, A4, 4A),
+		  BYTES_TO_WORDS_8(EA, 92, 30, CC, A9, 98, 96, 9F),
+		  BYTES_TO_WORDS_8(2B, 00, DA, B4, 74, D0, AE, 57),
+		  BYTES_TO_WORDS_8(96, 99, 8D, B1, 22, 56, 68, 33),
+		  BYTES_TO_WORDS_8(67, 7D, D5, 0F, 65, 37, F7, 4B),
+		  BYTES_TO_WORDS_8(B2, B8, 50, BC, 4C, 5A, EF, 5F),
+		  BYTES_TO_WORDS_8(17, AF, A7, DE, 00, 8C, 85, BA),
+		  BYTES_TO_WORDS_8(D9, 7C, 24, F1, 9E, 50, 2F, D4) },
+		{ BYTES_TO_WORDS_8(42, 63, 57, B7, EB, B6, 53, F0),
+		  BYTES_TO_WORDS_8(2A, 22, 99, 39, 83, 88, 2C, 5B),
+		  BYTES_TO_WORDS_8(D9, 79, 09, 96, D8, F9, D0, F7),
+		  BYTES_TO_WORDS_8(80, 00, F0, 08, 5C, EB, 13, 48),
+		  BYTES_TO_WORDS_8(16, 63, 37, 97, EB, 55, C1, 64),
+		  BYTES_TO_WORDS_8(4F, 90, 6A, 50, 7D, C6, 2D, CA),
+		  BYTES_TO_WORDS_8(4A, 52, 33, 8E, 84, 16, 60, F6),
+		  BYTES_TO_WORDS_8(40, 42, 3A, 23, D4, 3F, 04, 00) },
+		{ BYTES_TO_WORDS_8(BE, B2, 69, FF, 1D, 17, 67, 9F),
+		  BYTES_TO_WORDS_8(C0, 11, 11, DC, 4E, F7, 41, BA),
+		  BYTES_TO_WORDS_8(56, 6E, 38, AE, BB, 2D, 32, F1),
+		  BYTES_TO_WORDS_8(7A, 99, AE, A5, F9, F1, C3, 80),
+		  BYTES_TO_WORDS_8(F5, D2, 02, 41, 7C, B9, 04, 89),
+		  BYTES_TO_WORDS_8(BF, A8, B7, 5C, B3, 74, 4B, F1),
+		  BYTES_TO_WORDS_8(9B, 5A, 1D, 5B, 76, E2, 80, 29),
+		  BYTES_TO_WORDS_8(85, DE, 09, A0, 40, 21, 93, 0A) }
+	},
+	{ /* (2j + 1) * 16^41 * G */
+		{ BYTES_TO_WORDS_8(1D, C8, 76, E4, 4F, 7F, 83, 9C),
+		  BYTES_TO_WORDS_8(5E, 3D, E5, 99, 0E, 03, A3, B7),
+		  BYTES_TO_WORDS_8(66, A3, A8, 3D, 27, CD, F7, 9A),
+		  BYTES_TO_WORDS_8(01, 1A, B4, DC, DF, 90, 60, AD),
+		  BYTES_TO_WORDS_8(DD, 05, 67, EE, 84, BC, 8A, 81),
+		  BYTES_TO_WORDS_8(DF, 48, 30, 4F, 36, DC, 3F, 39),
+		  BYTES_TO_WORDS_8(A8, D8, 5B, CC, C2, 75, CD, AC),
+		  BYTES_TO_WORDS_8(1E, C9, F4, 48, DD, D1, B5, 77) },
+		{ BYTES_TO_WORDS_8(90, 54, 72, E2, 7C, 73, 24, 0A),
+		  BYTES_TO_WORDS_8(90, 59, CB, 23, 06, 24, C3, 4A),
+		  BYTES_TO_WORDS_8(3C, 86, 09, 3B, 53, AA, AD, A2),
+		  BYTES_TO_WORDS_8(7C, 69, AD, 71, BB, 45, 0B, D9),
+		  BYTES_TO_WORDS_8(99, 12, EB, AF, 84, 4F, F8, B0),
+		  BYTES_TO_WORDS_8(CC, 66, C4, F3, BF, 07, DC, 0C),
+		  BYTES_TO_WORDS_8(D8, CB, 78, 73, 68, B5, D8, 09),
+		  BYTES_TO_WORDS_8(0F, 35, BB, C1, 8E, 92, 26, 33) },
+		{ BYTES_TO_WORDS_8(68, 36, 93, 7E, 65, 3A, 6B, A7),
+		  BYTES_TO_WORDS_8(F0, AB, 6B, F8, 4C, D8, 02, FB),
+		  BYTES_TO_WORDS_8(BE, 06, 1F, FA, 3A, 39, 05, AC),
+		  BYTES_TO_WORDS_8(C7, 3F, 21, 31, 17, 92, 25, AC),
+		  BYTES_TO_WORDS_8(B5, 6F, 77, 32, 67, 7F, E7, 16),
+		  BYTES_TO_WORDS_8(7A, 1E, 9E, C6, 89, 41, 86, 6F),
+		  BYTES_TO_WORDS_8(7C, ED, D8, EB, 3E, C1, 0E, 85),
+		  BYTES_TO_WORDS_8(BA, A8, DB, 70, 38, A0, 79, 6C) },
+		{ BYTES_TO_WORDS_8(E3, E7, 8D, 12, 12, 7C, 61, 9A),
+		  BYTES_TO_WORDS_8(6D, 99, EA, AB, C3, 2A, 84, 86),
+		  BYTES_TO_WORDS_8(BF, 31, B4, A7, BD, 0F, 32, 87),
+		  BYTES_TO_WORDS_8(A8, F3, 79, E9, 4A, 37, C3, 7B),
+		  BYTES_TO_WORDS_8(29, 5E, 6E, AE, 2E, B3, A0, 67),
+		  BYTES_TO_WORDS_8(F0, CC, C0, B4, 39, DB, F2, 55),
+		  BYTES_TO_WORDS_8(BD, AC, 4B, 6E, AE, 77, 0C, E0),
+		  BYTES_TO_WORDS_8(5D, 4E, 85, 60, 24, F0, 31, B4) },
+		{ BYTES_TO_WORDS_8(7D, 05, 5E, 83, 23, 23, CB, 4A),
+		  BYTES_TO_WORDS_8(5B, 9A, D8, F6, DA, 10, CF, 29),
+		  BYTES_TO_WORDS_8(93, 11, 41, C3, 2F, 87, BC, 68),
+		  BYTES_TO_WORDS_8(B2, 02, AE, 53, 94, 14, 9C, BF),
+		  BYTES_TO_WORDS_8(EA, 0F, A2, 2D, 28, 4B, 56, 6F),
+		  BYTES_TO_WORDS_8(9B, 47, 5C, 1C, 18, 9E, 0B, 44),
+		  BYTES_TO_WORDS_8(42, A5, C7, 05, 3F, 31, 85, F3),
+		  BYTES_TO_WORDS_8(E0, 3B, F2, 25, 9F, B8, AC, 92) },
+		{ BYTES_TO_WORDS_8(84, 65, 1D, 02, C2, D7, AC, D2),
+		  BYTES_TO_WORDS_8(E5, D9, B3, 43, 64, 5D, 70, F2),
+		  BYTES_TO_WORDS_8(4E, 01, DF, 5A, A3, 7D, E9, 96),
+		  BYTES_TO_WORDS_8(8A, 4F, 78, B5, 39, 08, BF, 55),
+		  BYTES_TO_WORDS_8(EA, 44, D7, 8E, 42, 4F, 56, 0D),
+		  BYTES_TO_WORDS_8(A8, A5, E5, 2A, 20, 14, 9E, 08),
+		  BYTES_TO_WORDS_8(CF, 7D, BC, A8, 6B, BF, AC, 27),
+		  BYTES_TO_WORDS_8(CF, 1C, B6, E4, 33, 07, 98, 3D) },
+		{ BYTES_TO_WORDS_8(5E, 8C, 06, 41, 6E, DF, 69, DD),
+		  BYTES_TO_WORDS_8(D0, 73, E5, 4B, 6E, EE, 45, 2A),
+		  BYTES_TO_WORDS_8(87, D4, 15, 78, 4E, E1, 2A, 9F),
+		  BYTES_TO_WORDS_8(51, 8D, 37, 53, 16, 4E, F2, FC),
+		  BYTES_TO_WORDS_8(75, 9D, C1, 27, 3F, 45, 1F, 76),
+		  BYTES_TO_WORDS_8(5B, 85, 14, 28, 4B, 6A, 17, E9),
+		  BYTES_TO_WORDS_8(AE, E7, 92, B5, 21, 5E, 67, 5C),
+		  BYTES_TO_WORDS_8(E3, FF, 6F, 33, E5, B0, 6B, 18) },
+		{ BYTES_TO_WORDS_8(60, A8, 0D, 62, F0, 95, 7D, 8B),
+		  BYTES_TO_WORDS_8(00, D1, 49, 48, AA, 51, 34, 84),
+		  BYTES_TO_WORDS_8(2F, 1F, D9, 43, 53, B6, FD, A1),
+		  BYTES_TO_WORDS_8(EC, 67, 51, 2F, D0, 80, C2, 7B),
+		  BYTES_TO_WORDS_8(6D, C7, AA, 07, 41, 10, 29, BE),
+		  BYTES_TO_WORDS_8(2E, 63, C1, DC, 2F, 9A, E1, F2),
+		  BYTES_TO_WORDS_8(E0, E6, 5E, 70, FA, 6B, 62, E2),
+		  BYTES_TO_WORDS_8(E5, 31, BD, BB, 77, 6D, 3F, B3) }
+	},
+	{ /* (2j + 1) * 16^42 * G */
+		{ BYTES_TO_WORDS_8(05, A2, C4, 93, 36, 2C, 2F, A5),
+		  BYTES_TO_WORDS_8(48, A8, 10, F5, 89, DF, 1A, DE),
+		  BYTES_TO_WORDS_8(FC, 29, B9, 75, 70, 55, 66, E4),
+		  BYTES_TO_WORDS_8(C4, BB, 05, 63, 51, 6C, E0, B6),
+		  BYTES_TO_WORDS_8(05, 6D, B3, 5D, 86, 4D, 7F, 53),
+		  BYTES_TO_WORDS_8(87, 9F, 2A, A8, 19, 94, F9, 63),
+		  BYTES_TO_WORDS_8(3B, D7, 9E, E7, 26, F1, E1, C5),
+		  BYTES_TO_WORDS_8(F5, 23, B3, 21, 7C, 27, B4, BD) },
+		{ BYTES_TO_WORDS_8(07, 79, E2, F9, F6, 21, F8, 92),
+		  BYTES_TO_WORDS_8(D6, E4, D9, 88, B3, D4, 1A, 77),
+		  BYTES_TO_WORDS_8(68, BD, DF, 6F, 5D, 5D, 39, 6B),
+		  BYTES_TO_WORDS_8(4E, 1C, 24, 84, 3F, E4, D9, 0E),
+		  BYTES_TO_WORDS_8(FB, C4, 78, 6E, 50, 4F, 3F, F1),
+		  BYTES_TO_WORDS_8(05, 19, BA, B8, FE, 1C, 15, E9),
+		  BYTES_TO_WORDS_8(0C, 0E, 12, EB, D8, 0F, BC, F5),
+		  BYTES_TO_WORDS_8(47, 23, 6B, FF, 4A, 87, AF, B5) },
+		{ BYTES_TO_WORDS_8(54, 8F, B3, 35, 25, 57, D0, 36),
+		  BYTES_TO_WORDS_8(CE, 07, AF, 5C, 0E, 86, 2A, 2E),
+		  BYTES_TO_WORDS_8(F9, E1, FE, 48, DB, 68, 52, C5),
+		  BYTES_TO_WORDS_8(7D, 8F, 6D, 07, 10, E4, A7, 57),
+		  BYTES_TO_WORDS_8(09, 28, 5F, 24, E6, 81, A7, 5F),
+		  BYTES_TO_WORDS_8(A7, EB, 07, A9, 39, 6E, D7, DF),
+		  BYTES_TO_WORDS_8(21, DD, 82, BC, 23, 8A, 4C, 19),
+		  BYTES_TO_WORDS_8(24, AD, EC, C8, 03, 0F, 7F, FD) },
+		{ BYTES_TO_WORDS_8(93, 95, A7, A7, F9, BB, FE, 46),
+		  BYTES_TO_WORDS_8(79, 49, 5C, D2, 49, 72, 7A, 34),
+		  BYTES_TO_WORDS_8(F3, 5C, CA, 8C, 25, 9B, 2D, F5),
+		  BYTES_TO_WORDS_8(BE, 5D, EF, F3, E2, 9A, 79, 24),
+		  BYTES_TO_WORDS_8(55, 0D, 92, D0, 75, 8D, 38, D6),
+		  BYTES_TO_WORDS_8(98, 13, EB, 9B, 1F, 36, 94, 99),
+		  BYTES_TO_WORDS_8(00, E3, 63, D3, A9, D1, C3, 32),
+		  BYTES_TO_WORDS_8(7B, 7B, C8, 2E, 26, B5, 36, 94) },
+		{ BYTES_TO_WORDS_8(DC, AB, F5, 0B, B5, 6E, 21, 60),
+		  BYTES_TO_WORDS_8(06, 65, 0B, BD, AF, D3, 6C, 45),
+		  BYTES_TO_WORDS_8(60, 5D, 0D, 08, CB, 11, 31, ED),
+		  BYTES_TO_WORDS_8(26, 70, 4C, 88, C6, 17, 50, F1),
+		  BYTES_TO_WORDS_8(B7, 85, EF, AD, B8, E2, 5D, B7),
+		  BYTES_TO_WORDS_8(84, 55, B8, 27, 5C, 67, DC, CB),
+		  BYTES_TO_WORDS_8(32, E2, C5, 3F, 1E, 34, D8, EC),
+		  BYTES_TO_WORDS_8(A8, 02, 5F, 2C, 1C, EF, A7, DE) },
+		{ BYTES_TO_WORDS_8(B1, E9, 78, FE, B1, 52, F2, 69),
+		  BYTES_TO_WORDS_8(E8, 41, C1, 4E, DC, E6, 78, 89),
+		  BYTES_TO_WORDS_8(CC, DF, 12, 75, 1F, 83, 0F, 6E),
+		  BYTES_TO_WORDS_8(AA, BE, B4, 89, 0F, E2, 96, E1),
+		  BYTES_TO_WORDS_8(D7, EE, 77, CA, 1F, 56, 17, 44),
+		  BYTES_TO_WORDS_8(F4, 35, ED, BE, 12, 01, 8D, 90),
+		  BYTES_TO_WORDS_8(9A, ED, B2, 76, BE, 08, 64, 2A),
+		  BYTES_TO_WORDS_8(A6, 85, 1A, F8, 85, 6D, D6, A5) },
+		{ BYTES_TO_WORDS_8(4B, B6, 1C, 7B, E5, 33, EE, 76),
+		  BYTES_TO_WORDS_8(D5, C3, 8A, 61, 25, E5, 09, D6),
+		  BYTES_TO_WORDS_8(14, ED, 39, 15, D7, FC, 97, F3),
+		  BYTES_TO_WORDS_8(02, 03, 1B, 6C, DE, F5, 79, 77),
+		  BYTES_TO_WORDS_8(AB, 3A, BA, BA, 1C, 8D, E1, D8),
+		  BYTES_TO_WORDS_8(33, 95, AA, 3C, 42, 29, A8, E2),
+		  BYTES_TO_WORDS_8(FA, E3, A2, A7, 34, B1, FA, AD),
+		  BYTES_TO_WORDS_8(BE, 3E, 4C, 47, 3F, 42, A8, 09) },
+		{ BYTES_TO_WORDS_8(92, B4, D1, 91, 76, 58, D8, 3E),
+		  BYTES_TO_WORDS_8(F5, A6, 19, 20, 8C, 61, A0, DF),
+		  BYTES_TO_WORDS_8(E8, 8C, B2, AE, 9A, 6D, 5F, 1E),
+		  BYTES_TO_WORDS_8(F1, A2, 23, E4, 4B, B9, 05, 86),
+		  BYTES_TO_WORDS_8(98, 65, AC, 78, BF, 77, 1D, 57),
+		  BYTES_TO_WORDS_8(5C, 92, 1E, 48, 6D, 52, 23, EE),
+		  BYTES_TO_WORDS_8(A8, D1, 43, 21, 0C, 6E, EF, F3),
+		  BYTES_TO_WORDS_8(58, 57, E7, 7D, 28, 61, E5, A8) }
+	},
+	{ /* (2j + 1) * 16^43 * G */
+		{ BYTES_TO_WORDS_8(DF, 52, AA, A9, E4, F4, D5, 3C),
+		  BYTES_TO_WORDS_8(7F, 62, 2A, B4, B1, 52, C4, 18),
+		  BYTES_TO_WORDS_8(E6, EC, 91, D9, 89, 41, BC, 6D),
+		  BYTES_TO_WORDS_8(F7, 8B, 60, 7F, C9, 11, A5, 45),
+		  BYTES_TO_WORDS_8(6C, C1, 5E, 12, 12, BD, 52, 7B),
+		  BYTES_TO_WORDS_8(CE, 55, 29, D2, 27, 9B, 91, 5A),
+		  BYTES_TO_WORDS_8(D2, 5A, 62, CB, 7F, 33, E3, 3F),
+		  BYTES_TO_WORDS_8(6D, 9B, EA, 73, C7, 0E, BE, 73) },
+		{ BYTES_TO_WORDS_8(7F, BC, 75, AE, EF, 53, 67, 65),
+		  BYTES_TO_WORDS_8(1F, FB, F7, B6, 0D, 17, C7, 95),
+		  BYTES_TO_WORDS_8(7B, 4C, CD, 17, 12, 0F, F4, 8E),
+		  BYTES_TO_WORDS_8(43, 93, 2B, E7, 4F, AC, 57, 0B),
+		  BYTES_TO_WORDS_8(A9, E9, 72, 09, DD, 72, F1, 04),
+		  BYTES_TO_WORDS_8(62, FC, 49, 40, 0E, 6C, F9, B1),
+		  BYTES_TO_WORDS_8(FA, 94, 7E, A5, CF, 34, 8C, F2),
+		  BYTES_TO_WORDS_8(B5, F3, A9, 77, 82, BF, ED, CE) },
+		{ BYTES_TO_WORDS_8(FF, 25, 31, 83, CF, 33, 74, 13),
+		  BYTES_TO_WORDS_8(42, 81, 5A, 5A, B0, 57, 45, 35),
+		  BYTES_TO_WORDS_8(99, AE, 1C, CA, D9, 82, 46, CF),
+		  BYTES_TO_WORDS_8(48, D1, 4B, 6E, FB, B3, 78, 11),
+		  BYTES_TO_WORDS_8(BD, 6A, 48, D8, 09, 97, 0F, E8),
+		  BYTES_TO_WORDS_8(1B, 4D, E5, 08, CD, AD, C8, 0D),
+		  BYTES_TO_WORDS_8(D1, 0E, 31, EA, 37, E6, 2D, 38),
+		  BYTES_TO_WORDS_8(5B, D9, AB, 9B, EA, 97, D6, DF) },
+		{ BYTES_TO_WORDS_8(55, D9, 62, F6, CC, 95, 36, 3B),
+		  BYTES_TO_WORDS_8(4F, E4, 8C, B4, 85, D6, 44, 84),
+		  BYTES_TO_WORDS_8(93, 56, 27, 8D, 7E, 3B, A8, F8),
+		  BYTES_TO_WORDS_8(07, E9, 94, 6F, 82, A0, C7, 8A),
+		  BYTES_TO_WORDS_8(AE, 3D, 6B, 64, BE, 2D, 6A, BC),
+		  BYTES_TO_WORDS_8(8D, 13, 6C, BD, C5, 81, F4, E3),
+		  BYTES_TO_WORDS_8(D9, 9A, B5, 4C, 23, E5, D7, C9),
+		  BYTES_TO_WORDS_8(1C, 23, 33, 0F, 92, 40, 0F, C8) },
+		{ BYTES_TO_WORDS_8(E5, 03, 88, E8, AD, 79, D8, 7C),
+		  BYTES_TO_WORDS_8(CB, 65, 34, 0D, CE, B7, 1A, CC),
+		  BYTES_TO_WORDS_8(02, 9E, 56, 00, 87, FA, B7, 1A),
+		  BYTES_TO_WORDS_8(11, F2, DD, 59, 28, 8B, F4, C0),
+		  BYTES_TO_WORDS_8(EE, 19, 66, 87, 02, 22, 93, A6),
+		  BYTES_TO_WORDS_8(DB, 8E, 82, 0B, 07, 4E, 2E, 93),
+		  BYTES_TO_WORDS_8(D3, D7, 60, 7E, 72, 64, 9A, 9C),
+		  BYTES_TO_WORDS_8(36, CA, 83, F8, B6, 26, 43, 3D) },
+		{ BYTES_TO_WORDS_8(5C, 51, 1F, 9E, 09, 67, 6D, A9),
+		  BYTES_TO_WORDS_8(AF, 39, 65, 21, 32, 8A, B4, E2),
+		  BYTES_TO_WORDS_8(C0, B8, F7, 0F, E1, C8, 19, A0),
+		  BYTES_TO_WORDS_8(6D, 76, 51, 03, 0F, 70, E8, 2C),
+		  BYTES_TO_WORDS_8(6E, ED, 2E, 85, 49, 36, 19, 95),
+		  BYTES_TO_WORDS_8(2C, D5, C3, E2, D3, DC, A9, A7),
+		  BYTES_TO_WORDS_8(2C, 5D, EF, F7, 42, 2F, CB, BA),
+		  BYTES_TO_WORDS_8(A7, C4, 5E, 3B, 4F, 9F, 87, 73) },
+		{ BYTES_TO_WORDS_8(74, F2, DC, E4, 75, 37, AA, 45),
+		  BYTES_TO_WORDS_8(24, EA, AC, 2C, 68, 00, 72, 80),
+		  BYTES_TO_WORDS_8(1D, CA, 7C, FD, B0, 1B, 5E, 14),
+		  BYTES_TO_WORDS_8(09, C1, B7, DC, 61, 42, C4, FA),
+		  BYTES_TO_WORDS_8(72, 04, 2F, F1, 00, 86, 69, 63),
+		  BYTES_TO_WORDS_8(B1, 94, 45, 27, C6, 27, 20, 73),
+		  BYTES_TO_WORDS_8(BD, 97, EE, D4, D5, 23, C7, 7C),
+		  BYTES_TO_WORDS_8(A8, A8, 66, 15, C6, FD, 13, 97) },
+		{ BYTES_TO_WORDS_8(21, 9D, C3, BD, 6A, 4B, 5E, 2B),
+		  BYTES_TO_WORDS_8(68, DC, 9A, 40, BD, 3E, 37, 68),
+		  BYTES_TO_WORDS_8(13, 28, 99, A1, 43, 1E, 59, 46),
+		  BYTES_TO_WORDS_8(00, 3E, 40, 5B, 16, E6, 91, F8),
+		  BYTES_TO_WORDS_8(9F, 57, CA, C5, 17, 8E, 90, D5),
+		  BYTES_TO_WORDS_8(54, 02, 46, F5, C4, 7E, A9, 73),
+		  BYTES_TO_WORDS_8(3B, C4, DB, E2, A8, B8, AE, 18),
+		  BYTES_TO_WORDS_8(ED, FC, BD, 2B, B1, 53, 9F, 12) }
+	},
+	{ /* (2j + 1) * 16^44 * G */
+		{ BYTES_TO_WORDS_8(7B, F5, 76, 90, B9, 1A, CF, 28),
+		  BYTES_TO_WORDS_8(07, C6, CA, CE, E3, 86, 0B, 03),
+		  BYTES_TO_WORDS_8(3F, A5, F2, 1C, 50, E3, 27, B9),
+		  BYTES_TO_WORDS_8(9C, C7, 80, 48, 56, 18, E1, 20),
+		  BYTES_TO_WORDS_8(E6, AF, A7, AD, DB, BE, 83, 85),
+		  BYTES_TO_WORDS_8(1E, B7, E1, 40, 9B, DC, E0, 9F),
+		  BYTES_TO_WORDS_8(97, E9, 6D, FB, E3, C3, BD, 31),
+		  BYTES_TO_WORDS_8(F7, 7E, 43, AC, 52, B3, 67, FF) },
+		{ BYTES_TO_WORDS_8(A4, 1D, 66, 4B, ED, 3A, 9E, 84),
+		  BYTES_TO_WORDS_8(5C, 4A, A8, 64, AC, 51, 0A, 94),
+		  BYTES_TO_WORDS_8(21, 1A, 06, 03, D9, 7F, 7C, 8F),
+		  BYTES_TO_WORDS_8(CE, 06, 66, B8, 5B, 2A, CA, FF),
+		  BYTES_TO_WORDS_8(5A, 8A, 9B, AF, 5E, 83, 84, 89),
+		  BYTES_TO_WORDS_8(6F, 7F, 68, E5, AD, 87, 8F, 47),
+		  BYTES_TO_WORDS_8(8C, 6C, F4, 48, A1, C9, 3C, A5),
+		  BYTES_TO_WORDS_8(C8, CD, 71, 2B, E3, B0, 1C, CE) },
+		{ BYTES_TO_WORDS_8(22, FD, 8C, 9C, 13, 1E, AC, 3C),
+		  BYTES_TO_WORDS_8(58, BE, 36, B6, 71, 06, 2B, 4E),
+		  BYTES_TO_WORDS_8(4A, 35, AD, 0D, 15, 35, 65, 63),
+		  BYTES_TO_WORDS_8(AB, 16, C1, FF, ED, 9C, 20, FF),
+		  BYTES_TO_WORDS_8(35, 55, BC, 93, 4E, B1, 89, 23),
+		  BYTES_TO_WORDS_8(94, 4B, 68, C9, 92, 4B, 4F, 0D),
+		  BYTES_TO_WORDS_8(C8, F1, CF, 4C, D2, 41, 7D, 20),
+		  BYTES_TO_WORDS_8(7E, 0F, 9D, 46, 97, F3, 79, AD) },
+		{ BYTES_TO_WORDS_8(3E, 98, 4E, 8F, 85, E5, 07, E8),
+		  BYTES_TO_WORDS_8(7C, F7, 17, 70, C8, 6E, 9E, 6D),
+		  BYTES_TO_WORDS_8(15, 4B, 3B, D3, 80, 40, 60, 58),
+		  BYTES_TO_WORDS_8(A9, 9B, 07, 0B, 2D, F0, D5, 33),
+		  BYTES_TO_WORDS_8(A9, 37, EA, 91, 87, DB, 70, 6D),
+		  BYTES_TO_WORDS_8(95, 0C, 63, 59, 92, AA, 71, 7A),
+		  BYTES_TO_WORDS_8(EB, A1, BB, 55, 16, D6, C3, 73),
+		  BYTES_TO_WORDS_8(84, 47, 9C, D3, 76, 5A, EB, 01) },
+		{ BYTES_TO_WORDS_8(73, 2A, E5, 61, 9F, A7, 95, B6),
+		  BYTES_TO_WORDS_8(BC, A1, 05, 97, 6C, 11, E3, D0),
+		  BYTES_TO_WORDS_8(65, 5E, BB, AD, D9, 74, E9, A9),
+		  BYTES_TO_WORDS_8(90, 16, 26, A6, 3D, D2, 1B, 8F),
+		  BYTES_TO_WORDS_8(2E, 8F, EA, EB, 51, 14, DA, 57),
+		  BYTES_TO_WORDS_8(A8, 50, 18, 4B, E6, 02, 05, 59),
+		  BYTES_TO_WORDS_8(DE, EA, 43, 07, 43, 9E, 76, B8),
+		  BYTES_TO_WORDS_8(B8, A8, AD, 93, 63, 8F, 7A, 4C) },
+		{ BYTES_TO_WORDS_8(78, C0, 2B, FD, C2, FE, 42, 58),
+		  BYTES_TO_WORDS_8(5A, EF, F3, 29, 05, 76, A0, C4),
+		  BYTES_TO_WORDS_8(AE, 80, D8, DA, B7, 98, 62, EE),
+		  BYTES_TO_WORDS_8(F3, 37, B6, F7, FE, C9, 3B, 96),
+		  BYTES_TO_WORDS_8(57, 86, FB, 5A, 1F, 23, DB, 7D),
+		  BYTES_TO_WORDS_8(C2, A3, 43, F4, 28, 04, EC, C5),
+		  BYTES_TO_WORDS_8(F1, A4, 80, 29, 09, E5, A3, 80),
+		  BYTES_TO_WORDS_8(22, 76, 1E, CD, 3F, 38, D3, 7E) },
+		{ BYTES_TO_WORDS_8(AD, 08, B6, AF, 6E, E7, 71, 68),
+		  BYTES_TO_WORDS_8(3A, D9, 8F, D8, 54, 56, 80, 74),
+		  BYTES_TO_WORDS_8(49, BC, C8, B7, DC, AD, 31, E6),
+		  BYTES_TO_WORDS_8(44, A8, 1D, 86, AD, 6D, FE, 89),
+		  BYTES_TO_WORDS_8(AD, 4D, 4D, 86, E7, 06, 14, 60),
+		  BYTES_TO_WORDS_8(7B, A8, F0, E0, 13, D5, A9, AE),
+		  BYTES_TO_WORDS_8(39, DF, 25, B7, FF, 7D, B5, 87),
+		  BYTES_TO_WORDS_8(FC, E8, F4, 31, 82, 27, 98, 28) },
+		{ BYTES_TO_WORDS_8(29, 4A, AE, 19, 1B, 98, 18, 07),
+		  BYTES_TO_WORDS_8(0B, 2A, 23, A2, 6E, DA, 2F, DF),
+		  BYTES_TO_WORDS_8(84, 69, 16, E1, C4, 7A, 0D, 51),
+		  BYTES_TO_WORDS_8(59, 97, D7, 3B, 7F, 04, 48, C3),
+		  BYTES_TO_WORDS_8(35, 92, B0, CE, C4, 9A, 95, 34),
+		  BYTES_TO_WORDS_8(BF, AE, 49, 05, 9F, E9, 22, 84),
+		  BYTES_TO_WORDS_8(9A, AE, 0D, 0E, D2, 8D, DA, 13),
+		  BYTES_TO_WORDS_8(56, 1C, 6A, 05, F2, 81, 47, 58) }
+	},
+	{ /* (2j + 1) * 16^45 * G */
+		{ BYTES_TO_WORDS_8(8F, 3A, 27, 99, E8, 52, 14, DD),
+		  BYTES_TO_WORDS_8(4A, D5, 4F, 69, 8E, 47, DD, 3F),
+		  BYTES_TO_WORDS_8(C9, DA, D7, DF, 7F, EC, 18, 03),
+		  BYTES_TO_WORDS_8(7B, 02, 3A, 72, F8, C4, 9C, 5C),
+		  BYTES_TO_WORDS_8(6E, 0D, E8, 5C, 69, CA, DA, AD),
+		  BYTES_TO_WORDS_8(B5, CA, 1A, A1, 75, 36, 00, 4F),
+		  BYTES_TO_WORDS_8(96, AF, 08, 37, 9D, 58, 27, A8),
+		  BYTES_TO_WORDS_8(59, D2, FE, 1D, 7A, E0, EF, 84) },
+		{ BYTES_TO_WORDS_8(82, E3, 83, 48, 54, 98, 8C, 8C),
+		  BYTES_TO_WORDS_8(F3, 36, 55, F5, CE, 4F, 60, D0),
+		  BYTES_TO_WORDS_8(31, 74, 00, 52, 39, 40, E2, 5B),
+		  BYTES_TO_WORDS_8(5C, D8, DF, BB, 92, E1, C8, 5A),
+		  BYTES_TO_WORDS_8(DC, AA, FE, DD, 9B, 3D, 37, 51),
+		  BYTES_TO_WORDS_8(2E, 9D, 4D, 3D, A1, EC, 76, DE),
+		  BYTES_TO_WORDS_8(76, 39, 96, F0, F2, FF, C8, 39),
+		  BYTES_TO_WORDS_8(80, 8C, 7A, 4C, 00, E5, B7, FC) },
+		{ BYTES_TO_WORDS_8(E8, A3, 01, EF, 77, 30, A4, BC),
+		  BYTES_TO_WORDS_8(4E, 09, 48, 2E, 43, 65, EB, C6),
+		  BYTES_TO_WORDS_8(62, 73, D6, E0, 44, 5D, 51, 2D),
+		  BYTES_TO_WORDS_8(18, 21, 91, B7, 98, 06, DC, 99),
+		  BYTES_TO_WORDS_8(14, 11, F6, 40, FE, 45, 86, 52),
+		  BYTES_TO_WORDS_8(94, F2, F8, D7, 34, 70, A6, B7),
+		  BYTES_TO_WORDS_8(44, 00, D8, 71, 11, C7, 7A, 69),
+		  BYTES_TO_WORDS_8(BC, 82, B9, 23, DD, 9C, C6, 67) },
+		{ BYTES_TO_WORDS_8(AB, 35, D5, 4C, 00, 7B, 3F, 38),
+		  BYTES_TO_WORDS_8(C3, 4D, 76, E8, 83, D8, 24, 77),
+		  BYTES_TO_WORDS_8(F3, B9, CF, CF, 57, 43, 02, 44),
+		  BYTES_TO_WORDS_8(16, 06, 04, 8E, 61, F3, E2, AB),
+		  BYTES_TO_WORDS_8(1A, 9C, 7B, 51, 34, 1B, 71, 90),
+		  BYTES_TO_WORDS_8(D9, 8D, AC, C3, 18, 7A, DE, 7F),
+		  BYTES_TO_WORDS_8(95, F7, 2D, 20, 2B, BF, 0D, DE),
+		  BYTES_TO_WORDS_8(93, B2, 55, B7, 4C, D6, 02, 4F) },
+		{ BYTES_TO_WORDS_8(0C, 97, 09, 69, B3, 66, 4B, DB),
+		  BYTES_TO_WORDS_8(E0, E4, E6, 99, A5, DB, 18, 45),
+		  BYTES_TO_WORDS_8(9E, 09, E6, 77, 1F, FB, C6, 37),
+		  BYTES_TO_WORDS_8(21, E7, 39, 8C, D7, D0, 7C, 22),
+		  BYTES_TO_WORDS_8(27, 97, 80, 1F, E3, 4A, 5A, 28),
+		  BYTES_TO_WORDS_8(C4, 9E, B9, 7E, 3F, EC, 10, A2),
+		  BYTES_TO_WORDS_8(EF, 5D, FF, 1C, 74, C8, D6, 87),
+		  BYTES_TO_WORDS_8(1D, 39, 19, C8, 71, E7, 25, 22) },
+		{ BYTES_TO_WORDS_8(59, 5B, E6, 89, C9, DF, 9A, CD),
+		  BYTES_TO_WORDS_8(77, FF, 44, 7D, 2F, 02, 41, 7A),
+		  BYTES_TO_WORDS_8(3B, 05, CD, A8, 30, E9, 7E, 82),
+		  BYTES_TO_WORDS_8(B6, C5, ED, 0A, 82, 46, 31, 36),
+		  BYTES_TO_WORDS_8(CF, C2, B4, 69, 42, 16, 0A, C8),
+		  BYTES_TO_WORDS_8(E9, B6, C5, B5, 03, C9, 43, C1),
+		  BYTES_TO_WORDS_8(C1, 7F, 22, 20, F9, 78, 82, 8E),
+		  BYTES_TO_WORDS_8(92, 72, 89, 17, 62, DB, 87, 1D) },
+		{ BYTES_TO_WORDS_8(06, 25, 4C, CD, 8B, 15, 7B, 01),
+		  BYTES_TO_WORDS_8(AF, 9F, 9E, F1, C7, 5D, 6C, 5B),
+		  BYTES_TO_WORDS_8(EC, 1F, 9D, 18, CE, 68, 4A, E7),
+		  BYTES_TO_WORDS_8(A3, 18, 6B, 68, B6, D6, 5E, F6),
+		  BYTES_TO_WORDS_8(AC, DF, 13, 39, 25, DC, 52, CC),
+		  BYTES_TO_WORDS_8(2B, 54, D6, 4C, C3, EF, 28, 41),
+		  BYTES_TO_WORDS_8(BD, E7, 76, D3, 2F, DC, 55, 52),
+		  BYTES_TO_WORDS_8(E8, AA, 8B, 32, 68, BC, D0, D6) },
+		{ BYTES_TO_WORDS_8(0B, A8, 47, 3B, 75, F9, E4, 81),
+		  BYTES_TO_WORDS_8(57, 97, 24, 64, A6, C5, 97, FF),
+		  BYTES_TO_WORDS_8(A8, DB, AB, 6F, 27, 9C, DD, 29),
+		  BYTES_TO_WORDS_8(57, 13, F6, 11, FA, DE, A0, 66),
+		  BYTES_TO_WORDS_8(8B, 5E, 79, FF, F8, 95, 71, 0F),
+		  BYTES_TO_WORDS_8(20, DD, 6E, 52, 28, A4, 30, C2),
+		  BYTES_TO_WORDS_8(74, F4, AE, 61, 25, DF, D8, CA),
+		  BYTES_TO_WORDS_8(41, CA, 7A, E3, 6D, AA, 24, 3E) }
+	},
+	{ /* (2j + 1) * 16^46 * G */
+		{ BYTES_TO_WORDS_8(B3, 3E, 52, 28, B3, 9A, DD, E7),
+		  BYTES_TO_WORDS_8(4A, 6C, 6C, 55, 75, 3A, 1A, 35),
+		  BYTES_TO_WORDS_8(E3, CD, 3D, 4F, 44, 18, AC, 46),
+		  BYTES_TO_WORDS_8(AB, B5, A8, F8, EB, D4, FF, BA),
+		  BYTES_TO_WORDS_8(87, F3, AC, D5, 0C, 30, 78, 19),
+		  BYTES_TO_WORDS_8(EE, B6, 48, BF, CF, 1C, 51, 24),
+		  BYTES_TO_WORDS_8(9C, C0, 5A, 79, B3, 8E, 3A, 00),
+		  BYTES_TO_WORDS_8(83, 5E, C9, DB, C5, 3D, A9, 0F) },
+		{ BYTES_TO_WORDS_8(41, 76, 73, F4, 4E, 9B, 09, D0),
+		  BYTES_TO_WORDS_8(3A, E1, C2, 66, C1, C0, FA, 1A),
+		  BYTES_TO_WORDS_8(B7, 3F, 56, 36, 12, B5, 78, 77),
+		  BYTES_TO_WORDS_8(ED, 89, 1C, 44, 22, 45, B4, 91),
+		  BYTES_TO_WORDS_8(E0, BB, 01, E1, 29, 2B, 51, F2),
+		  BYTES_TO_WORDS_8(03, 7D, 07, 6E, 66, DC, D7, C9),
+		  BYTES_TO_WORDS_8(28, B4, 2F, B0, 5A, 23, 13, 2C),
+		  BYTES_TO_WORDS_8(76, A9, FD, 37, BD, 63, 44, 3F) },
+		{ BYTES_TO_WORDS_8(DF, 01, DD, 26, B8, BA, A2, C6),
+		  BYTES_TO_WORDS_8(B9, EF, 8F, 53, 76, FF, 3E, 74),
+		  BYTES_TO_WORDS_8(65, 91, 68, C8, C7, A6, 7E, A3),
+		  BYTES_TO_WORDS_8(7A, B0, 2D, E8, 5D, 13, 6D, 29),
+		  BYTES_TO_WORDS_8(C8, 0D, 3A, AA, 20, D3, 50, 49),
+		  BYTES_TO_WORDS_8(60, 6F, E6, E5, 18, F6, FA, DF),
+		  BYTES_TO_WORDS_8(CA, 77, C7, 76, 97, 12, 87, 2B),
+		  BYTES_TO_WORDS_8(E4, 45, E1, 92, DD, 4E, 05, 14) },
+		{ BYTES_TO_WORDS_8(DD, F5, 50, D6, 06, 6F, 7E, C6),
+		  BYTES_TO_WORDS_8(C8, B2, 91, 21, 24, E1, FF, 54),
+		  BYTES_TO_WORDS_8(96, 4A, 9E, F1, F1, C2, 13, 8F),
+		  BYTES_TO_WORDS_8(31, 7A, 36, 91, F3, 42, 09, 4B),
+		  BYTES_TO_WORDS_8(6D, DC, ED, 7A, CC, 5B, EA, C2),
+		  BYTES_TO_WORDS_8(62, 3A, E7, E4, 82, 67, 3C, 02),
+		  BYTES_TO_WORDS_8(5F, C2, 13, 56, 01, C1, 55, E0),
+		  BYTES_TO_WORDS_8(C0, AB, 6C, 36, A6, AA, 32, 74) },
+		{ BYTES_TO_WORDS_8(6F, A9, E4, 04, 8F, 5E, 37, 7A),
+		  BYTES_TO_WORDS_8(14, 5B, 65, 35, B4, 62, 88, 18),
+		  BYTES_TO_WORDS_8(AF, E4, D2, C4, 8F, DB, 3E, 83),
+		  BYTES_TO_WORDS_8(1A, C1, EC, 2F, A6, 77, 63, 03),
+		  BYTES_TO_WORDS_8(DB, 8C, E0, 51, E0, B7, AF, 8B),
+		  BYTES_TO_WORDS_8(26, 13, 09, 43, 21, 8C, 09, 84),
+		  BYTES_TO_WORDS_8(63, 62, 54, 78, 55, 0C, 93, 8D),
+		  BYTES_TO_WORDS_8(83, DF, 4F, 35, 1D, 19, DE, A1) },
+		{ BYTES_TO_WORDS_8(59, 5A, 9B, 67, E1, D3, 1F, 14),
+		  BYTES_TO_WORDS_8(2A, E6, 69, B2, 9E, E8, 21, C6),
+		  BYTES_TO_WORDS_8(51, 32, D8, 09, 57, ED, BB, BC),
+		  BYTES_TO_WORDS_8(62, E1, F5, 30, F7, 1A, 04, A1),
+		  BYTES_TO_WORDS_8(A3, 14, 55, 2C, 02, B4, D2, D8),
+		  BYTES_TO_WORDS_8(D9, 66, AC, 1E, 0E, 69, 30, FB),
+		  BYTES_TO_WORDS_8(FB, 2A, BC, 73, D8, 50, 26, 42),
+		  BYTES_TO_WORDS_8(19, 8B, F5, A8, 6A, 17, 42, AD) },
+		{ BYTES_TO_WORDS_8(7B, 59, DD, CD, 06, DB, E8, EA),
+		  BYTES_TO_WORDS_8(8D, 75, 85, CC, 70, 31, 89, D8),
+		  BYTES_TO_WORDS_8(07, 20, E9, F9, D0, 1A, 37, 03),
+		  BYTES_TO_WORDS_8(47, 56, 1E, 0B, AD, 67, 21, DA),
+		  BYTES_TO_WORDS_8(04, FA, E7, 3D, 7E, 72, 81, 26),
+		  BYTES_TO_WORDS_8(46, 9F, 4F, 14, 52, 2A, DE, CD),
+		  BYTES_TO_WORDS_8(F6, EB, 98, A7, 0E, 70, F6, 1F),
+		  BYTES_TO_WORDS_8(36, ED, 46, 25, B6, 92, 19, A2) },
+		{ BYTES_TO_WORDS_8(B0, DB, F7, B3, 22, A2, 34, 99),
+		  BYTES_TO_WORDS_8(C0, 29, BF, 26, DC, 23, EE, F4),
+		  BYTES_TO_WORDS_8(9D, F2, 64, 21, 87, 3B, 86, BC),
+		  BYTES_TO_WORDS_8(78, C6, F6, 37, C2, DB, 3F, 1C),
+		  BYTES_TO_WORDS_8(32, 6D, E1, 72, C9, BD, 4C, D6),
+		  BYTES_TO_WORDS_8(AD, F8, 20, 00, 38, 46, 06, 1F),
+		  BYTES_TO_WORDS_8(D4, 18, 4B, 4A, 39, A5, AE, F0),
+		  BYTES_TO_WORDS_8(13, 98, 92, 37, 10, 0F, 26, 39) }
+	},
+	{ /* (2j + 1) * 16^47 * G */
+		{ BYTES_TO_WORDS_8(01, 11, 11, BA, D8, 08, 52, 83),
+		  BYTES_TO_WORDS_8(5F, 3C, DB, 76, 1A, 0B, 9F, 47),
+		  BYTES_TO_WORDS_8(96, 4C, 7E, 25, 4D, A3, 22, ED),
+		  BYTES_TO_WORDS_8(66, D7, CE, 8F, 09, 2A, AD, 06),
+		  BYTES_TO_WORDS_8(F4, 7E, B3, 5F, 9D, BA, A7, C1),
+		  BYTES_TO_WORDS_8(AE, 89, 0E, B7, 82, 9D, 42, DE),
+		  BYTES_TO_WORDS_8(A0, 62, EB, B9, 1B, C0, A4, 59),
+		  BYTES_TO_WORDS_8(35, 5E, F8, 58, 1C, 8B, 5B, 2D) },
+		{ BYTES_TO_WORDS_8(6F, EF, 2B, 70, 47, 38, FC, 76),
+		  BYTES_TO_WORDS_8(43, EE, 31, 45, 18, 4F, AE, BB),
+		  BYTES_TO_WORDS_8(75, D4, D8, 6B, D6, 8B, F7, 04),
+		  BYTES_TO_WORDS_8(72, CD, 3B, 6C, 55, CA, A2, F1),
+		  BYTES_TO_WORDS_8(A3, 1C, 6C, 8F, FD, D1, B2, 11),
+		  BYTES_TO_WORDS_8(40, 2B, D5, 1F, A8, 7E, B4, B0),
+		  BYTES_TO_WORDS_8(68, 01, 02, DC, 17, 54, 45, DF),
+		  BYTES_TO_WORDS_8(3E, 31, 88, 04, AF, 59, 9B, B3) },
+		{ BYTES_TO_WORDS_8(67, 53, 45, A0, FC, 28, 60, 80),
+		  BYTES_TO_WORDS_8(E0, 13, D6, 24, C8, F2, C4, E6),
+		  BYTES_TO_WORDS_8(51, 18, BF, 8E, 65, 01, 19, EE),
+		  BYTES_TO_WORDS_8(30, 80, 3B, FE, 49, AD, 24, E9),
+		  BYTES_TO_WORDS_8(92, 7E, 25, 28, F8, 8C, D1, 5F),
+		  BYTES_TO_WORDS_8(2B, 75, A6, 4F, AA, 31, DA, 52),
+		  BYTES_TO_WORDS_8(6F, BB, 6F, 3D, 39, 85, 20, 75),
+		  BYTES_TO_WORDS_8(D5, 3E, 14, 9A, 97, 7D, C9, FC) },
+		{ BYTES_TO_WORDS_8(E7, F1, F8, 42, 39, 09, 1F, E9),
+		  BYTES_TO_WORDS_8(E2, F9, D1, 4D, 5D, AA, D4, 8D),
+		  BYTES_TO_WORDS_8(F6, 22, FB, 05, 51, 93, 0B, A0),
+		  BYTES_TO_WORDS_8(6F, 02, F7, C5, 7D, 9C, 9D, F4),
+		  BYTES_TO_WORDS_8(72, 99, 4D, 91, B1, 8A, 22, 92),
+		  BYTES_TO_WORDS_8(83, 7A, 4D, 4E, 3C, 01, B0, 01),
+		  BYTES_TO_WORDS_8(79, F6, 94, B9, B3, D3, E5, 6A),
+		  BYTES_TO_WORDS_8(AE, AC, E3, 03, 42, 5D, 58, F5) },
+		{ BYTES_TO_WORDS_8(79, 9A, 21, FB, 77, 96, 3A, 7B),
+		  BYTES_TO_WORDS_8(A7, 27, 98, 7E, 41, D4, 4C, 5C),
+		  BYTES_TO_WORDS_8(E6, 89, 51, 75, 55, C3, E3, B0),
+		  BYTES_TO_WORDS_8(48, 9D, 6A, E4, 03, 4D, B0, 28),
+		  BYTES_TO_WORDS_8(24, BE, 2D, 10, D9, 7C, BF, F8),
+		  BYTES_TO_WORDS_8(E5, 4B, 00, 86, CF, 6C, 16, 86),
+		  BYTES_TO_WORDS_8(6B, 20, 3E, 18, 72, E5, CF, 59),
+		  BYTES_TO_WORDS_8(14, CF, 14, 5A, 9E, DA, 58, F6) },
+		{ BYTES_TO_WORDS_8(F9, 4A, 77, 57, 9C, 2D, 82, B2),
+		  BYTES_TO_WORDS_8(D8, 0A, 46, 11, 65, BA, 16, 4C),
+		  BYTES_TO_WORDS_8(B5, EF, 6A, 88, 92, 03, 85, D6),
+		  BYTES_TO_WORDS_8(93, FE, C1, 7C, BE, 66, 47, 3F),
+		  BYTES_TO_WORDS_8(90, E9, 4D, DD, 64, 7F, CD, F7),
+		  BYTES_TO_WORDS_8(6F, 32, B7, F9, FD, 4C, A9, 1C),
+		  BYTES_TO_WORDS_8(51, 5F, 6E, 6E, 90, 78, B1, 3A),
+		  BYTES_TO_WORDS_8(BA, 1C, 33, A7, D6, 0D, 81, CC) },
+		{ BYTES_TO_WORDS_8(05, 77, E5, 48, 1E, 9F, 41, 78),
+		  BYTES_TO_WORDS_8(8E, 59, 4D, C8, FA, B7, CE, 21),
+		  BYTES_TO_WORDS_8(17, 36, 6F, 1D, B4, DA, 2A, 1F),
+		  BYTES_TO_WORDS_8(79, EE, F8, C0, 02, 9E, 24, E3),
+		  BYTES_TO_WORDS_8(0C, EC, CA, 38, E8, 19, 4B, 09),
+		  BYTES_TO_WORDS_8(22, 84, 73, 16, D7, 45, 19, 50),
+		  BYTES_TO_WORDS_8(5A, 6B, 48, F2, C1, 78, B7, DC),
+		  BYTES_TO_WORDS_8(07, 95, 36, 01, 87, 65, 66, A6) },
+		{ BYTES_TO_WORDS_8(AC, 93, 5B, B2, AF, CE, 8B, C7),
+		  BYTES_TO_WORDS_8(D2, F8, 87, 05, 51, 02, E2, 17),
+		  BYTES_TO_WORDS_8(E9, B4, FB, 3D, 69, E7, F9, BD),
+		  BYTES_TO_WORDS_8(1C, 96, B7, DF, 0B, 58, 89, A6),
+		  BYTES_TO_WORDS_8(AB, 9A, 58, 6F, 4D, 1C, 3D, EA),
+		  BYTES_TO_WORDS_8(3A, FD, C4, D9, 17, F8, F1, FC),
+		  BYTES_TO_WORDS_8(F2, 9F, 05, 5F, 01, 2F, 7F, AA),
+		  BYTES_TO_WORDS_8(3E, 78, F0, B4, 94, CA, 57, 46) }
+	},
+	{ /* (2j + 1) * 16^48 * G */
+		{ BYTES_TO_WORDS_8(BE, 28, 37, 31, FB, 0F, F2, 6C),
+		  BYTES_TO_WORDS_8(4A, B9, C6, A3, 91, 95, 43, 96),
+		  BYTES_TO_WORDS_8(C5, 5F, 31, 44, 83, FF, 36, 27),
+		  BYTES_TO_WORDS_8(76, 92, 84, A7, 77, 96, D3, A6),
+		  BYTES_TO_WORDS_8(F4, F5, 57, C3, 33, B8, BA, F2),
+		  BYTES_TO_WORDS_8(9B, 05, 84, 22, 0C, 92, 4A, 82),
+		  BYTES_TO_WORDS_8(DF, EC, 27, 2D, BD, BA, B8, 66),
+		  BYTES_TO_WORDS_8(16, 88, 0B, 9B, 74, 84, 4F, 67) },
+		{ BYTES_TO_WORDS_8(64, D8, 15, CF, 69, B5, 54, C0),
+		  BYTES_TO_WORDS_8(3C, 8D, CC, A1, C6, FD, 06, 24),
+		  BYTES_TO_WORDS_8(35, CF, 26, BE, E7, EC, C8, AF),
+		  BYTES_TO_WORDS_8(0D, DB, DE, C5, D7, 66, EF, 07),
+		  BYTES_TO_WORDS_8(FE, 07, 09, 74, 27, 54, 62, 54),
+		  BYTES_TO_WORDS_8(8B, 4A, CE, 1C, 3B, 0E, 47, 9F),
+		  BYTES_TO_WORDS_8(5E, 50, FD, 21, 52, 0C, D4, 06),
+		  BYTES_TO_WORDS_8(A5, E6, 9D, B8, 5D, 32, B3, 2D) },
+		{ BYTES_TO_WORDS_8(5E, C0, C7, 17, 3C, 14, 95, C6),
+		  BYTES_TO_WORDS_8(6A, 41, E5, 2C, 95, CB, 83, B2),
+		  BYTES_TO_WORDS_8(0B, 8C, F2, 75, 2F, A7, F3, 14),
+		  BYTES_TO_WORDS_8(60, C4, 6D, C0, 5F, 4E, DF, 82),
+		  BYTES_TO_WORDS_8(6B, F2, FF, D8, 02, 3D, 61, B9),
+		  BYTES_TO_WORDS_8(00, B3, 2D, 84, 46, D9, 15, CF),
+		  BYTES_TO_WORDS_8(D1, CB, 17, 12, 21, 16, 52, 27),
+		  BYTES_TO_WORDS_8(0A, 42, 96, 8C, C9, 88, E1, E4) },
+		{ BYTES_TO_WORDS_8(B0, 68, 03, 54, 41, 1D, AE, 80),
+		  BYTES_TO_WORDS_8(9D, 94, EE, 8F, 2F, C2, 24, 13),
+		  BYTES_TO_WORDS_8(62, 7A, E4, 38, 8D, 5B, 9E, 7D),
+		  BYTES_TO_WORDS_8(6A, 0C, 2B, C1, 9B, FC, 1E, 26),
+		  BYTES_TO_WORDS_8(1F, 01, EB, BD, 59, 25, AD, 13),
+		  BYTES_TO_WORDS_8(30, 5D, 9B, E3, E1, 0B, 34, 7E),
+		  BYTES_TO_WORDS_8(79, FF, 4F, D6, 2C, 85, C8, FD),
+		  BYTES_TO_WORDS_8(E9, FC, 86, E3, DB, 2A, 9D, 8A) },
+		{ BYTES_TO_WORDS_8(34, 80, EB, 15, 95, 3E, 03, F1),
+		  BYTES_TO_WORDS_8(4A, CA, E8, 56, 5F, 33, 0B, F3),
+		  BYTES_TO_WORDS_8(2D, 69, E7, D9, 59, 7E, AA, 49),
+		  BYTES_TO_WORDS_8(91, 27, 2C, 7A, D7, DF, 48, 6D),
+		  BYTES_TO_WORDS_8(30, CE, B0, 5A, 7A, 08, 73, E8),
+		  BYTES_TO_WORDS_8(61, 89, 3E, 2A, EA, 10, 02, 08),
+		  BYTES_TO_WORDS_8(63, 47, 05, 9E, 64, 79, 5E, 3D),
+		  BYTES_TO_WORDS_8(2F, D1, 5D, 16, 45, 72, B4, 3C) },
+		{ BYTES_TO_WORDS_8(C8, 35, 05, 54, FC, 3D, 14, B5),
+		  BYTES_TO_WORDS_8(3E, B1, 8D, 0C, 63, A5, F0, 65),
+		  BYTES_TO_WORDS_8(6F, 4E, C5, 4F, FB, 23, 91, A4),
+		  BYTES_TO_WORDS_8(23, 89, B9, 7B, 1E, C0, A5, 93),
+		  BYTES_TO_WORDS_8(44, B8, 59, 3D, 08, 74, 95, C4),
+		  BYTES_TO_WORDS_8(FF, ED, 5B, 93, 04, 62, A1, 66),
+		  BYTES_TO_WORDS_8(C1, A5, 15, 8E, 35, 84, 6A, C1),
+		  BYTES_TO_WORDS_8(F4, C2, 80, 49, 90, 0E, 44, 2D) },
+		{ BYTES_TO_WORDS_8(BA, 47, 20, 9E, 66, A5, 61, A2),
+		  BYTES_TO_WORDS_8(52, F6, B0, 6B, 99, 04, 47, E5),
+		  BYTES_TO_WORDS_8(31, 70, D6, 17, E0, A0, 5D, B3),
+		  BYTES_TO_WORDS_8(BB, 72, 12, 16, 29, B9, B0, 3F),
+		  BYTES_TO_WORDS_8(58, 41, B2, DD, 4E, CD, FE, 57),
+		  BYTES_TO_WORDS_8(D3, 09, 70, 71, E7, 0A, 42, 6C),
+		  BYTES_TO_WORDS_8(C8, 6D, 66, 99, 1C, 62, 72, CA),
+		  BYTES_TO_WORDS_8(94, DF, 17, 82, E6, 7A, 46, 9D) },
+		{ BYTES_TO_WORDS_8(C1, 71, DF, E2, BA, BD, BD, 00),
+		  BYTES_TO_WORDS_8(3A, 72, BB, AF, BE, 86, 31, 1C),
+		  BYTES_TO_WORDS_8(38, E4, 33, DE, A9, 3B, 76, D0),
+		  BYTES_TO_WORDS_8(D5, 83, 8E, E0, 39, 94, B0, DA),
+		  BYTES_TO_WORDS_8(E3, A1, C3, 24, 41, 48, 73, B8),
+		  BYTES_TO_WORDS_8(3B, 4E, B4, A4, 0C, 33, 96, 6E),
+		  BYTES_TO_WORDS_8(3D, 0B, D2, 20, 6F, E8, 5A, 38),
+		  BYTES_TO_WORDS_8(EF, 1C, 4E, 54, 1E, BC, 3C, 76) }
+	},
+	{ /* (2j + 1) * 16^49 * G */
+		{ BYTES_TO_WORDS_8(FD, C6, 14, 45, FF, 62, EF, 6E),
+		  BYTES_TO_WORDS_8(3E, 01, AB, 0D, 4D, 3B, 68, FD),
+		  BYTES_TO_WORDS_8(36, 59, FF, 10, 57, DB, D4, 33),
+		  BYTES_TO_WORDS_8(E0, F4, 9C, 08, 80, DA, 25, AC),
+		  BYTES_TO_WORDS_8(41, 05, 83, 05, 77, 39, B5, 60),
+		  BYTES_TO_WORDS_8(7A, F3, 3B, 24, E8, 83, 09, 81),
+		  BYTES_TO_WORDS_8(8C, 33, 1B, 2A, 31, A9, 3D, 88),
+		  BYTES_TO_WORDS_8(7B, 4C, B4, 5C, 98, 9D, C6, EB) },
+		{ BYTES_TO_WORDS_8(3D, 0E, FD, 32, 7E, 1C, 94, 81),
+		  BYTES_TO_WORDS_8(60, AD, 27, 54, DC, E4, 31, E6),
+		  BYTES_TO_WORDS_8(47, 55, 16, 1E, 67, 48, D7, B4),
+		  BYTES_TO_WORDS_8(8B, 3C, BA, 49, 6C, E6, A7, EE),
+		  BYTES_TO_WORDS_8(68, 58, 1D, D9, 68, 1F, 41, 10),
+		  BYTES_TO_WORDS_8(CC, E3, 19, 30, A2, AD, CB, 5A),
+		  BYTES_TO_WORDS_8(98, 7D, 9B, BE, 27, 3F, 84, 28),
+		  BYTES_TO_WORDS_8(61, 92, 88, 9F, 5B, D4, FE, 83) },
+		{ BYTES_TO_WORDS_8(B3, 63, CB, 6C, F2, 14, 9F, 11),
+		  BYTES_TO_WORDS_8(5D, 8E, 40, 44, 6C, FE, DF, 7D),
+		  BYTES_TO_WORDS_8(7B, C6, 03, 54, B3, 94, D1, BA),
+		  BYTES_TO_WORDS_8(BD, 21, 3E, E9, D3, E2, 3D, 9A),
+		  BYTES_TO_WORDS_8(CF, 3F, F9, 7D, 97, 32, C5, 01),
+		  BYTES_TO_WORDS_8(60, 22, 58, EF, 9F, 1D, C0, 49),
+		  BYTES_TO_WORDS_8(4C, 3C, 81, EE, 36, 27, 9F, 80),
+		  BYTES_TO_WORDS_8(C8, 12, 11, 61, 90, 9B, 80, 2F) },
+		{ BYTES_TO_WORDS_8(17, 11, 3F, D6, 4D, A3, EC, E4),
+		  BYTES_TO_WORDS_8(8B, 6D, 7F, BA, 70, 6F, 89, 34),
+		  BYTES_TO_WORDS_8(AF, AD, 3F, 12, 30, 0D, 10, 05),
+		  BYTES_TO_WORDS_8(DB, 92, 3B, B5, F4, 82, C3, A7),
+		  BYTES_TO_WORDS_8(9A, CB, 34, 19, 5E, 0C, 22, C1),
+		  BYTES_TO_WORDS_8(8C, A6, C4, D3, 6E, B7, 4E, AE),
+		  BYTES_TO_WORDS_8(B5, CF, 5D, 70, 77, F7, 59, 04),
+		  BYTES_TO_WORDS_8(88, BF, 61, 67, 11, E5, 91, 1B) },
+		{ BYTES_TO_WORDS_8(96, 4A, 77, A6, C5, 81, BC, 50),
+		  BYTES_TO_WORDS_8(E8, E3, 38, 18, D9, 1F, 23, E8),
+		  BYTES_TO_WORDS_8(97, F4, A6, 83, FC, 3B, 14, 87),
+		  BYTES_TO_WORDS_8(13, 12, 86, CD, 98, A9, 5A, 55),
+		  BYTES_TO_WORDS_8(34, 0E, DB, 86, 2D, 97, 40, 9D),
+		  BYTES_TO_WORDS_8(A6, 6F, E2, C8, 4B, 5D, 0D, 9A),
+		  BYTES_TO_WORDS_8(B8, BB, 50, 13, E7, 41, D4, 99),
+		  BYTES_TO_WORDS_8(69, BC, 07, D2, 68, 28, 53, B0) },
+		{ BYTES_TO_WORDS_8(7D, AC, 7D, AF, F3, EE, F7, 32),
+		  BYTES_TO_WORDS_8(12, 12, 24, 11, 92, 2B, 57, 16),
+		  BYTES_TO_WORDS_8(69, C3, 77, 8D, 8F, D7, 8C, B5),
+		  BYTES_TO_WORDS_8(D7, 7A, 8A, 34, 5B, 2F, A4, 01),
+		  BYTES_TO_WORDS_8(6E, E4, 95, 81, 31, 4A, 89, 27),
+		  BYTES_TO_WORDS_8(6B, A9, CE, 28, 93, F2, 2A, 17),
+		  BYTES_TO_WORDS_8(16, 92, BF, B8, 54, F9, 97, 34),
+		  BYTES_TO_WORDS_8(81, 77, 20, 55, 38, 9C, 7A, 95) },
+		{ BYTES_TO_WORDS_8(36, FC, 2A, 20, D4, A1, 2B, E0),
+		  BYTES_TO_WORDS_8(D3, 71, 30, 14, D5, EE, 4D, 13),
+		  BYTES_TO_WORDS_8(A3, D3, 45, 1B, EF, 09, 5B, 3A),
+		  BYTES_TO_WORDS_8(3D, CE, 05, EB, 37, F5, 47, 4B),
+		  BYTES_TO_WORDS_8(FF, 33, 81, 6F, 6A, F7, 89, 4E),
+		  BYTES_TO_WORDS_8(A3, BD, 5F, B2, E9, CB, 5A, 34),
+		  BYTES_TO_WORDS_8(73, F5, 8D, 0E, FA, 06, CB, 2D),
+		  BYTES_TO_WORDS_8(0C, 5F, C8, 99, 03, 45, FC, F2) },
+		{ BYTES_TO_WORDS_8(68, 7F, D1, 77, 3C, 2E, BF, AA),
+		  BYTES_TO_WORDS_8(86, AD, 8B, CB, DF, A1, 15, 79),
+		  BYTES_TO_WORDS_8(8F, 41, AE, 36, F5, 16, 65, D5),
+		  BYTES_TO_WORDS_8(CE, E8, 24, C5, 9C, EC, 3D, 6B),
+		  BYTES_TO_WORDS_8(02, 24, 23, C9, 20, 7A, AE, CF),
+		  BYTES_TO_WORDS_8(68, CB, DC, A6, 6A, A9, F2, 47),
+		  BYTES_TO_WORDS_8(47, 5D, CD, 16, B4, 81, 09, 05),
+		  BYTES_TO_WORDS_8(EF, D9, EF, FD, 37, 39, 65, B8) }
+	},
+	{ /* (2j + 1) * 16^50 * G */
+		{ BYTES_TO_WORDS_8(AE, 0B, D2, 2F, 7A, E3, D4, 55),
+		  BYTES_TO_WORDS_8(11, A8, B4, D5, 72, 56, 03, 26),
+		  BYTES_TO_WORDS_8(3A, 34, 6D, 17, 12, BA, 7B, 02),
+		  BYTES_TO_WORDS_8(D9, FC, BC, C3, ED, 50, 52, 28),
+		  BYTES_TO_WORDS_8(97, AB, E0, 54, 5A, 45, DE, F9),
+		  BYTES_TO_WORDS_8(23, F3, EF, F1, 2C, 1A, 9B, 6E),
+		  BYTES_TO_WORDS_8(71, C1, 46, 10, AD, 84, 72, 3F),
+		  BYTES_TO_WORDS_8(A8, 7E, AD, F4, 86, C0, 66, 78) },
+		{ BYTES_TO_WORDS_8(0B, A5, 36, A6, AB, 76, 88, CC),
+		  BYTES_TO_WORDS_8(96, 51, B7, AB, 16, F6, 2E, 5D),
+		  BYTES_TO_WORDS_8(F6, BA, 78, FC, 12, FA, 36, 58),
+		  BYTES_TO_WORDS_8(5C, A7, D5, 45, 65, C5, E3, F1),
+		  BYTES_TO_WORDS_8(B6, 28, 31, AB, 4E, 91, 77, DF),
+		  BYTES_TO_WORDS_8(6E, 7A, 2D, D2, 76, A5, 7F, 6B),
+		  BYTES_TO_WORDS_8(13, F3, A5, F6, 67, 6A, 73, 6C),
+		  BYTES_TO_WORDS_8(E7, FC, 1E, 6E, 7A, 84, B8, 12) },
+		{ BYTES_TO_WORDS_8(40, 33, 58, 4E, 21, 13, 7F, 51),
+		  BYTES_TO_WORDS_8(B2, F3, 34, 5D, 6B, 1B, 5C, F4),
+		  BYTES_TO_WORDS_8(8C, 22, 9B, FA, AB, CD, 87, 6D),
+		  BYTES_TO_WORDS_8(A7, 34, E1, 81, 9C, 72, 4D, 58),
+		  BYTES_TO_WORDS_8(B9, 24, FB, 74, E9, E5, F6, 72),
+		  BYTES_TO_WORDS_8(70, C0, 94, 64, A6, 70, 17, 8F),
+		  BYTES_TO_WORDS_8(FA, AF, 30, 30, 59, 7C, 30, CD),
+		  BYTES_TO_WORDS_8(AB, 80, 0D, 56, A4, 80, DD, 2F) },
+		{ BYTES_TO_WORDS_8(9B, 80, 35, 02, DE, 3E, C8, 92),
+		  BYTES_TO_WORDS_8(73, 81, EB, B5, F0, 2D, 57, 3C),
+		  BYTES_TO_WORDS_8(45, 3C, 38, C2, 8D, 02, 2E, 1E),
+		  BYTES_TO_WORDS_8(7D, DF, 37, C8, 00, AE, AE, BA),
+		  BYTES_TO_WORDS_8(62, FD, 54, C1, A5, D8, 61, CD),
+		  BYTES_TO_WORDS_8(E5, E7, D2, A1, 42, 3C, 5C, 83),
+		  BYTES_TO_WORDS_8(99, F2, 49, CB, 7B, 30, A2, B4),
+		  BYTES_TO_WORDS_8(80, 4B, 32, 3F, 83, 88, 57, 32) },
+		{ BYTES_TO_WORDS_8(68, 22, 61, 0D, C4, 42, 00, F6),
+		  BYTES_TO_WORDS_8(16, D0, 5E, 0A, DF, 59, CF, 06),
+		  BYTES_TO_WORDS_8(B9, B8, 94, 43, FA, 9E, 13, 65),
+		  BYTES_TO_WORDS_8(1A, 13, C2, 60, 63, E4, C7, 06),
+		  BYTES_TO_WORDS_8(A0, 66, 01, 26, 01, B6, B4, BC),
+		  BYTES_TO_WORDS_8(98, 70, 2E, 78, 5A, 8A, 8D, 23),
+		  BYTES_TO_WORDS_8(CA, 53, F4, E2, 5C, C7, 7F, 74),
+		  BYTES_TO_WORDS_8(CD, D8, 2D, F7, 5D, D5, 6A, CB) },
+		{ BYTES_TO_WORDS_8(C8, BD, 2F, 81, 5B, A3, 43, BD),
+		  BYTES_TO_WORDS_8(A3, E2, C0, A2, CA, 20, 9E, B8),
+		  BYTES_TO_WORDS_8(6D, A3, 11, B7, C7, EC, C2, 5B),
+		  BYTES_TO_WORDS_8(3E, 64, D6, AB, DE, 31, 41, 06),
+		  BYTES_TO_WORDS_8(80, 93, F9, A9, 09, F3, 3F, 5D),
+		  BYTES_TO_WORDS_8(0A, 02, FB, B1, 68, E2, 3A, 60),
+		  BYTES_TO_WORDS_8(98, 75, 95, 34, D9, 80, B3, F2),
+		  BYTES_TO_WORDS_8(28, 70, D6, 32, AC, 7F, 2C, 88) },
+		{ BYTES_TO_WORDS_8(32, 9F, AC, 4B, 06, 00, EB, 75),
+		  BYTES_TO_WORDS_8(06, 9B, 68, 59, CC, 21, 38, 44),
+		  BYTES_TO_WORDS_8(00, 64, 9B, E1, 6F, 41, 16, 8A),
+		  BYTES_TO_WORDS_8(37, C2, 75, C2, AC, B7, 6B, 36),
+		  BYTES_TO_WORDS_8(7D, D4, 85, BC, CF, E5, F0, 42),
+		  BYTES_TO_WORDS_8(8A, 26, F0, 07, 0C, E5, DC, 1F),
+		  BYTES_TO_WORDS_8(C0, CF, 61, 8D, AB, 83, 07, 4F),
+		  BYTES_TO_WORDS_8(06, AF, 85, 87, 70, 7B, 10, 7D) },
+		{ BYTES_TO_WORDS_8(EB, 27, DD, 86, 52, 52, CB, 03),
+		  BYTES_TO_WORDS_8(23, 56, 3B, 7B, C3, 55, 8C, B9),
+		  BYTES_TO_WORDS_8(EC, 32, BE, 9B, E3, D0, 27, 6B),
+		  BYTES_TO_WORDS_8(00, 3C, C7, 7C, 25, DB, 67, B7),
+		  BYTES_TO_WORDS_8(C4, DA, 65, CF, 47, 1A, 52, 15),
+		  BYTES_TO_WORDS_8(D4, 0E, 60, 48, B4, 00, B7, 64),
+		  BYTES_TO_WORDS_8(5B, D8, 99, 6B, 81, CB, EA, 5C),
+		  BYTES_TO_WORDS_8(CB, 29, 12, 26, C3, 08, 13, DC) }
+	},
+	{ /* (2j + 1) * 16^51 * G */
+		{ BYTES_TO_WORDS_8(F1, E4, 07, 3E, 2A, 3A, 1F, 17),
+		  BYTES_TO_WORDS_8(7C, 26, DC, D0, 7D, 14, C5, 1F),
+		  BYTES_TO_WORDS_8(0E, 89, F8, 7E, C0, EB, 8D, 81),
+		  BYTES_TO_WORDS_8(6F, 36, D0, 2E, 06, C1, 72, C4),
+		  BYTES_TO_WORDS_8(A9, DA, B0, 86, 3D, 68, 1C, 57),
+		  BYTES_TO_WORDS_8(8A, 5D, 2B, E2, B1, B7, F3, 85),
+		  BYTES_TO_WORDS_8(D8, 67, D6, 84, 5A, AB, 32, 64),
+		  BYTES_TO_WORDS_8(E9, 70, 5F, 94, 01, 0E, 82, 41) },
+		{ BYTES_TO_WORDS_8(B1, AC, F8, A2, 4A, 53, 69, 43),
+		  BYTES_TO_WORDS_8(3F, 05, 3F, 61, 54, 65, 9D, B3),
+		  BYTES_TO_WORDS_8(1E, C3, EC, B8, A4, B7, E1, 85),
+		  BYTES_TO_WORDS_8(D6, E3, 45, 95, 39, 8F, F8, 86),
+		  BYTES_TO_WORDS_8(19, 8A, 09, 05, D1, 42, B0, 14),
+		  BYTES_TO_WORDS_8(71, 52, 16, E9, BE, 62, EA, 4E),
+		  BYTES_TO_WORDS_8(21, B1, 91, B5, 8F, 97, 7C, B3),
+		  BYTES_TO_WORDS_8(D6, 38, 82, A6, 69, DD, CF, 2C) },
+		{ BYTES_TO_WORDS_8(66, AB, AD, FC, B6, 77, 83, D8),
+		  BYTES_TO_WORDS_8(02, 56, D3, 3D, 3C, A3, C6, E1),
+		  BYTES_TO_WORDS_8(A0, F9, D9, 60, 96, 66, F7, 7D),
+		  BYTES_TO_WORDS_8(74, 8E, 94, C9, 1F, BE, A3, A2),
+		  BYTES_TO_WORDS_8(12, EB, 1A, 4C, 48, 12, 4A, EF),
+		  BYTES_TO_WORDS_8(25, AD, 80, 34, A5, E8, 2D, FB),
+		  BYTES_TO_WORDS_8(E1, 5E, 23, 4D, D7, 7E, 50, 06),
+		  BYTES_TO_WORDS_8(67, BE, 24, B5, E6, D8, 3B, A9) },
+		{ BYTES_TO_WORDS_8(BF, 25, 7C, 20, 13, 22, 9D, B8),
+		  BYTES_TO_WORDS_8(97, 80, 2D, BE, 77, C7, FB, 82),
+		  BYTES_TO_WORDS_8(BE, 80, C0, 77, 46, 12, 7E, 36),
+		  BYTES_TO_WORDS_8(B9, 8D, E7, 56, ED, 7C, 4E, 35),
+		  BYTES_TO_WORDS_8(11, 42, 86, 5A, 99, A3, 23, 51),
+		  BYTES_TO_WORDS_8(21, AA, A0, 05, CB, 56, D7, 5F),
+		  BYTES_TO_WORDS_8(58, E5, CF, A5, 24, D8, EB, E6),
+		  BYTES_TO_WORDS_8(70, 40, 99, BB, E9, 62, 9D, 62) },
+		{ BYTES_TO_WORDS_8(D8, DA, E1, 75, E0, 82, 7D, 4A),
+		  BYTES_TO_WORDS_8(2E, BD, C4, 86, 85, A7, 80, 8B),
+		  BYTES_TO_WORDS_8(49, 9F, 09, 0C, 72, CF, B5, 79),
+		  BYTES_TO_WORDS_8(5B, 80, DE, F5, AA, C9, 51, C7),
+		  BYTES_TO_WORDS_8(8B, FC, 4A, 2E, 61, B3, 36, D1),
+		  BYTES_TO_WORDS_8(02, 8C, 0A, 3A, 0A, 97, F8, E6),
+		  BYTES_TO_WORDS_8(FF, A4, C9, 6D, FD, C1, B4, BE),
+		  BYTES_TO_WORDS_8(E2, 9D, 79, FC, 37, 64, 98, CB) },
+		{ BYTES_TO_WORDS_8(A2, 9B, 9D, 09, 21, 1B, 12, D3),
+		  BYTES_TO_WORDS_8(57, A7, AA, 97, D6, 57, F6, 0C),
+		  BYTES_TO_WORDS_8(A8, 9C, 0F, B5, 86, 52, AB, 78),
+		  BYTES_TO_WORDS_8(21, D0, D1, B9, 41, CC, E9, AE),
+		  BYTES_TO_WORDS_8(58, AD, D2, BE, 83, 04, D6, 78),
+		  BYTES_TO_WORDS_8(0E, 49, 17, 6A, E2, 68, 2E, 31),
+		  BYTES_TO_WORDS_8(F5, B1, C6, 00, FB, 7B, E9, 7B),
+		  BYTES_TO_WORDS_8(6F, A3, 52, DB, 02, F3, 2C, B7) },
+		{ BYTES_TO_WORDS_8(8D, 20, 4D, 89, 24, 08, FF, 63),
+		  BYTES_TO_WORDS_8(A4, 91, F3, 0F, FF, A8, 0D, FB),
+		  BYTES_TO_WORDS_8(CE, F0, 1F, 2B, AF, 60, FF, 6B),
+		  BYTES_TO_WORDS_8(C5, 2E, 91, A7, 46, 3F, 0D, 0D),
+		  BYTES_TO_WORDS_8(B1, D1, 45, 9D, F7, 53, 2F, D6),
+		  BYTES_TO_WORDS_8(BF, DA, 1D, A7, D1, C0, 13, B2),
+		  BYTES_TO_WORDS_8(F0, 9F, 90, 5F, A6, 4D, 47, B0),
+		  BYTES_TO_WORDS_8(69, 71, 1F, AE, 80, 1B, 37, DC) },
+		{ BYTES_TO_WORDS_8(90, D8, CF, 19, C8, 22, E8, C6),
+		  BYTES_TO_WORDS_8(45, 11, 07, 7C, 73, C3, 36, CB),
+		  BYTES_TO_WORDS_8(E1, 41, 54, 7E, 38, D8, 7C, F4),
+		  BYTES_TO_WORDS_8(35, 75, 13, 44, 6B, 14, 8D, 77),
+		  BYTES_TO_WORDS_8(F2, 57, F0, D6, A7, 7F, A8, C9),
+		  BYTES_TO_WORDS_8(CA, 0A, D2, 8E, 48, 45, CA, 96),
+		  BYTES_TO_WORDS_8(37, CD, 86, 97, 8D, 71, 52, 2A),
+		  BYTES_TO_WORDS_8(F7, 1A, 01, 3B, 13, BA, 85, 3C) }
+	},
+	{ /* (2j + 1) * 16^52 * G */
+		{ BYTES_TO_WORDS_8(5F, B8, 9B, 83, C3, 09, 0F, 32),
+		  BYTES_TO_WORDS_8(2C, E6, 50, A0, 06, FB, 01, 01),
+		  BYTES_TO_WORDS_8(58, 34, D5, 9A, C9, 82, 75, 55),
+		  BYTES_TO_WORDS_8(2B, 43, 66, 16, 8D, 39, D5, 55),
+		  BYTES_TO_WORDS_8(6F, 93, ED, 4F, 18, 31, F6, F7),
+		  BYTES_TO_WORDS_8(E1, D9, 33, 18, 7F, 6A, 0D, D9),
+		  BYTES_TO_WORDS_8(2A, A7, BA, 8E, 9E, 6A, 9C, 05),
+		  BYTES_TO_WORDS_8(2D, 8E, FF, 49, 90, 22, 6E, 57) },
+		{ BYTES_TO_WORDS_8(5A, 28, EA, 12, 92, 2B, 7E, C0),
+		  BYTES_TO_WORDS_8(D1, 10, B9, F7, E6, C1, 01, 9F),
+		  BYTES_TO_WORDS_8(A3, A7, C0, DD, 8D, 05, 58, 78),
+		  BYTES_TO_WORDS_8(8B, 88, 4F, 81, 08, 64, B4, 1B),
+		  BYTES_TO_WORDS_8(02, C7, 7D, 90, 79, 8A, 0C, DC),
+		  BYTES_TO_WORDS_8(4E, A9, 2F, 99, 4B, A3, 52, 1E),
+		  BYTES_TO_WORDS_8(FC, A4, B4, 92, B8, D9, 0F, A4),
+		  BYTES_TO_WORDS_8(25, 11, AE, AF, BF, 16, 30, 8A) },
+		{ BYTES_TO_WORDS_8(5A, 78, 39, D5, 00, 29, 01, 45),
+		  BYTES_TO_WORDS_8(01, 7F, 29, B8, 76, D0, 88, 8C),
+		  BYTES_TO_WORDS_8(54, 7A, 62, 78, 26, 3E, 97, E0),
+		  BYTES_TO_WORDS_8(4E, A1, 2F, E0, 70, 4E, BC, 04),
+		  BYTES_TO_WORDS_8(BB, E3, 62, CA, 75, 04, 99, 53),
+		  BYTES_TO_WORDS_8(C3, 75, 32, 7A, 72, 17, 70, 87),
+		  BYTES_TO_WORDS_8(4F, FB, 3D, 3F, CF, A1, F5, A5),
+		  BYTES_TO_WORDS_8(C3, 4C, CB, B8, 24, F2, 29, 57) },
+		{ BYTES_TO_WORDS_8(B5, CF, 14, E1, B1, 4B, 2D, 11),
+		  BYTES_TO_WORDS_8(A3, A6, D5, A3, 9A, 18, 36, D1),
+		  BYTES_TO_WORDS_8(76, 08, DF, B7, E1, 39, 77, 58),
+		  BYTES_TO_WORDS_8(73, 81, F8, C1, FD, 92, E4, D3),
+		  BYTES_TO_WORDS_8(45, 70, 7F, 69, A5, 9A, EB, BC),
+		  BYTES_TO_WORDS_8(EF, 4E, 75, 46, 6E, F0, 88, 9C),
+		  BYTES_TO_WORDS_8(A3, FE, 15, BF, 76, 26, EE, 1F),
+		  BYTES_TO_WORDS_8(8B, C4, F8, 73, 0A, A7, 04, 36) },
+		{ BYTES_TO_WORDS_8(FF, DD, 55, AC, BB, 74, 26, 1A),
+		  BYTES_TO_WORDS_8(87, B7, D4, 64, 3F, 1B, AD, 1D),
+		  BYTES_TO_WORDS_8(79, C1, CD, 0F, 31, 52, 4E, 8A),
+		  BYTES_TO_WORDS_8(53, 42, 28, 86, 55, C2, BF, BE),
+		  BYTES_TO_WORDS_8(03, F3, A2, 3E, CA, B0, 4D, 6D),
+		  BYTES_TO_WORDS_8(70, AA, 0B, 65, 2D, 82, CA, 3C),
+		  BYTES_TO_WORDS_8(6C, 57, 76, B7, C4, 11, 3A, 8A),
+		  BYTES_TO_WORDS_8(CE, 04, 96, C0, 65, E2, 0D, 85) },
+		{ BYTES_TO_WORDS_8(51, AD, 9E, C9, E4, 41, AF, 91),
+		  BYTES_TO_WORDS_8(4E, 22, D9, 21, 3A, 54, A3, 5D),
+		  BYTES_TO_WORDS_8(71, 84, 07, 16, 1D, 93, B2, 2F),
+		  BYTES_TO_WORDS_8(60, 0D, D2, 73, DC, 84, E9, 36),
+		  BYTES_TO_WORDS_8(3E, 5E, 0E, 6E, 42, 9D, FB, C6),
+		  BYTES_TO_WORDS_8(AF, 80, 42, 70, C1, BE, AB, 3B),
+		  BYTES_TO_WORDS_8(20, 2B, E3, AC, C9, DF, FB, 4B),
+		  BYTES_TO_WORDS_8(5F, 48, BF, 21, 47, 71, 37, 14) },
+		{ BYTES_TO_WORDS_8(F0, 3D, 09, 23, BB, 77, 8B, 7A),
+		  BYTES_TO_WORDS_8(4D, 46, 76, 67, 81, 24, 5E, 78),
+		  BYTES_TO_WORDS_8(AF, 93, D7, 54, 79, 14, 15, F3),
+		  BYTES_TO_WORDS_8(AE, 04, F6, 43, 00, 75, B6, 91),
+		  BYTES_TO_WORDS_8(14, 9F, CC, D2, 37, 8C, DE, 5C),
+		  BYTES_TO_WORDS_8(7F, F6, CA, F9, F8, 85, 36, 93),
+		  BYTES_TO_WORDS_8(5D, 1C, E2, 96, DA, 7A, 7C, 47),
+		  BYTES_TO_WORDS_8(0D, A0, 24, 58, 1E, DB, FE, 07) },
+		{ BYTES_TO_WORDS_8(C4, 8D, 7B, FB, 86, 7B, 36, A2),
+		  BYTES_TO_WORDS_8(48, 38, 9B, 8A, 02, 93, 34, 5B),
+		  BYTES_TO_WORDS_8(AC, 2F, 60, 03, 1A, 7E, 49, 7C),
+		  BYTES_TO_WORDS_8(3E, 88, C4, A1, C7, C3, D9, C5),
+		  BYTES_TO_WORDS_8(EA, F0, 2D, 1B, 8D, 97, 64, ED),
+		  BYTES_TO_WORDS_8(36, 49, FD, D1, 2F, F7, D8, D0),
+		  BYTES_TO_WORDS_8(F3, 0A, C5, 05, 86, C3, 08, 58),
+		  BYTES_TO_WORDS_8(9E, B7, FD, 5C, E2, B9, 59, 3E) }
+	},
+	{ /* (2j + 1) * 16^53 * G */
+		{ BYTES_TO_WORDS_8(26, 39, 51, 32, 9C, BC, 2D, C6),
+		  BYTES_TO_WORDS_8(EC, 85, EC, EF, 40, 89, 26, CC),
+		  BYTES_TO_WORDS_8(83, 33, FC, 4B, B2, BA, FE, 94),
+		  BYTES_TO_WORDS_8(26, 87, A0, 3C, 46, 86, 42, 88),
+		  BYTES_TO_WORDS_8(4D, A5, B8, AF, 2A, 28, E4, 0E),
+		  BYTES_TO_WORDS_8(5A, C1, DB, EB, 22, B1, 0E, CE),
+		  BYTES_TO_WORDS_8(07, 12, D8, 65, B3, 0D, 66, 69),
+		  BYTES_TO_WORDS_8(5A, DD, C2, 01, 9C, 42, 78, F7) },
+		{ BYTES_TO_WORDS_8(F1, F1, 20, 65, 19, AC, 2B, ED),
+		  BYTES_TO_WORDS_8(A4, 7D, 7F, 64, 9E, B4, F1, D7),
+		  BYTES_TO_WORDS_8(4A, 6F, CF, 8C, 16, FD, A5, D5),
+		  BYTES_TO_WORDS_8(19, 08, 6F, F7, 36, 9D, AD, 3B),
+		  BYTES_TO_WORDS_8(4D, DF, 98, 56, 72, 70, 19, 6A),
+		  BYTES_TO_WORDS_8(58, 72, B6, 4E, A2, 81, 99, 49),
+		  BYTES_TO_WORDS_8(80, 0E, EC, 9D, 7D, FA, D9, BC),
+		  BYTES_TO_WORDS_8(59, E6, 24, 3E, E3, 9D, F9, 49) },
+		{ BYTES_TO_WORDS_8(66, AE, 85, B1, A8, 44, 1E, 0B),
+		  BYTES_TO_WORDS_8(DF, 83, A7, EF, DB, 16, EC, A6),
+		  BYTES_TO_WORDS_8(8B, 11, 24, D1, 53, DF, A7, 67),
+		  BYTES_TO_WORDS_8(6D, C4, B0, AD, B1, A4, B3, A6),
+		  BYTES_TO_WORDS_8(1B, F2, FB, 8B, 3F, 55, EB, 7B),
+		  BYTES_TO_WORDS_8(DD, 48, B2, F5, 5D, 0A, BF, BC),
+		  BYTES_TO_WORDS_8(D8, E8, 69, D9, 1C, A9, 61, 13),
+		  BYTES_TO_WORDS_8(23, 96, 88, 63, D7, E8, B6, 0C) },
+		{ BYTES_TO_WORDS_8(3A, 0E, 63, EC, E4, 4C, 68, A9),
+		  BYTES_TO_WORDS_8(C2, F1, F3, 7F, C1, 60, 10, F6),
+		  BYTES_TO_WORDS_8(C1, 10, 7F, D8, A7, E3, 27, E2),
+		  BYTES_TO_WORDS_8(A4, 14, 91, 6C, 5A, 8F, 84, 1F),
+		  BYTES_TO_WORDS_8(0A, 61, CA, 86, F6, 9F, ED, AE),
+		  BYTES_TO_WORDS_8(24, 97, 35, FE, 6B, 92, A3, 4B),
+		  BYTES_TO_WORDS_8(26, A4, 9D, 1A, 3D, C8, 29, 86),
+		  BYTES_TO_WORDS_8(63, F9, 06, CD, 2C, 55, 28, A0) },
+		{ BYTES_TO_WORDS_8(10, CD, 1B, C4, CD, F3, FE, 4D),
+		  BYTES_TO_WORDS_8(15, 4E, B4, 45, 76, 55, B9, 11),
+		  BYTES_TO_WORDS_8(B2, 2E, CA, C6, 77, 26, 1A, 8B),
+		  BYTES_TO_WORDS_8(58, C3, 49, E9, 4B, E5, D1, CF),
+		  BYTES_TO_WORDS_8(32, E7, 62, AA, B9, 5E, 01, AC),
+		  BYTES_TO_WORDS_8(65, 39, 55, 08, 5D, 91, D9, AC),
+		  BYTES_TO_WORDS_8(AF, 2F, 05, 5B, BD, 51, 57, 9C),
+		  BYTES_TO_WORDS_8(BB, 58, 09, 60, 5F, 1F, E3, F4) },
+		{ BYTES_TO_WORDS_8(FB, A5, 8D, 22, 92, 1D, A6, 4F),
+		  BYTES_TO_WORDS_8(72, 0E, 87, 2A, 5E, BF, E4, 90),
+		  BYTES_TO_WORDS_8(1B, 29, 71, E7, E3, 95, C7, 12),
+		  BYTES_TO_WORDS_8(55, 9E, 6C, 04, 0C, 73, 3E, 4B),
+		  BYTES_TO_WORDS_8(48, 9E, 16, BC, 38, A6, F0, BF),
+		  BYTES_TO_WORDS_8(2B, 47, 23, 9C, 1C, A1, A3, 65),
+		  BYTES_TO_WORDS_8(8C, B4, E0, B8, 07, BA, 0C, E8),
+		  BYTES_TO_WORDS_8(E9, 60, 36, A2, 4D, 96, 40, 8C) },
+		{ BYTES_TO_WORDS_8(80, 47, 89, 9F, 58, 1A, E9, B8),
+		  BYTES_TO_WORDS_8(5D, EC, 9A, 58, A3, CC, E9, 37),
+		  BYTES_TO_WORDS_8(F7, D8, 42, 4B, A5, B8, 54, 1D),
+		  BYTES_TO_WORDS_8(E7, 8F, 43, 74, DF, 15, E9, AF),
+		  BYTES_TO_WORDS_8(44, D4, 11, D5, 53, 95, 96, 2F),
+		  BYTES_TO_WORDS_8(45, AF, C0, 3A, E7, 8B, 9E, 90),
+		  BYTES_TO_WORDS_8(36, 2E, 3F, 33, 42, 43, 4B, A9),
+		  BYTES_TO_WORDS_8(86, 46, 20, 8D, 40, C3, AE, 3C) },
+		{ BYTES_TO_WORDS_8(6E, FA, 82, D1, CB, 1F, A3, F5),
+		  BYTES_TO_WORDS_8(AF, C8, 81, 69, DD, 32, A6, C0),
+		  BYTES_TO_WORDS_8(E7, C9, 35, 6D, A3, A3, 66, 58),
+		  BYTES_TO_WORDS_8(85, AC, FF, 10, 28, 48, 05, 0C),
+		  BYTES_TO_WORDS_8(45, D1, 1C, 66, AB, FE, BC, 6E),
+		  BYTES_TO_WORDS_8(1F, D0, 76, 4B, 58, 64, E6, F5),
+		  BYTES_TO_WORDS_8(2B, 60, 5D, 46, 89, 8B, AA, D1),
+		  BYTES_TO_WORDS_8(33, F5, F1, D0, CA, D2, 9C, 2F) }
+	},
+	{ /* (2j + 1) * 16^54 * G */
+		{ BYTES_TO_WORDS_8(BB, 1F, 44, D4, 5A, 5D, 0B, 3E),
+		  BYTES_TO_WORDS_8(5E, 11, ED, A5, 20, 85, AA, 9E),
+		  BYTES_TO_WORDS_8(55, 25, B9, ED, 55, 0C, B6, 7F),
+		  BYTES_TO_WORDS_8(D4, 21, DE, 21, 4E, 8C, 95, B4),
+		  BYTES_TO_WORDS_8(18, 71, DD, 4A, 9F, 3C, 7E, 4C),
+		  BYTES_TO_WORDS_8(41, 38, 46, 2D, 13, F6, B9, 2D),
+		  BYTES_TO_WORDS_8(E1, B7, 8C, C3, FB, 41, C0, E5),
+		  BYTES_TO_WORDS_8(EF, 40, 66, 99, BF, E7, D6, FC) },
+		{ BYTES_TO_WORDS_8(F1, 07, 1F, 37, 4C, 68, ED, 5A),
+		  BYTES_TO_WORDS_8(4A, 0C, D7, 30, B7, ED, 8C, 87),
+		  BYTES_TO_WORDS_8(4B, 68, 06, 46, B6, A0, 2E, 23),
+		  BYTES_TO_WORDS_8(4D, 44, 20, 7B, 5E, 3F, A4, B3),
+		  BYTES_TO_WORDS_8(A5, FD, 1D, E0, F4, 22, CD, 53),
+		  BYTES_TO_WORDS_8(CC, 0E, CB, CD, A0, 77, 78, EC),
+		  BYTES_TO_WORDS_8(E7, 5E, 97, 69, 73, 22, 83, 41),
+		  BYTES_TO_WORDS_8(B8, D6, 8F, 24, 5B, 4F, C6, 34) },
+		{ BYTES_TO_WORDS_8(49, 9D, 55, 6B, A4, 97, 7C, FF),
+		  BYTES_TO_WORDS_8(44, 9B, DC, 0D, 69, B4, E1, 48),
+		  BYTES_TO_WORDS_8(B1, 08, C0, 84, FD, 2F, 66, C2),
+		  BYTES_TO_WORDS_8(4A, E1, 6B, A4, 69, 98, 2E, 45),
+		  BYTES_TO_WORDS_8(A7, 6B, 0D, DA, 46, 60, 7C, 74),
+		  BYTES_TO_WORDS_8(25, E4, 1E, 3B, 6C, 85, 82, 59),
+		  BYTES_TO_WORDS_8(52, EE, 61, 67, 7B, 05, C0, F5),
+		  BYTES_TO_WORDS_8(D0, 80, 5F, 19, 8F, 8A, 5E, 8C) },
+		{ BYTES_TO_WORDS_8(DA, 94, CE, 53, EB, 67, 7A, 53),
+		  BYTES_TO_WORDS_8(60, 9E, 82, 56, 42, 4F, B2, 8B),
+		  BYTES_TO_WORDS_8(EE, 74, C4, 3A, DC, E0, CD, 51),
+		  BYTES_TO_WORDS_8(BB, 62, 6D, 8C, D4, F5, A7, 19),
+		  BYTES_TO_WORDS_8(BB, E7, 25, 30, 16, 47, 04, 73),
+		  BYTES_TO_WORDS_8(03, EB, 25, AE, 06, 53, 62, FB),
+		  BYTES_TO_WORDS_8(E8, A2, 00, 42, D4, 51, 6A, 2F),
+		  BYTES_TO_WORDS_8(C3, 75, 30, A9, A7, 4B, 50, A2) },
+		{ BYTES_TO_WORDS_8(97, C6, 7D, D4, C6, 6C, 69, B9),
+		  BYTES_TO_WORDS_8(9B, 5B, E1, B5, AF, 18, EE, 17),
+		  BYTES_TO_WORDS_8(A4, 6F, FC, B5, B2, B0, 1E, 01),
+		  BYTES_TO_WORDS_8(DC, 34, 4F, 0A, 02, 5B, AF, BD),
+		  BYTES_TO_WORDS_8(E2, 79, A4, 86, E7, CB, 11, B9),
+		  BYTES_TO_WORDS_8(77, A4, B7, 85, 78, 2E, 12, 55),
+		  BYTES_TO_WORDS_8(08, AA, 57, 7B, E4, 75, F5, 8C),
+		  BYTES_TO_WORDS_8(6C, 83, FA, BD, 6C, 0C, EC, 3C) },
+		{ BYTES_TO_WORDS_8(10, 5E, E0, 6C, 1B, B9, 00, 2A),
+		  BYTES_TO_WORDS_8(20, 06, E1, 43, 9F, 7C, EF, 8A),
+		  BYTES_TO_WORDS_8(DB, 70, CE, 84, FE, B7, 84, AB),
+		  BYTES_TO_WORDS_8(5D, D1, 39, 5F, E9, BA, 5D, 26),
+		  BYTES_TO_WORDS_8(F4, 24, 13, 17, 8B, 01, 7F, FF),
+		  BYTES_TO_WORDS_8(7F, C6, 64, 3D, 93, F3, 63, 06),
+		  BYTES_TO_WORDS_8(CB, 5D, CB, 56, 8B, CE, B3, F3),
+		  BYTES_TO_WORDS_8(AD, 37, 30, 9A, D0, 63, DF, 58) },
+		{ BYTES_TO_WORDS_8(38, 59, FE, B3, 55, BC, 15, ED),
+		  BYTES_TO_WORDS_8(CD, D7, 36, B6, 3D, 30, C8, 9E),
+		  BYTES_TO_WORDS_8(66, 68, 56, 3A, D5, 49, F7, 89),
+		  BYTES_TO_WORDS_8(96, 63, E6, 17, 3F, 08, 3E, C4),
+		  BYTES_TO_WORDS_8(F3, 32, 37, D8, 6E, 75, 79, 76),
+		  BYTES_TO_WORDS_8(47, 07, 44, 62, 71, 30, 62, AB),
+		  BYTES_TO_WORDS_8(2E, 40, C4, AB, 03, 03, 09, 35),
+		  BYTES_TO_WORDS_8(58, CC, FB, 39, 92, 02, C6, 54) },
+		{ BYTES_TO_WORDS_8(75, 29, D5, 9D, F7, 70, 1C, C3),
+		  BYTES_TO_WORDS_8(80, 41, B4, 06, D3, 0F, CF, 2B),
+		  BYTES_TO_WORDS_8(BA, 66, B2, 77, DA, 50, AC, 65),
+		  BYTES_TO_WORDS_8(86, 84, 3F, 0A, 70, F1, 68, 78),
+		  BYTES_TO_WORDS_8(AC, 6F, 62, 3C, 50, ED, 16, 30),
+		  BYTES_TO_WORDS_8(44, 90, 96, A6, EC, F9, F6, 68),
+		  BYTES_TO_WORDS_8(6C, 27, 11, DB, C6, A1, 3F, 11),
+		  BYTES_TO_WORDS_8(E1, 7E, 21, 31, CF, 97, 90, E8) }
+	},
+	{ /* (2j + 1) * 16^55 * G */
+		{ BYTES_TO_WORDS_8(DF, E1, 12, 6E, 43, E6, 24, AC),
+		  BYTES_TO_WORDS_8(04, 1D, 76, 7D, 0B, FD, A7, D8),
+		  BYTES_TO_WORDS_8(7C, 02, 46, B3, 13, BF, 34, 41),
+		  BYTES_TO_WORDS_8(B6, 32, E9, 88, 96, 91, E0, D0),
+		  BYTES_TO_WORDS_8(BE, 8F, D2, 9F, DB, 44, 65, 6A),
+		  BYTES_TO_WORDS_8(DF, B8, 46, 98, BD, C4, 4C, 54),
+		  BYTES_TO_WORDS_8(67, F8, DB, 91, B6, 60, EB, B4),
+		  BYTES_TO_WORDS_8(52, 14, 7D, FE, 59, 9A, 9C, 06) },
+		{ BYTES_TO_WORDS_8(98, A0, 4A, 08, 10, 85, 0D, BB),
+		  BYTES_TO_WORDS_8(02, 3E, 6E, A9, 40, 01, C1, 09),
+		  BYTES_TO_WORDS_8(85, FA, C1, BF, AC, 7D, 8A, 39),
+		  BYTES_TO_WORDS_8(EB, 08, 33, A1, 54, A4, 17, B5),
+		  BYTES_TO_WORDS_8(BF, EF, 40, 45, 9F, B5, 04, 60),
+		  BYTES_TO_WORDS_8(FD, 47, 24, 69, 54, 8B, D4, A4),
+		  BYTES_TO_WORDS_8(A3, 6F, F2, B0, 2F, 3E, EA, 60),
+		  BYTES_TO_WORDS_8(9A, 87, 1F, 0C, 7D, 87, 3D, 0A) },
+		{ BYTES_TO_WORDS_8(A1, BF, 44, 47, AA, AC, 95, 6D),
+		  BYTES_TO_WORDS_8(3D, 64, 93, E0, 7C, D2, 26, CC),
+		  BYTES_TO_WORDS_8(87, E3, F3, D8, 12, 27, C2, 7B),
+		  BYTES_TO_WORDS_8(F6, 66, 51, 4B, 38, 14, EC, F8),
+		  BYTES_TO_WORDS_8(6D, 5F, B6, 32, 63, 4E, 92, C6),
+		  BYTES_TO_WORDS_8(60, 00, 90, C3, C5, 7A, 63, 0A),
+		  BYTES_TO_WORDS_8(61, 0F, D6, 69, B2, 8F, 36, 32),
+		  BYTES_TO_WORDS_8(A6, B9, 3F, 11, B2, 34, 11, 76) },
+		{ BYTES_TO_WORDS_8(BB, A4, 27, 32, E9, 3B, 2C, F6),
+		  BYTES_TO_WORDS_8(F2, 99, 8D, 0F, F0, B1, E6, 4B),
+		  BYTES_TO_WORDS_8(E6, F2, D4, 21, AD, 4E, E7, 94),
+		  BYTES_TO_WORDS_8(E7, FA, 7B, DB, 78, FF, 0C, 32),
+		  BYTES_TO_WORDS_8(D4, D2, F3, B0, 06, C9, 1C, 58),
+		  BYTES_TO_WORDS_8(70, F9, E2, 09, 74, 23, 47, 60),
+		  BYTES_TO_WORDS_8(99, 62, FF, 54, A2, 96, 77, AB),
+		  BYTES_TO_WORDS_8(92, 86, 2A, 07, D4, E8, 9F, AF) },
+		{ BYTES_TO_WORDS_8(83, A6, 2C, 5C, 5E, 5A, 5B, 3B),
+		  BYTES_TO_WORDS_8(37, A7, 95, 0A, 5E, F3, 6C, 20),
+		  BYTES_TO_WORDS_8(6A, 42, 43, B5, CC, DD, ED, 17),
+		  BYTES_TO_WORDS_8(85, ED, 7A, 6A, 7C, DE, 08, 0C),
+		  BYTES_TO_WORDS_8(59, F2, B5, 7D, B5, 6D, 40, 92),
+		  BYTES_TO_WORDS_8(C6, 68, EA, E0, B7, D7, C8, C3),
+		  BYTES_TO_WORDS_8(79, 0E, CE, DF, 9C, 29, C8, B7),
+		  BYTES_TO_WORDS_8(19, 6E, A1, 5E, 85, 6D, B7, DD) },
+		{ BYTES_TO_WORDS_8(CD, E5, 2A, 25, F8, AC, 67, 1C),
+		  BYTES_TO_WORDS_8(86, D7, FD, F4, FA, 52, B6, 95),
+		  BYTES_TO_WORDS_8(09, 39, E4, 4C, A4, F7, E6, 18),
+		  BYTES_TO_WORDS_8(3D, 7C, C4, D0, 6A, C7, F8, D1),
+		  BYTES_TO_WORDS_8(DA, 2D, 6D, FE, C3, 7B, B9, 7E),
+		  BYTES_TO_WORDS_8(FC, F4, 89, 69, 15, E8, BA, 39),
+		  BYTES_TO_WORDS_8(32, 20, 61, 1F, B0, 97, 79, AC),
+		  BYTES_TO_WORDS_8(02, E8, 20, 61, C6, 5D, D4, 74) },
+		{ BYTES_TO_WORDS_8(3F, 60, DC, AB, 6A, 06, 90, B7),
+		  BYTES_TO_WORDS_8(5A, FE, DF, 67, CD, 65, 6D, C9),
+		  BYTES_TO_WORDS_8(D8, 20, 76, 26, C6, 3E, E3, 93),
+		  BYTES_TO_WORDS_8(C0, 90, 38, 3F, 69, 83, CB, A6),
+		  BYTES_TO_WORDS_8(CC, EF, 6B, C9, E0, 03, CE, CA),
+		  BYTES_TO_WORDS_8(35, 17, 66, 4C, 6A, C1, 1E, FB),
+		  BYTES_TO_WORDS_8(72, 0B, 51, 4C, DA, 9B, 2D, 8F),
+		  BYTES_TO_WORDS_8(FC, CA, F3, 61, E4, C8, 23, D8) },
+		{ BYTES_TO_WORDS_8(B0, 74, C3, E2, 12, A6, E3, 29),
+		  BYTES_TO_WORDS_8(4A, DB, 70, B5, 98, 35, 5B, BF),
+		  BYTES_TO_WORDS_8(F0, 4E, 42, 52, 71, C9, BE, 36),
+		  BYTES_TO_WORDS_8(21, 33, 6C, EA, 91, 9C, 6C, 8A),
+		  BYTES_TO_WORDS_8(BD, 08, 8C, B7, 8D, CF, F7, 3B),
+		  BYTES_TO_WORDS_8(58, 4D, 0F, 34, F4, 34, 15, 46),
+		  BYTES_TO_WORDS_8(A0, 32, 01, C9, 5D, 88, A7, 79),
+		  BYTES_TO_WORDS_8(AF, FF, CD, 65, 4F, 7F, BC, E4) }
+	},
+	{ /* (2j + 1) * 16^56 * G */
+		{ BYTES_TO_WORDS_8(07, DF, 95, E8, 10, 3F, 70, 6A),
+		  BYTES_TO_WORDS_8(D8, 6B, 87, 01, FA, F3, 75, FD),
+		  BYTES_TO_WORDS_8(FE, 8F, E0, 0C, E7, 06, 5B, EB),
+		  BYTES_TO_WORDS_8(EE, DF, 83, 27, 54, B8, F6, 68),
+		  BYTES_TO_WORDS_8(55, 26, 71, 78, 8A, 6F, C7, 90),
+		  BYTES_TO_WORDS_8(7F, BF, 10, F3, D2, 93, 52, CF),
+		  BYTES_TO_WORDS_8(28, 50, A4, FD, 4D, 04, C8, FB),
+		  BYTES_TO_WORDS_8(E6, 0C, E4, 92, BA, FE, E1, CB) },
+		{ BYTES_TO_WORDS_8(92, 96, A8, 3A, 23, FA, 18, E4),
+		  BYTES_TO_WORDS_8(08, 23, 4C, F9, D6, 08, 3B, 71),
+		  BYTES_TO_WORDS_8(76, A7, 18, 24, 41, E6, 96, E9),
+		  BYTES_TO_WORDS_8(4D, 8F, 66, 81, 71, CA, DF, 3B),
+		  BYTES_TO_WORDS_8(08, 03, 51, 1A, 43, DB, DB, 93),
+		  BYTES_TO_WORDS_8(13, EF, E2, 45, 63, 0C, DC, C7),
+		  BYTES_TO_WORDS_8(33, 53, DA, AE, 51, 61, 42, 49),
+		  BYTES_TO_WORDS_8(B8, 67, 51, 56, 68, 1F, 72, 0A) },
+		{ BYTES_TO_WORDS_8(D7, A1, 7E, C3, 42, 23, 9B, 07),
+		  BYTES_TO_WORDS_8(4D, AE, 9A, F8, 58, 36, 39, B2),
+		  BYTES_TO_WORDS_8(4F, 9E, 8D, 51, 52, 85, 32, 35),
+		  BYTES_TO_WORDS_8(56, 10, 52, B7, 95, AC, A8, AC),
+		  BYTES_TO_WORDS_8(A2, 73, A9, 9B, 04, B1, EF, DD),
+		  BYTES_TO_WORDS_8(E9, 35, 39, 41, DC, BF, ED, E1),
+		  BYTES_TO_WORDS_8(89, 21, 87, 92, 4B, 4C, 30, 94),
+		  BYTES_TO_WORDS_8(20, CC, 75, DD, 67, C5, 12, 7F) },
+		{ BYTES_TO_WORDS_8(7F, 5B, 24, D3, 1C, 78, B2, 5D),
+		  BYTES_TO_WORDS_8(BF, 7F, 59, 90, 96, 66, 7D, A3),
+		  BYTES_TO_WORDS_8(11, 53, D8, 98, AF, 21, 6C, 20),
+		  BYTES_TO_WORDS_8(0E, 7C, 66, DB, 04, 47, 90, FA),
+		  BYTES_TO_WORDS_8(EF, 6B, DF, 4D, F1, 3D, 83, EF),
+		  BYTES_TO_WORDS_8(47, 1D, 4F, 62, D2, EC, 9E, CB),
+		  BYTES_TO_WORDS_8(89, C1, F1, 40, ED, A3, 6F, 2D),
+		  BYTES_TO_WORDS_8(A4, 36, A8, 74, 36, 8C, 1C, 1A) },
+		{ BYTES_TO_WORDS_8(3A, 95, F0, 77, FD, 78, 1F, B6),
+		  BYTES_TO_WORDS_8(9A, 43, 15, FF, 83, 14, 49, 18),
+		  BYTES_TO_WORDS_8(A8, 92, FA, D2, E1, B8, 72, D6),
+		  BYTES_TO_WORDS_8(8C, 7D, F5, 91, AB, 1A, 43, 1D),
+		  BYTES_TO_WORDS_8(60, F2, 68, 9D, 76, 9D, C5, 17),
+		  BYTES_TO_WORDS_8(7C, 7E, 70, 08, A9, 29, 8E, F4),
+		  BYTES_TO_WORDS_8(E0, FA, 15, CE, 83, 0C, 53, BC),
+		  BYTES_TO_WORDS_8(1E, 12, 19, BF, C3, 67, D6, 08) },
+		{ BYTES_TO_WORDS_8(70, 7C, 22, 65, 13, 17, 31, 5A),
+		  BYTES_TO_WORDS_8(70, EA, A3, 33, B3, EA, 2B, F3),
+		  BYTES_TO_WORDS_8(0F, C6, 31, 2E, 5B, B3, A4, DD),
+		  BYTES_TO_WORDS_8(37, 11, 3E, 5A, 0D, EA, EE, 6D),
+		  BYTES_TO_WORDS_8(B7, B9, 69, 03, 81, A3, 6D, AD),
+		  BYTES_TO_WORDS_8(DB, 83, 90, 56, 1E, EC, 7A, 28),
+		  BYTES_TO_WORDS_8(84, CC, 6A, EF, AF, CB, 14, 00),
+		  BYTES_TO_WORDS_8(40, 3E, 44, C7, 0F, 3F, B9, CB) },
+		{ BYTES_TO_WORDS_8(4D, B5, 21, 84, E8, D5, 5F, FB),
+		  BYTES_TO_WORDS_8(4F, 4A, 56, A5, 83, 2B, 9B, 57),
+		  BYTES_TO_WORDS_8(CA, 9D, FA, B1, 2B, 9D, AC, D4),
+		  BYTES_TO_WORDS_8(D8, 78, 55, 63, 10, 5C, 13, 28),
+		  BYTES_TO_WORDS_8(68, D8, E5, 8E, 9B, F0, CC, AD),
+		  BYTES_TO_WORDS_8(D8, 10, E3, 91, CC, 94, 04, EF),
+		  BYTES_TO_WORDS_8(15, 8C, 7F, 10, 74, 9D, FA, 06),
+		  BYTES_TO_WORDS_8(15, BE, 51, 38, BE, 4A, D8, 9E) },
+		{ BYTES_TO_WORDS_8(10, AC, E4, E8, 91, 55, 7E, 91),
+		  BYTES_TO_WORDS_8(9A, 4A, E2, AC, 12, A8, 96, 79),
+		  BYTES_TO_WORDS_8(68, B5, FF, 09, 5A, CC, C3, D6),
+		  BYTES_TO_WORDS_8(7B, 07, B1, 20, 76, 05, 9A, 33),
+		  BYTES_TO_WORDS_8(A0, 12, 13, 4D, 64, A8, 6D, F7),
+		  BYTES_TO_WORDS_8(6E, C6, 1C, F4, 88, E7, 39, 50),
+		  BYTES_TO_WORDS_8(3E, 55, CF, 8A, F7, 4D, 85, 43),
+		  BYTES_TO_WORDS_8(7F, 94, 6A, DD, BE, 5F, 98, CA) }
+	},
+	{ /* (2j + 1) * 16^57 * G */
+		{ BYTES_TO_WORDS_8(34, 1F, EA, 67, 17, AB, 4D, D3),
+		  BYTES_TO_WORDS_8(0D, 9E, 73, 04, 54, D3, 6B, 64),
+		  BYTES_TO_WORDS_8(D6, 53, B3, 93, 17, 1D, B4, C3),
+		  BYTES_TO_WORDS_8(66, 4B, 47, 3D, A2, 60, 94, 7F),
+		  BYTES_TO_WORDS_8(EC, 63, 90, CD, CA, C2, BE, 58),
+		  BYTES_TO_WORDS_8(FC, 4F, E3, 24, 51, 81, FF, C6),
+		  BYTES_TO_WORDS_8(61, 66, 07, 8F, BF, F2, F1, 69),
+		  BYTES_TO_WORDS_8(87, 61, B0, 8F, 77, 16, D5, D0) },
+		{ BYTES_TO_WORDS_8(9D, 0A, FC, BD, C9, 74, 5B, DC),
+		  BYTES_TO_WORDS_8(A0, 7A, F7, 14, 5B, 23, 44, DE),
+		  BYTES_TO_WORDS_8(A2, A2, E0, 6A, 64, E3, 60, 2A),
+		  BYTES_TO_WORDS_8(02, 9E, 32, 4C, F8, E7, 43, DB),
+		  BYTES_TO_WORDS_8(13, D7, 9A, 9E, 3A, 09, B1, F0),
+		  BYTES_TO_WORDS_8(54, F0, D2, 56, 73, 04, 39, 88),
+		  BYTES_TO_WORDS_8(A4, 9F, EF, 4C, 81, 6C, A5, B8),
+		  BYTES_TO_WORDS_8(91, B5, 36, BE, A2, 8D, 16, B0) },
+		{ BYTES_TO_WORDS_8(8D, 80, 83, 42, 77, B1, BC, 30),
+		  BYTES_TO_WORDS_8(89, 3A, 64, 35, CE, 07, 8F, 0F),
+		  BYTES_TO_WORDS_8(98, 78, FA, 21, 91, 5E, 51, B8),
+		  BYTES_TO_WORDS_8(AE, 21, 0D, EE, 81, 30, AF, E9),
+		  BYTES_TO_WORDS_8(33, 9D, B3, 39, 8E, 2F, 6C, 96),
+		  BYTES_TO_WORDS_8(19, 6D, 13, 15, 51, 92, 6B, 97),
+		  BYTES_TO_WORDS_8(71, 49, EF, 0F, 55, 26, AF, 85),
+		  BYTES_TO_WORDS_8(60, 12, 47, 9C, 48, C8, 76, A9) },
+		{ BYTES_TO_WORDS_8(DF, 26, 84, AD, 2C, F4, 92, 26),
+		  BYTES_TO_WORDS_8(0A, 8A, 6F, 4E, 5A, 39, 41, 0F),
+		  BYTES_TO_WORDS_8(59, 83, F8, 3B, 38, C9, 3A, 70),
+		  BYTES_TO_WORDS_8(80, 69, 80, 2C, 63, 33, B7, 6E),
+		  BYTES_TO_WORDS_8(67, 42, 0B, 20, EE, 59, F7, 3F),
+		  BYTES_TO_WORDS_8(83, 1B, FE, 83, 7C, E9, 52, 92),
+		  BYTES_TO_WORDS_8(8D, 8E, C0, EC, 2C, 4B, 0E, 03),
+		  BYTES_TO_WORDS_8(9A, 7A, 30, 17, C1, 6E, C5, 96) },
+		{ BYTES_TO_WORDS_8(3D, 45, 16, 1A, 7C, 6D, D1, F7),
+		  BYTES_TO_WORDS_8(DB, 33, 10, 76, BE, 87, 7E, 8B),
+		  BYTES_TO_WORDS_8(E6, D0, B4, F8, 91, 1B, 74, E1),
+		  BYTES_TO_WORDS_8(45, 5F, 9D, 07, 5E, 9D, 97, D3),
+		  BYTES_TO_WORDS_8(37, D7, B6, 67, 31, B8, CB, F3),
+		  BYTES_TO_WORDS_8(A4, 61, 69, 8A, 62, F6, DD, 17),
+		  BYTES_TO_WORDS_8(69, 45, 72, 53, 57, 92, D0, A4),
+		  BYTES_TO_WORDS_8(B9, AD, 99, D7, 35, 93, 5F, C5) },
+		{ BYTES_TO_WORDS_8(04, 65, 32, ED, A5, 99, A1, CE),
+		  BYTES_TO_WORDS_8(2C, 20, B5, 27, 46, 9B, 5A, F6),
+		  BYTES_TO_WORDS_8(12, FC, AE, C1, 88, 3B, 38, 2C),
+		  BYTES_TO_WORDS_8(34, C2, B8, E5, 9C, 92, C3, 54),
+		  BYTES_TO_WORDS_8(07, E1, C9, 7E, FA, 11, F0, 8B),
+		  BYTES_TO_WORDS_8(26, 67, 8A, 60, 9E, 3D, A5, 47),
+		  BYTES_TO_WORDS_8(44, AB, 14, 49, 28, AA, 89, C4),
+		  BYTES_TO_WORDS_8(D0, 16, EA, 60, 25, 30, 96, 46) },
+		{ BYTES_TO_WORDS_8(E7, CC, 5E, BB, 76, F5, 44, 30),
+		  BYTES_TO_WORDS_8(35, 21, 0D, 0C, 8B, 15, 28, 73),
+		  BYTES_TO_WORDS_8(C8, 59, 96, C1, 83, 8E, 4E, B8),
+		  BYTES_TO_WORDS_8(C5, D6, 66, 86, B2, E9, 44, 37),
+		  BYTES_TO_WORDS_8(21, 77, 24, 6A, 41, 21, 13, 20),
+		  BYTES_TO_WORDS_8(39, F8, A6, 52, F0, B5, E8, 28),
+		  BYTES_TO_WORDS_8(3C, EC, 29, EB, 56, 69, 0E, 0E),
+		  BYTES_TO_WORDS_8(AA, 47, 90, D9, F8, E0, 46, 95) },
+		{ BYTES_TO_WORDS_8(96, F9, FE, 45, DE, 28, C9, 50),
+		  BYTES_TO_WORDS_8(51, 53, 42, 94, 63, 8F, 06, 14),
+		  BYTES_TO_WORDS_8(DE, F2, F3, 1E, A4, D0, 4C, 32),
+		  BYTES_TO_WORDS_8(53, 6D, 65, E3, 17, 3E, 34, 11),
+		  BYTES_TO_WORDS_8(ED, AD, 92, 57, E7, 0A, 15, 40),
+		  BYTES_TO_WORDS_8(8E, F1, 86, A0, 65, 4D, CE, D0),
+		  BYTES_TO_WORDS_8(65, 37, 27, 06, 93, DF, 4D, B0),
+		  BYTES_TO_WORDS_8(EE, 8E, BA, DE, 80, 84, 9E, 4A) }
+	},
+	{ /* (2j + 1) * 16^58 * G */
+		{ BYTES_TO_WORDS_8(83, 84, 6D, 8E, D7, B4, C9, CE),
+		  BYTES_TO_WORDS_8(0D, 7F, 96, 46, A8, D7, F2, 82),
+		  BYTES_TO_WORDS_8(45, E9, 6E, 1B, 9F, F4, 58, 29),
+		  BYTES_TO_WORDS_8(3D, 56, 3D, A3, 60, CB, 39, 9C),
+		  BYTES_TO_WORDS_8(FB, 50, 2C, 6B, 6F, 35, B3, 94),
+		  BYTES_TO_WORDS_8(68, 43, BE, 3D, 2F, E5, AD, BB),
+		  BYTES_TO_WORDS_8(46, 65, A1, BC, B7, 96, D1, 03),
+		  BYTES_TO_WORDS_8(10, E5, 93, E4, 1E, BF, 97, F0) },
+		{ BYTES_TO_WORDS_8(DA, 4D, A1, 47, F8, 31, 5C, F5),
+		  BYTES_TO_WORDS_8(F3, 4D, 4B, 67, 29, 04, 6D, 60),
+		  BYTES_TO_WORDS_8(83, 30, 01, 24, F7, 68, 37, 44),
+		  BYTES_TO_WORDS_8(D7, DA, EA, 90, CC, 7A, F3, 18),
+		  BYTES_TO_WORDS_8(64, 83, AC, 25, C3, CD, 2F, E2),
+		  BYTES_TO_WORDS_8(CB, 36, 85, 8A, C7, F7, D8, 77),
+		  BYTES_TO_WORDS_8(0B, CD, 1B, EE, EC, FF, BB, D7),
+		  BYTES_TO_WORDS_8(26, 2C, 09, AA, BA, 4B, 94, 2F) },
+		{ BYTES_TO_WORDS_8(BE, 59, 7D, CC, E8, E8, 74, 56),
+		  BYTES_TO_WORDS_8(FB, 32, 09, 8E, 58, 18, EA, 98),
+		  BYTES_TO_WORDS_8(6B, 73, 72, 47, EE, FF, C5, 4E),
+		  BYTES_TO_WORDS_8(DA, 79, 1E, 28, 8C, 35, 13, 54),
+		  BYTES_TO_WORDS_8(90, 05, F8, E4, F6, A1, 7E, 2D),
+		  BYTES_TO_WORDS_8(67, B3, 00, C9, 15, 5B, E2, 53),
+		  BYTES_TO_WORDS_8(5A, 51, 64, 01, D2, 8F, C4, E7),
+		  BYTES_TO_WORDS_8(24, B0, 9C, 96, DE, D4, 0F, 68) },
+		{ BYTES_TO_WORDS_8(A8, 51, 60, 87, 9F, 0C, B8, 8E),
+		  BYTES_TO_WORDS_8(A5, 7E, 45, 3A, 96, 73, D7, BE),
+		  BYTES_TO_WORDS_8(80, 52, B8, C1, A3, C1, CF, 5D),
+		  BYTES_TO_WORDS_8(F0, 94, B1, 91, 26, D1, 2F, 4E),
+		  BYTES_TO_WORDS_8(05, 90, CC, E9, 4F, C7, FE, 6A),
+		  BYTES_TO_WORDS_8(2E, FE, C4, 92, A5, BA, B8, EB),
+		  BYTES_TO_WORDS_8(BC, 31, 8A, 50, A1, 35, 1B, 37),
+		  BYTES_TO_WORDS_8(B2, FB, F4, F5, DB, BB, 2A, 12) },
+		{ BYTES_TO_WORDS_8(09, 0E, A8, 56, FA, A8, 7C, 36),
+		  BYTES_TO_WORDS_8(FE, F5, 25, 66, F7, F0, 75, A2),
+		  BYTES_TO_WORDS_8(A0, 8F, C0, 13, 68, F5, 04, 20),
+		  BYTES_TO_WORDS_8(59, 1B, FF, BE, D4, 58, E7, 2D),
+		  BYTES_TO_WORDS_8(D3, 1C, 6A, 43, F5, ED, 62, 9D),
+		  BYTES_TO_WORDS_8(C9, D6, DA, 95, 66, DC, 1A, 7A),
+		  BYTES_TO_WORDS_8(A0, 64, 5E, 26, B0, 32, C0, D7),
+		  BYTES_TO_WORDS_8(67, EE, D8, 77, 31, CF, 9A, DD) },
+		{ BYTES_TO_WORDS_8(AC, 28, 36, FA, B2, 35, 50, C2),
+		  BYTES_TO_WORDS_8(4E, 56, 5B, DF, 2C, BA, 8B, 56),
+		  BYTES_TO_WORDS_8(A4, 12, EE, C6, 73, A1, C5, 28),
+		  BYTES_TO_WORDS_8(57, 4A, 1D, DC, AC, A0, 97, F5),
+		  BYTES_TO_WORDS_8(0F, 55, D3, 6C, 0D, 31, A0, 7E),
+		  BYTES_TO_WORDS_8(6E, 10, 12, D4, 91, CF, 2E, 77),
+		  BYTES_TO_WORDS_8(C0, 2C, 62, 89, 72, BB, B1, 7B),
+		  BYTES_TO_WORDS_8(55, D4, 2B, 33, 8E, 16, B9, 0D) },
+		{ BYTES_TO_WORDS_8(C3, D6, 75, AB, D4, 83, D6, 78),
+		  BYTES_TO_WORDS_8(56, 28, 3A, D5, 57, 54, 2A, C4),
+		  BYTES_TO_WORDS_8(F3, 40, BE, 21, 18, 07, A1, 08),
+		  BYTES_TO_WORDS_8(B9, 4F, F4, D6, 86, 2A, 22, AA),
+		  BYTES_TO_WORDS_8(28, B0, 4C, 64, 4E, 5A, 26, 13),
+		  BYTES_TO_WORDS_8(F6, C8, A8, B5, 94, FC, 71, 60),
+		  BYTES_TO_WORDS_8(42, DF, E2, AE, 25, 8A, 44, CE),
+		  BYTES_TO_WORDS_8(76, 8E, 1A, 00, 93, 87, 37, 56) },
+		{ BYTES_TO_WORDS_8(C9, 90, 57, 23, 39, 57, A8, 7F),
+		  BYTES_TO_WORDS_8(03, C5, F3, 73, 17, B9, 01, 9E),
+		  BYTES_TO_WORDS_8(2E, 5E, F3, 92, 43, C6, F0, 56),
+		  BYTES_TO_WORDS_8(B7, 15, 97, CD, 6B, B2, 68, 85),
+		  BYTES_TO_WORDS_8(AC, F5, B1, 26, 38, 55, 3F, DD),
+		  BYTES_TO_WORDS_8(9F, 47, 85, FB, F8, E5, 45, 01),
+		  BYTES_TO_WORDS_8(E8, 3C, 36, E4, 0A, 8E, 07, E9),
+		  BYTES_TO_WORDS_8(AD, D2, 4D, 58, 1A, 26, F2, D3) }
+	},
+	{ /* (2j + 1) * 16^59 * G */
+		{ BYTES_TO_WORDS_8(E4, D4, 38, 5C, C5, 97, DA, 7D),
+		  BYTES_TO_WORDS_8(74, 73, B1, B1, F1, 65, FD, E2),
+		  BYTES_TO_WORDS_8(25, 1E, 18, 30, 74, 6E, 56, 97),
+		  BYTES_TO_WORDS_8(38, 99, 22, 11, 26, 85, 92, 3D),
+		  BYTES_TO_WORDS_8(D3, F0, CC, C0, 00, EF, AA, 6F),
+		  BYTES_TO_WORDS_8(7F, BC, 7A, 19, 38, B1, 0A, CC),
+		  BYTES_TO_WORDS_8(EA, 69, 28, 5C, 03, 57, F0, 3F),
+		  BYTES_TO_WORDS_8(B5, EA, 68, D4, A5, A0, 2C, D3) },
+		{ BYTES_TO_WORDS_8(8A, 71, D7, 0D, 58, 32, 72, D0),
+		  BYTES_TO_WORDS_8(4E, 4E, BE, 19, 65, 1B, C8, 91),
+		  BYTES_TO_WORDS_8(F8, DF, 76, 5E, A2, 59, C1, F7),
+		  BYTES_TO_WORDS_8(C3, 2F, 90, 2B, 37, 0E, 18, 3B),
+		  BYTES_TO_WORDS_8(DB, 82, FD, 9A, 29, 26, 66, 72),
+		  BYTES_TO_WORDS_8(D0, 14, 2D, 70, 56, 11, 49, 58),
+		  BYTES_TO_WORDS_8(1E, 21, 05, 29, 9D, BC, A4, FA),
+		  BYTES_TO_WORDS_8(AA, 58, 6B, F3, 17, B1, B6, F2) },
+		{ BYTES_TO_WORDS_8(3D, 65, D3, 93, 11, A5, 81, FA),
+		  BYTES_TO_WORDS_8(D5, 67, E4, 74, B2, C4, 4E, 13),
+		  BYTES_TO_WORDS_8(B2, 3E, A8, 98, 40, 4F, EF, 45),
+		  BYTES_TO_WORDS_8(9F, 9C, D6, 91, 03, FF, 52, F3),
+		  BYTES_TO_WORDS_8(8E, F2, 44, 8A, 8C, 67, E6, 79),
+		  BYTES_TO_WORDS_8(D0, 82, C5, 72, F9, 95, 19, 5C),
+		  BYTES_TO_WORDS_8(05, D5, A6, FD, 3D, D7, 0B, 02),
+		  BYTES_TO_WORDS_8(BD, 5E, 6C, CB, 6C, 62, 72, 44) },
+		{ BYTES_TO_WORDS_8(DA, 78, 44, ED, 1A, DF, 61, D6),
+		  BYTES_TO_WORDS_8(54, 01, 0E, 24, C2, F6, 5C, F1),
+		  BYTES_TO_WORDS_8(A1, 3C, 79, BF, CD, 45, FB, 0A),
+		  BYTES_TO_WORDS_8(23, 8C, 4D, 03, 71, E4, 0E, 67),
+		  BYTES_TO_WORDS_8(F0, 63, F5, F4, 4F, FE, 8F, 62),
+		  BYTES_TO_WORDS_8(70, 47, F2, 0F, 16, B8, C3, 1C),
+		  BYTES_TO_WORDS_8(E8, 50, 87, 13, 5B, 60, 46, 25),
+		  BYTES_TO_WORDS_8(CA, 22, A0, 5B, 42, C7, A0, 5C) },
+		{ BYTES_TO_WORDS_8(81, D5, DB, 43, 04, 29, 4E, AC),
+		  BYTES_TO_WORDS_8(5B, B3, D6, 28, 88, B3, FE, 3C),
+		  BYTES_TO_WORDS_8(A9, 6F, EC, AC, 30, FA, BB, EF),
+		  BYTES_TO_WORDS_8(DB, 9B, 9D, 34, 54, E3, F2, 96),
+		  BYTES_TO_WORDS_8(52, 99, F5, E8, FE, 4F, 9A, 4D),
+		  BYTES_TO_WORDS_8(45, 5D, 4F, 50, 1D, 8F, A1, 35),
+		  BYTES_TO_WORDS_8(F4, BA, 0D, 96, E3, D8, E5, 4F),
+		  BYTES_TO_WORDS_8(CF, 26, D5, 85, 08, D8, FC, 09) },
+		{ BYTES_TO_WORDS_8(FC, C2, E9, A4, 24, 43, B3, 1E),
+		  BYTES_TO_WORDS_8(6A, 70, BD, 2F, CF, F0, 2C, E7),
+		  BYTES_TO_WORDS_8(35, 9A, 60, 14, 0B, 82, 41, 80),
+		  BYTES_TO_WORDS_8(AC, 99, 83, 7E, 51, 6E, 94, C4),
+		  BYTES_TO_WORDS_8(E8, 8C, 39, 66, 37, 76, 34, 34),
+		  BYTES_TO_WORDS_8(12, 23, 46, D1, 8E, F3, 8B, E4),
+		  BYTES_TO_WORDS_8(37, 82, 7B, F4, 68, 0F, 9A, E9),
+		  BYTES_TO_WORDS_8(4C, 8A, 85, B1, 20, 01, 89, 74) },
+		{ BYTES_TO_WORDS_8(03, 0B, 96, 84, 3E, 17, B9, 5C),
+		  BYTES_TO_WORDS_8(8F, 8E, 80, C8, B0, 3A, AC, B6),
+		  BYTES_TO_WORDS_8(8F, 4D, 09, 78, C5, C8, 48, FA),
+		  BYTES_TO_WORDS_8(DB, 33, BE, A9, 4D, B6, 53, 16),
+		  BYTES_TO_WORDS_8(69, 3C, F7, B0, 4E, A5, 06, F8),
+		  BYTES_TO_WORDS_8(E7, 64, B5, A1, E4, E0, 38, 8B),
+		  BYTES_TO_WORDS_8(94, A8, 95, 3E, D8, 2B, 4B, 9F),
+		  BYTES_TO_WORDS_8(60, D5, E5, 69, 81, 70, 83, A5) },
+		{ BYTES_TO_WORDS_8(0E, 64, 63, BB, 31, 7E, 57, C5),
+		  BYTES_TO_WORDS_8(F2, 2D, C7, 90, F2, B7, 9B, 97),
+		  BYTES_TO_WORDS_8(F4, CB, 85, A6, 9C, 67, 0C, 50),
+		  BYTES_TO_WORDS_8(3F, 15, 2F, ED, D7, 6D, 07, 51),
+		  BYTES_TO_WORDS_8(6C, 47, E4, 82, 87, 72, 69, 1F),
+		  BYTES_TO_WORDS_8(02, EF, 20, E7, E9, A4, BE, C8),
+		  BYTES_TO_WORDS_8(A6, FD, E0, 72, 01, 65, BE, AE),
+		  BYTES_TO_WORDS_8(76, DF, 6D, 2D, 4A, 27, 97, B3) }
+	},
+	{ /* (2j + 1) * 16^60 * G */
+		{ BYTES_TO_WORDS_8(E3, 8D, 4E, A4, B1, 04, 63, 60),
+		  BYTES_TO_WORDS_8(07, 1E, CC, 2E, 6A, 96, 08, 5C),
+		  BYTES_TO_WORDS_8(91, 17, BD, 08, CF, 7D, 5A, 3A),
+		  BYTES_TO_WORDS_8(B7, 10, 88, 46, B7, 99, 0B, F5),
+		  BYTES_TO_WORDS_8(88, 35, 7F, DB, A6, 3B, 3F, 4A),
+		  BYTES_TO_WORDS_8(85, 1E, 72, 21, 8D, F1, 75, E9),
+		  BYTES_TO_WORDS_8(BB, CE, ED, 2D, 3A, 97, 89, 87),
+		  BYTES_TO_WORDS_8(0C, 8F, F1, 55, 1E, 06, B5, E2) },
+		{ BYTES_TO_WORDS_8(8B, CF, AC, 82, 6B, 6B, DC, DD),
+		  BYTES_TO_WORDS_8(A7, 6F, 81, 82, 91, 99, D2, 81),
+		  BYTES_TO_WORDS_8(04, 43, 39, 51, E2, 30, 5F, 64),
+		  BYTES_TO_WORDS_8(70, 57, 50, A5, 61, 7F, 8D, 59),
+		  BYTES_TO_WORDS_8(08, B8, 6C, 0F, 3C, 67, 84, 1B),
+		  BYTES_TO_WORDS_8(B9, 40, 35, 35, 8F, 9A, 28, D2),
+		  BYTES_TO_WORDS_8(CA, EB, 73, B2, 62, 51, 6C, 54),
+		  BYTES_TO_WORDS_8(09, 26, 8F, 4F, F7, 21, 31, 9F) },
+		{ BYTES_TO_WORDS_8(3E, 7B, AA, 64, 54, 9A, B3, 9F),
+		  BYTES_TO_WORDS_8(EA, 9C, 6C, 05, 1B, EF, C4, 13),
+		  BYTES_TO_WORDS_8(10, 58, 1C, 54, 91, 20, FD, 64),
+		  BYTES_TO_WORDS_8(4D, 4C, 9F, F4, 12, 20, 5A, 71),
+		  BYTES_TO_WORDS_8(1D, 08, 7D, BC, 44, 39, A3, D9),
+		  BYTES_TO_WORDS_8(D0, 47, 8B, A8, 88, C5, 1B, 42),
+		  BYTES_TO_WORDS_8(62, 3B, 91, 8A, 8F, 28, 79, 1F),
+		  BYTES_TO_WORDS_8(0A, 6C, 60, AA, B1, B3, 22, 59) },
+		{ BYTES_TO_WORDS_8(20, B2, 0D, 62, 97, B6, BD, D1),
+		  BYTES_TO_WORDS_8(E4, AC, 87, 16, 10, CB, 1C, C7),
+		  BYTES_TO_WORDS_8(76, 78, B8, 7F, 89, CE, 09, C4),
+		  BYTES_TO_WORDS_8(25, B1, A9, 6A, 5E, 8C, EC, 49),
+		  BYTES_TO_WORDS_8(C2, 38, 73, 67, A0, AC, B8, 99),
+		  BYTES_TO_WORDS_8(CE, 9C, 3B, E5, 73, 30, 2C, 84),
+		  BYTES_TO_WORDS_8(29, 54, 5F, 86, 34, CC, A9, 3D),
+		  BYTES_TO_WORDS_8(9B, 62, EA, E5, 4F, 7D, A9, 99) },
+		{ BYTES_TO_WORDS_8(68, 12, 77, 5E, 31, CA, EB, 51),
+		  BYTES_TO_WORDS_8(68, 65, 0A, D9, A7, 14, 4F, 2F),
+		  BYTES_TO_WORDS_8(7A, 7B, E0, 05, 0E, 19, 6F, 3E),
+		  BYTES_TO_WORDS_8(48, B4, 50, 48, 0D, B7, 8F, 1F),
+		  BYTES_TO_WORDS_8(DD, C8, 09, C9, 10, 30, FD, 1A),
+		  BYTES_TO_WORDS_8(AB, B3, 92, 1C, 31, 3C, 1D, 4E),
+		  BYTES_TO_WORDS_8(A1, 92, 61, 72, 74, ED, C2, 12),
+		  BYTES_TO_WORDS_8(BF, A2, 1B, 46, DB, 7A, 3E, F5) },
+		{ BYTES_TO_WORDS_8(9E, 81, D9, 28, 2B, 0F, EC, 55),
+		  BYTES_TO_WORDS_8(1A, AB, 2D, 74, 2F, 79, 06, D6),
+		  BYTES_TO_WORDS_8(2C, 73, 78, A6, 2B, 14, 5D, DD),
+		  BYTES_TO_WORDS_8(1F, F6, 97, 64, 1A, C7, D5, B8),
+		  BYTES_TO_WORDS_8(C4, 8A, 13, A9, 8E, BE, 78, DC),
+		  BYTES_TO_WORDS_8(3C, 5C, D4, 61, 13, 9F, F4, E2),
+		  BYTES_TO_WORDS_8(79, DC, 63, 9B, 35, E4, 6E, 3B),
+		  BYTES_TO_WORDS_8(82, 7F, 13, 32, F1, 4E, D1, 1C) },
+		{ BYTES_TO_WORDS_8(F3, A3, BC, 60, E6, DB, 93, 6A),
+		  BYTES_TO_WORDS_8(90, 04, 60, 45, 51, 43, B3, EC),
+		  BYTES_TO_WORDS_8(C4, D8, 80, C8, 61, EB, 63, DD),
+		  BYTES_TO_WORDS_8(3D, AE, BA, 65, AC, B5, 65, 22),
+		  BYTES_TO_WORDS_8(FF, 09, 74, 51, 6C, 9C, 82, 25),
+		  BYTES_TO_WORDS_8(5A, 3D, 39, D2, 12, A6, 80, 3C),
+		  BYTES_TO_WORDS_8(98, 64, 09, B1, A3, 13, A3, 61),
+		  BYTES_TO_WORDS_8(0F, FE, AC, 5C, BF, 98, A1, 97) },
+		{ BYTES_TO_WORDS_8(6E, C3, BA, 45, FF, 23, 2D, 37),
+		  BYTES_TO_WORDS_8(D0, DC, 75, 99, 45, 99, 98, 59),
+		  BYTES_TO_WORDS_8(CB, AB, C9, 5F, 9F, 8A, FD, 21),
+		  BYTES_TO_WORDS_8(25, 49, 58, 03, D1, 1C, 38, AF),
+		  BYTES_TO_WORDS_8(A9, 19, B1, B1, 7A, 88, 3D, FF),
+		  BYTES_TO_WORDS_8(90, 4A, 4D, EF, F1, 82, 9B, 58),
+		  BYTES_TO_WORDS_8(48, 26, 1A, 95, 22, 7F, 45, C9),
+		  BYTES_TO_WORDS_8(BD, 0F, DF, B7, 7F, 08, 1A, 68) }
+	},
+	{ /* (2j + 1) * 16^61 * G */
+		{ BYTES_TO_WORDS_8(B4, CF, 37, 60, 05, 94, 19, 9E),
+		  BYTES_TO_WORDS_8(85, AA, CD, C3, 46, F2, 00, 74),
+		  BYTES_TO_WORDS_8(E0, B0, A0, 0D, 88, F4, 77, 0D),
+		  BYTES_TO_WORDS_8(0B, ED, F5, 3F, 82, 31, 25, 04),
+		  BYTES_TO_WORDS_8(23, 5D, 77, D8, 5E, 32, B7, 00),
+		  BYTES_TO_WORDS_8(D4, 5D, EC, 34, F5, E4, A3, EE),
+		  BYTES_TO_WORDS_8(AC, 1F, 66, C8, D0, A4, 8C, 62),
+		  BYTES_TO_WORDS_8(7E, 0F, E0, FA, CC, 8B, 0E, C9) },
+		{ BYTES_TO_WORDS_8(77, 45, C3, 46, 35, 67, 4F, 78),
+		  BYTES_TO_WORDS_8(F7, 2A, A5, E6, C8, 9E, 40, E6),
+		  BYTES_TO_WORDS_8(BD, E4, C0, E8, 08, E3, F5, B1),
+		  BYTES_TO_WORDS_8(48, CA, 0B, E3, A0, 7A, 55, 27),
+		  BYTES_TO_WORDS_8(3C, 19, 16, 04, B8, B9, FE, AD),
+		  BYTES_TO_WORDS_8(0B, 38, C4, 74, 73, CA, A2, 18),
+		  BYTES_TO_WORDS_8(F3, 34, FD, 49, 5A, D7, C8, 77),
+		  BYTES_TO_WORDS_8(3B, 5B, 10, 46, 58, C7, 99, 83) },
+		{ BYTES_TO_WORDS_8(D3, F4, 01, A4, B6, FD, 58, EE),
+		  BYTES_TO_WORDS_8(01, B3, 95, EA, 50, 2E, 6C, CF),
+		  BYTES_TO_WORDS_8(DE, D7, 61, F5, 3B, 78, 50, 8E),
+		  BYTES_TO_WORDS_8(64, 73, 58, D2, 17, 78, 68, 8E),
+		  BYTES_TO_WORDS_8(6B, D8, 94, 42, 94, 1E, 28, 90),
+		  BYTES_TO_WORDS_8(28, 91, A1, 2E, F1, 96, 0B, 90),
+		  BYTES_TO_WORDS_8(AE, 3C, 6D, 50, A0, 09, F8, 62),
+		  BYTES_TO_WORDS_8(FA, 9B, 2C, 6E, 88, AB, 9C, 98) },
+		{ BYTES_TO_WORDS_8(E6, A8, 2A, 6D, E2, 3D, 96, C5),
+		  BYTES_TO_WORDS_8(2D, FE, EF, 40, FC, 59, 53, 20),
+		  BYTES_TO_WORDS_8(EE, DB, 67, CA, 03, 68, 03, D1),
+		  BYTES_TO_WORDS_8(F6, 5C, 3E, 25, 46, 17, A4, 98),
+		  BYTES_TO_WORDS_8(5B, F7, 6C, 60, ED, 0B, 74, 69),
+		  BYTES_TO_WORDS_8(19, D2, 7E, AB, FA, 17, 02, E3),
+		  BYTES_TO_WORDS_8(C9, CE, F5, A2, F5, 42, 15, B1),
+		  BYTES_TO_WORDS_8(D6, 63, 34, 7E, 94, C6, 9A, 57) },
+		{ BYTES_TO_WORDS_8(31, 2D, 2C, 75, 8F, CC, A2, 7C),
+		  BYTES_TO_WORDS_8(CD, EE, 61, 8C, B0, AB, 00, 18),
+		  BYTES_TO_WORDS_8(46, A9, 21, 3E, 44, 6E, 21, 92),
+		  BYTES_TO_WORDS_8(FD, 40, 05, 23, 42, 54, 68, E1),
+		  BYTES_TO_WORDS_8(EC, 0F, A5, 24, 68, 83, B8, 1C),
+		  BYTES_TO_WORDS_8(94, 83, 99, F8, 2B, 19, 76, 3E),
+		  BYTES_TO_WORDS_8(34, C9, 2B, D0, 42, E6, B2, 2F),
+		  BYTES_TO_WORDS_8(14, 72, 8E, 92, 5C, 85, 00, 07) },
+		{ BYTES_TO_WORDS_8(AD, CD, A7, 73, E3, BA, 33, 4A),
+		  BYTES_TO_WORDS_8(AF, CF, 0B, E5, D2, 83, AD, 3C),
+		  BYTES_TO_WORDS_8(A5, 51, 89, 33, E5, A2, A2, 1C),
+		  BYTES_TO_WORDS_8(EA, 13, D5, 09, 4B, 31, A6, BF),
+		  BYTES_TO_WORDS_8(53, B9, 5C, 29, 30, 89, F8, C5),
+		  BYTES_TO_WORDS_8(A1, 47, 40, C8, F8, 90, 11, 26),
+		  BYTES_TO_WORDS_8(A7, D1, EE, B1, BB, 85, 5F, 2A),
+		  BYTES_TO_WORDS_8(78, 2C, 80, 4C, 19, E8, 52, B4) },
+		{ BYTES_TO_WORDS_8(B7, 0F, DE, 0A, 50, C8, BC, ED),
+		  BYTES_TO_WORDS_8(D8, 18, 65, EA, 4D, C7, 6D, 0C),
+		  BYTES_TO_WORDS_8(20, 8E, D9, 6D, 5E, 97, F0, EC),
+		  BYTES_TO_WORDS_8(D3, 1C, 96, 0A, 2D, 08, 87, E6),
+		  BYTES_TO_WORDS_8(CE, 6E, 4D, 1D, F3, E0, 79, 91),
+		  BYTES_TO_WORDS_8(59, 22, 8C, F8, 5E, E8, C1, 17),
+		  BYTES_TO_WORDS_8(21, A7, D1, 21, 53, 0E, 5F, 5E),
+		  BYTES_TO_WORDS_8(55, 95, 4C, 68, 48, A4, 35, 21) },
+		{ BYTES_TO_WORDS_8(AF, 2D, 43, CE, F0, B5, 3C, C8),
+		  BYTES_TO_WORDS_8(C9, 7A, 82, AA, 08, DA, BE, F3),
+		  BYTES_TO_WORDS_8(75, 49, 07, 95, D7, 28, FC, 4B),
+		  BYTES_TO_WORDS_8(E9, A9, A9, 62, F8, 6E, B1, 7A),
+		  BYTES_TO_WORDS_8(48, DC, 1B, A7, 8A, 58, 17, 31),
+		  BYTES_TO_WORDS_8(01, DB, 4F, E7, 3A, CE, E9, C7),
+		  BYTES_TO_WORDS_8(C5, A7, DB, 28, 3E, 18, 59, A3),
+		  BYTES_TO_WORDS_8(B1, 28, C3, 97, 0A, 0E, 4E, 58) }
+	},
+	{ /* (2j + 1) * 16^62 * G */
+		{ BYTES_TO_WORDS_8(44, BD, 5F, 88, 29, 71, 74, C0),
+		  BYTES_TO_WORDS_8(7A, 26, 26, 9F, A3, CA, C2, 89),
+		  BYTES_TO_WORDS_8(2C, 22, D5, 16, CE, 71, 54, E0),
+		  BYTES_TO_WORDS_8(05, 59, AB, D9, DA, 06, BF, 9B),
+		  BYTES_TO_WORDS_8(88, 3E, 1D, 7A, FA, 7D, 44, A3),
+		  BYTES_TO_WORDS_8(D2, 6E, 03, 15, DC, BD, D4, C0),
+		  BYTES_TO_WORDS_8(E8, 47, 6F, 0A, F3, DA, 55, 67),
+		  BYTES_TO_WORDS_8(A3, 20, E1, 4D, A8, 7F, CC, 1B) },
+		{ BYTES_TO_WORDS_8(06, B5, A7, B4, 92, E7, 7A, 8B),
+		  BYTES_TO_WORDS_8(E0, 0B, 86, E7, BA, 8B, 75, 22),
+		  BYTES_TO_WORDS_8(E9, 0E, 50, E7, 2A, FB, 9C, 42),
+		  BYTES_TO_WORDS_8(D3, 5B, 3B, 5B, F6, F7, 6F, 64),
+		  BYTES_TO_WORDS_8(46, F9, 36, 2B, 25, C1, 79, C9),
+		  BYTES_TO_WORDS_8(95, 69, 8E, C0, 4F, FC, 2D, 49),
+		  BYTES_TO_WORDS_8(E8, 8F, 4A, 80, 31, E3, 61, 5A),
+		  BYTES_TO_WORDS_8(A5, 18, 4A, 06, 9D, 2A, 11, BC) },
+		{ BYTES_TO_WORDS_8(53, B5, 03, C1, C9, 71, 4B, 15),
+		  BYTES_TO_WORDS_8(80, 5A, 38, 83, 27, EA, 60, BE),
+		  BYTES_TO_WORDS_8(7E, 50, 7E, B2, 00, 10, 0C, 9D),
+		  BYTES_TO_WORDS_8(9A, D3, 17, A6, 7A, 54, C0, 7C),
+		  BYTES_TO_WORDS_8(26, A5, 45, CD, A3, CB, 99, 57),
+		  BYTES_TO_WORDS_8(7D, 8B, 22, AC, 0A, 5A, 18, 00),
+		  BYTES_TO_WORDS_8(C4, 94, FC, 39, CB, 28, D7, BD),
+		  BYTES_TO_WORDS_8(5A, 04, 28, 23, BD, 9E, 32, 7B) },
+		{ BYTES_TO_WORDS_8(A4, 17, E7, 19, 54, F4, 2E, AC),
+		  BYTES_TO_WORDS_8(81, 1B, F0, AC, DA, 2B, DA, 68),
+		  BYTES_TO_WORDS_8(54, E1, AE, 6D, 53, ED, 63, 05),
+		  BYTES_TO_WORDS_8(4E, DB, C1, 0B, 99, 51, 68, 94),
+		  BYTES_TO_WORDS_8(A3, DE, 26, B5, D1, 0F, 5F, A7),
+		  BYTES_TO_WORDS_8(9C, CD, 0A, F7, 90, 95, 99, 57),
+		  BYTES_TO_WORDS_8(C0, 7D, 66, B2, E6, D0, B8, B3),
+		  BYTES_TO_WORDS_8(A8, 91, C5, 0D, 42, 78, 5C, CA) },
+		{ BYTES_TO_WORDS_8(35, 27, 36, 08, 6F, C3, 82, DF),
+		  BYTES_TO_WORDS_8(7B, 32, 2B, F1, 7E, B3, F8, DF),
+		  BYTES_TO_WORDS_8(F5, D1, 52, A4, 8E, 8F, 25, B1),
+		  BYTES_TO_WORDS_8(FA, E8, E0, E7, 1B, 8F, B9, E1),
+		  BYTES_TO_WORDS_8(B7, 11, CB, CE, C9, 38, 61, F9),
+		  BYTES_TO_WORDS_8(0A, 09, 74, DF, 33, EE, 19, 7E),
+		  BYTES_TO_WORDS_8(A2, 2B, BB, 83, 9A, B4, 05, 7E),
+		  BYTES_TO_WORDS_8(0B, 6A, 97, 9A, AD, E9, 83, CA) },
+		{ BYTES_TO_WORDS_8(46, 63, 04, 39, D8, BB, 40, 3B),
+		  BYTES_TO_WORDS_8(08, 40, 14, 30, E7, 8D, A5, 56),
+		  BYTES_TO_WORDS_8(2D, 96, 67, D9, 6B, A0, 08, 6D),
+		  BYTES_TO_WORDS_8(EF, 07, D6, 8F, 5C, F2, 36, 35),
+		  BYTES_TO_WORDS_8(A6, FE, 14, CC, 2B, 06, 01, 94),
+		  BYTES_TO_WORDS_8(E2, B3, D9, A2, 1E, 3D, 6C, 9E),
+		  BYTES_TO_WORDS_8(C3, E1, 29, A5, A1, 16, BA, 73),
+		  BYTES_TO_WORDS_8(9E, 50, E3, 7D, E1, 1F, 27, 1E) },
+		{ BYTES_TO_WORDS_8(F8, F6, 47, 68, ED, 83, FF, 0F),
+		  BYTES_TO_WORDS_8(53, EF, 40, BD, 1F, B5, 29, 10),
+		  BYTES_TO_WORDS_8(3C, 8C, 7F, 4B, F3, 51, 01, 69),
+		  BYTES_TO_WORDS_8(DE, D4, 23, BE, 46, 02, F5, 0D),
+		  BYTES_TO_WORDS_8(A6, 33, 16, BB, A6, A8, CC, B4),
+		  BYTES_TO_WORDS_8(49, 34, DF, 89, 66, 16, 6E, 4C),
+		  BYTES_TO_WORDS_8(AB, 74, 21, BC, 4F, 2C, 23, 2B),
+		  BYTES_TO_WORDS_8(CA, F1, DA, 29, 7F, 04, 07, 21) },
+		{ BYTES_TO_WORDS_8(81, 1B, 4F, FD, ED, EA, 5C, 18),
+		  BYTES_TO_WORDS_8(15, BB, F4, 8C, A4, A7, 69, AD),
+		  BYTES_TO_WORDS_8(30, 93, 52, 36, B3, E3, 9D, F6),
+		  BYTES_TO_WORDS_8(98, 33, F5, 4C, D4, D5, 9D, CA),
+		  BYTES_TO_WORDS_8(BD, C8, B7, 42, AE, 2C, C6, 8C),
+		  BYTES_TO_WORDS_8(0F, A1, AD, FA, 0B, 76, C9, 66),
+		  BYTES_TO_WORDS_8(3E, 7B, 46, 44, FB, 71, 24, 40),
+		  BYTES_TO_WORDS_8(56, 2C, BE, 51, 86, 98, 4B, 6E) }
+	},
+	{ /* (2j + 1) * 16^63 * G */
+		{ BYTES_TO_WORDS_8(48, 04, 4C, 44, 33, 32, AD, 1E),
+		  BYTES_TO_WORDS_8(E3, 19, 03, C1, 86, 76, 35, 96),
+		  BYTES_TO_WORDS_8(E7, 93, 78, 3B, CB, FC, 43, 49),
+		  BYTES_TO_WORDS_8(A5, DF, 43, 29, F5, AD, 2F, B1),
+		  BYTES_TO_WORDS_8(57, DE, 69, B3, 76, 5E, 57, 96),
+		  BYTES_TO_WORDS_8(F2, 4D, FC, 32, 03, E7, 05, 1D),
+		  BYTES_TO_WORDS_8(A7, A6, B2, 77, 66, 8F, 6F, E9),
+		  BYTES_TO_WORDS_8(AC, F4, B0, 99, 95, 45, E2, 02) },
+		{ BYTES_TO_WORDS_8(1F, 15, E9, 64, 54, C4, 36, F5),
+		  BYTES_TO_WORDS_8(18, 84, 0D, C8, 99, 33, EA, 67),
+		  BYTES_TO_WORDS_8(3E, FB, D8, 91, DA, 5D, 25, 43),
+		  BYTES_TO_WORDS_8(68, 05, C5, F1, 34, 8E, 38, 48),
+		  BYTES_TO_WORDS_8(34, 94, 7A, CD, ED, 49, EE, 1B),
+		  BYTES_TO_WORDS_8(10, 83, DE, 53, 11, 41, B1, 99),
+		  BYTES_TO_WORDS_8(CC, 2B, 48, 15, 93, 33, 25, 6A),
+		  BYTES_TO_WORDS_8(9E, 4E, E4, F4, AB, 63, EC, B0) },
+		{ BYTES_TO_WORDS_8(3D, 83, 5B, 8E, A5, B4, DF, D7),
+		  BYTES_TO_WORDS_8(19, 24, 0B, CA, 73, 00, 3A, 59),
+		  BYTES_TO_WORDS_8(C9, 09, 01, 05, 81, DF, 65, 5E),
+		  BYTES_TO_WORDS_8(DA, 53, 14, AE, 47, 64, 8E, DE),
+		  BYTES_TO_WORDS_8(C7, 5C, 4C, A1, 9A, C1, FC, F0),
+		  BYTES_TO_WORDS_8(C9, C6, 01, 29, 13, 03, 7E, 98),
+		  BYTES_TO_WORDS_8(65, E2, 6D, BD, 8C, 28, 32, E3),
+		  BYTES_TO_WORDS_8(D8, 13, 09, 15, 3C, 46, E1, 05) },
+		{ BYTES_TO_WORDS_8(48, DF, F7, C1, EA, 93, 25, 3E),
+		  BYTES_TO_WORDS_8(7B, 31, 71, B8, 3E, 47, 67, B2),
+		  BYTES_TO_WORDS_8(85, F3, 58, 4E, 4E, 5B, 55, 8E),
+		  BYTES_TO_WORDS_8(9E, 7E, EC, A4, D0, 12, 8B, B1),
+		  BYTES_TO_WORDS_8(46, B5, 46, E8, 90, D5, B3, 91),
+		  BYTES_TO_WORDS_8(59, E5, D1, 83, E4, F7, 83, 3C),
+		  BYTES_TO_WORDS_8(3B, C3, AC, C5, 6B, 42, EC, 5C),
+		  BYTES_TO_WORDS_8(44, FB, 59, A3, 22, 19, 53, FF) },
+		{ BYTES_TO_WORDS_8(24, FD, C9, 99, C6, AD, 53, F2),
+		  BYTES_TO_WORDS_8(0D, 1E, 21, 45, 98, D8, CD, 02),
+		  BYTES_TO_WORDS_8(44, 69, 28, C7, A4, CA, C1, C7),
+		  BYTES_TO_WORDS_8(33, 94, DC, C8, 71, AD, 51, 5F),
+		  BYTES_TO_WORDS_8(3A, FD, 2F, 6D, 88, AE, 3B, 9C),
+		  BYTES_TO_WORDS_8(96, A9, 24, 46, 24, F6, 21, 87),
+		  BYTES_TO_WORDS_8(03, 4D, 2E, CC, FB, 05, D3, 0C),
+		  BYTES_TO_WORDS_8(4A, 71, 7E, DF, 11, EF, BB, 2B) },
+		{ BYTES_TO_WORDS_8(2E, C4, CE, D7, 3F, 06, C4, E3),
+		  BYTES_TO_WORDS_8(B7, BD, E3, EE, 33, C9, 3D, 6F),
+		  BYTES_TO_WORDS_8(55, D8, 46, 43, EE, 22, 58, FA),
+		  BYTES_TO_WORDS_8(BB, 1E, 30, 37, D9, 40, F3, FD),
+		  BYTES_TO_WORDS_8(8B, 90, B6, CD, B7, 34, F6, 38),
+		  BYTES_TO_WORDS_8(C8, 30, DE, 50, BF, 6A, 6E, 45),
+		  BYTES_TO_WORDS_8(C4, D2, CA, 38, E7, 1F, 0C, D7),
+		  BYTES_TO_WORDS_8(E1, C6, 8C, 96, 63, 9A, E5, A3) },
+		{ BYTES_TO_WORDS_8(E8, 4F, DC, E1, 54, 94, 18, FC),
+		  BYTES_TO_WORDS_8(15, 24, 07, 96, 3A, A1, E8, F9),
+		  BYTES_TO_WORDS_8(83, C9, 7D, 7B, 91, 52, 64, EC),
+		  BYTES_TO_WORDS_8(79, 5D, EA, B9, C8, EB, CA, E3),
+		  BYTES_TO_WORDS_8(03, B4, 07, 13, 72, 0B, B6, 16),
+		  BYTES_TO_WORDS_8(A1, 86, 4F, A1, 65, 03, 30, 51),
+		  BYTES_TO_WORDS_8(76, F9, 01, 8B, CB, 35, 20, D2),
+		  BYTES_TO_WORDS_8(28, 59, F0, 7B, D2, 93, F0, 97) },
+		{ BYTES_TO_WORDS_8(FF, 9E, 11, 3C, 5D, D6, 14, 64),
+		  BYTES_TO_WORDS_8(84, 9B, 9F, 0A, 0C, 2E, 90, 39),
+		  BYTES_TO_WORDS_8(03, A0, 8F, E5, 5C, 1A, F4, 9A),
+		  BYTES_TO_WORDS_8(B8, 65, A8, 42, B9, 2D, 31, 03),
+		  BYTES_TO_WORDS_8(50, B9, B1, F8, A9, A3, 95, FE),
+		  BYTES_TO_WORDS_8(85, 55, 51, 5F, DB, 59, EC, 0A),
+		  BYTES_TO_WORDS_8(6F, E8, 09, 78, 31, EA, 4E, 10),
+		  BYTES_TO_WORDS_8(DF, 24, 37, 6B, 64, DA, 3E, 6E) }
+	}
+};
+
+#endif /* __TC_ECC_SECP256R1_TABLE_H__ */
@@ -0,0 +1,146 @@
+/* ecc_x25519.c - TinyCrypt implementation of X25519 key agreement */
+
+/*
+ *  Copyright (C) 2017 by Intel Corporation, All Rights Reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *    - Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *    - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ *    - Neither the name of Intel Corporation nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <tinycrypt/constants.h>
+#include <tinycrypt/ecc.h>
+#include <tinycrypt/ecc_x25519.h>
+#include <tinycrypt/utils.h>
+#include <string.h>
+
+#include "ecc_fe25519.h"
+
+int uECC_x25519(uint_least8_t *out, const uint_least8_t *scalar,
+		const uint_least8_t *u)
+{
+	uint_least8_t k[uECC_X25519_KEY_SIZE];
+	fe x1, x2, z2, x3, z3;
+	fe a, aa, b, bb, e, c, d;
+	uint64_t swap = 0;
+	uint64_t bit;
+	uint_least8_t nonzero = 0;
+	int t;
+
+	memcpy(k, scalar, sizeof(k));
+	k[0] &= 248;
+	k[31] &= 127;
+	k[31] |= 64;
+
+	fe_frombytes(x1, u);
+	fe_one(x2);
+	memset(z2, 0, sizeof(z2));
+	memcpy(x3, x1, sizeof(x3));
+	fe_one(z3);
+
+	/* Montgomery ladder (RFC 7748, section 5): */
+	for (t = 254; t >= 0; --t) {
+		bit = (k[t >> 3] >> (t & 7)) & 1;
+		swap ^= bit;
+		fe_cswap(x2, x3, swap);
+		fe_cswap(z2, z3, swap);
+		swap = bit;
+
+		fe_add(a, x2, z2);
+		fe_sub(b, x2, z2);
+		fe_add(c, x3, z3);
+		fe_sub(d, x3, z3);
+		fe_sq(aa, a);
+		fe_sq(bb, b);
+		fe_mul(d, d, a);          /* DA */
+		fe_mul(c, c, b);          /* CB */
+		fe_sub(e, aa, bb);
+		fe_add(a, d, c);
+		fe_sub(b, d, c);
+		fe_sq(x3, a);
+		fe_sq(b, b);
+		fe_mul(z3, x1, b);
+		fe_mul(x2, aa, bb);
+		fe_mul_a24(a, e);
+		fe_add(a, aa, a);
+		fe_mul(z2, e, a);
+	}
+	fe_cswap(x2, x3, swap);
+	fe_cswap(z2, z3, swap);
+
+	fe_invert(z2, z2);
+	fe_mul(x2, x2, z2);
+	fe_tobytes(out, x2);
+
+	_set_secure(k, 0, sizeof(k));
+	_set_secure(x2, 0, sizeof(x2));
+	_set_secure(z2, 0, sizeof(z2));
+	_set_secure(x3, 0, sizeof(x3));
+	_set_secure(z3, 0, sizeof(z3));
+
+	/* a zero result means u was a point of small order: */
+	for (t = 0; t < uECC_X25519_KEY_SIZE; ++t) {
+		nonzero |= out[t];
+	}
+	return nonzero != 0 ? TC_CRYPTO_SUCCESS : TC_CRYPTO_FAIL;
+}
+
+int uECC_x25519_make_key_ctx(const uECC_Ctx *ctx, uint_least8_t *public_key,
+			     uint_least8_t *private_key)
+{
+	static const uint_least8_t base_point[uECC_X25519_KEY_SIZE] = {9};
+
+	if (public_key == (uint_least8_t *) 0 ||
+	    private_key == (uint_least8_t *) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	if (!uECC_ctx_random(ctx, private_key, uECC_X25519_KEY_SIZE)) {
+		return TC_CRYPTO_FAIL;
+	}
+	return uECC_x25519(public_key, private_key, base_point);
+}
+
+int uECC_x25519_make_key(uint_least8_t *public_key, uint_least8_t *private_key)
+{
+	return uECC_x25519_make_key_ctx(0, public_key, private_key);
+}
+
+int uECC_x25519_shared_secret(const uint_least8_t *public_key,
+			      const uint_least8_t *private_key,
+			      uint_least8_t *secret)
+{
+	if (public_key == (const uint_least8_t *) 0 ||
+	    private_key == (const uint_least8_t *) 0 ||
+	    secret == (uint_least8_t *) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	if (!uECC_x25519(secret, private_key, public_key)) {
+		_set_secure(secret, 0, uECC_X25519_KEY_SIZE);
+		return TC_CRYPTO_FAIL;
+	}
+	return TC_CRYPTO_SUCCESS;
+}
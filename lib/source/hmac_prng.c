@@ -72,6 +72,20 @@ static const uint32_t MAX_GENS = UINT32_MAX;
  */
 static const uint32_t  MAX_OUT = ((uint32_t)1 << 19);
 
+/*
+ * Assumes: prng != NULL
+ */
+static void step(TCHmacPrng_t prng)
+{
+	/* configure the new prng key into the prng's instance of hmac */
+	(void)tc_hmac_set_key(&prng->h, prng->key, sizeof(prng->key));
+
+	/* V = HMAC_K(V) */
+	(void)tc_hmac_init(&prng->h);
+	(void)tc_hmac_update(&prng->h, prng->v, sizeof(prng->v));
+	(void)tc_hmac_final(prng->v, sizeof(prng->v), &prng->h);
+}
+
 /*
  * Assumes: prng != NULL
  */
@@ -95,13 +109,8 @@ static void update(TCHmacPrng_t prng, const uint_least8_t *data, uint32_t datale
 
 	(void)tc_hmac_final(prng->key, sizeof(prng->key), &prng->h);
 
-	/* configure the new prng key into the prng's instance of hmac */
-	(void)tc_hmac_set_key(&prng->h, prng->key, sizeof(prng->key));
-
 	/* use the new key to compute a new state variable v */
-	(void)tc_hmac_init(&prng->h);
-	(void)tc_hmac_update(&prng->h, prng->v, sizeof(prng->v));
-	(void)tc_hmac_final(prng->v, sizeof(prng->v), &prng->h);
+	step(prng);
 
 	if (data == 0 || datalen == 0)
 		return;
@@ -118,13 +127,8 @@ static void update(TCHmacPrng_t prng, const uint_least8_t *data, uint32_t datale
 		(void)tc_hmac_update(&prng->h, additional_data, additional_datalen);
 	(void)tc_hmac_final(prng->key, sizeof(prng->key), &prng->h);
 
-	/* configure the new prng key into the prng's instance of hmac */
-	(void)tc_hmac_set_key(&prng->h, prng->key, sizeof(prng->key));
-
 	/* use the new key to compute a new state variable v */
-	(void)tc_hmac_init(&prng->h);
-	(void)tc_hmac_update(&prng->h, prng->v, sizeof(prng->v));
-	(void)tc_hmac_final(prng->v, sizeof(prng->v), &prng->h);
+	step(prng);
 }
 
 int tc_hmac_prng_init(TCHmacPrng_t prng,
@@ -189,6 +193,91 @@ int tc_hmac_prng_reseed(TCHmacPrng_t prng,
 	return TC_CRYPTO_SUCCESS;
 }
 
+int tc_hmac_prng_instantiate_prefix(struct tc_hmac_state_struct *prefix,
+				    const uint_least8_t *seed,
+				    uint32_t seedlen)
+{
+	const uint_least8_t separator0 = 0x00;
+	uint_least8_t key[TC_SHA256_DIGEST_SIZE];
+	uint_least8_t v[TC_SHA256_DIGEST_SIZE];
+
+	/* input sanity check: */
+	if (prefix == (struct tc_hmac_state_struct *) 0 ||
+	    seed == (const uint_least8_t *) 0 ||
+	    seedlen < MIN_SLEN ||
+	    seedlen > MAX_SLEN) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	/* the known state of tc_hmac_prng_init, then V || 0x00 || seed: */
+	_set(key, 0x00, sizeof(key));
+	_set(v, 0x01, sizeof(v));
+	(void)tc_hmac_set_key(prefix, key, sizeof(key));
+	(void)tc_hmac_init(prefix);
+	(void)tc_hmac_update(prefix, v, sizeof(v));
+	(void)tc_hmac_update(prefix, &separator0, sizeof(separator0));
+	(void)tc_hmac_update(prefix, seed, seedlen);
+
+	return TC_CRYPTO_SUCCESS;
+}
+
+int tc_hmac_prng_instantiate(TCHmacPrng_t prng,
+			     const struct tc_hmac_state_struct *prefix,
+			     const uint_least8_t *seed,
+			     uint32_t seedlen,
+			     const uint_least8_t *additional_input,
+			     uint32_t additionallen)
+{
+	const uint_least8_t separator1 = 0x01;
+
+	/* input sanity check: */
+	if (prng == (TCHmacPrng_t) 0 ||
+	    seed == (const uint_least8_t *) 0 ||
+	    seedlen < MIN_SLEN ||
+	    seedlen > MAX_SLEN) {
+		return TC_CRYPTO_FAIL;
+	}
+	if (additional_input != (const uint_least8_t *) 0 &&
+	    (additionallen == 0 || additionallen > MAX_ALEN)) {
+		return TC_CRYPTO_FAIL;
+	}
+	if (additional_input == (const uint_least8_t *) 0) {
+		additionallen = 0;
+	}
+
+	/* K = HMAC_K(V || 0x00 || seed || additional_input), from the prefix: */
+	if (prefix == (const struct tc_hmac_state_struct *) 0) {
+		(void)tc_hmac_prng_instantiate_prefix(&prng->h, seed, seedlen);
+	} else {
+		memcpy(&prng->h, prefix, sizeof(prng->h));
+	}
+	if (additionallen != 0) {
+		(void)tc_hmac_update(&prng->h, additional_input, additionallen);
+	}
+	(void)tc_hmac_final(prng->key, sizeof(prng->key), &prng->h);
+
+	/* V = HMAC_K(V) */
+	_set(prng->v, 0x01, sizeof(prng->v));
+	step(prng);
+
+	/* K = HMAC_K(V || 0x01 || seed || additional_input), V = HMAC_K(V) */
+	(void)tc_hmac_set_key(&prng->h, prng->key, sizeof(prng->key));
+	(void)tc_hmac_init(&prng->h);
+	(void)tc_hmac_update(&prng->h, prng->v, sizeof(prng->v));
+	(void)tc_hmac_update(&prng->h, &separator1, sizeof(separator1));
+	(void)tc_hmac_update(&prng->h, seed, seedlen);
+	if (additionallen != 0) {
+		(void)tc_hmac_update(&prng->h, additional_input, additionallen);
+	}
+	(void)tc_hmac_final(prng->key, sizeof(prng->key), &prng->h);
+	step(prng);
+
+	/* ... and enable hmac_prng_generate */
+	prng->countdown = MAX_GENS;
+
+	return TC_CRYPTO_SUCCESS;
+}
+
 int tc_hmac_prng_generate(uint_least8_t *out, uint32_t outlen, TCHmacPrng_t prng)
 {
 	uint32_t bufferlen;
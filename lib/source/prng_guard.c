@@ -0,0 +1,279 @@
+/* prng_guard.c - TinyCrypt implementation of a fork-safe PRNG wrapper */
+
+/*
+ *  Copyright (C) 2017 by Intel Corporation, All Rights Reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *    - Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *    - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ *    - Neither the name of Intel Corporation nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <tinycrypt/prng_guard.h>
+#include <tinycrypt/constants.h>
+#include <tinycrypt/utils.h>
+
+/* request limits of the wrapped generators (see ctr_prng.c, hmac_prng.c): */
+#define CTR_PRNG_MAX_REQS 0x1000000000000ULL
+#define HMAC_PRNG_MAX_GENS 0xffffffffULL
+
+#if defined(unix) || defined(__linux__) || defined(__unix__) || \
+    defined(__unix) || (defined(__APPLE__) && defined(__MACH__)) || \
+    defined(uECC_POSIX)
+
+#include <sys/types.h>
+#include <pthread.h>
+#include <unistd.h>
+
+/*
+ * Bumped in the child on every fork(), so that the request path compares two
+ * words instead of calling getpid(). Unlike a process id, it also changes in
+ * a grandchild that got the pid of its dead grandparent after a double fork.
+ * Only the single thread of a fresh child writes it.
+ */
+static unsigned long fork_generation;
+/* whether the handler bumping fork_generation is registered: */
+static int fork_handler_ok;
+static pthread_once_t fork_handler_once = PTHREAD_ONCE_INIT;
+
+static void bump_fork_generation(void)
+{
+	fork_generation++;
+}
+
+static void register_fork_handler(void)
+{
+	fork_handler_ok = pthread_atfork(0, 0, bump_fork_generation) == 0;
+}
+
+static void watch_forks(void)
+{
+	(void)pthread_once(&fork_handler_once, register_fork_handler);
+}
+
+static long current_pid(void)
+{
+	return (long)getpid();
+}
+
+/* Assumes: guard != NULL */
+static int forked(TCPrngGuard_t guard)
+{
+	if (fork_handler_ok) {
+		return guard->generation != fork_generation;
+	}
+	/* without the handler: a system call, blind to pid reuse */
+	return guard->pid != current_pid();
+}
+
+#else /* no fork() on this platform */
+
+static const unsigned long fork_generation = 0;
+
+static void watch_forks(void)
+{
+}
+
+static long current_pid(void)
+{
+	return 0;
+}
+
+static int forked(TCPrngGuard_t guard)
+{
+	(void)guard;
+	return 0;
+}
+
+#endif /* platform */
+
+/*
+ * Draws fresh entropy and mixes it into the wrapped generator. The process id
+ * goes in as additional input, so that two processes can never end up with
+ * the same state even if they were handed the same entropy.
+ * Assumes: guard != NULL
+ */
+static int reseed(TCPrngGuard_t guard)
+{
+	uint_least8_t seed[TC_PRNG_GUARD_SEED_SIZE];
+	long pid = current_pid();
+	int result;
+
+	if (!guard->entropy(seed, sizeof(seed))) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	if (guard->type == TC_PRNG_GUARD_CTR) {
+		result = tc_ctr_prng_reseed(guard->ctr, seed, sizeof(seed),
+					    (const uint_least8_t *)&pid, sizeof(pid));
+	} else {
+		result = tc_hmac_prng_reseed(guard->hmac, seed, sizeof(seed),
+					     (const uint_least8_t *)&pid, sizeof(pid));
+	}
+
+	/* erasing temporary buffer used to store entropy: */
+	_set_secure(seed, 0, sizeof(seed));
+
+	if (result != TC_CRYPTO_SUCCESS) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	guard->pid = pid;
+	guard->generation = fork_generation;
+	guard->requests = 0;
+	return TC_CRYPTO_SUCCESS;
+}
+
+/*
+ * Requests the wrapped generator serves before it demands a reseed, counting
+ * those made without the guard.
+ * Assumes: guard != NULL
+ */
+static uint64_t remaining(TCPrngGuard_t guard)
+{
+	if (guard->type == TC_PRNG_GUARD_CTR) {
+		return guard->ctr->reseedCount > CTR_PRNG_MAX_REQS ? 0 :
+		       CTR_PRNG_MAX_REQS + 1 - guard->ctr->reseedCount;
+	}
+	return guard->hmac->countdown;
+}
+
+/* Assumes: guard != NULL */
+static int generate(TCPrngGuard_t guard, uint_least8_t *out, uint32_t outlen)
+{
+	if (guard->type == TC_PRNG_GUARD_CTR) {
+		return tc_ctr_prng_generate(guard->ctr, 0, 0, out, outlen);
+	}
+	return tc_hmac_prng_generate(out, outlen, guard->hmac);
+}
+
+static int init(TCPrngGuard_t guard, int type, TCEntropyFunction_t entropy,
+		uint64_t reseed_interval)
+{
+	/* half the wrapped generator's limit, so maintenance has headroom: */
+	uint64_t max_interval = (type == TC_PRNG_GUARD_CTR ? CTR_PRNG_MAX_REQS :
+				 HMAC_PRNG_MAX_GENS) / 2;
+
+	watch_forks();
+
+	guard->type = type;
+	guard->entropy = entropy;
+	guard->pid = current_pid();
+	guard->generation = fork_generation;
+	guard->requests = 0;
+	guard->reseed_interval = reseed_interval ? reseed_interval :
+				 TC_PRNG_GUARD_DEFAULT_INTERVAL;
+	if (guard->reseed_interval > max_interval) {
+		guard->reseed_interval = max_interval;
+	}
+
+	return TC_CRYPTO_SUCCESS;
+}
+
+int tc_prng_guard_init_ctr(TCPrngGuard_t guard, TCCtrPrng_t *prng,
+			   TCEntropyFunction_t entropy,
+			   uint64_t reseed_interval)
+{
+	/* input sanity check: */
+	if (guard == (TCPrngGuard_t) 0 ||
+	    prng == (TCCtrPrng_t *) 0 ||
+	    entropy == (TCEntropyFunction_t) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	guard->ctr = prng;
+	guard->hmac = (TCHmacPrng_t) 0;
+	return init(guard, TC_PRNG_GUARD_CTR, entropy, reseed_interval);
+}
+
+int tc_prng_guard_init_hmac(TCPrngGuard_t guard, TCHmacPrng_t prng,
+			    TCEntropyFunction_t entropy,
+			    uint64_t reseed_interval)
+{
+	/* input sanity check: */
+	if (guard == (TCPrngGuard_t) 0 ||
+	    prng == (TCHmacPrng_t) 0 ||
+	    entropy == (TCEntropyFunction_t) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	guard->ctr = (TCCtrPrng_t *) 0;
+	guard->hmac = prng;
+	return init(guard, TC_PRNG_GUARD_HMAC, entropy, reseed_interval);
+}
+
+int tc_prng_guard_generate(TCPrngGuard_t guard, uint_least8_t *out,
+			   uint32_t outlen)
+{
+	int result;
+
+	/* input sanity check: */
+	if (guard == (TCPrngGuard_t) 0 || out == (uint_least8_t *) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	/* first request after fork(): never replay the parent's stream */
+	if (forked(guard) &&
+	    reseed(guard) != TC_CRYPTO_SUCCESS) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	result = generate(guard, out, outlen);
+	if (result == TC_CTR_PRNG_RESEED_REQ ||
+	    result == TC_HMAC_PRNG_RESEED_REQ) {
+		/* maintenance did not run at all; reseed on the spot */
+		if (reseed(guard) != TC_CRYPTO_SUCCESS) {
+			return TC_CRYPTO_FAIL;
+		}
+		result = generate(guard, out, outlen);
+	}
+
+	if (result != TC_CRYPTO_SUCCESS) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	guard->requests++;
+	return TC_CRYPTO_SUCCESS;
+}
+
+int tc_prng_guard_maintain(TCPrngGuard_t guard)
+{
+	/* input sanity check: */
+	if (guard == (TCPrngGuard_t) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	/*
+	 * Reseed once the interval has elapsed, and also as soon as fewer than
+	 * an interval's worth of requests remain before the wrapped generator's
+	 * own limit, so that generate never reaches it.
+	 */
+	if (!forked(guard) &&
+	    guard->requests < guard->reseed_interval &&
+	    remaining(guard) >= guard->reseed_interval) {
+		return TC_CRYPTO_SUCCESS;
+	}
+
+	return reseed(guard);
+}
@@ -71,20 +71,18 @@ int test_1(void)
 		0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
 		0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
 	};
-	const struct tc_aes_key_sched_struct expected = {
-		{
-			0x2b7e1516, 0x28aed2a6, 0xabf71588, 0x09cf4f3c,
-			0xa0fafe17, 0x88542cb1, 0x23a33939, 0x2a6c7605,
-			0xf2c295f2, 0x7a96b943, 0x5935807a, 0x7359f67f,
-			0x3d80477d, 0x4716fe3e, 0x1e237e44, 0x6d7a883b,
-			0xef44a541, 0xa8525b7f, 0xb671253b, 0xdb0bad00,
-			0xd4d1c6f8, 0x7c839d87, 0xcaf2b8bc, 0x11f915bc,
-			0x6d88a37a, 0x110b3efd, 0xdbf98641, 0xca0093fd,
-			0x4e54f70e, 0x5f5fc9f3, 0x84a64fb2, 0x4ea6dc4f,
-			0xead27321, 0xb58dbad2, 0x312bf560, 0x7f8d292f,
-			0xac7766f3, 0x19fadc21, 0x28d12941, 0x575c006e,
-			0xd014f9a8, 0xc9ee2589, 0xe13f0cc8, 0xb6630ca6
-		}
+	const uint32_t expected[Nb*(Nr+1)] = {
+		0x2b7e1516, 0x28aed2a6, 0xabf71588, 0x09cf4f3c,
+		0xa0fafe17, 0x88542cb1, 0x23a33939, 0x2a6c7605,
+		0xf2c295f2, 0x7a96b943, 0x5935807a, 0x7359f67f,
+		0x3d80477d, 0x4716fe3e, 0x1e237e44, 0x6d7a883b,
+		0xef44a541, 0xa8525b7f, 0xb671253b, 0xdb0bad00,
+		0xd4d1c6f8, 0x7c839d87, 0xcaf2b8bc, 0x11f915bc,
+		0x6d88a37a, 0x110b3efd, 0xdbf98641, 0xca0093fd,
+		0x4e54f70e, 0x5f5fc9f3, 0x84a64fb2, 0x4ea6dc4f,
+		0xead27321, 0xb58dbad2, 0x312bf560, 0x7f8d292f,
+		0xac7766f3, 0x19fadc21, 0x28d12941, 0x575c006e,
+		0xd014f9a8, 0xc9ee2589, 0xe13f0cc8, 0xb6630ca6
 	};
 	struct tc_aes_key_sched_struct s;
 
@@ -97,8 +95,8 @@ int test_1(void)
 		goto exitTest1;
 	}
 
-	result = check_result(1, expected.words, sizeof(expected.words), s.words,
-			      sizeof(s.words));
+	result = check_result(1, expected, sizeof(expected), s.words,
+			      sizeof(expected));
 
 exitTest1:
 	TC_END_RESULT(result);
@@ -146,7 +144,7 @@ exitTest2:
 }
 
 int var_text_test(unsigned int r, const uint_least8_t *in, const uint_least8_t *out,
-		  TCAesKeySched_t s)
+		  TCAesKeySched_t s, TCAesKeySched_t ds)
 {
 	uint_least8_t ciphertext[NUM_OF_NIST_KEYS];
 	uint_least8_t decrypted[NUM_OF_NIST_KEYS];
@@ -156,7 +154,7 @@ int var_text_test(unsigned int r, const uint_least8_t *in, const uint_least8_t *
 	result = check_result(r, out, NUM_OF_NIST_KEYS, ciphertext,
 			      sizeof(ciphertext));
 	if (result != TC_FAIL) {
-		if (tc_aes_decrypt(decrypted, ciphertext, s) == 0) {
+		if (tc_aes_decrypt(decrypted, ciphertext, ds) == 0) {
 			TC_ERROR("aes_decrypt failed\n");
 			result = TC_FAIL;
 		} else {
@@ -1077,14 +1075,16 @@ int test_3(void)
 			} }
 	};
 	struct tc_aes_key_sched_struct s;
+	struct tc_aes_key_sched_struct ds;
 	unsigned int i;
 
 	TC_PRINT("AES128 %s (NIST fixed-key and variable-text):\n", __func__);
 
 	(void)tc_aes128_set_encrypt_key(&s, key);
+	(void)tc_aes128_set_decrypt_key(&ds, key);
 
 	for (i = 0; i < 128; ++i) {
-		result = var_text_test(i, kat_tbl[i].in, kat_tbl[i].out, &s);
+		result = var_text_test(i, kat_tbl[i].in, kat_tbl[i].out, &s, &ds);
 		if (result == TC_FAIL) {
 			break;
 		}
@@ -1104,6 +1104,7 @@ int var_key_test(unsigned int r, const uint_least8_t *in, const uint_least8_t *o
 		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 	};
 	uint_least8_t ciphertext[NUM_OF_NIST_KEYS];
+	uint_least8_t decrypted[NUM_OF_NIST_KEYS];
 	struct tc_aes_key_sched_struct s;
 
 	(void)tc_aes128_set_encrypt_key(&s, in);
@@ -1111,6 +1112,13 @@ int var_key_test(unsigned int r, const uint_least8_t *in, const uint_least8_t *o
 	(void)tc_aes_encrypt(ciphertext, plaintext, &s);
 	result = check_result(r, out, NUM_OF_NIST_KEYS, ciphertext,
 			      sizeof(ciphertext));
+	if (result != TC_FAIL) {
+		/* the decryption schedule differs for every key: */
+		(void)tc_aes128_set_decrypt_key(&s, in);
+		(void)tc_aes_decrypt(decrypted, ciphertext, &s);
+		result = check_result(r, plaintext, NUM_OF_NIST_KEYS,
+				      decrypted, sizeof(decrypted));
+	}
 
 	return result;
 }
@@ -2036,6 +2044,174 @@ int test_4(void)
 	return result;
 }
 
+/*
+ * FIPS 197 appendix C example vectors for all three key sizes, encrypted
+ * and decrypted through the same tc_aes_encrypt/decrypt calls.
+ */
+int test_5(void)
+{
+	int result = TC_PASS;
+	const uint_least8_t key[TC_AES256_KEY_SIZE] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+		0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+		0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+		0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
+	};
+	const uint_least8_t plaintext[NUM_OF_NIST_KEYS] = {
+		0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+		0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff
+	};
+	const uint_least8_t expected[3][NUM_OF_NIST_KEYS] = {
+		{
+			0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+			0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a
+		}, {
+			0xdd, 0xa9, 0x7c, 0xa4, 0x86, 0x4c, 0xdf, 0xe0,
+			0x6e, 0xaf, 0x70, 0xa0, 0xec, 0x0d, 0x71, 0x91
+		}, {
+			0x8e, 0xa2, 0xb7, 0xca, 0x51, 0x67, 0x45, 0xbf,
+			0xea, 0xfc, 0x49, 0x90, 0x4b, 0x49, 0x60, 0x89
+		}
+	};
+	int (*set_encrypt_key[3])(TCAesKeySched_t, const uint_least8_t *) = {
+		tc_aes128_set_encrypt_key, tc_aes192_set_encrypt_key,
+		tc_aes256_set_encrypt_key
+	};
+	int (*set_decrypt_key[3])(TCAesKeySched_t, const uint_least8_t *) = {
+		tc_aes128_set_decrypt_key, tc_aes192_set_decrypt_key,
+		tc_aes256_set_decrypt_key
+	};
+	uint_least8_t ciphertext[NUM_OF_NIST_KEYS];
+	uint_least8_t decrypted[NUM_OF_NIST_KEYS];
+	struct tc_aes_key_sched_struct s;
+	unsigned int i;
+
+	TC_PRINT("AES test #5 (FIPS 197 AES-128, AES-192 and AES-256):\n");
+
+	for (i = 0; i < 3; ++i) {
+		if (set_encrypt_key[i](&s, key) == 0 ||
+		    s.rounds != Nr + 2 * i ||
+		    tc_aes_encrypt(ciphertext, plaintext, &s) == 0) {
+			TC_ERROR("AES-%u encryption failed.\n", 128 + 64 * i);
+			result = TC_FAIL;
+			break;
+		}
+		result = check_result(5, expected[i], sizeof(expected[i]),
+				      ciphertext, sizeof(ciphertext));
+		if (result == TC_FAIL) {
+			break;
+		}
+
+		if (tc_aes_decrypt(decrypted, ciphertext, &s) != 0) {
+			TC_ERROR("AES-%u decryption accepted an encryption "
+				 "schedule.\n", 128 + 64 * i);
+			result = TC_FAIL;
+			break;
+		}
+
+		if (set_decrypt_key[i](&s, key) == 0 ||
+		    tc_aes_decrypt(decrypted, ciphertext, &s) == 0) {
+			TC_ERROR("AES-%u decryption failed.\n", 128 + 64 * i);
+			result = TC_FAIL;
+			break;
+		}
+		if (tc_aes_encrypt(ciphertext, plaintext, &s) != 0 ||
+		    tc_aes_encrypt_blocks(ciphertext, plaintext, 1, &s) != 0) {
+			TC_ERROR("AES-%u encryption accepted a decryption "
+				 "schedule.\n", 128 + 64 * i);
+			result = TC_FAIL;
+			break;
+		}
+		result = check_result(5, plaintext, sizeof(plaintext),
+				      decrypted, sizeof(decrypted));
+		if (result == TC_FAIL) {
+			break;
+		}
+	}
+
+	TC_END_RESULT(result);
+
+	return result;
+}
+
+/*
+ * tc_aes_encrypt_blocks against tc_aes_encrypt for every key size and for
+ * 1 to 9 blocks, so that full and partial groups of TC_AES_PARALLEL_BLOCKS
+ * are covered, in place and out of place.
+ */
+#define TEST_6_BLOCKS 9
+
+int test_6(void)
+{
+	int result = TC_PASS;
+	int (*set_encrypt_key[3])(TCAesKeySched_t, const uint_least8_t *) = {
+		tc_aes128_set_encrypt_key, tc_aes192_set_encrypt_key,
+		tc_aes256_set_encrypt_key
+	};
+	uint_least8_t key[TC_AES256_KEY_SIZE];
+	uint_least8_t plaintext[TEST_6_BLOCKS * TC_AES_BLOCK_SIZE];
+	uint_least8_t expected[TEST_6_BLOCKS * TC_AES_BLOCK_SIZE];
+	uint_least8_t ciphertext[TEST_6_BLOCKS * TC_AES_BLOCK_SIZE];
+	struct tc_aes_key_sched_struct s;
+	unsigned int i;
+	unsigned int n;
+
+	TC_PRINT("AES test #6 (multi-block encryption):\n");
+
+	for (i = 0; i < sizeof(key); ++i) {
+		key[i] = (uint_least8_t)(0x5a ^ (7 * i));
+	}
+	for (i = 0; i < sizeof(plaintext); ++i) {
+		plaintext[i] = (uint_least8_t)(i * i + 3);
+	}
+
+	for (i = 0; i < 3; ++i) {
+		(void)set_encrypt_key[i](&s, key);
+		for (n = 0; n < TEST_6_BLOCKS; ++n) {
+			(void)tc_aes_encrypt(&expected[n * TC_AES_BLOCK_SIZE],
+					     &plaintext[n * TC_AES_BLOCK_SIZE], &s);
+		}
+
+		for (n = 1; n <= TEST_6_BLOCKS; ++n) {
+			memset(ciphertext, 0, sizeof(ciphertext));
+			if (tc_aes_encrypt_blocks(ciphertext, plaintext, n, &s) == 0) {
+				TC_ERROR("AES-%u: %u blocks failed.\n", 128 + 64 * i, n);
+				result = TC_FAIL;
+				goto exitTest6;
+			}
+			result = check_result(6, expected, n * TC_AES_BLOCK_SIZE,
+					      ciphertext, n * TC_AES_BLOCK_SIZE);
+			if (result == TC_FAIL) {
+				goto exitTest6;
+			}
+
+			memcpy(ciphertext, plaintext, sizeof(ciphertext));
+			(void)tc_aes_encrypt_blocks(ciphertext, ciphertext, n, &s);
+			result = check_result(6, expected, n * TC_AES_BLOCK_SIZE,
+					      ciphertext, n * TC_AES_BLOCK_SIZE);
+			if (result == TC_FAIL ||
+			    memcmp(&ciphertext[n * TC_AES_BLOCK_SIZE],
+				   &plaintext[n * TC_AES_BLOCK_SIZE],
+				   sizeof(ciphertext) - n * TC_AES_BLOCK_SIZE) != 0) {
+				TC_ERROR("AES-%u: %u blocks in place failed.\n",
+					 128 + 64 * i, n);
+				result = TC_FAIL;
+				goto exitTest6;
+			}
+		}
+	}
+
+	if (tc_aes_encrypt_blocks(ciphertext, plaintext, 0, &s) != 0) {
+		TC_ERROR("AES: encrypting zero blocks did not fail.\n");
+		result = TC_FAIL;
+	}
+
+ exitTest6:
+	TC_END_RESULT(result);
+
+	return result;
+}
+
 /*
  * Main task to test AES
  */
@@ -2068,6 +2244,19 @@ int main(void)
 		goto exitTest;
 	}
 
+	result = test_5();
+	if (result == TC_FAIL) { /* terminate test */
+		TC_ERROR("AES test #5 (FIPS 197 AES-128, AES-192 and AES-256) "
+			 "failed.\n");
+		goto exitTest;
+	}
+
+	result = test_6();
+	if (result == TC_FAIL) { /* terminate test */
+		TC_ERROR("AES test #6 (multi-block encryption) failed.\n");
+		goto exitTest;
+	}
+
 	TC_PRINT("All AES128 tests succeeded!\n");
 
  exitTest:
@@ -149,6 +149,67 @@ exitTest1:
 	return result;
 }
 
+/*
+ * NIST SP 800-38a F.2.5 and F.2.6: CBC-AES256, through the same mode calls
+ * as AES-128.
+ */
+int test_3(void)
+{
+	const uint_least8_t key256[TC_AES256_KEY_SIZE] = {
+		0x60, 0x3d, 0xeb, 0x10, 0x15, 0xca, 0x71, 0xbe, 0x2b, 0x73, 0xae, 0xf0,
+		0x85, 0x7d, 0x77, 0x81, 0x1f, 0x35, 0x2c, 0x07, 0x3b, 0x61, 0x08, 0xd7,
+		0x2d, 0x98, 0x10, 0xa3, 0x09, 0x14, 0xdf, 0xf4
+	};
+	const uint_least8_t ciphertext256[80] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+		0x0c, 0x0d, 0x0e, 0x0f, 0xf5, 0x8c, 0x4c, 0x04, 0xd6, 0xe5, 0xf1, 0xba,
+		0x77, 0x9e, 0xab, 0xfb, 0x5f, 0x7b, 0xfb, 0xd6, 0x9c, 0xfc, 0x4e, 0x96,
+		0x7e, 0xdb, 0x80, 0x8d, 0x67, 0x9f, 0x77, 0x7b, 0xc6, 0x70, 0x2c, 0x7d,
+		0x39, 0xf2, 0x33, 0x69, 0xa9, 0xd9, 0xba, 0xcf, 0xa5, 0x30, 0xe2, 0x63,
+		0x04, 0x23, 0x14, 0x61, 0xb2, 0xeb, 0x05, 0xe2, 0xc3, 0x9b, 0xe9, 0xfc,
+		0xda, 0x6c, 0x19, 0x07, 0x8c, 0x6a, 0x9d, 0x1b
+	};
+	struct tc_aes_key_sched_struct a;
+	uint_least8_t iv_buffer[16];
+	uint_least8_t encrypted[80];
+	uint_least8_t decrypted[64];
+	int result = TC_PASS;
+
+	TC_PRINT("CBC test #3 (AES-256 SP 800-38a tests):\n");
+
+	(void)tc_aes256_set_encrypt_key(&a, key256);
+	(void)memcpy(iv_buffer, iv, TC_AES_BLOCK_SIZE);
+	if (tc_cbc_mode_encrypt(encrypted, sizeof(encrypted), plaintext,
+				sizeof(plaintext), iv_buffer, &a) == 0) {
+		TC_ERROR("CBC test #3 (AES-256 encryption) failed in %s.\n",
+			 __func__);
+		result = TC_FAIL;
+		goto exitTest3;
+	}
+	result = check_result(3, ciphertext256, sizeof(ciphertext256),
+			      encrypted, sizeof(encrypted));
+	if (result == TC_FAIL) {
+		goto exitTest3;
+	}
+
+	(void)tc_aes256_set_decrypt_key(&a, key256);
+	if (tc_cbc_mode_decrypt(decrypted, sizeof(encrypted) - TC_AES_BLOCK_SIZE,
+				&encrypted[TC_AES_BLOCK_SIZE],
+				sizeof(encrypted) - TC_AES_BLOCK_SIZE,
+				encrypted, &a) == 0) {
+		TC_ERROR("CBC test #3 (AES-256 decryption) failed in %s.\n",
+			 __func__);
+		result = TC_FAIL;
+		goto exitTest3;
+	}
+	result = check_result(3, plaintext, sizeof(plaintext), decrypted,
+			      sizeof(decrypted));
+
+exitTest3:
+	TC_END_RESULT(result);
+	return result;
+}
+
 /*
  * Main task to test AES
  */
@@ -166,6 +227,13 @@ int main(void)
 		goto exitTest;
 	}
 
+	result = test_3();
+	if (result == TC_FAIL) {
+		/* terminate test */
+		TC_ERROR("CBC test #3 failed.\n");
+		goto exitTest;
+	}
+
 	TC_PRINT("All CBC tests succeeded!\n");
 
 exitTest:
@@ -36,6 +36,7 @@
 
   Scenarios tested include:
   - AES128 CTR mode encryption SP 800-38a tests
+  - AES128 CTR mode over several parallel groups with counter wrap
 */
 
 #include <tinycrypt/ctr_mode.h>
@@ -113,6 +114,71 @@ unsigned int test_1_and_2(void)
         return result;
 }
 
+/*
+ * CTR over several groups of parallel blocks against a keystream built with
+ * tc_aes_encrypt, with a counter that wraps around 2^32 on the way.
+ */
+#define TEST_3_BLOCKS 11
+
+unsigned int test_3(void)
+{
+        const uint_least8_t key[16] = {
+		0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6, 0xab, 0xf7, 0x15, 0x88,
+		0x09, 0xcf, 0x4f, 0x3c
+        };
+        const uint_least8_t ctr_init[16] = {
+		0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb,
+		0xff, 0xff, 0xff, 0xfb
+        };
+        struct tc_aes_key_sched_struct sched;
+        uint_least8_t ctr[16];
+        uint_least8_t block[16];
+        uint_least8_t in[TEST_3_BLOCKS * TC_AES_BLOCK_SIZE - 5];
+        uint_least8_t expected[sizeof(in)];
+        uint_least8_t out[sizeof(in)];
+        uint32_t count;
+        unsigned int result = TC_PASS;
+        unsigned int i;
+
+        TC_PRINT("CTR test #3 (multi-block with counter wrap):\n");
+        (void)tc_aes128_set_encrypt_key(&sched, key);
+
+        for (i = 0; i < sizeof(in); ++i) {
+		in[i] = (uint_least8_t)(3 * i + 1);
+        }
+        (void)memcpy(ctr, ctr_init, sizeof(ctr));
+        count = 0xfffffffb;
+        for (i = 0; i < sizeof(in); ++i) {
+		if ((i % TC_AES_BLOCK_SIZE) == 0) {
+			ctr[12] = (uint_least8_t)(count >> 24);
+			ctr[13] = (uint_least8_t)(count >> 16);
+			ctr[14] = (uint_least8_t)(count >> 8);
+			ctr[15] = (uint_least8_t)(count);
+			(void)tc_aes_encrypt(block, ctr, &sched);
+			count++;
+		}
+		expected[i] = in[i] ^ block[i % TC_AES_BLOCK_SIZE];
+        }
+
+        (void)memcpy(ctr, ctr_init, sizeof(ctr));
+        if (tc_ctr_mode(out, sizeof(out), in, sizeof(in), ctr, &sched) == 0) {
+                TC_ERROR("CTR test #3 (multi-block with counter wrap) failed in %s.\n", __func__);
+                result = TC_FAIL;
+                goto exitTest3;
+        }
+        result = check_result(3, expected, sizeof(expected), out, sizeof(out));
+        if (result == TC_PASS &&
+            (memcmp(ctr, ctr_init, 12) != 0 || ctr[12] != 0 || ctr[13] != 0 ||
+             ctr[14] != 0 || ctr[15] != TEST_3_BLOCKS - 5)) {
+                TC_ERROR("CTR test #3: wrong counter after the call.\n");
+                result = TC_FAIL;
+        }
+
+ exitTest3:
+        TC_END_RESULT(result);
+        return result;
+}
+
 /*
  * Main task to test AES
  */
@@ -130,6 +196,12 @@ int main(void)
                 goto exitTest;
         }
 
+        result = test_3();
+        if (result == TC_FAIL) { /* terminate test */
+                TC_ERROR("CTR test #3 failed.\n");
+                goto exitTest;
+        }
+
         TC_PRINT("All CTR tests succeeded!\n");
 
  exitTest:
@@ -356,6 +356,7 @@ static int test_reseed(void)
 	/* confirm entropy and additional_input are being used correctly */
 	/* first, entropy only */
 	memset(&ctx, 0x0, sizeof ctx);
+	ctx.key.rounds = Nr; /* an all-zero AES-128 key schedule */
 	for (i = 0U; i < sizeof entropy; i++) {
 		entropy[i] = i;
 	}
@@ -378,6 +379,7 @@ static int test_reseed(void)
 
 	/* now, entropy and additional_input */
 	memset(&ctx, 0x0, sizeof ctx);
+	ctx.key.rounds = Nr;
 	for (i = 0U; i < sizeof additional_input; i++) {
 		additional_input[i] = i * 2U;
 	}
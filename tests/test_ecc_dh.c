@@ -61,6 +61,9 @@
 #include <test_ecc_utils.h>
 #include <test_utils.h>
 #include <tinycrypt/constants.h>
+#if uECC_FIXED_BASE_TABLE
+#include "ecc_secp256r1_table.h"
+#endif
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -72,13 +75,13 @@ int ecdh_vectors(char **qx_vec, char **qy_vec, char **d_vec, char **z_vec,
 		  int tests, int verbose)
 {
 
-	unsigned int pub[2*NUM_ECC_WORDS];
-	unsigned int prv[NUM_ECC_WORDS];
-	unsigned int z[NUM_ECC_WORDS];
+	uECC_word_t pub[2*NUM_ECC_WORDS];
+	uECC_word_t prv[NUM_ECC_WORDS];
+	uECC_word_t z[NUM_ECC_WORDS];
 	unsigned int result = TC_PASS;
 
 	int rc;
-	unsigned int exp_z[NUM_ECC_WORDS];
+	uECC_word_t exp_z[NUM_ECC_WORDS];
 
 	const struct uECC_Curve_t * curve = uECC_secp256r1();
 
@@ -90,11 +93,11 @@ int ecdh_vectors(char **qx_vec, char **qy_vec, char **d_vec, char **z_vec,
 	    	string2scalar(prv, NUM_ECC_WORDS, d_vec[i]);
 
 		uint_least8_t pub_bytes[2*NUM_ECC_BYTES];
-		uECC_vli_nativeToBytes(pub_bytes, 2*NUM_ECC_BYTES, pub);
+		uECC_vli_wordsToBytes(pub_bytes, 2*NUM_ECC_BYTES, pub);
 		uint_least8_t private_bytes[NUM_ECC_BYTES];
-		uECC_vli_nativeToBytes(private_bytes, NUM_ECC_BYTES, prv);
+		uECC_vli_wordsToBytes(private_bytes, NUM_ECC_BYTES, prv);
 		uint_least8_t z_bytes[NUM_ECC_BYTES];
-		uECC_vli_nativeToBytes(z_bytes, NUM_ECC_BYTES, exp_z);
+		uECC_vli_wordsToBytes(z_bytes, NUM_ECC_BYTES, exp_z);
 
 		rc = uECC_shared_secret(pub_bytes, private_bytes, z_bytes, curve);
 
@@ -104,7 +107,7 @@ int ecdh_vectors(char **qx_vec, char **qy_vec, char **d_vec, char **z_vec,
 			return result;;
 		}
 
-		uECC_vli_bytesToNative(z, z_bytes, NUM_ECC_BYTES);
+		uECC_vli_bytesToWords(z, z_bytes, NUM_ECC_BYTES);
 
 		result = check_ecc_result(i, "Z", exp_z, z, NUM_ECC_WORDS, verbose);
 		if (result == TC_FAIL) {
@@ -308,7 +311,7 @@ int pkv_vectors(char **qx_vec, char **qy_vec, char **res_vec, int tests,
 		 bool verbose)
 {
 
-	unsigned int pub[2 * NUM_ECC_WORDS];
+	uECC_word_t pub[2 * NUM_ECC_WORDS];
 	uint_least8_t _public[2 * NUM_ECC_BYTES];
 	int rc;
 	int exp_rc;
@@ -332,8 +335,8 @@ int pkv_vectors(char **qx_vec, char **qy_vec, char **res_vec, int tests,
 		string2scalar(pub, NUM_ECC_WORDS, qx_vec[i]);
 		string2scalar(pub + NUM_ECC_WORDS, NUM_ECC_WORDS, qy_vec[i]);
 
-		uECC_vli_nativeToBytes(_public, NUM_ECC_BYTES, pub);
-		uECC_vli_nativeToBytes(_public + NUM_ECC_BYTES, NUM_ECC_BYTES, pub+NUM_ECC_WORDS);
+		uECC_vli_wordsToBytes(_public, NUM_ECC_BYTES, pub);
+		uECC_vli_wordsToBytes(_public + NUM_ECC_BYTES, NUM_ECC_BYTES, pub+NUM_ECC_WORDS);
 
 		rc = uECC_valid_public_key(_public, curve);
 	}
@@ -477,6 +480,794 @@ int montecarlo_ecdh(int num_tests, bool verbose)
         return result;
 }
 
+/* Reference scalar * G, computed with the Montgomery ladder. */
+static void ladder_mult_base(uECC_word_t *result, const uECC_word_t *scalar,
+			     uECC_Curve curve)
+{
+	uECC_word_t k0[NUM_ECC_WORDS];
+	uECC_word_t k1[NUM_ECC_WORDS];
+	uECC_word_t carry = regularize_k(scalar, k0, k1, curve);
+
+	EccPoint_mult(result, curve->G, carry ? k0 : k1, 0,
+		      curve->num_n_bits + 1, curve);
+}
+
+/*
+ * Edge cases (small scalars, window boundaries, scalars just below n, top
+ * bits set)
+ * come with their expected multiples of G; random scalars are compared with
+ * the ladder.
+ */
+int fixed_base_mult(int num_tests, bool verbose)
+{
+	char *k[] = {
+		"0000000000000000000000000000000000000000000000000000000000000001",
+		"0000000000000000000000000000000000000000000000000000000000000002",
+		"0000000000000000000000000000000000000000000000000000000000000003",
+		"000000000000000000000000000000000000000000000000000000000000000F",
+		"0000000000000000000000000000000000000000000000000000000000000010",
+		"0000000000000000000000000000000000000000000000000000000000000011",
+		"FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632550",
+		"FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC63254F",
+		"FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC63254B",
+		"FFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632533",
+		"8000000000000000000000000000000000000000000000000000000000000000",
+		"1000000000000000000000000000000000000000000000000000000000000000",
+		"F000000000000000000000000000000000000000000000000000000000000001",
+	};
+
+	char *x[] = {
+		"6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296",
+		"7CF27B188D034F7E8A52380304B51AC3C08969E277F21B35A60B48FC47669978",
+		"5ECBE4D1A6330A44C8F7EF951D4BF165E6C6B721EFADA985FB41661BC6E7FD6C",
+		"F0454DC6971ABAE7ADFB378999888265AE03AF92DE3A0EF163668C63E59B9D5F",
+		"76A94D138A6B41858B821C629836315FCD28392EFF6CA038A5EB4787E1277C6E",
+		"47776904C0F1CC3A9C0984B66F75301A5FA68678F0D64AF8BA1ABCE34738A73E",
+		"6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296",
+		"7CF27B188D034F7E8A52380304B51AC3C08969E277F21B35A60B48FC47669978",
+		"B01A172A76A4602C92D3242CB897DDE3024C740DEBB215B4C6B0AAE93C2291A9",
+		"409F8DA21AEA236A5F5A1904D0310C1C6192A67D0DA08936319869A8AD0838A3",
+		"77B20A912E6B23135066E911891524BC4EFE3560E3E92350B52DEC8F375F2B54",
+		"B12FADF52943DFA54943FCCB3B7893E796357686C10319E31EAD3233444C0448",
+		"D7F0A34CE916C18219056EF7695E1660281910559FE81775B620F81D76B31EC6",
+	};
+
+	char *y[] = {
+		"4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5",
+		"07775510DB8ED040293D9AC69F7430DBBA7DADE63CE982299E04B79D227873D1",
+		"8734640C4998FF7E374B06CE1A64A2ECD82AB036384FB83D9A79B127A27D5032",
+		"B5B93EE3592E2D1F4E6594E51F9643E62A3B21CE75B5FA3F47E59CDE0D034F36",
+		"A985FE61341F260E6CB0A1B5E11E87208599A0040FC78BAA0E9DDD724B8C5110",
+		"AA005EE6B5B957286231856577648E8381B2804428D5733F32F787FF71F1FCDC",
+		"B01CBD1C01E58065711814B583F061E9D431CCA994CEA1313449BF97C840AE0A",
+		"F888AAEE24712FC0D6C26539608BCF244582521AC3167DD661FB4862DD878C2E",
+		"17A3EF8ACDC8252B9013F1D20458FC86E3FF0890E381E9420283B7AC7038801D",
+		"8F23084D30FF71A9F1D918D42C42BF08C1665F14E9D5986C1E9C2D38D5E170A5",
+		"A3DC291825CEA3F7F7B10BFCDD038A72DF623DA1E850E0F1CAA801FCD6CC67FF",
+		"02E2459599B0F4ACE96F8F6677B2A6A71D05E70332FC4DF296575E76B369DE57",
+		"61EFB86FD50F58CFF94064F1A706429C99283C4050D4226F824E6F7DBDB1C956",
+	};
+
+	uECC_word_t scalar[NUM_ECC_WORDS];
+	uECC_word_t expected[2 * NUM_ECC_WORDS];
+	uECC_word_t computed[2 * NUM_ECC_WORDS];
+	unsigned int result = TC_PASS;
+#if uECC_FIXED_BASE_TABLE
+	int num_vectors = sizeof(k) / sizeof(k[0]);
+#else
+	/* the ladder does not handle scalars this close to 0 or n */
+	int num_vectors = 0;
+#endif
+	int i;
+
+	const struct uECC_Curve_t * curve = uECC_secp256r1();
+
+	TC_PRINT("Test #5: Fixed-base multiplication ");
+	TC_PRINT("NIST-p256\n");
+
+#if uECC_FIXED_BASE_TABLE
+	/* the checked-in table is what EccPoint_fixed_table computes for G: */
+	static uECC_FixedTable table;
+
+	EccPoint_fixed_table(table, curve->G, curve);
+	if (memcmp(table, secp256r1_G_table, sizeof(table)) != 0) {
+		TC_ERROR("ecc_secp256r1_table.h differs from the table of G\n");
+		result = TC_FAIL;
+		goto exitTest1;
+	}
+#endif
+
+	for (i = 0; i < num_vectors + num_tests; ++i) {
+		if (i < num_vectors) {
+			string2scalar(scalar, NUM_ECC_WORDS, k[i]);
+			string2scalar(expected, NUM_ECC_WORDS, x[i]);
+			string2scalar(expected + NUM_ECC_WORDS, NUM_ECC_WORDS, y[i]);
+		} else {
+			uECC_generate_random_int(scalar, curve->n, NUM_ECC_WORDS);
+			ladder_mult_base(expected, scalar, curve);
+		}
+
+		EccPoint_mult_base(computed, scalar, curve);
+
+		result = check_ecc_result(i, "k*G", expected, computed,
+					  2 * NUM_ECC_WORDS, verbose);
+		if (result == TC_FAIL) {
+			goto exitTest1;
+		}
+	}
+
+ exitTest1:
+        TC_END_RESULT(result);
+        return result;
+}
+
+/*
+ * Checks inputs times their inverses against 1, and Montgomery products
+ * against uECC_vli_modMult, modulo p and n. Edge cases are 0 (whose
+ * "inverse" is 0), 1, 2, mod - 2 and mod - 1.
+ */
+int modular_inverse(int num_tests, bool verbose)
+{
+	uECC_word_t x[NUM_ECC_WORDS];
+	uECC_word_t y[NUM_ECC_WORDS];
+	uECC_word_t inv[NUM_ECC_WORDS];
+	uECC_word_t expected[NUM_ECC_WORDS];
+	uECC_word_t computed[NUM_ECC_WORDS];
+	uECC_word_t r2[NUM_ECC_WORDS];
+	uECC_word_t mod_inv;
+	unsigned int result = TC_PASS;
+	int m, i;
+
+	const struct uECC_Curve_t * curve = uECC_secp256r1();
+	const uECC_word_t *mods[2] = {curve->p, curve->n};
+
+	TC_PRINT("Test #6: Modular inversion ");
+	TC_PRINT("NIST-p256\n");
+
+	for (m = 0; m < 2; ++m) {
+		const uECC_word_t *mod = mods[m];
+
+		mod_inv = uECC_vli_montInit(r2, mod, NUM_ECC_WORDS);
+		for (i = 0; i < 5 + num_tests; ++i) {
+			uECC_vli_clear(x, NUM_ECC_WORDS);
+			if (i < 3) {
+				x[0] = i;
+			} else if (i < 5) {
+				x[0] = 5 - i;
+				uECC_vli_sub(x, mod, x, NUM_ECC_WORDS);
+			} else {
+				uECC_generate_random_int(x, mod, NUM_ECC_WORDS);
+			}
+
+			uECC_vli_modInv(inv, x, mod, NUM_ECC_WORDS);
+			uECC_vli_modMult(computed, x, inv, mod, NUM_ECC_WORDS);
+			uECC_vli_clear(expected, NUM_ECC_WORDS);
+			expected[0] = (i != 0);
+			result = check_ecc_result(i, m ? "x/x mod n" : "x/x mod p",
+						  expected, computed,
+						  NUM_ECC_WORDS, verbose);
+			if (result == TC_FAIL) {
+				goto exitTest1;
+			}
+
+			/* x * y == (x * y / R) * R^2 / R: */
+			uECC_generate_random_int(y, mod, NUM_ECC_WORDS);
+			uECC_vli_modMult(expected, x, y, mod, NUM_ECC_WORDS);
+			uECC_vli_montMult(computed, x, y, mod, mod_inv,
+					  NUM_ECC_WORDS);
+			uECC_vli_montMult(computed, computed, r2, mod, mod_inv,
+					  NUM_ECC_WORDS);
+			result = check_ecc_result(i, m ? "x*y mod n" : "x*y mod p",
+						  expected, computed,
+						  NUM_ECC_WORDS, verbose);
+			if (result == TC_FAIL) {
+				goto exitTest1;
+			}
+		}
+	}
+
+ exitTest1:
+        TC_END_RESULT(result);
+        return result;
+}
+
+/*
+ * Differential test of the field arithmetic kernels: products and point
+ * doublings (which square) computed with every CPU feature in use must match
+ * the portable code. Edge cases are all-one words, p - 1 and 0.
+ */
+int field_kernels(int num_tests, bool verbose)
+{
+	uECC_word_t x[NUM_ECC_WORDS];
+	uECC_word_t y[NUM_ECC_WORDS];
+	uECC_word_t z[NUM_ECC_WORDS];
+	uECC_word_t expected[4 * NUM_ECC_WORDS];
+	uECC_word_t computed[4 * NUM_ECC_WORDS];
+	unsigned int features;
+	unsigned int result = TC_PASS;
+	int i, pass;
+
+	const struct uECC_Curve_t * curve = uECC_secp256r1();
+
+	TC_PRINT("Test #7: Field arithmetic kernels ");
+	TC_PRINT("NIST-p256\n");
+
+	features = uECC_set_cpu_features(~0U);
+	if (!features) {
+		TC_PRINT("no optional CPU features in use, comparing the "
+			 "portable code with itself\n");
+	}
+
+	for (i = 0; i < num_tests; ++i) {
+		if (i == 0) {
+			memset(x, 0xff, sizeof(x));
+			memset(y, 0xff, sizeof(y));
+			uECC_vli_clear(z, NUM_ECC_WORDS);
+		} else if (i == 1) {
+			uECC_vli_set(x, curve->p, NUM_ECC_WORDS);
+			x[0] -= 1;
+			uECC_vli_set(y, x, NUM_ECC_WORDS);
+			uECC_vli_set(z, x, NUM_ECC_WORDS);
+		} else {
+			uECC_generate_random_int(x, curve->p, NUM_ECC_WORDS);
+			uECC_generate_random_int(y, curve->p, NUM_ECC_WORDS);
+			uECC_generate_random_int(z, curve->p, NUM_ECC_WORDS);
+		}
+
+		for (pass = 0; pass < 2; ++pass) {
+			uECC_word_t *out = pass ? computed : expected;
+
+			uECC_set_cpu_features(pass ? ~0U : 0);
+			uECC_vli_modMult_fast(out, x, y, curve);
+			uECC_vli_set(out + NUM_ECC_WORDS, x, NUM_ECC_WORDS);
+			uECC_vli_set(out + 2 * NUM_ECC_WORDS, y, NUM_ECC_WORDS);
+			uECC_vli_set(out + 3 * NUM_ECC_WORDS, z, NUM_ECC_WORDS);
+			curve->double_jacobian(out + NUM_ECC_WORDS,
+					       out + 2 * NUM_ECC_WORDS,
+					       out + 3 * NUM_ECC_WORDS, curve);
+		}
+
+		result = check_ecc_result(i, "field kernels", expected, computed,
+					  4 * NUM_ECC_WORDS, verbose);
+		if (result == TC_FAIL) {
+			goto exitTest1;
+		}
+	}
+
+ exitTest1:
+	uECC_set_cpu_features(~0U);
+        TC_END_RESULT(result);
+        return result;
+}
+
+/*
+ * Round-trips random public keys through uECC_compress and uECC_decompress,
+ * and checks that malformed encodings and x coordinates off the curve are
+ * rejected.
+ */
+int point_compression(int num_tests, bool verbose)
+{
+	uint_least8_t private[NUM_ECC_BYTES];
+	uint_least8_t public[2 * NUM_ECC_BYTES];
+	uint_least8_t decompressed[2 * NUM_ECC_BYTES];
+	uint_least8_t compressed[NUM_ECC_BYTES + 1];
+	unsigned int result = TC_PASS;
+	int i, rejected;
+
+	const struct uECC_Curve_t * curve = uECC_secp256r1();
+
+	TC_PRINT("Test #8: Point compression ");
+	TC_PRINT("NIST-p256\n");
+
+	if (uECC_curve_compressed_public_key_size(curve) != sizeof(compressed)) {
+		TC_ERROR("wrong compressed public key size\n");
+		result = TC_FAIL;
+		goto exitTest1;
+	}
+
+	/* G is 03 || Gx: */
+	uECC_vli_wordsToBytes(public, NUM_ECC_BYTES, curve->G);
+	uECC_vli_wordsToBytes(public + NUM_ECC_BYTES, NUM_ECC_BYTES,
+			      curve->G + NUM_ECC_WORDS);
+	uECC_compress(public, compressed, curve);
+	if (compressed[0] != 0x03 || compressed[1] != 0x6b) {
+		TC_ERROR("wrong encoding of G\n");
+		result = TC_FAIL;
+		goto exitTest1;
+	}
+
+	for (i = 0; i < num_tests; ++i) {
+		if (!uECC_make_key(public, private, curve)) {
+			TC_ERROR("uECC_make_key() failed\n");
+			result = TC_FAIL;
+			goto exitTest1;
+		}
+		uECC_compress(public, compressed, curve);
+		if (!uECC_decompress(compressed, decompressed, curve) ||
+		    memcmp(public, decompressed, sizeof(public)) != 0) {
+			TC_ERROR("key %d: decompression failed\n", i);
+			if (verbose) {
+				vli_print_bytes(compressed, sizeof(compressed));
+			}
+			result = TC_FAIL;
+			goto exitTest1;
+		}
+	}
+
+	/* bad prefix, and x >= p: */
+	compressed[0] = 0x04;
+	if (uECC_decompress(compressed, decompressed, curve)) {
+		TC_ERROR("prefix 04 accepted\n");
+		result = TC_FAIL;
+		goto exitTest1;
+	}
+	memset(compressed, 0xff, sizeof(compressed));
+	compressed[0] = 0x02;
+	if (uECC_decompress(compressed, decompressed, curve)) {
+		TC_ERROR("x >= p accepted\n");
+		result = TC_FAIL;
+		goto exitTest1;
+	}
+
+	/* about half of all x are not on the curve: */
+	rejected = 0;
+	memset(compressed, 0, sizeof(compressed));
+	for (i = 1; i <= 32; ++i) {
+		compressed[0] = 0x02;
+		compressed[NUM_ECC_BYTES] = (uint_least8_t)i;
+		if (!uECC_decompress(compressed, decompressed, curve)) {
+			rejected++;
+		} else if (uECC_valid_public_key(decompressed, curve) != 0) {
+			TC_ERROR("x = %d: decompressed point is not valid\n", i);
+			result = TC_FAIL;
+			goto exitTest1;
+		}
+	}
+	if (rejected == 0 || rejected == 32) {
+		TC_ERROR("%d of 32 small x rejected\n", rejected);
+		result = TC_FAIL;
+	}
+
+ exitTest1:
+        TC_END_RESULT(result);
+        return result;
+}
+
+/* keys for the batch validation test: not a multiple of uECC_LANES */
+#define VALIDATE_KEYS (4 * 8 + 5)
+
+/*
+ * Compares uECC_valid_public_keys with uECC_valid_public_key on random keys,
+ * some of them corrupted, with and without the multi-lane engine.
+ */
+int batch_validation(bool verbose)
+{
+	static uint_least8_t keys[VALIDATE_KEYS][2 * NUM_ECC_BYTES];
+	uint_least8_t private[NUM_ECC_BYTES];
+	uint_least8_t valid[(VALIDATE_KEYS + 7) / 8];
+	unsigned int result = TC_PASS;
+	unsigned int expected_valid, num_valid;
+	int i, pass, expected, got;
+
+	const struct uECC_Curve_t * curve = uECC_secp256r1();
+
+	TC_PRINT("Test #9: Batch public key validation ");
+	TC_PRINT("NIST-p256\n");
+
+	for (i = 0; i < VALIDATE_KEYS; ++i) {
+		if (!uECC_make_key(keys[i], private, curve)) {
+			TC_ERROR("uECC_make_key() failed\n");
+			result = TC_FAIL;
+			goto exitTest1;
+		}
+		switch (i % 7) {
+		case 1:		/* off the curve */
+			keys[i][2 * NUM_ECC_BYTES - 1] ^= 0x01;
+			break;
+		case 3:		/* x = p */
+			uECC_vli_wordsToBytes(keys[i], NUM_ECC_BYTES, curve->p);
+			break;
+		case 4:		/* infinity */
+			memset(keys[i], 0, sizeof(keys[i]));
+			break;
+		case 5:		/* the generator */
+			uECC_vli_wordsToBytes(keys[i], NUM_ECC_BYTES, curve->G);
+			uECC_vli_wordsToBytes(keys[i] + NUM_ECC_BYTES,
+					      NUM_ECC_BYTES,
+					      curve->G + NUM_ECC_WORDS);
+			break;
+		}
+	}
+
+	for (pass = 0; pass < 2; ++pass) {
+		uECC_set_cpu_features(pass ? 0 : ~0U);
+		memset(valid, 0xff, sizeof(valid));
+		num_valid = uECC_valid_public_keys(&keys[0][0], VALIDATE_KEYS,
+						   valid, curve);
+		expected_valid = 0;
+		for (i = 0; i < VALIDATE_KEYS; ++i) {
+			expected = uECC_valid_public_key(keys[i], curve) == 0;
+			got = (valid[i / 8] >> (i % 8)) & 1;
+			expected_valid += expected;
+			if (got != expected) {
+				TC_ERROR("pass %d, key %d: %d instead of %d\n",
+					 pass, i, got, expected);
+				result = TC_FAIL;
+				goto exitTest1;
+			}
+		}
+		if (num_valid != expected_valid) {
+			TC_ERROR("pass %d: %u valid keys instead of %u\n", pass,
+				 num_valid, expected_valid);
+			result = TC_FAIL;
+			goto exitTest1;
+		}
+	}
+
+	if (verbose) {
+		TC_PRINT("  %u of %d keys valid\n", num_valid, VALIDATE_KEYS);
+	}
+
+ exitTest1:
+	uECC_set_cpu_features(~0U);
+        TC_END_RESULT(result);
+        return result;
+}
+
+/*
+ * Compares uECC_shared_secret_prepared with uECC_shared_secret for random and
+ * edge-case private keys, and checks that invalid peer keys and private keys
+ * out of range are rejected.
+ */
+int prepared_peer(int num_tests, bool verbose)
+{
+	static uECC_PeerKeyCtx peer;
+	uint_least8_t peer_public[2 * NUM_ECC_BYTES];
+	uint_least8_t private[NUM_ECC_BYTES];
+	uint_least8_t public[2 * NUM_ECC_BYTES];
+	uint_least8_t expected[NUM_ECC_BYTES];
+	uint_least8_t computed[NUM_ECC_BYTES];
+	uECC_word_t k[NUM_ECC_WORDS];
+	unsigned int result = TC_PASS;
+	int i;
+
+	const struct uECC_Curve_t * curve = uECC_secp256r1();
+
+	TC_PRINT("Test #10: Shared secret with a prepared peer key ");
+	TC_PRINT("NIST-p256\n");
+
+	if (!uECC_make_key(peer_public, private, curve) ||
+	    !uECC_prepare_peer_key(&peer, peer_public, curve)) {
+		TC_ERROR("peer key preparation failed\n");
+		result = TC_FAIL;
+		goto exitTest1;
+	}
+
+	for (i = 0; i < num_tests; ++i) {
+		if (!uECC_make_key(public, private, curve)) {
+			TC_ERROR("uECC_make_key() failed\n");
+			result = TC_FAIL;
+			goto exitTest1;
+		}
+		if (!uECC_shared_secret(peer_public, private, expected, curve) ||
+		    !uECC_shared_secret_prepared(&peer, private, computed) ||
+		    memcmp(expected, computed, sizeof(computed)) != 0) {
+			TC_ERROR("key %d: wrong shared secret\n", i);
+			if (verbose) {
+				vli_print_bytes(private, sizeof(private));
+			}
+			result = TC_FAIL;
+			goto exitTest1;
+		}
+	}
+
+	/* k and n - k for small k, where the ladder of uECC_shared_secret only
+	 * covers k > 1 (and 1 * Q = Q): */
+	for (i = 1; i <= 3; ++i) {
+		uECC_vli_clear(k, NUM_ECC_WORDS);
+		k[0] = i;
+		uECC_vli_wordsToBytes(private, NUM_ECC_BYTES, k);
+		if (i == 1) {
+			memcpy(expected, peer_public, sizeof(expected));
+		} else if (!uECC_shared_secret(peer_public, private, expected,
+					       curve)) {
+			TC_ERROR("uECC_shared_secret() failed\n");
+			result = TC_FAIL;
+			goto exitTest1;
+		}
+		if (!uECC_shared_secret_prepared(&peer, private, computed) ||
+		    memcmp(expected, computed, sizeof(computed)) != 0) {
+			TC_ERROR("private key %d: wrong shared secret\n", i);
+			result = TC_FAIL;
+			goto exitTest1;
+		}
+		uECC_vli_sub(k, curve->n, k, NUM_ECC_WORDS);
+		uECC_vli_wordsToBytes(private, NUM_ECC_BYTES, k);
+		if (!uECC_shared_secret_prepared(&peer, private, computed) ||
+		    memcmp(expected, computed, sizeof(computed)) != 0) {
+			TC_ERROR("private key n - %d: wrong shared secret\n", i);
+			result = TC_FAIL;
+			goto exitTest1;
+		}
+	}
+
+	/* private keys 0 and n: */
+	memset(private, 0, sizeof(private));
+	if (uECC_shared_secret_prepared(&peer, private, computed)) {
+		TC_ERROR("private key 0 accepted\n");
+		result = TC_FAIL;
+		goto exitTest1;
+	}
+	uECC_vli_wordsToBytes(private, NUM_ECC_BYTES, curve->n);
+	if (uECC_shared_secret_prepared(&peer, private, computed)) {
+		TC_ERROR("private key n accepted\n");
+		result = TC_FAIL;
+		goto exitTest1;
+	}
+
+	/* a point off the curve leaves the context empty: */
+	peer_public[2 * NUM_ECC_BYTES - 1] ^= 0x01;
+	if (uECC_prepare_peer_key(&peer, peer_public, curve) ||
+	    uECC_shared_secret_prepared(&peer, expected, computed)) {
+		TC_ERROR("invalid peer key accepted\n");
+		result = TC_FAIL;
+	}
+
+ exitTest1:
+        TC_END_RESULT(result);
+        return result;
+}
+
+/* key pairs for the batch key generation test: not a multiple of the batch */
+#define BATCH_KEYS (uECC_KEYGEN_BATCH_SIZE + 7)
+
+static int failing_rng(void *state, uint_least8_t *dest, uint32_t size)
+{
+	(void)state;
+	(void)dest;
+	(void)size;
+	return 0;
+}
+
+/*
+ * Checks every key pair of uECC_make_key_batch against
+ * uECC_compute_public_key, and that an RNG failure is reported.
+ */
+int batch_keygen(bool verbose)
+{
+	static uint_least8_t public[BATCH_KEYS][2 * NUM_ECC_BYTES];
+	static uint_least8_t private[BATCH_KEYS][NUM_ECC_BYTES];
+	uint_least8_t expected[2 * NUM_ECC_BYTES];
+	unsigned int result = TC_PASS;
+	uECC_Ctx ctx;
+	int i;
+
+	const struct uECC_Curve_t * curve = uECC_secp256r1();
+
+	TC_PRINT("Test #11: Batch key generation ");
+	TC_PRINT("NIST-p256\n");
+
+	if (!uECC_make_key_batch(public[0], private[0], BATCH_KEYS, curve)) {
+		TC_ERROR("uECC_make_key_batch() failed\n");
+		result = TC_FAIL;
+		goto exitTest1;
+	}
+
+	for (i = 0; i < BATCH_KEYS; ++i) {
+		if (!uECC_compute_public_key(private[i], expected, curve) ||
+		    memcmp(expected, public[i], sizeof(expected)) != 0) {
+			TC_ERROR("key %d: wrong public key\n", i);
+			if (verbose) {
+				vli_print_bytes(private[i], sizeof(private[i]));
+			}
+			result = TC_FAIL;
+			goto exitTest1;
+		}
+		if (i > 0 && memcmp(private[i], private[i - 1],
+				    sizeof(private[i])) == 0) {
+			TC_ERROR("key %d: repeated private key\n", i);
+			result = TC_FAIL;
+			goto exitTest1;
+		}
+	}
+
+	(void)uECC_ctx_init(&ctx, failing_rng, 0);
+	if (uECC_make_key_batch_ctx(&ctx, public[0], private[0], BATCH_KEYS,
+				    curve)) {
+		TC_ERROR("RNG failure not reported\n");
+		result = TC_FAIL;
+	}
+
+ exitTest1:
+        TC_END_RESULT(result);
+        return result;
+}
+
+/*
+ * secp256k1 through the curve hooks: known key pair and shared secret,
+ * random key agreements, and point compression (p = 3 mod 4 square roots).
+ */
+int secp256k1_dh(int num_tests, bool verbose)
+{
+	uint_least8_t private[2][NUM_ECC_BYTES];
+	uint_least8_t public[2][2 * NUM_ECC_BYTES];
+	uint_least8_t expected[2 * NUM_ECC_BYTES];
+	uint_least8_t secret[2][NUM_ECC_BYTES];
+	uint_least8_t compressed[NUM_ECC_BYTES + 1];
+	unsigned int result = TC_PASS;
+	int i;
+
+	const struct uECC_Curve_t * curve = uECC_secp256k1();
+
+	TC_PRINT("Test #12: EC-DH on secp256k1 ");
+	TC_PRINT("secp256k1\n");
+
+	(void)hex2bin(private[0], NUM_ECC_BYTES,
+		"e263435d7f22cf4cc4c0afb8dc4ec329f5ddde3896a87eb96ab58655e20cad64",
+		2 * NUM_ECC_BYTES);
+	(void)hex2bin(expected, 2 * NUM_ECC_BYTES,
+		"5d479869ca24497abab18243ea162c816edf6ef0c42e4b149f3c955accabd62f"
+		"954076ca7f14f2d48ce580cf5b899c9526fc73f6c260f9fc8398767d7515dbca",
+		4 * NUM_ECC_BYTES);
+	if (!uECC_compute_public_key(private[0], public[0], curve) ||
+	    memcmp(public[0], expected, sizeof(expected)) != 0 ||
+	    uECC_valid_public_key(public[0], curve) != 0) {
+		TC_ERROR("wrong public key\n");
+		result = TC_FAIL;
+		goto exitTest1;
+	}
+
+	(void)hex2bin(private[1], NUM_ECC_BYTES,
+		"f98525bffae47362768f7d8e3b15f335db92084684aef52215b23cff29d6f916",
+		2 * NUM_ECC_BYTES);
+	(void)hex2bin(expected, NUM_ECC_BYTES,
+		"b068e6d4c1a0e701d15fa9a0a3ba1834d193d6d493c08772509067c301cb99fa",
+		2 * NUM_ECC_BYTES);
+	if (!uECC_compute_public_key(private[1], public[1], curve) ||
+	    !uECC_shared_secret(public[1], private[0], secret[0], curve) ||
+	    memcmp(secret[0], expected, NUM_ECC_BYTES) != 0) {
+		TC_ERROR("wrong shared secret\n");
+		result = TC_FAIL;
+		goto exitTest1;
+	}
+
+	for (i = 0; i < num_tests; ++i) {
+		if (!uECC_make_key(public[0], private[0], curve) ||
+		    !uECC_make_key(public[1], private[1], curve)) {
+			TC_ERROR("uECC_make_key() failed\n");
+			result = TC_FAIL;
+			goto exitTest1;
+		}
+		if (!uECC_shared_secret(public[1], private[0], secret[0], curve) ||
+		    !uECC_shared_secret(public[0], private[1], secret[1], curve) ||
+		    memcmp(secret[0], secret[1], NUM_ECC_BYTES) != 0) {
+			TC_ERROR("key %d: shared secrets differ\n", i);
+			if (verbose) {
+				vli_print_bytes(private[0], NUM_ECC_BYTES);
+			}
+			result = TC_FAIL;
+			goto exitTest1;
+		}
+		uECC_compress(public[0], compressed, curve);
+		if (!uECC_decompress(compressed, expected, curve) ||
+		    memcmp(public[0], expected, 2 * NUM_ECC_BYTES) != 0) {
+			TC_ERROR("key %d: decompression failed\n", i);
+			result = TC_FAIL;
+			goto exitTest1;
+		}
+	}
+
+	/* a P-256 key is not a secp256k1 key: */
+	if (!uECC_make_key(public[0], private[0], uECC_secp256r1()) ||
+	    uECC_valid_public_key(public[0], curve) == 0) {
+		TC_ERROR("P-256 key accepted\n");
+		result = TC_FAIL;
+	}
+
+ exitTest1:
+        TC_END_RESULT(result);
+        return result;
+}
+
+/* enough points for both sides of the Straus/Pippenger threshold: */
+#define MSM_POINTS (uECC_MSM_STRAUS_MAX + 40)
+
+/*
+ * Checks sum(k_i P_i) against (sum(k_i a_i) mod n) G for P_i = a_i G, on both
+ * sides of the Straus/Pippenger threshold, with repeated points in every sum
+ * and a last term that cancels the first one when two points are left.
+ */
+int multi_scalar_mult(bool verbose)
+{
+        static uECC_word_t points[MSM_POINTS][2 * NUM_ECC_WORDS];
+        static uECC_word_t scalars[MSM_POINTS][NUM_ECC_WORDS];
+        static uECC_word_t scratch[64 * 1024];
+        uECC_word_t logs[MSM_POINTS][NUM_ECC_WORDS];
+        uECC_word_t sum[NUM_ECC_WORDS];
+        uECC_word_t tmp[NUM_ECC_WORDS];
+        uECC_word_t X[NUM_ECC_WORDS], Y[NUM_ECC_WORDS], Z[NUM_ECC_WORDS];
+        uECC_word_t expected[2 * NUM_ECC_WORDS];
+        uECC_word_t computed[2 * NUM_ECC_WORDS];
+        unsigned int sizes[] = { 1, 2, 3, uECC_MSM_STRAUS_MAX,
+                                 uECC_MSM_STRAUS_MAX + 1, 64, MSM_POINTS };
+        unsigned int result = TC_PASS;
+        unsigned int s, i, n;
+        int c;
+
+        TC_PRINT("Test #13: Multi-scalar multiplication ");
+        TC_PRINT("NIST-p256 and secp256k1\n");
+
+        for (c = 0; c < 2; ++c) {
+                uECC_Curve curve = c ? uECC_secp256k1() : uECC_secp256r1();
+                wordcount_t num_words = curve->num_words;
+
+                for (i = 0; i < MSM_POINTS; ++i) {
+                        if (i % 5 == 4) {
+                                /* the same point as two terms back */
+                                uECC_vli_set(logs[i], logs[i - 2], num_words);
+                        } else {
+                                uECC_generate_random_int(logs[i], curve->n,
+                                                         num_words);
+                        }
+                        (void)EccPoint_compute_public_key(points[i], logs[i],
+                                                          curve);
+                        uECC_generate_random_int(scalars[i], curve->n, num_words);
+                }
+
+                for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+                        n = sizes[s];
+                        if (EccPoint_mult_multi_scratch_words(n, curve) >
+                            sizeof(scratch) / sizeof(scratch[0])) {
+                                TC_ERROR("%u points: scratch too large\n", n);
+                                result = TC_FAIL;
+                                goto exitTest1;
+                        }
+                        if (n == 2) {
+                                /* k G + (n - k) G = infinity */
+                                uECC_vli_set(logs[1], logs[0], num_words);
+                                uECC_vli_set(points[1], points[0], 2 * num_words);
+                                uECC_vli_sub(scalars[1], curve->n, scalars[0],
+                                             num_words);
+                        }
+
+                        uECC_vli_clear(sum, num_words);
+                        for (i = 0; i < n; ++i) {
+                                uECC_vli_modMult(tmp, scalars[i], logs[i], curve->n,
+                                                 num_words);
+                                uECC_vli_modAdd(sum, sum, tmp, curve->n, num_words);
+                        }
+
+                        EccPoint_mult_multi(X, Y, Z, scalars[0], points[0], n,
+                                            scratch, curve);
+
+                        if (uECC_vli_isZero(sum, num_words)) {
+                                if (!uECC_vli_isZero(Z, num_words)) {
+                                        TC_ERROR("%u points: infinity expected\n", n);
+                                        result = TC_FAIL;
+                                        goto exitTest1;
+                                }
+                                continue;
+                        }
+                        (void)EccPoint_compute_public_key(expected, sum, curve);
+                        uECC_vli_modInv(tmp, Z, curve->p, num_words);
+                        apply_z(X, Y, tmp, curve);
+                        uECC_vli_set(computed, X, num_words);
+                        uECC_vli_set(computed + num_words, Y, num_words);
+
+                        result = check_ecc_result(n, "sum(k_i P_i)", expected,
+                                                  computed, 2 * NUM_ECC_WORDS,
+                                                  verbose);
+                        if (result == TC_FAIL) {
+                                goto exitTest1;
+                        }
+                }
+        }
+
+ exitTest1:
+        TC_END_RESULT(result);
+        return result;
+}
+
 int main()
 {
         unsigned int result = TC_PASS;
@@ -513,6 +1304,69 @@ int main()
                 goto exitTest;
         }
 
+	TC_PRINT("Performing fixed_base_mult test:\n");
+	result = fixed_base_mult(32, false);
+        if (result == TC_FAIL) { /* terminate test */
+                TC_ERROR("fixed_base_mult test failed.\n");
+                goto exitTest;
+        }
+
+	TC_PRINT("Performing modular_inverse test:\n");
+	result = modular_inverse(256, false);
+        if (result == TC_FAIL) { /* terminate test */
+                TC_ERROR("modular_inverse test failed.\n");
+                goto exitTest;
+        }
+
+	TC_PRINT("Performing field_kernels test:\n");
+	result = field_kernels(1024, false);
+        if (result == TC_FAIL) { /* terminate test */
+                TC_ERROR("field_kernels test failed.\n");
+                goto exitTest;
+        }
+
+	TC_PRINT("Performing point_compression test:\n");
+	result = point_compression(64, false);
+        if (result == TC_FAIL) { /* terminate test */
+                TC_ERROR("point_compression test failed.\n");
+                goto exitTest;
+        }
+
+	TC_PRINT("Performing batch_validation test:\n");
+	result = batch_validation(false);
+        if (result == TC_FAIL) { /* terminate test */
+                TC_ERROR("batch_validation test failed.\n");
+                goto exitTest;
+        }
+
+	TC_PRINT("Performing prepared_peer test:\n");
+	result = prepared_peer(64, false);
+        if (result == TC_FAIL) { /* terminate test */
+                TC_ERROR("prepared_peer test failed.\n");
+                goto exitTest;
+        }
+
+	TC_PRINT("Performing batch_keygen test:\n");
+	result = batch_keygen(false);
+        if (result == TC_FAIL) { /* terminate test */
+                TC_ERROR("batch_keygen test failed.\n");
+                goto exitTest;
+        }
+
+	TC_PRINT("Performing secp256k1_dh test:\n");
+	result = secp256k1_dh(16, false);
+        if (result == TC_FAIL) { /* terminate test */
+                TC_ERROR("secp256k1_dh test failed.\n");
+                goto exitTest;
+        }
+
+	TC_PRINT("Performing multi_scalar_mult test:\n");
+	result = multi_scalar_mult(false);
+        if (result == TC_FAIL) { /* terminate test */
+                TC_ERROR("multi_scalar_mult test failed.\n");
+                goto exitTest;
+        }
+
         TC_PRINT("All EC-DH tests succeeded!\n");
 
  exitTest:
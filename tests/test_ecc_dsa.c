@@ -61,6 +61,8 @@
 #include <tinycrypt/ecc_dh.h>
 #include <tinycrypt/constants.h>
 #include <tinycrypt/sha256.h>
+#include <tinycrypt/hmac_prng.h>
+#include <tinycrypt/utils.h>
 #include <test_utils.h>
 #include <test_ecc_utils.h>
 
@@ -69,6 +71,7 @@
 #include <string.h>
 
 #include <fcntl.h>
+#include <pthread.h>
 
 /* Maximum size of message to be signed. */
 #define BUF_SIZE 256
@@ -78,18 +81,18 @@ int sign_vectors(TCSha256State_t hash, char **d_vec, char **k_vec,
 		 char **s_vec, int tests, bool verbose)
 {
 
-	unsigned int k[NUM_ECC_WORDS];
-	unsigned int private[NUM_ECC_WORDS];
+	uECC_word_t k[NUM_ECC_WORDS];
+	uECC_word_t private[NUM_ECC_WORDS];
 	uint_least8_t private_bytes[NUM_ECC_BYTES];
-	unsigned int sig[2 * NUM_ECC_WORDS];
+	uECC_word_t sig[2 * NUM_ECC_WORDS];
 	uint_least8_t sig_bytes[2 * NUM_ECC_BYTES];
-	unsigned int digest[TC_SHA256_DIGEST_SIZE / 4];
+	uECC_word_t digest[NUM_ECC_WORDS];
 	uint_least8_t  digest_bytes[TC_SHA256_DIGEST_SIZE];
 	unsigned int result = TC_PASS;
 
 	/* expected outputs (converted input vectors) */
-	unsigned int exp_r[NUM_ECC_WORDS];
-	unsigned int exp_s[NUM_ECC_WORDS];
+	uECC_word_t exp_r[NUM_ECC_WORDS];
+	uECC_word_t exp_s[NUM_ECC_WORDS];
 
 	uint_least8_t msg[BUF_SIZE];
 	size_t msglen;
@@ -99,7 +102,7 @@ int sign_vectors(TCSha256State_t hash, char **d_vec, char **k_vec,
 		/* use keygen test to generate and validate pubkey */
 		keygen_vectors(d_vec+i, qx_vec+i, qy_vec+i, 1, false);
 		string2scalar(private, NUM_ECC_WORDS, d_vec[i]);
-		uECC_vli_nativeToBytes(private_bytes, NUM_ECC_BYTES, private);
+		uECC_vli_wordsToBytes(private_bytes, NUM_ECC_BYTES, private);
 
 		/* validate ECDSA: hash message, sign digest, check r+s */
 		memset(k, 0, NUM_ECC_BYTES);
@@ -121,14 +124,14 @@ int sign_vectors(TCSha256State_t hash, char **d_vec, char **k_vec,
 
 		/* if digest larger than ECC scalar, drop the end
 		 * if digest smaller than ECC scalar, zero-pad front */
-		int hash_dwords = TC_SHA256_DIGEST_SIZE / 4;
-		if (NUM_ECC_WORDS < hash_dwords) {
-			hash_dwords = NUM_ECC_WORDS;
+		int hash_words = TC_SHA256_DIGEST_SIZE / uECC_WORD_SIZE;
+		if (NUM_ECC_WORDS < hash_words) {
+			hash_words = NUM_ECC_WORDS;
 		}
 
-		memset(digest, 0, NUM_ECC_BYTES - 4 * hash_dwords);
-		uECC_vli_bytesToNative(digest + (NUM_ECC_WORDS-hash_dwords),
-				        digest_bytes, TC_SHA256_DIGEST_SIZE);
+		memset(digest, 0, NUM_ECC_BYTES - uECC_WORD_SIZE * hash_words);
+		uECC_vli_bytesToWords(digest + (NUM_ECC_WORDS-hash_words),
+				       digest_bytes, TC_SHA256_DIGEST_SIZE);
 
 		if (uECC_sign_with_k(private_bytes, digest_bytes, 
 		    sizeof(digest_bytes), k, sig_bytes, uECC_secp256r1()) == 0) {
@@ -137,8 +140,8 @@ int sign_vectors(TCSha256State_t hash, char **d_vec, char **k_vec,
 			goto exitTest1;
 		}
 
-		uECC_vli_bytesToNative(sig, sig_bytes, NUM_ECC_BYTES);
-		uECC_vli_bytesToNative(sig + NUM_ECC_WORDS, sig_bytes+NUM_ECC_BYTES, NUM_ECC_BYTES);
+		uECC_vli_bytesToWords(sig, sig_bytes, NUM_ECC_BYTES);
+		uECC_vli_bytesToWords(sig + NUM_ECC_WORDS, sig_bytes+NUM_ECC_BYTES, NUM_ECC_BYTES);
 
 		result = check_ecc_result(i, "sig.r", exp_r, sig,  NUM_ECC_WORDS, verbose);
 		if(result == TC_FAIL) {
@@ -345,12 +348,12 @@ int vrfy_vectors(TCSha256State_t hash, char **msg_vec, char **qx_vec, char **qy_
 {
 
 	const struct uECC_Curve_t * curve = uECC_secp256r1();
-	unsigned int pub[2 * NUM_ECC_WORDS];
+	uECC_word_t pub[2 * NUM_ECC_WORDS];
 	uint_least8_t pub_bytes[2 * NUM_ECC_BYTES];
-	unsigned int sig[2 * NUM_ECC_WORDS];
+	uECC_word_t sig[2 * NUM_ECC_WORDS];
 	uint_least8_t sig_bytes[2 * NUM_ECC_BYTES];
 	uint_least8_t  digest_bytes[TC_SHA256_DIGEST_SIZE];
-	unsigned int digest[TC_SHA256_DIGEST_SIZE / 4];
+	uECC_word_t digest[NUM_ECC_WORDS];
 	unsigned int result = TC_PASS;
 
 	int rc;
@@ -388,27 +391,27 @@ int vrfy_vectors(TCSha256State_t hash, char **msg_vec, char **qx_vec, char **qy_
 
 		/* if digest larger than ECC scalar, drop the end
 		 * if digest smaller than ECC scalar, zero-pad front */
-		int hash_dwords = TC_SHA256_DIGEST_SIZE / 4;
-		if (NUM_ECC_WORDS < hash_dwords) {
-			hash_dwords = NUM_ECC_WORDS;
+		int hash_words = TC_SHA256_DIGEST_SIZE / uECC_WORD_SIZE;
+		if (NUM_ECC_WORDS < hash_words) {
+			hash_words = NUM_ECC_WORDS;
 		}
 
-		memset(digest, 0, NUM_ECC_BYTES - 4 * hash_dwords);
-		uECC_vli_bytesToNative(digest + (NUM_ECC_WORDS-hash_dwords), digest_bytes,
-				       TC_SHA256_DIGEST_SIZE);
+		memset(digest, 0, NUM_ECC_BYTES - uECC_WORD_SIZE * hash_words);
+		uECC_vli_bytesToWords(digest + (NUM_ECC_WORDS-hash_words), digest_bytes,
+				      TC_SHA256_DIGEST_SIZE);
 
-		uECC_vli_nativeToBytes(pub_bytes, NUM_ECC_BYTES, pub);
-		uECC_vli_nativeToBytes(pub_bytes + NUM_ECC_BYTES, NUM_ECC_BYTES, 
-				       pub + NUM_ECC_WORDS);
+		uECC_vli_wordsToBytes(pub_bytes, NUM_ECC_BYTES, pub);
+		uECC_vli_wordsToBytes(pub_bytes + NUM_ECC_BYTES, NUM_ECC_BYTES, 
+				      pub + NUM_ECC_WORDS);
 
 		/* adapt return codes to match CAVP error: */
 		if (0 != uECC_valid_public_key(pub_bytes, curve)) {
 			/* error 4 - Q changed */
 			rc = 4;
 		} else {
-			uECC_vli_nativeToBytes(sig_bytes, NUM_ECC_BYTES, sig);
-			uECC_vli_nativeToBytes(sig_bytes + NUM_ECC_BYTES, NUM_ECC_BYTES,
-					       sig + NUM_ECC_WORDS);
+			uECC_vli_wordsToBytes(sig_bytes, NUM_ECC_BYTES, sig);
+			uECC_vli_wordsToBytes(sig_bytes + NUM_ECC_BYTES, NUM_ECC_BYTES,
+					      sig + NUM_ECC_WORDS);
 
 			rc = uECC_verify(pub_bytes, digest_bytes, sizeof(digest_bytes), sig_bytes,
 									 uECC_secp256r1());
@@ -595,7 +598,7 @@ int montecarlo_signverify(int num_tests, bool verbose)
 	uint_least8_t private[NUM_ECC_BYTES];
 	uint_least8_t public[2*NUM_ECC_BYTES];
 	uint_least8_t hash[NUM_ECC_BYTES];
-	unsigned int hash_words[NUM_ECC_WORDS];
+	uECC_word_t hash_words[NUM_ECC_WORDS];
 	uint_least8_t sig[2*NUM_ECC_BYTES];
 
 	const struct uECC_Curve_t * curve = uECC_secp256r1();
@@ -607,7 +610,7 @@ int montecarlo_signverify(int num_tests, bool verbose)
 		}
 
 		uECC_generate_random_int(hash_words, curve->n, BITS_TO_WORDS(curve->num_n_bits));
-		uECC_vli_nativeToBytes(hash, NUM_ECC_BYTES, hash_words);
+		uECC_vli_wordsToBytes(hash, NUM_ECC_BYTES, hash_words);
 
 		if (!uECC_make_key(public, private, curve)) {
 			TC_ERROR("uECC_make_key() failed\n");
@@ -632,6 +635,816 @@ int montecarlo_signverify(int num_tests, bool verbose)
 	return TC_PASS;
 }
 
+/* number of signatures for the batch test, spanning more than one chunk: */
+#define BATCH_TESTS (uECC_VERIFY_BATCH_SIZE + 4)
+
+int batch_verify(bool verbose)
+{
+	printf("Test #4: Batch verification (%d EC-DSA signatures) ", BATCH_TESTS);
+	printf("NIST-p256, SHA2-256\n");
+	static uint_least8_t public[BATCH_TESTS][2*NUM_ECC_BYTES];
+	static uint_least8_t hash[BATCH_TESTS][NUM_ECC_BYTES];
+	static uint_least8_t sig[BATCH_TESTS][2*NUM_ECC_BYTES];
+	const uint_least8_t *keys[BATCH_TESTS];
+	const uint_least8_t *hashes[BATCH_TESTS];
+	const uint_least8_t *sigs[BATCH_TESTS];
+	int results[BATCH_TESTS];
+	uint_least8_t private[NUM_ECC_BYTES];
+	uECC_word_t hash_words[NUM_ECC_WORDS];
+	int i, rc;
+
+	const struct uECC_Curve_t * curve = uECC_secp256r1();
+
+	for (i = 0; i < BATCH_TESTS; ++i) {
+		uECC_generate_random_int(hash_words, curve->n, BITS_TO_WORDS(curve->num_n_bits));
+		uECC_vli_wordsToBytes(hash[i], NUM_ECC_BYTES, hash_words);
+
+		if (!uECC_make_key(public[i], private, curve) ||
+		    !uECC_sign(private, hash[i], sizeof(hash[i]), sig[i], curve)) {
+			TC_ERROR("failed to generate a signature\n");
+			return TC_FAIL;
+		}
+		keys[i] = public[i];
+		hashes[i] = hash[i];
+		sigs[i] = sig[i];
+	}
+
+	rc = uECC_verify_batch(keys, hashes, NUM_ECC_BYTES, sigs, BATCH_TESTS,
+			       results, curve);
+	for (i = 0; i < BATCH_TESTS; ++i) {
+		if (results[i] != 1) {
+			rc = 0;
+		}
+	}
+	if (rc != 1) {
+		TC_ERROR("a valid batch was rejected\n");
+		return TC_FAIL;
+	}
+
+	/* spoil a few entries, in both chunks: */
+	sig[1][2 * NUM_ECC_BYTES - 1] ^= 1;		/* s changed */
+	memset(sig[3] + NUM_ECC_BYTES, 0, NUM_ECC_BYTES);	/* s = 0 */
+	hash[4][0] ^= 0x80;				/* message changed */
+	public[6][NUM_ECC_BYTES] ^= 1;			/* Q off the curve */
+	sig[BATCH_TESTS - 2][0] ^= 0x40;		/* r changed */
+	hashes[BATCH_TESTS - 1] = hash[0];		/* wrong message */
+
+	rc = uECC_verify_batch(keys, hashes, NUM_ECC_BYTES, sigs, BATCH_TESTS,
+			       results, curve);
+	if (rc != 0) {
+		TC_ERROR("an invalid batch was accepted\n");
+		return TC_FAIL;
+	}
+	for (i = 0; i < BATCH_TESTS; ++i) {
+		int expected = uECC_verify(keys[i], hashes[i], NUM_ECC_BYTES,
+					   sigs[i], curve);
+		if (results[i] != expected) {
+			TC_ERROR("signature %d: batch says %d, uECC_verify says %d\n",
+				 i, results[i], expected);
+			return TC_FAIL;
+		}
+		if (verbose && !expected) {
+			TC_PRINT("  signature %d rejected as expected\n", i);
+		}
+	}
+	return TC_PASS;
+}
+
+/* Returns true if cache holds an entry for public_key. */
+static bool cache_holds(const uECC_PublicKeyCache *cache,
+			const uint_least8_t *public_key)
+{
+	for (int i = 0; i < uECC_KEY_CACHE_SIZE; ++i) {
+		if (cache->last_used[i] &&
+		    memcmp(cache->entries[i].key, public_key, 2*NUM_ECC_BYTES) == 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+int prepared_verify(bool verbose)
+{
+	printf("Test #5: Prepared public keys and key cache ");
+	printf("NIST-p256, SHA2-256\n");
+	static uint_least8_t public[uECC_KEY_CACHE_SIZE + 1][2*NUM_ECC_BYTES];
+	static uECC_PublicKeyCache cache;
+	uECC_PublicKeyCtx ctx;
+	uint_least8_t private[NUM_ECC_BYTES];
+	uint_least8_t hash[NUM_ECC_BYTES];
+	uint_least8_t sig[2*NUM_ECC_BYTES];
+	uint_least8_t bad[2*NUM_ECC_BYTES];
+	uint_least8_t generator[2*NUM_ECC_BYTES];
+	uECC_word_t hash_words[NUM_ECC_WORDS];
+	int i;
+
+	const struct uECC_Curve_t * curve = uECC_secp256r1();
+
+	uECC_generate_random_int(hash_words, curve->n, BITS_TO_WORDS(curve->num_n_bits));
+	uECC_vli_wordsToBytes(hash, NUM_ECC_BYTES, hash_words);
+	for (i = 0; i <= uECC_KEY_CACHE_SIZE; ++i) {
+		if (!uECC_make_key(public[i], private, curve)) {
+			TC_ERROR("uECC_make_key() failed\n");
+			return TC_FAIL;
+		}
+	}
+	/* the signature is made with the last key: */
+	if (!uECC_sign(private, hash, sizeof(hash), sig, curve)) {
+		TC_ERROR("uECC_sign() failed\n");
+		return TC_FAIL;
+	}
+
+	if (!uECC_prepare_public_key(&ctx, public[uECC_KEY_CACHE_SIZE], curve) ||
+	    !uECC_verify_prepared(&ctx, hash, sizeof(hash), sig)) {
+		TC_ERROR("valid signature rejected with a prepared key\n");
+		return TC_FAIL;
+	}
+	memcpy(bad, sig, sizeof(sig));
+	bad[NUM_ECC_BYTES] ^= 1;
+	if (uECC_verify_prepared(&ctx, hash, sizeof(hash), bad)) {
+		TC_ERROR("invalid signature accepted with a prepared key\n");
+		return TC_FAIL;
+	}
+	memcpy(bad, public[0], sizeof(bad));
+	bad[2*NUM_ECC_BYTES - 1] ^= 1;
+	if (uECC_prepare_public_key(&ctx, bad, curve) ||
+	    uECC_verify_prepared(&ctx, hash, sizeof(hash), sig)) {
+		TC_ERROR("a key off the curve was prepared\n");
+		return TC_FAIL;
+	}
+	/* the generator is rejected as by uECC_valid_public_key: */
+	uECC_vli_wordsToBytes(generator, curve->num_bytes, curve->G);
+	uECC_vli_wordsToBytes(generator + curve->num_bytes, curve->num_bytes,
+			      curve->G + curve->num_words);
+	if (uECC_valid_public_key(generator, curve) == 0 ||
+	    uECC_prepare_public_key(&ctx, generator, curve)) {
+		TC_ERROR("the generator was prepared as a public key\n");
+		return TC_FAIL;
+	}
+	if (verbose) {
+		TC_PRINT("  prepared key: ok\n");
+	}
+
+	/* fill the cache, then make the first key the most recently used: */
+	uECC_key_cache_init(&cache);
+	for (i = 0; i < uECC_KEY_CACHE_SIZE; ++i) {
+		if (uECC_verify_cached(&cache, public[i], hash, sizeof(hash), sig,
+				       curve)) {
+			TC_ERROR("signature accepted under the wrong key\n");
+			return TC_FAIL;
+		}
+	}
+	if (uECC_key_cache_get(&cache, public[0], curve) == 0) {
+		TC_ERROR("cache lookup failed\n");
+		return TC_FAIL;
+	}
+
+	/* an invalid key is neither cached nor evicts anything: */
+	if (uECC_key_cache_get(&cache, bad, curve) != 0) {
+		TC_ERROR("a key off the curve was cached\n");
+		return TC_FAIL;
+	}
+	if (uECC_key_cache_get(&cache, generator, curve) != 0) {
+		TC_ERROR("the generator was cached\n");
+		return TC_FAIL;
+	}
+	for (i = 0; i < uECC_KEY_CACHE_SIZE; ++i) {
+		if (!cache_holds(&cache, public[i])) {
+			TC_ERROR("an invalid key evicted a cache entry\n");
+			return TC_FAIL;
+		}
+	}
+
+	/* a new key evicts the least recently used one, public[1]: */
+	if (!uECC_verify_cached(&cache, public[uECC_KEY_CACHE_SIZE], hash,
+				sizeof(hash), sig, curve) ||
+	    !uECC_verify_cached(&cache, public[uECC_KEY_CACHE_SIZE], hash,
+				sizeof(hash), sig, curve)) {
+		TC_ERROR("valid signature rejected through the cache\n");
+		return TC_FAIL;
+	}
+	if (!cache_holds(&cache, public[0]) ||
+	    (uECC_KEY_CACHE_SIZE > 1 && cache_holds(&cache, public[1])) ||
+	    !cache_holds(&cache, public[uECC_KEY_CACHE_SIZE])) {
+		TC_ERROR("wrong entry evicted from the cache\n");
+		return TC_FAIL;
+	}
+	if (verbose) {
+		TC_PRINT("  key cache: ok\n");
+	}
+	return TC_PASS;
+}
+
+/* Returns true if two Jacobian points are the same (Z == 0 is infinity). */
+static bool same_point(const uECC_word_t *X1, const uECC_word_t *Y1,
+		       const uECC_word_t *Z1, const uECC_word_t *X2,
+		       const uECC_word_t *Y2, const uECC_word_t *Z2,
+		       uECC_Curve curve)
+{
+	uECC_word_t z1[NUM_ECC_WORDS], z2[NUM_ECC_WORDS];
+	uECC_word_t a[NUM_ECC_WORDS], b[NUM_ECC_WORDS];
+
+	if (uECC_vli_isZero(Z1, NUM_ECC_WORDS) ||
+	    uECC_vli_isZero(Z2, NUM_ECC_WORDS)) {
+		return uECC_vli_isZero(Z1, NUM_ECC_WORDS) &&
+		       uECC_vli_isZero(Z2, NUM_ECC_WORDS);
+	}
+
+	/* x1 z2^2 == x2 z1^2 and y1 z2^3 == y2 z1^3: */
+	uECC_vli_modMult_fast(z1, Z1, Z1, curve);
+	uECC_vli_modMult_fast(z2, Z2, Z2, curve);
+	uECC_vli_modMult_fast(a, X1, z2, curve);
+	uECC_vli_modMult_fast(b, X2, z1, curve);
+	if (uECC_vli_equal(a, b, NUM_ECC_WORDS) != 0) {
+		return false;
+	}
+	uECC_vli_modMult_fast(z1, z1, Z1, curve);
+	uECC_vli_modMult_fast(z2, z2, Z2, curve);
+	uECC_vli_modMult_fast(a, Y1, z2, curve);
+	uECC_vli_modMult_fast(b, Y2, z1, curve);
+	return uECC_vli_equal(a, b, NUM_ECC_WORDS) == 0;
+}
+
+#define LANE_TESTS 16
+#define LANE_WIDTH 5
+
+/*
+ * Checks the multi-lane engine against EccPoint_mult_wnaf: u1 G + u2 Q_l in
+ * each lane, with u1 == 0 (lane 0), u1 == u2 == 0 (lane 1), u1 == 1 (lane 2)
+ * and u1 == n - 1 (lane 3) among random scalars. Lane 7 adds G to itself
+ * (Q = G, u2 == u1), which the engine must leave to the caller.
+ */
+int lanes_verify(bool verbose)
+{
+	printf("Test #6: Multi-lane wNAF (%d x %d lanes) ", LANE_TESTS, uECC_LANES);
+	printf("NIST-p256\n");
+	static uECC_word_t tables[uECC_LANES][(1 << (LANE_WIDTH - 2)) * 2 * NUM_ECC_WORDS];
+	uECC_word_t u[uECC_LANES * 2][NUM_ECC_WORDS];
+	uECC_word_t X[uECC_LANES * NUM_ECC_WORDS];
+	uECC_word_t Y[uECC_LANES * NUM_ECC_WORDS];
+	uECC_word_t Z[uECC_LANES * NUM_ECC_WORDS];
+	uECC_word_t x[NUM_ECC_WORDS], y[NUM_ECC_WORDS], z[NUM_ECC_WORDS];
+	uECC_word_t point[2 * NUM_ECC_WORDS];
+	uint_least8_t public[2 * NUM_ECC_BYTES];
+	uint_least8_t private[NUM_ECC_BYTES];
+	const uECC_word_t *scalars[uECC_LANES * 2];
+	const uECC_word_t *term_tables[uECC_LANES * 2];
+	wordcount_t widths[2] = {LANE_WIDTH, LANE_WIDTH};
+	unsigned int done = 0;
+	int i, l;
+
+	const struct uECC_Curve_t * curve = uECC_secp256r1();
+
+	for (i = 0; i < LANE_TESTS; ++i) {
+		for (l = 0; l < uECC_LANES; ++l) {
+			if (l == uECC_LANES - 1) {
+				uECC_vli_set(point, curve->G, 2 * NUM_ECC_WORDS);
+			} else {
+				if (!uECC_make_key(public, private, curve)) {
+					TC_ERROR("failed to generate a key\n");
+					return TC_FAIL;
+				}
+				uECC_vli_bytesToWords(point, public, NUM_ECC_BYTES);
+				uECC_vli_bytesToWords(point + NUM_ECC_WORDS,
+						      public + NUM_ECC_BYTES,
+						      NUM_ECC_BYTES);
+			}
+			EccPoint_odd_multiples(tables[l], point, LANE_WIDTH, curve);
+			uECC_generate_random_int(u[2 * l], curve->n, NUM_ECC_WORDS);
+			uECC_generate_random_int(u[2 * l + 1], curve->n,
+						 NUM_ECC_WORDS);
+		}
+		uECC_vli_clear(u[0], NUM_ECC_WORDS);
+		uECC_vli_clear(u[2], NUM_ECC_WORDS);
+		uECC_vli_clear(u[3], NUM_ECC_WORDS);
+		uECC_vli_clear(u[4], NUM_ECC_WORDS);
+		u[4][0] = 1;
+		uECC_vli_sub(u[6], curve->n, u[4], NUM_ECC_WORDS);
+		uECC_vli_set(u[2 * uECC_LANES - 1], u[2 * uECC_LANES - 2],
+			     NUM_ECC_WORDS);
+
+		for (l = 0; l < uECC_LANES; ++l) {
+			scalars[2 * l] = u[2 * l];
+			scalars[2 * l + 1] = u[2 * l + 1];
+			term_tables[2 * l] = tables[uECC_LANES - 1]; /* G */
+			term_tables[2 * l + 1] = tables[l];
+		}
+
+		done = EccPoint_mult_wnaf_x8(X, Y, Z, scalars, term_tables,
+					     widths, 2, curve);
+		if (done & (1u << (uECC_LANES - 1))) {
+			TC_ERROR("the engine did not leave out G + G\n");
+			return TC_FAIL;
+		}
+		for (l = 0; l < uECC_LANES; ++l) {
+			if (!(done & (1u << l))) {
+				continue;
+			}
+			EccPoint_mult_wnaf(x, y, z, scalars + 2 * l,
+					   term_tables + 2 * l, widths, 2, curve);
+			if (!same_point(X + l * NUM_ECC_WORDS,
+					Y + l * NUM_ECC_WORDS,
+					Z + l * NUM_ECC_WORDS, x, y, z, curve)) {
+				TC_ERROR("test %d, lane %d: wrong point\n", i, l);
+				return TC_FAIL;
+			}
+		}
+	}
+
+	if (verbose) {
+		TC_PRINT("  %s\n", done ? "multi-lane engine in use" :
+			 "no multi-lane engine on this CPU");
+	}
+	return TC_PASS;
+}
+
+/* signatures for the nonce pool test: the pool runs dry twice */
+#define POOL_TESTS (2 * uECC_NONCE_POOL_SIZE + 1)
+
+/* signatures made while another thread refills the pool: */
+#define POOL_THREAD_TESTS (4 * uECC_NONCE_POOL_SIZE)
+
+/* Producer thread: puts POOL_THREAD_TESTS nonces, waiting while it is full. */
+static void *pool_producer(void *arg)
+{
+	uECC_NoncePool *pool = arg;
+	uECC_Nonce nonce;
+	int made = 0;
+
+	while (made < POOL_THREAD_TESTS) {
+		if (!uECC_nonce_make(&nonce, pool->curve)) {
+			return arg;
+		}
+		while (!uECC_nonce_pool_put(pool, &nonce)) {
+			/* full: the consumer frees a slot eventually */
+			if (!uECC_nonce_make(&nonce, pool->curve)) {
+				return arg;
+			}
+		}
+		made++;
+	}
+	return (void *)0;
+}
+
+int nonce_pool(bool verbose)
+{
+	printf("Test #7: Nonce pool (%d EC-DSA signatures) ", POOL_TESTS);
+	printf("NIST-p256, SHA2-256\n");
+	static uECC_NoncePool pool;
+	uECC_Nonce nonce;
+	uint_least8_t private[NUM_ECC_BYTES];
+	uint_least8_t public[2*NUM_ECC_BYTES];
+	uint_least8_t hash[NUM_ECC_BYTES];
+	uint_least8_t sig[POOL_TESTS][2*NUM_ECC_BYTES];
+	uECC_word_t hash_words[NUM_ECC_WORDS];
+	int i, j;
+
+	const struct uECC_Curve_t * curve = uECC_secp256r1();
+
+	if (uECC_nonce_pool_init(0, curve) ||
+	    uECC_nonce_pool_init(&pool, 0) ||
+	    uECC_sign_pooled(0, private, hash, sizeof(hash), sig[0])) {
+		TC_ERROR("invalid arguments were accepted\n");
+		return TC_FAIL;
+	}
+
+	if (!uECC_make_key(public, private, curve) ||
+	    !uECC_nonce_pool_init(&pool, curve) ||
+	    !uECC_nonce_pool_refill(&pool) ||
+	    pool.tail - pool.head != uECC_NONCE_POOL_SIZE) {
+		TC_ERROR("could not fill the pool\n");
+		return TC_FAIL;
+	}
+
+	if (!uECC_nonce_make(&nonce, curve) ||
+	    uECC_nonce_pool_put(&pool, &nonce) ||
+	    pool.tail - pool.head != uECC_NONCE_POOL_SIZE) {
+		TC_ERROR("a full pool accepted a nonce\n");
+		return TC_FAIL;
+	}
+
+	for (i = 0; i < POOL_TESTS; ++i) {
+		uECC_generate_random_int(hash_words, curve->n,
+					 BITS_TO_WORDS(curve->num_n_bits));
+		uECC_vli_wordsToBytes(hash, NUM_ECC_BYTES, hash_words);
+
+		/* refill once the pool ran dry, then let it run dry again: */
+		if (i == uECC_NONCE_POOL_SIZE + 1 && !uECC_nonce_pool_refill(&pool)) {
+			TC_ERROR("uECC_nonce_pool_refill() failed\n");
+			return TC_FAIL;
+		}
+
+		if (!uECC_sign_pooled(&pool, private, hash, sizeof(hash), sig[i])) {
+			TC_ERROR("uECC_sign_pooled() failed\n");
+			return TC_FAIL;
+		}
+
+		if (!uECC_verify(public, hash, sizeof(hash), sig[i], curve)) {
+			TC_ERROR("signature %d does not verify\n", i);
+			return TC_FAIL;
+		}
+	}
+
+	/* every nonce is used once, including the ones computed on the spot: */
+	for (i = 0; i < POOL_TESTS; ++i) {
+		for (j = 0; j < i; ++j) {
+			if (memcmp(sig[i], sig[j], NUM_ECC_BYTES) == 0) {
+				TC_ERROR("signatures %d and %d share r\n", j, i);
+				return TC_FAIL;
+			}
+		}
+	}
+
+	(void)uECC_nonce_pool_refill(&pool);
+	uECC_nonce_pool_clear(&pool);
+	if (pool.tail != pool.head) {
+		TC_ERROR("uECC_nonce_pool_clear() left nonces behind\n");
+		return TC_FAIL;
+	}
+
+	/* one thread refills while this one signs; r must never repeat: */
+	static uint_least8_t r[POOL_THREAD_TESTS][NUM_ECC_BYTES];
+	pthread_t producer;
+	void *failed;
+
+	if (pthread_create(&producer, 0, pool_producer, &pool) != 0) {
+		TC_ERROR("pthread_create() failed\n");
+		return TC_FAIL;
+	}
+	for (i = 0; i < POOL_THREAD_TESTS; ++i) {
+		if (!uECC_sign_pooled(&pool, private, hash, sizeof(hash), sig[0]) ||
+		    !uECC_verify(public, hash, sizeof(hash), sig[0], curve)) {
+			TC_ERROR("concurrent signature %d failed\n", i);
+			(void)pthread_join(producer, &failed);
+			return TC_FAIL;
+		}
+		memcpy(r[i], sig[0], NUM_ECC_BYTES);
+		for (j = 0; j < i; ++j) {
+			if (memcmp(r[i], r[j], NUM_ECC_BYTES) == 0) {
+				TC_ERROR("concurrent signatures %d and %d share r\n",
+					 j, i);
+				(void)pthread_join(producer, &failed);
+				return TC_FAIL;
+			}
+		}
+	}
+	if (pthread_join(producer, &failed) != 0 || failed != (void *)0) {
+		TC_ERROR("the producer thread failed\n");
+		return TC_FAIL;
+	}
+	uECC_nonce_pool_clear(&pool);
+
+	if (verbose) {
+		TC_PRINT("  %d signatures, %d nonces from the pool\n", POOL_TESTS,
+			 2 * uECC_NONCE_POOL_SIZE);
+	}
+	return TC_PASS;
+}
+
+static int failing_rng(uint_least8_t *dest, unsigned int size)
+{
+	(void)dest;
+	(void)size;
+	return 0;
+}
+
+int deterministic_sign(bool verbose)
+{
+	printf("Test #8: Deterministic signatures (RFC 6979 A.2.5) ");
+	printf("NIST-p256, SHA2-256\n");
+	/* messages "sample" and "test" */
+	const char *msg[2] = { "sample", "test" };
+	const char *x =
+		"C9AFA9D845BA75166B5C215767B1D6934E50C3DB36E89B127B8A622B120F6721";
+	const char *r[2] = {
+		"EFD48B2AACB6A8FD1140DD9CD45E81D69D2C877B56AAF991C34D0EA84EAF3716",
+		"F1ABB023518351CD71D881567B1EA663ED3EFCF6C5132B354F28D3B0B7D38367"
+	};
+	const char *s[2] = {
+		"F7CB1C942D657C41D436C7A1B6E29F65F3E900DBB9AFF4064DC4AB2F843ACDA8",
+		"019F4113742A2B14BD25926B49C649155F267E60D3814B4C0CC84250E46F0083"
+	};
+	struct tc_sha256_state_struct sha256_ctx;
+	uECC_DeterministicKey key;
+	uint_least8_t zero[NUM_ECC_BYTES] = {0};
+	uint_least8_t private[NUM_ECC_BYTES];
+	uint_least8_t public[2*NUM_ECC_BYTES];
+	uint_least8_t hash[TC_SHA256_DIGEST_SIZE];
+	uint_least8_t expected[2*NUM_ECC_BYTES];
+	uint_least8_t sig[2*NUM_ECC_BYTES];
+	uint_least8_t again[2*NUM_ECC_BYTES];
+	int result = TC_PASS;
+	int i;
+
+	const struct uECC_Curve_t * curve = uECC_secp256r1();
+
+	hex2bin(private, sizeof(private), x, strlen(x));
+	if (uECC_deterministic_key_init(0, private, curve) ||
+	    uECC_deterministic_key_init(&key, private, 0) ||
+	    uECC_deterministic_key_init(&key, zero, curve) ||
+	    !uECC_deterministic_key_init(&key, private, curve) ||
+	    !uECC_compute_public_key(private, public, curve)) {
+		TC_ERROR("uECC_deterministic_key_init() failed\n");
+		return TC_FAIL;
+	}
+
+	/* no entropy is needed: */
+	uECC_set_rng(&failing_rng);
+
+	for (i = 0; i < 2; ++i) {
+		(void)tc_sha256_init(&sha256_ctx);
+		(void)tc_sha256_update(&sha256_ctx, (const uint_least8_t *)msg[i],
+				       strlen(msg[i]));
+		(void)tc_sha256_final(hash, &sha256_ctx);
+		hex2bin(expected, NUM_ECC_BYTES, r[i], strlen(r[i]));
+		hex2bin(expected + NUM_ECC_BYTES, NUM_ECC_BYTES, s[i], strlen(s[i]));
+
+		if (!uECC_sign_deterministic(&key, hash, sizeof(hash), sig) ||
+		    !uECC_sign_deterministic(&key, hash, sizeof(hash), again)) {
+			TC_ERROR("uECC_sign_deterministic() failed\n");
+			result = TC_FAIL;
+			break;
+		}
+		if (memcmp(sig, expected, sizeof(sig)) != 0) {
+			TC_ERROR("message \"%s\": wrong signature\n", msg[i]);
+			result = TC_FAIL;
+			break;
+		}
+		if (memcmp(sig, again, sizeof(sig)) != 0) {
+			TC_ERROR("message \"%s\": signature not reproducible\n",
+				 msg[i]);
+			result = TC_FAIL;
+			break;
+		}
+		if (!uECC_verify(public, hash, sizeof(hash), sig, curve)) {
+			TC_ERROR("message \"%s\": signature does not verify\n",
+				 msg[i]);
+			result = TC_FAIL;
+			break;
+		}
+	}
+
+	uECC_set_rng(&default_CSPRNG);
+	uECC_deterministic_key_clear(&key);
+	if (verbose && result == TC_PASS) {
+		TC_PRINT("  %d vectors\n", i);
+	}
+	return result;
+}
+
+/* a uECC_CtxRNG_Function backed by a per-context HMAC-PRNG */
+static int ctx_hmac_prng(void *state, uint_least8_t *dest, uint32_t size)
+{
+	return tc_hmac_prng_generate(dest, size, (TCHmacPrng_t)state) ==
+	       TC_CRYPTO_SUCCESS;
+}
+
+int context_rng(bool verbose)
+{
+	printf("Test #9: Per-context RNG ");
+	printf("NIST-p256, SHA2-256\n");
+	struct tc_hmac_prng_struct prng[3];
+	uECC_Ctx ctx[3];
+	uECC_Ctx none;
+	static uECC_NoncePool pool;
+	uECC_Nonce nonce;
+	uint_least8_t seed[32];
+	uint_least8_t private[3][NUM_ECC_BYTES];
+	uint_least8_t public[3][2*NUM_ECC_BYTES];
+	uint_least8_t secret[2][NUM_ECC_BYTES];
+	uint_least8_t hash[NUM_ECC_BYTES] = { 0x5a };
+	uint_least8_t sig[2*NUM_ECC_BYTES];
+	int result = TC_PASS;
+	int i;
+
+	const struct uECC_Curve_t * curve = uECC_secp256r1();
+
+	/* contexts 0 and 2 get the same seed, context 1 another one: */
+	for (i = 0; i < 3; ++i) {
+		_set(seed, (uint_least8_t)(i == 1), sizeof(seed));
+		(void)tc_hmac_prng_init(&prng[i], (const uint_least8_t *)"ctx", 3);
+		(void)tc_hmac_prng_reseed(&prng[i], seed, sizeof(seed), 0, 0);
+		(void)uECC_ctx_init(&ctx[i], &ctx_hmac_prng, &prng[i]);
+	}
+	(void)uECC_ctx_init(&none, 0, 0);
+
+	/* only the contexts may be used: */
+	uECC_set_rng(&failing_rng);
+
+	for (i = 0; i < 3; ++i) {
+		if (!uECC_make_key_ctx(&ctx[i], public[i], private[i], curve)) {
+			TC_ERROR("uECC_make_key_ctx() failed\n");
+			result = TC_FAIL;
+			goto exitTest;
+		}
+	}
+	if (memcmp(private[0], private[2], NUM_ECC_BYTES) != 0 ||
+	    memcmp(private[0], private[1], NUM_ECC_BYTES) == 0) {
+		TC_ERROR("keys do not follow the context RNG\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+
+	if (uECC_make_key_ctx(&none, public[2], private[2], curve) ||
+	    uECC_sign_ctx(&none, private[0], hash, sizeof(hash), sig, curve) ||
+	    uECC_make_key(public[2], private[2], curve)) {
+		TC_ERROR("key generated without an RNG\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+
+	if (!uECC_sign_ctx(&ctx[0], private[0], hash, sizeof(hash), sig, curve) ||
+	    !uECC_verify(public[0], hash, sizeof(hash), sig, curve)) {
+		TC_ERROR("uECC_sign_ctx() failed\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+
+	if (!uECC_nonce_pool_init(&pool, curve) ||
+	    !uECC_nonce_make_ctx(&ctx[1], &nonce, curve) ||
+	    !uECC_nonce_pool_put(&pool, &nonce) ||
+	    !uECC_sign_pooled(&pool, private[1], hash, sizeof(hash), sig) ||
+	    !uECC_verify(public[1], hash, sizeof(hash), sig, curve)) {
+		TC_ERROR("uECC_nonce_make_ctx() failed\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+
+	if (!uECC_nonce_pool_refill_ctx(&ctx[2], &pool) ||
+	    pool.tail - pool.head != uECC_NONCE_POOL_SIZE ||
+	    !uECC_sign_pooled(&pool, private[2], hash, sizeof(hash), sig) ||
+	    !uECC_verify(public[2], hash, sizeof(hash), sig, curve) ||
+	    uECC_nonce_pool_refill_ctx(&none, &pool) ||
+	    uECC_nonce_pool_refill(&pool)) {
+		TC_ERROR("uECC_nonce_pool_refill_ctx() failed\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+	uECC_nonce_pool_clear(&pool);
+
+	if (!uECC_shared_secret_ctx(&ctx[0], public[1], private[0], secret[0],
+				    curve) ||
+	    !uECC_shared_secret_ctx(&ctx[1], public[0], private[1], secret[1],
+				    curve) ||
+	    memcmp(secret[0], secret[1], NUM_ECC_BYTES) != 0) {
+		TC_ERROR("uECC_shared_secret_ctx() failed\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+
+	if (verbose) {
+		TC_PRINT("  global RNG untouched\n");
+	}
+
+ exitTest:
+	uECC_set_rng(&default_CSPRNG);
+	return result;
+}
+
+/*
+ * ECDSA on secp256k1, where verification splits both scalars with the GLV
+ * endomorphism: a known signature, random ones, and tampered ones.
+ */
+int secp256k1_dsa(int num_tests, bool verbose)
+{
+	printf("Test #10: EC-DSA on secp256k1 ");
+	printf("secp256k1, SHA2-256\n");
+	uint_least8_t private[NUM_ECC_BYTES];
+	uint_least8_t public[2*NUM_ECC_BYTES];
+	uint_least8_t hash[NUM_ECC_BYTES];
+	uECC_word_t hash_words[NUM_ECC_WORDS];
+	uint_least8_t sig[2*NUM_ECC_BYTES];
+	int result = TC_PASS;
+	int i;
+
+	const struct uECC_Curve_t * curve = uECC_secp256k1();
+
+	(void)hex2bin(public, sizeof(public),
+		"5d479869ca24497abab18243ea162c816edf6ef0c42e4b149f3c955accabd62f"
+		"954076ca7f14f2d48ce580cf5b899c9526fc73f6c260f9fc8398767d7515dbca",
+		4 * NUM_ECC_BYTES);
+	(void)hex2bin(hash, sizeof(hash),
+		"383b27532153f353fa4cc689239f7365dfe924ebcf67807eb6916307a4e2701e",
+		2 * NUM_ECC_BYTES);
+	(void)hex2bin(sig, sizeof(sig),
+		"129bc900dfd82ddae6151a22b664b6fec64c365c318ec902d84c646910c1bf1e"
+		"ff4dcfe83d7b416f35df6b6889c25beba6298d6b34ec4c12fbb22a1637ef6282",
+		4 * NUM_ECC_BYTES);
+	if (!uECC_verify(public, hash, sizeof(hash), sig, curve)) {
+		TC_ERROR("known signature rejected\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+	if (uECC_verify(public, hash, sizeof(hash), sig, uECC_secp256r1())) {
+		TC_ERROR("signature accepted on the wrong curve\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+
+	for (i = 0; i < num_tests; ++i) {
+		uECC_generate_random_int(hash_words, curve->n, NUM_ECC_WORDS);
+		uECC_vli_wordsToBytes(hash, NUM_ECC_BYTES, hash_words);
+		if (!uECC_make_key(public, private, curve) ||
+		    !uECC_sign(private, hash, sizeof(hash), sig, curve)) {
+			TC_ERROR("uECC_sign() failed\n");
+			result = TC_FAIL;
+			goto exitTest;
+		}
+		if (!uECC_verify(public, hash, sizeof(hash), sig, curve)) {
+			TC_ERROR("signature %d rejected\n", i);
+			if (verbose) {
+				vli_print_bytes(sig, sizeof(sig));
+			}
+			result = TC_FAIL;
+			goto exitTest;
+		}
+		hash[i % sizeof(hash)] ^= 0x10;
+		if (uECC_verify(public, hash, sizeof(hash), sig, curve)) {
+			TC_ERROR("signature %d accepted for another hash\n", i);
+			result = TC_FAIL;
+			goto exitTest;
+		}
+	}
+
+ exitTest:
+	return result;
+}
+
+/*
+ * Signing and verification with a caller-supplied arena of exactly
+ * uECC_scratch_size() bytes, which must not be written past its end.
+ */
+int scratch_arena(bool verbose)
+{
+	printf("Test #11: Scratch arena ");
+	printf("NIST-p256 and secp256k1, SHA2-256\n");
+	static uECC_word_t arena[uECC_SCRATCH_SIZE / uECC_WORD_SIZE + 4];
+	uint_least8_t private[NUM_ECC_BYTES];
+	uint_least8_t public[2*NUM_ECC_BYTES];
+	uint_least8_t hash[NUM_ECC_BYTES] = { 0x3c };
+	uint_least8_t sig[2*NUM_ECC_BYTES];
+	unsigned int size, words, i;
+	int result = TC_PASS;
+	int c;
+
+	for (c = 0; c < 2; ++c) {
+		uECC_Curve curve = c ? uECC_secp256k1() : uECC_secp256r1();
+
+		size = uECC_scratch_size(curve);
+		words = size / uECC_WORD_SIZE;
+		if (size % uECC_WORD_SIZE != 0 || size > uECC_SCRATCH_SIZE) {
+			TC_ERROR("bad scratch size %u\n", size);
+			result = TC_FAIL;
+			goto exitTest;
+		}
+		memset(arena, 0x5a, sizeof(arena));
+
+		if (!uECC_make_key(public, private, curve) ||
+		    !uECC_sign_scratch(0, private, hash, sizeof(hash), sig, curve,
+				       arena, size) ||
+		    !uECC_verify(public, hash, sizeof(hash), sig, curve) ||
+		    !uECC_verify_scratch(public, hash, sizeof(hash), sig, curve,
+					 arena, size)) {
+			TC_ERROR("signing or verification with an arena failed\n");
+			result = TC_FAIL;
+			goto exitTest;
+		}
+		hash[0] ^= 1;
+		if (uECC_verify_scratch(public, hash, sizeof(hash), sig, curve,
+					arena, size)) {
+			TC_ERROR("signature accepted for another hash\n");
+			result = TC_FAIL;
+			goto exitTest;
+		}
+		hash[0] ^= 1;
+
+		for (i = words; i < sizeof(arena) / sizeof(arena[0]); ++i) {
+			if (arena[i] != (uECC_word_t)~(uECC_word_t)0 / 0xff * 0x5a) {
+				TC_ERROR("arena overrun at word %u\n", i);
+				result = TC_FAIL;
+				goto exitTest;
+			}
+		}
+
+		if (uECC_sign_scratch(0, private, hash, sizeof(hash), sig, curve,
+				      arena, size - uECC_WORD_SIZE) ||
+		    uECC_verify_scratch(public, hash, sizeof(hash), sig, curve,
+					arena, size - uECC_WORD_SIZE) ||
+		    uECC_verify_scratch(public, hash, sizeof(hash), sig, curve,
+					0, size)) {
+			TC_ERROR("undersized arena accepted\n");
+			result = TC_FAIL;
+			goto exitTest;
+		}
+		if (verbose) {
+			TC_PRINT("  %s: %u bytes\n", c ? "secp256k1" : "p-256", size);
+		}
+	}
+
+ exitTest:
+	return result;
+}
+
 int main()
 {
 	unsigned int result = TC_PASS;
@@ -660,6 +1473,60 @@ int main()
 		TC_ERROR("montecarlo_signverify test failed.\n");
 	goto exitTest;
 	}
+	TC_PRINT("Performing batch_verify test:\n");
+	result = batch_verify(verbose);
+	if (result == TC_FAIL) {
+		TC_ERROR("batch_verify test failed.\n");
+		goto exitTest;
+	}
+	TC_PRINT("Performing prepared_verify test:\n");
+	result = prepared_verify(verbose);
+	if (result == TC_FAIL) {
+		TC_ERROR("prepared_verify test failed.\n");
+		goto exitTest;
+	}
+
+	TC_PRINT("Performing lanes_verify test:\n");
+	result = lanes_verify(verbose);
+	if (result == TC_FAIL) {
+		TC_ERROR("lanes_verify test failed.\n");
+		goto exitTest;
+	}
+
+	TC_PRINT("Performing nonce_pool test:\n");
+	result = nonce_pool(verbose);
+	if (result == TC_FAIL) {
+		TC_ERROR("nonce_pool test failed.\n");
+		goto exitTest;
+	}
+
+	TC_PRINT("Performing deterministic_sign test:\n");
+	result = deterministic_sign(verbose);
+	if (result == TC_FAIL) {
+		TC_ERROR("deterministic_sign test failed.\n");
+		goto exitTest;
+	}
+
+	TC_PRINT("Performing context_rng test:\n");
+	result = context_rng(verbose);
+	if (result == TC_FAIL) {
+		TC_ERROR("context_rng test failed.\n");
+		goto exitTest;
+	}
+
+	TC_PRINT("Performing secp256k1_dsa test:\n");
+	result = secp256k1_dsa(16, false);
+	if (result == TC_FAIL) {
+		TC_ERROR("secp256k1_dsa test failed.\n");
+		goto exitTest;
+	}
+
+	TC_PRINT("Performing scratch_arena test:\n");
+	result = scratch_arena(verbose);
+	if (result == TC_FAIL) {
+		TC_ERROR("scratch_arena test failed.\n");
+		goto exitTest;
+	}
 
 	TC_PRINT("\nAll ECC-DSA tests succeeded.\n");
 
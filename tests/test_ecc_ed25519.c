@@ -0,0 +1,413 @@
+/*  test_ecc_ed25519.c - TinyCrypt implementation of some Ed25519 tests */
+
+/*
+ *  Copyright (C) 2017 by Intel Corporation, All Rights Reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *    - Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *    - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ *    - Neither the name of Intel Corporation nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+  DESCRIPTION
+  This module tests the Ed25519 signature scheme.
+
+  Scenarios tested include:
+  - RFC 8032 test vectors (section 7.1, tests 1 to 3)
+  - signing and verification with random key pairs
+  - batch verification of valid batches and of batches with a bad signature
+  - rejection of S >= L, of non-canonical points and of invalid arguments
+*/
+
+#include <tinycrypt/ecc_ed25519.h>
+#include <tinycrypt/ecc_platform_specific.h>
+#include <tinycrypt/constants.h>
+#include <test_ecc_utils.h>
+#include <test_utils.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define KEY_HEX (2 * uECC_ED25519_KEY_SIZE)
+#define SIG_HEX (2 * uECC_ED25519_SIGNATURE_SIZE)
+#define NUM_BATCH 72
+
+struct ed25519_vector {
+	const char *secret;
+	const char *public;
+	const char *message;
+	const char *signature;
+};
+
+static const struct ed25519_vector vectors[] = {
+	{
+		"9d61b19deffd5a60ba844af492ec2cc44449c5697b326919703bac031cae7f60",
+		"d75a980182b10ab7d54bfed3c964073a0ee172f3daa62325af021a68f707511a",
+		"",
+		"e5564300c360ac729086e2cc806e828a84877f1eb8e5d974d873e065224901555"
+		"fb8821590a33bacc61e39701cf9b46bd25bf5f0595bbe24655141438e7a100b"
+	}, {
+		"4ccd089b28ff96da9db6c346ec114e0f5b8a319f35aba624da8cf6ed4fb8a6fb",
+		"3d4017c3e843895a92b70aa74d1b7ebc9c982ccf2ec4968cc0cd55f12af4660c",
+		"72",
+		"92a009a9f0d4cab8720e820b5f642540a2b27b5416503f8fb3762223ebdb69da"
+		"085ac1e43e15996e458f3613d0f11d8c387b2eaeb4302aeeb00d291612bb0c00"
+	}, {
+		"c5aa8df43f9f837bedb7442f31dcb7b166d38535076f094b85ce3a2e0b4458f7",
+		"fc51cd8e6218a1a38da47ed00230f0580816ed13ba3303ac5deb911548908025",
+		"af82",
+		"6291d657deec24024827e69c3abe01a30ce548a284743a445e3680d7db5ac3ac"
+		"18ff9b538d16f290ae67f760984dc6594a7c15e9716ed28dc027beceea1ec40a"
+	}
+};
+
+static unsigned int test_vectors(void)
+{
+	unsigned int result = TC_PASS;
+	uint_least8_t secret[uECC_ED25519_KEY_SIZE];
+	uint_least8_t public[uECC_ED25519_KEY_SIZE];
+	uint_least8_t computed[uECC_ED25519_KEY_SIZE];
+	uint_least8_t message[2];
+	uint_least8_t signature[uECC_ED25519_SIGNATURE_SIZE];
+	uint_least8_t expected[uECC_ED25519_SIGNATURE_SIZE];
+	uint_least8_t expanded[uECC_ED25519_EXPANDED_KEY_SIZE];
+	size_t message_size;
+	unsigned int i;
+
+	TC_PRINT("Ed25519 test #1 (RFC 8032 vectors):\n");
+
+	for (i = 0; i < sizeof(vectors) / sizeof(vectors[0]); ++i) {
+		(void)hex2bin(secret, sizeof(secret), vectors[i].secret, KEY_HEX);
+		(void)hex2bin(public, sizeof(public), vectors[i].public, KEY_HEX);
+		(void)hex2bin(expected, sizeof(expected), vectors[i].signature,
+			      SIG_HEX);
+		message_size = strlen(vectors[i].message) / 2;
+		(void)hex2bin(message, sizeof(message), vectors[i].message,
+			      2 * message_size);
+
+		if (!uECC_ed25519_public_key(computed, secret) ||
+		    memcmp(computed, public, sizeof(public)) != 0) {
+			TC_ERROR("vector %u: wrong public key\n", i + 1);
+			show_str("\t\tExpected", public, sizeof(public));
+			show_str("\t\tComputed", computed, sizeof(computed));
+			result = TC_FAIL;
+			goto exitTest;
+		}
+		if (!uECC_ed25519_sign(secret, message, message_size, signature) ||
+		    memcmp(signature, expected, sizeof(expected)) != 0) {
+			TC_ERROR("vector %u: wrong signature\n", i + 1);
+			show_str("\t\tExpected", expected, sizeof(expected));
+			show_str("\t\tComputed", signature, sizeof(signature));
+			result = TC_FAIL;
+			goto exitTest;
+		}
+		memset(signature, 0, sizeof(signature));
+		if (!uECC_ed25519_expand_key(expanded, secret) ||
+		    memcmp(expanded + 64, public, sizeof(public)) != 0 ||
+		    !uECC_ed25519_sign_expanded(expanded, message, message_size,
+						signature) ||
+		    memcmp(signature, expected, sizeof(expected)) != 0) {
+			TC_ERROR("vector %u: wrong signature from the expanded "
+				 "key\n", i + 1);
+			result = TC_FAIL;
+			goto exitTest;
+		}
+		if (!uECC_ed25519_verify(public, message, message_size,
+					 signature)) {
+			TC_ERROR("vector %u: signature rejected\n", i + 1);
+			result = TC_FAIL;
+			goto exitTest;
+		}
+	}
+
+ exitTest:
+	TC_END_RESULT(result);
+	return result;
+}
+
+static unsigned int test_random(void)
+{
+	unsigned int result = TC_PASS;
+	uint_least8_t private[uECC_ED25519_KEY_SIZE];
+	uint_least8_t public[uECC_ED25519_KEY_SIZE];
+	uint_least8_t message[64];
+	uint_least8_t signature[uECC_ED25519_SIGNATURE_SIZE];
+	unsigned int i;
+
+	TC_PRINT("Ed25519 test #2 (random keys and messages):\n");
+
+	for (i = 0; i < 32; ++i) {
+		if (!uECC_ed25519_make_key(public, private) ||
+		    !default_CSPRNG(message, sizeof(message))) {
+			TC_ERROR("key generation failed\n");
+			result = TC_FAIL;
+			goto exitTest;
+		}
+		if (!uECC_ed25519_sign(private, message, i, signature) ||
+		    !uECC_ed25519_verify(public, message, i, signature)) {
+			TC_ERROR("round %u: signature rejected\n", i);
+			result = TC_FAIL;
+			goto exitTest;
+		}
+
+		/* any flipped bit of the message or signature is detected: */
+		if (i > 0) {
+			message[i - 1] ^= 1;
+			if (uECC_ed25519_verify(public, message, i, signature)) {
+				TC_ERROR("round %u: modified message accepted\n", i);
+				result = TC_FAIL;
+				goto exitTest;
+			}
+			message[i - 1] ^= 1;
+		}
+		signature[i % sizeof(signature)] ^= 0x10;
+		if (uECC_ed25519_verify(public, message, i, signature)) {
+			TC_ERROR("round %u: modified signature accepted\n", i);
+			result = TC_FAIL;
+			goto exitTest;
+		}
+	}
+
+ exitTest:
+	TC_END_RESULT(result);
+	return result;
+}
+
+static unsigned int test_batch(void)
+{
+	unsigned int result = TC_PASS;
+	static uint_least8_t private[NUM_BATCH][uECC_ED25519_KEY_SIZE];
+	static uint_least8_t public[NUM_BATCH][uECC_ED25519_KEY_SIZE];
+	static uint_least8_t message[NUM_BATCH][32];
+	static uint_least8_t signature[NUM_BATCH][uECC_ED25519_SIGNATURE_SIZE];
+	const uint_least8_t *public_keys[NUM_BATCH];
+	const uint_least8_t *messages[NUM_BATCH];
+	const uint_least8_t *signatures[NUM_BATCH];
+	size_t message_sizes[NUM_BATCH];
+	int results[NUM_BATCH];
+	unsigned int i, j;
+
+	TC_PRINT("Ed25519 test #3 (batch verification):\n");
+
+	for (i = 0; i < NUM_BATCH; ++i) {
+		if (!uECC_ed25519_make_key(public[i], private[i]) ||
+		    !default_CSPRNG(message[i], sizeof(message[i])) ||
+		    !uECC_ed25519_sign(private[i], message[i], i % 33,
+				       signature[i])) {
+			TC_ERROR("signing failed\n");
+			result = TC_FAIL;
+			goto exitTest;
+		}
+		public_keys[i] = public[i];
+		messages[i] = message[i];
+		message_sizes[i] = i % 33;
+		signatures[i] = signature[i];
+	}
+
+	/* more than one chunk, all valid: */
+	memset(results, 0, sizeof(results));
+	if (!uECC_ed25519_verify_batch(public_keys, messages, message_sizes,
+				       signatures, NUM_BATCH, results)) {
+		TC_ERROR("valid batch rejected\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+	for (i = 0; i < NUM_BATCH; ++i) {
+		if (results[i] != 1) {
+			TC_ERROR("valid signature %u marked invalid\n", i);
+			result = TC_FAIL;
+			goto exitTest;
+		}
+	}
+
+	/*
+	 * a bad S, a bad R and a signature over another message: the batch
+	 * fails and the results match single verification.
+	 */
+	signature[3][40] ^= 1;
+	signature[17][5] ^= 0x20;
+	messages[50] = message[51];
+	message_sizes[50] = message_sizes[51];
+	if (uECC_ed25519_verify_batch(public_keys, messages, message_sizes,
+				      signatures, NUM_BATCH, results)) {
+		TC_ERROR("invalid batch accepted\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+	for (i = 0; i < NUM_BATCH; ++i) {
+		j = uECC_ed25519_verify(public_keys[i], messages[i],
+					message_sizes[i], signatures[i]);
+		if (results[i] != (int)j || (j == 0) != (i == 3 || i == 17 || i == 50)) {
+			TC_ERROR("signature %u: batch result %d, single result %u\n",
+				 i, results[i], j);
+			result = TC_FAIL;
+			goto exitTest;
+		}
+	}
+
+ exitTest:
+	TC_END_RESULT(result);
+	return result;
+}
+
+static int failing_rng(void *state, uint_least8_t *dest, uint32_t size)
+{
+	(void)state;
+	(void)dest;
+	(void)size;
+	return 0;
+}
+
+static unsigned int test_rejection(void)
+{
+	unsigned int result = TC_PASS;
+	uint_least8_t public[uECC_ED25519_KEY_SIZE];
+	uint_least8_t private[uECC_ED25519_KEY_SIZE];
+	uint_least8_t signature[uECC_ED25519_SIGNATURE_SIZE];
+	uint_least8_t bad[uECC_ED25519_SIGNATURE_SIZE];
+	uint_least8_t L[uECC_ED25519_KEY_SIZE];
+	const uint_least8_t *public_keys[1];
+	const uint_least8_t *messages[1];
+	const uint_least8_t *signatures[1];
+	size_t message_sizes[1] = {0};
+	int results[1];
+	uECC_Ctx ctx;
+	unsigned int i;
+	int carry;
+
+	TC_PRINT("Ed25519 test #4 (rejection of invalid inputs):\n");
+
+	(void)hex2bin(private, sizeof(private), vectors[0].secret, KEY_HEX);
+	(void)hex2bin(public, sizeof(public), vectors[0].public, KEY_HEX);
+	(void)hex2bin(signature, sizeof(signature), vectors[0].signature,
+		      SIG_HEX);
+	(void)hex2bin(L, sizeof(L),
+		"edd3f55c1a631258d69cf7a2def9de1400000000000000000000000000000010",
+		KEY_HEX);
+
+	/* S + L verifies mathematically, but is not the canonical S: */
+	memcpy(bad, signature, sizeof(bad));
+	for (i = 0, carry = 0; i < sizeof(L); ++i) {
+		carry += bad[32 + i] + L[i];
+		bad[32 + i] = (uint_least8_t)carry;
+		carry >>= 8;
+	}
+	if (uECC_ed25519_verify(public, 0, 0, bad)) {
+		TC_ERROR("S >= L accepted\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+
+	/* y = p + 1 is a non-canonical encoding of y = 1: */
+	memset(bad, 0xff, 32);
+	bad[0] = 0xee;
+	bad[31] = 0x7f;
+	memcpy(bad + 32, signature + 32, 32);
+	if (uECC_ed25519_verify(public, 0, 0, bad) ||
+	    uECC_ed25519_verify(bad, 0, 0, signature)) {
+		TC_ERROR("non-canonical point accepted\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+
+	/* x = 0 with the sign bit set: */
+	memset(bad, 0, 32);
+	bad[0] = 1;
+	bad[31] = 0x80;
+	if (uECC_ed25519_verify(bad, 0, 0, signature)) {
+		TC_ERROR("negative zero accepted\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+
+	public_keys[0] = public;
+	messages[0] = 0;
+	signatures[0] = bad;
+	memcpy(bad, signature, sizeof(bad));
+	bad[63] |= 0x80;
+	if (uECC_ed25519_verify_batch(public_keys, messages, message_sizes,
+				      signatures, 1, results) ||
+	    results[0] != 0) {
+		TC_ERROR("batch accepted S >= L\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+
+	(void)uECC_ctx_init(&ctx, failing_rng, 0);
+	if (uECC_ed25519_make_key_ctx(&ctx, public, private) ||
+	    uECC_ed25519_public_key(0, private) ||
+	    uECC_ed25519_sign(private, 0, 1, signature) ||
+	    uECC_ed25519_sign(0, 0, 0, signature) ||
+	    uECC_ed25519_expand_key(0, private) ||
+	    uECC_ed25519_sign_expanded(0, 0, 0, signature) ||
+	    uECC_ed25519_verify(public, 0, 1, signature) ||
+	    uECC_ed25519_verify(public, 0, 0, 0) ||
+	    uECC_ed25519_verify_batch(0, messages, message_sizes, signatures,
+				      1, results)) {
+		TC_ERROR("invalid arguments were accepted\n");
+		result = TC_FAIL;
+	}
+
+ exitTest:
+	TC_END_RESULT(result);
+	return result;
+}
+
+/*
+ * Main task to test Ed25519
+ */
+int main(void)
+{
+	unsigned int result = TC_PASS;
+
+	TC_START("Performing Ed25519 tests:");
+
+	/* Setup of the Cryptographically Secure PRNG. */
+	uECC_set_rng(&default_CSPRNG);
+
+	result = test_vectors();
+	if (result == TC_FAIL) {
+		goto exitTest;
+	}
+	result = test_random();
+	if (result == TC_FAIL) {
+		goto exitTest;
+	}
+	result = test_batch();
+	if (result == TC_FAIL) {
+		goto exitTest;
+	}
+	result = test_rejection();
+	if (result == TC_FAIL) {
+		goto exitTest;
+	}
+
+	TC_PRINT("All Ed25519 tests succeeded!\n");
+
+ exitTest:
+	TC_END_RESULT(result);
+	TC_END_REPORT(result);
+}
@@ -128,10 +128,10 @@ int hex2bin(uint_least8_t *buf, const size_t buflen, const char *hex,
 /*
  * Convert hex string to zero-padded nanoECC scalar
  */
-void string2scalar(unsigned int *scalar, unsigned int num_word32, char *str)
+void string2scalar(uECC_word_t *scalar, unsigned int num_words, char *str)
 {
 
-	unsigned int num_bytes = 4 * num_word32;
+	unsigned int num_bytes = uECC_WORD_SIZE * num_words;
 	uint_least8_t tmp[num_bytes];
 	size_t hexlen = strlen(str);
 
@@ -150,7 +150,7 @@ void string2scalar(unsigned int *scalar, unsigned int num_word32, char *str)
 	{
 		exit(-1);
 	}
-	uECC_vli_bytesToNative(scalar, tmp, num_bytes);
+	uECC_vli_bytesToWords(scalar, tmp, num_bytes);
 
 }
 
@@ -162,8 +162,8 @@ void vli_print_bytes(uint_least8_t *vli, unsigned int size)
 	}
 }
 
-void print_ecc_scalar(const char *label, const unsigned int * p_vli,
-		      unsigned int num_word32)
+void print_ecc_scalar(const char *label, const uECC_word_t * p_vli,
+		      unsigned int num_words)
 {
 	unsigned int i;
 
@@ -171,10 +171,10 @@ void print_ecc_scalar(const char *label, const unsigned int * p_vli,
 		printf("%s = { ", label);
 	}
 
-	for(i = 0; i < num_word32 - 1; ++i) {
-		printf("0x%08lX, ", (unsigned long)p_vli[i]);
+	for(i = 0; i < num_words - 1; ++i) {
+		printf("0x%0*llX, ", 2 * uECC_WORD_SIZE, (unsigned long long)p_vli[i]);
 	}
-	printf("0x%08lX", (unsigned long)p_vli[i]);
+	printf("0x%0*llX", 2 * uECC_WORD_SIZE, (unsigned long long)p_vli[i]);
 
 	if (label) {
 		printf(" };\n");
@@ -182,15 +182,15 @@ void print_ecc_scalar(const char *label, const unsigned int * p_vli,
 }
 
 int check_ecc_result(const int num, const char *name,
-		      const unsigned int *expected, 
-		      const unsigned int *computed,
-		      const unsigned int num_word32, const bool verbose)
+		      const uECC_word_t *expected,
+		      const uECC_word_t *computed,
+		      const unsigned int num_words, const bool verbose)
 {
-  uint32_t num_bytes = 4 * num_word32;
+  uint32_t num_bytes = uECC_WORD_SIZE * num_words;
   if (memcmp(computed, expected, num_bytes)) {
     TC_PRINT("\n  Vector #%02d check %s - FAILURE:\n\n", num, name);
-    print_ecc_scalar("Expected", expected, num_word32);
-    print_ecc_scalar("Computed", computed, num_word32);
+    print_ecc_scalar("Expected", expected, num_words);
+    print_ecc_scalar("Computed", computed, num_words);
     TC_PRINT("\n");
     return TC_FAIL;
   }
@@ -223,14 +223,15 @@ int keygen_vectors(char **d_vec, char **qx_vec, char **qy_vec, int tests,
 		    bool verbose)
 {
 
-	unsigned int pub[2 * NUM_ECC_WORDS];
-	unsigned int d[NUM_ECC_WORDS];
-	unsigned int prv[NUM_ECC_WORDS];
+	uECC_word_t pub[2 * NUM_ECC_WORDS];
+	uECC_word_t d[NUM_ECC_WORDS];
+	uint32_t d32[NUM_ECC_BYTES / 4];
+	uECC_word_t prv[NUM_ECC_WORDS];
 	unsigned int result = TC_PASS;
 
 	/* expected outputs (converted input vectors) */
-	unsigned int exp_pub[2 * NUM_ECC_WORDS];
-	unsigned int exp_prv[NUM_ECC_WORDS];
+	uECC_word_t exp_pub[2 * NUM_ECC_WORDS];
+	uECC_word_t exp_prv[NUM_ECC_WORDS];
 
 	for (int i = 0; i < tests; i++) {
 		string2scalar(exp_prv, NUM_ECC_WORDS, d_vec[i]);
@@ -247,11 +248,14 @@ int keygen_vectors(char **d_vec, char **qx_vec, char **qy_vec, int tests,
 		uint_least8_t pub_bytes[2*NUM_ECC_BYTES];
 		uint_least8_t prv_bytes[NUM_ECC_BYTES];
 
-		uECC_make_key_with_d(pub_bytes, prv_bytes, d, uECC_secp256r1());
+		/* d goes through the public 32-bit word format: */
+		uECC_vli_wordsToBytes(prv_bytes, NUM_ECC_BYTES, d);
+		uECC_vli_bytesToNative(d32, prv_bytes, NUM_ECC_BYTES);
+		uECC_make_key_with_d(pub_bytes, prv_bytes, d32, uECC_secp256r1());
 
-		uECC_vli_bytesToNative(prv, prv_bytes, NUM_ECC_BYTES);
-		uECC_vli_bytesToNative(pub, pub_bytes, NUM_ECC_BYTES);
-		uECC_vli_bytesToNative(pub + NUM_ECC_WORDS, pub_bytes + NUM_ECC_BYTES, NUM_ECC_BYTES);
+		uECC_vli_bytesToWords(prv, prv_bytes, NUM_ECC_BYTES);
+		uECC_vli_bytesToWords(pub, pub_bytes, NUM_ECC_BYTES);
+		uECC_vli_bytesToWords(pub + NUM_ECC_WORDS, pub_bytes + NUM_ECC_BYTES, NUM_ECC_BYTES);
 
 		/* validate correctness of vector conversion and make_key() */
 		result = check_ecc_result(i, "prv  ", exp_prv, prv,  NUM_ECC_WORDS, verbose);
@@ -0,0 +1,247 @@
+/*  test_ecc_x25519.c - TinyCrypt implementation of some X25519 tests */
+
+/*
+ *  Copyright (C) 2017 by Intel Corporation, All Rights Reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *    - Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *    - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ *    - Neither the name of Intel Corporation nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+  DESCRIPTION
+  This module tests the X25519 key agreement.
+
+  Scenarios tested include:
+  - RFC 7748 test vectors (section 5.2)
+  - iterated X25519 (RFC 7748, section 5.2, 1 and 1,000 iterations)
+  - Diffie-Hellman key agreement (RFC 7748, section 6.1) and random key pairs
+  - rejection of small-order points and of a failing RNG
+*/
+
+#include <tinycrypt/ecc_x25519.h>
+#include <tinycrypt/ecc_platform_specific.h>
+#include <tinycrypt/constants.h>
+#include <test_ecc_utils.h>
+#include <test_utils.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define KEY_HEX (2 * uECC_X25519_KEY_SIZE)
+
+static int check_vector(const char *name, const uint_least8_t *computed,
+			const char *expected_hex)
+{
+	uint_least8_t expected[uECC_X25519_KEY_SIZE];
+
+	(void)hex2bin(expected, sizeof(expected), expected_hex, KEY_HEX);
+	if (memcmp(computed, expected, sizeof(expected)) != 0) {
+		TC_ERROR("%s: wrong result\n", name);
+		show_str("\t\tExpected", expected, sizeof(expected));
+		show_str("\t\tComputed", computed, sizeof(expected));
+		return 0;
+	}
+	return 1;
+}
+
+static unsigned int test_vectors(void)
+{
+	unsigned int result = TC_PASS;
+	uint_least8_t scalar[uECC_X25519_KEY_SIZE];
+	uint_least8_t u[uECC_X25519_KEY_SIZE];
+	uint_least8_t out[uECC_X25519_KEY_SIZE];
+
+	TC_PRINT("X25519 test #1 (RFC 7748 vectors):\n");
+
+	(void)hex2bin(scalar, sizeof(scalar),
+		"a546e36bf0527c9d3b16154b82465edd62144c0ac1fc5a18506a2244ba449ac4",
+		KEY_HEX);
+	(void)hex2bin(u, sizeof(u),
+		"e6db6867583030db3594c1a424b15f7c726624ec26b3353b10a903a6d0ab1c4c",
+		KEY_HEX);
+	if (!uECC_x25519(out, scalar, u) ||
+	    !check_vector("vector 1", out,
+		"c3da55379de9c6908e94ea4df28d084f32eccf03491c71f754b4075577a28552")) {
+		result = TC_FAIL;
+		goto exitTest;
+	}
+
+	/* the u-coordinate has its top bit set, which must be ignored: */
+	(void)hex2bin(scalar, sizeof(scalar),
+		"4b66e9d4d1b4673c5ad22691957d6af5c11b6421e0ea01d42ca4169e7918ba0d",
+		KEY_HEX);
+	(void)hex2bin(u, sizeof(u),
+		"e5210f12786811d3f4b7959d0538ae2c31dbe7106fc03c3efc4cd549c715a493",
+		KEY_HEX);
+	if (!uECC_x25519(out, scalar, u) ||
+	    !check_vector("vector 2", out,
+		"95cbde9476e8907d7aade45cb4b873f88b595a68799fa152e6f8f7647aac7957")) {
+		result = TC_FAIL;
+	}
+
+ exitTest:
+	TC_END_RESULT(result);
+	return result;
+}
+
+static unsigned int test_iterated(void)
+{
+	unsigned int result = TC_PASS;
+	uint_least8_t k[uECC_X25519_KEY_SIZE] = {9};
+	uint_least8_t u[uECC_X25519_KEY_SIZE] = {9};
+	uint_least8_t out[uECC_X25519_KEY_SIZE];
+	unsigned int i;
+
+	TC_PRINT("X25519 test #2 (1,000 iterations):\n");
+
+	for (i = 1; i <= 1000; ++i) {
+		if (!uECC_x25519(out, k, u)) {
+			TC_ERROR("iteration %u failed\n", i);
+			result = TC_FAIL;
+			goto exitTest;
+		}
+		memcpy(u, k, sizeof(u));
+		memcpy(k, out, sizeof(k));
+		if (i == 1 && !check_vector("1 iteration", k,
+		    "422c8e7a6227d7bca1350b3e2bb7279f7897b87bb6854b783c60e80311ae3079")) {
+			result = TC_FAIL;
+			goto exitTest;
+		}
+	}
+	if (!check_vector("1,000 iterations", k,
+	    "684cf59ba83309552800ef566f2f4d3c1c3887c49360e3875f2eb94d99532c51")) {
+		result = TC_FAIL;
+	}
+
+ exitTest:
+	TC_END_RESULT(result);
+	return result;
+}
+
+static int failing_rng(void *state, uint_least8_t *dest, uint32_t size)
+{
+	(void)state;
+	(void)dest;
+	(void)size;
+	return 0;
+}
+
+static unsigned int test_key_agreement(void)
+{
+	unsigned int result = TC_PASS;
+	uint_least8_t private[2][uECC_X25519_KEY_SIZE];
+	uint_least8_t public[2][uECC_X25519_KEY_SIZE];
+	uint_least8_t secret[2][uECC_X25519_KEY_SIZE];
+	uint_least8_t zero[uECC_X25519_KEY_SIZE] = {0};
+	uint_least8_t one[uECC_X25519_KEY_SIZE] = {1};
+	uECC_Ctx ctx;
+	unsigned int i;
+
+	TC_PRINT("X25519 test #3 (key agreement):\n");
+
+	(void)hex2bin(private[0], uECC_X25519_KEY_SIZE,
+		"77076d0a7318a57d3c16c17251b26645df4c2f87ebc0992ab177fba51db92c2a",
+		KEY_HEX);
+	(void)hex2bin(public[1], uECC_X25519_KEY_SIZE,
+		"de9edb7d7b7dc1b4d35b61c2ece435373f8343c85b78674dadfc7e146f882b4f",
+		KEY_HEX);
+	if (!uECC_x25519_shared_secret(public[1], private[0], secret[0]) ||
+	    !check_vector("RFC 7748 6.1", secret[0],
+		"4a5d9d5ba4ce2de1728e3bf480350f25e07e21c947d19e3376f09b3c1e161742")) {
+		result = TC_FAIL;
+		goto exitTest;
+	}
+
+	for (i = 0; i < 16; ++i) {
+		if (!uECC_x25519_make_key(public[0], private[0]) ||
+		    !uECC_x25519_make_key(public[1], private[1])) {
+			TC_ERROR("uECC_x25519_make_key() failed\n");
+			result = TC_FAIL;
+			goto exitTest;
+		}
+		if (!uECC_x25519_shared_secret(public[1], private[0], secret[0]) ||
+		    !uECC_x25519_shared_secret(public[0], private[1], secret[1]) ||
+		    memcmp(secret[0], secret[1], uECC_X25519_KEY_SIZE) != 0) {
+			TC_ERROR("key pair %u: shared secrets differ\n", i);
+			result = TC_FAIL;
+			goto exitTest;
+		}
+	}
+
+	/* points of order 1 and 4 give an all-zero secret: */
+	if (uECC_x25519_shared_secret(zero, private[0], secret[0]) ||
+	    uECC_x25519_shared_secret(one, private[0], secret[0]) ||
+	    memcmp(secret[0], zero, sizeof(zero)) != 0) {
+		TC_ERROR("small-order point accepted\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+
+	(void)uECC_ctx_init(&ctx, failing_rng, 0);
+	if (uECC_x25519_make_key_ctx(&ctx, public[0], private[0]) ||
+	    uECC_x25519_make_key(0, private[0]) ||
+	    uECC_x25519_shared_secret(public[1], 0, secret[0])) {
+		TC_ERROR("invalid arguments were accepted\n");
+		result = TC_FAIL;
+	}
+
+ exitTest:
+	TC_END_RESULT(result);
+	return result;
+}
+
+/*
+ * Main task to test X25519
+ */
+int main(void)
+{
+	unsigned int result = TC_PASS;
+
+	TC_START("Performing X25519 tests:");
+
+	/* Setup of the Cryptographically Secure PRNG. */
+	uECC_set_rng(&default_CSPRNG);
+
+	result = test_vectors();
+	if (result == TC_FAIL) {
+		goto exitTest;
+	}
+	result = test_iterated();
+	if (result == TC_FAIL) {
+		goto exitTest;
+	}
+	result = test_key_agreement();
+	if (result == TC_FAIL) {
+		goto exitTest;
+	}
+
+	TC_PRINT("All X25519 tests succeeded!\n");
+
+ exitTest:
+	TC_END_RESULT(result);
+	TC_END_REPORT(result);
+}
@@ -38,6 +38,7 @@
   - HMAC-PRNG init
   - HMAC-PRNG reseed
   - HMAC-PRNG generate)
+  - HMAC-PRNG instantiate from raw seed material (RFC 6979)
 */
 
 #include <tinycrypt/hmac_prng.h>
@@ -6576,6 +6577,82 @@ unsigned int test_120(void)
 	return result;
 }
 
+/*
+ * RFC 6979, A.2.5: the HMAC-DRBG instantiated with int2octets(x) ||
+ * bits2octets(h1) for P-256, SHA-256 and "sample" first generates k.
+ */
+unsigned int test_121(void)
+{
+	unsigned int result = TC_PASS;
+	const uint_least8_t x[32] = {
+		0xc9, 0xaf, 0xa9, 0xd8, 0x45, 0xba, 0x75, 0x16, 0x6b, 0x5c, 0x21, 0x57,
+		0x67, 0xb1, 0xd6, 0x93, 0x4e, 0x50, 0xc3, 0xdb, 0x36, 0xe8, 0x9b, 0x12,
+		0x7b, 0x8a, 0x62, 0x2b, 0x12, 0x0f, 0x67, 0x21,
+	};
+	const uint_least8_t h1[32] = {
+		0xaf, 0x2b, 0xdb, 0xe1, 0xaa, 0x9b, 0x6e, 0xc1, 0xe2, 0xad, 0xe1, 0xd6,
+		0x94, 0xf4, 0x1f, 0xc7, 0x1a, 0x83, 0x1d, 0x02, 0x68, 0xe9, 0x89, 0x15,
+		0x62, 0x11, 0x3d, 0x8a, 0x62, 0xad, 0xd1, 0xbf,
+	};
+	const uint_least8_t k[32] = {
+		0xa6, 0xe3, 0xc5, 0x7d, 0xd0, 0x1a, 0xbe, 0x90, 0x08, 0x65, 0x38, 0x39,
+		0x83, 0x55, 0xdd, 0x4c, 0x3b, 0x17, 0xaa, 0x87, 0x33, 0x82, 0xb0, 0xf2,
+		0x4d, 0x61, 0x29, 0x49, 0x3d, 0x8a, 0xad, 0x60,
+	};
+	struct tc_hmac_state_struct prefix;
+	struct tc_hmac_prng_struct h;
+	uint_least8_t random[32];
+
+	TC_PRINT("HMAC-PRNG %s:\n", __func__);
+
+	/* without and with the precomputed prefix: */
+	memset(&h, 0x0, sizeof(h));
+	if (tc_hmac_prng_instantiate(&h, 0, x, sizeof(x), h1, sizeof(h1)) !=
+	    TC_CRYPTO_SUCCESS ||
+	    tc_hmac_prng_generate(random, sizeof(random), &h) !=
+	    TC_CRYPTO_SUCCESS) {
+		TC_ERROR("instantiate failed\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+	result = check_result(121, k, sizeof(k), random, sizeof(random));
+	if (result == TC_FAIL) {
+		goto exitTest;
+	}
+
+	memset(&h, 0x0, sizeof(h));
+	if (tc_hmac_prng_instantiate_prefix(&prefix, x, sizeof(x)) !=
+	    TC_CRYPTO_SUCCESS ||
+	    tc_hmac_prng_instantiate(&h, &prefix, x, sizeof(x), h1,
+				     sizeof(h1)) != TC_CRYPTO_SUCCESS ||
+	    tc_hmac_prng_generate(random, sizeof(random), &h) !=
+	    TC_CRYPTO_SUCCESS) {
+		TC_ERROR("instantiate with prefix failed\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+	result = check_result(121, k, sizeof(k), random, sizeof(random));
+	if (result == TC_FAIL) {
+		goto exitTest;
+	}
+
+	/* bad arguments: */
+	if (tc_hmac_prng_instantiate(0, 0, x, sizeof(x), h1, sizeof(h1)) ||
+	    tc_hmac_prng_instantiate(&h, 0, 0, sizeof(x), h1, sizeof(h1)) ||
+	    tc_hmac_prng_instantiate(&h, 0, x, 16, h1, sizeof(h1)) ||
+	    tc_hmac_prng_instantiate(&h, 0, x, sizeof(x), h1, 0) ||
+	    tc_hmac_prng_instantiate_prefix(0, x, sizeof(x)) ||
+	    tc_hmac_prng_instantiate_prefix(&prefix, 0, sizeof(x)) ||
+	    tc_hmac_prng_instantiate_prefix(&prefix, x, 16)) {
+		TC_ERROR("bad arguments accepted\n");
+		result = TC_FAIL;
+	}
+
+exitTest:
+	TC_END_RESULT(result);
+	return result;
+}
+
 
 /*
  * Main task to test HMAC-PRNG
@@ -7426,6 +7503,13 @@ int main(void)
 		goto exitTest;
 	}
 
+	result = test_121();
+	if (result == TC_FAIL) {
+		/* terminate test */
+		TC_ERROR("HMAC test #{test_number} failed.\n");
+		goto exitTest;
+	}
+
 	TC_PRINT("All HMAC-PRNG tests succeeded!\n");
 
 exitTest:
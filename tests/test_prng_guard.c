@@ -0,0 +1,280 @@
+/*  test_prng_guard.c - TinyCrypt implementation of some PRNG guard tests */
+
+/*
+ *  Copyright (C) 2017 by Intel Corporation, All Rights Reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *    - Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *    - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ *    - Neither the name of Intel Corporation nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+  DESCRIPTION
+  This module tests the PRNG guard routines.
+
+  Scenarios tested include:
+  - input validation
+  - scheduled reseeding through tc_prng_guard_maintain, ahead of the
+    wrapped generator's limit
+  - forced reseeding when the wrapped generator runs out
+  - diverging output of parent and child after fork()
+*/
+
+#include <tinycrypt/prng_guard.h>
+#include <tinycrypt/ctr_prng.h>
+#include <tinycrypt/hmac_prng.h>
+#include <tinycrypt/constants.h>
+#include <test_utils.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/* number of times the test entropy source was called */
+static unsigned int entropy_calls;
+
+/* Deterministic "entropy" source: good enough to observe reseeds. */
+static int test_entropy(uint_least8_t *dest, uint32_t size)
+{
+	uint32_t i;
+
+	entropy_calls++;
+	for (i = 0; i < size; i++) {
+		dest[i] = (uint_least8_t)(entropy_calls * 31 + i);
+	}
+	return 1;
+}
+
+static int failing_entropy(uint_least8_t *dest, uint32_t size)
+{
+	(void)dest;
+	(void)size;
+	return 0;
+}
+
+static unsigned int test_robustness(void)
+{
+	unsigned int result = TC_PASS;
+	struct tc_prng_guard_struct guard;
+	struct tc_hmac_prng_struct hmac;
+	TCCtrPrng_t ctr;
+	uint_least8_t out[16];
+
+	TC_PRINT("PRNG guard robustness test:\n");
+
+	if (tc_prng_guard_init_ctr(0, &ctr, test_entropy, 0) != TC_CRYPTO_FAIL ||
+	    tc_prng_guard_init_ctr(&guard, 0, test_entropy, 0) != TC_CRYPTO_FAIL ||
+	    tc_prng_guard_init_ctr(&guard, &ctr, 0, 0) != TC_CRYPTO_FAIL ||
+	    tc_prng_guard_init_hmac(0, &hmac, test_entropy, 0) != TC_CRYPTO_FAIL ||
+	    tc_prng_guard_init_hmac(&guard, 0, test_entropy, 0) != TC_CRYPTO_FAIL ||
+	    tc_prng_guard_init_hmac(&guard, &hmac, 0, 0) != TC_CRYPTO_FAIL ||
+	    tc_prng_guard_generate(0, out, sizeof(out)) != TC_CRYPTO_FAIL ||
+	    tc_prng_guard_maintain(0) != TC_CRYPTO_FAIL) {
+		TC_ERROR("invalid arguments were accepted\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+
+	/* an unseeded HMAC-PRNG must not produce output if entropy fails: */
+	(void)tc_hmac_prng_init(&hmac, (const uint_least8_t *)"guard", 5);
+	(void)tc_prng_guard_init_hmac(&guard, &hmac, failing_entropy, 0);
+	if (tc_prng_guard_generate(&guard, out, sizeof(out)) != TC_CRYPTO_FAIL) {
+		TC_ERROR("generate succeeded without a seed\n");
+		result = TC_FAIL;
+	}
+
+ exitTest:
+	TC_END_RESULT(result);
+	return result;
+}
+
+static unsigned int test_schedule(void)
+{
+	unsigned int result = TC_PASS;
+	struct tc_prng_guard_struct guard;
+	TCCtrPrng_t ctr;
+	uint_least8_t seed[TC_PRNG_GUARD_SEED_SIZE] = {0};
+	uint_least8_t out[16];
+	unsigned int i;
+
+	TC_PRINT("PRNG guard reseed schedule test:\n");
+
+	(void)tc_ctr_prng_init(&ctr, seed, sizeof(seed), 0, 0);
+	(void)tc_prng_guard_init_ctr(&guard, &ctr, test_entropy, 3);
+	entropy_calls = 0;
+
+	for (i = 0; i < 3; i++) {
+		if (tc_prng_guard_maintain(&guard) != TC_CRYPTO_SUCCESS ||
+		    tc_prng_guard_generate(&guard, out, sizeof(out)) != TC_CRYPTO_SUCCESS) {
+			TC_ERROR("generate failed\n");
+			result = TC_FAIL;
+			goto exitTest;
+		}
+	}
+	if (entropy_calls != 0) {
+		TC_ERROR("reseeded before the interval elapsed\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+
+	/* the interval has elapsed: maintenance reseeds, generate does not */
+	if (tc_prng_guard_maintain(&guard) != TC_CRYPTO_SUCCESS ||
+	    entropy_calls != 1 || guard.requests != 0) {
+		TC_ERROR("scheduled reseed did not happen\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+
+	/* close to the generator's limit, maintenance reseeds ahead of it: */
+	ctr.reseedCount = 0x1000000000000ULL - 1;
+	if (tc_prng_guard_maintain(&guard) != TC_CRYPTO_SUCCESS ||
+	    entropy_calls != 2 || ctr.reseedCount != 1) {
+		TC_ERROR("maintenance left no headroom\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+
+	/* without maintenance, a generator at its limit is reseeded on the
+	 * request path: */
+	ctr.reseedCount = 0x1000000000001ULL;
+	if (tc_prng_guard_generate(&guard, out, sizeof(out)) != TC_CRYPTO_SUCCESS ||
+	    entropy_calls != 3) {
+		TC_ERROR("forced reseed did not happen\n");
+		result = TC_FAIL;
+	}
+
+ exitTest:
+	TC_END_RESULT(result);
+	return result;
+}
+
+static unsigned int test_fork(int type)
+{
+	unsigned int result = TC_PASS;
+	struct tc_prng_guard_struct guard;
+	struct tc_hmac_prng_struct hmac;
+	TCCtrPrng_t ctr;
+	uint_least8_t seed[TC_PRNG_GUARD_SEED_SIZE] = {0};
+	uint_least8_t parent_out[32];
+	uint_least8_t child_out[32];
+	int fds[2];
+	int status;
+	pid_t pid;
+
+	TC_PRINT("PRNG guard fork test (%s):\n",
+		 type == TC_PRNG_GUARD_CTR ? "CTR-PRNG" : "HMAC-PRNG");
+
+	if (type == TC_PRNG_GUARD_CTR) {
+		(void)tc_ctr_prng_init(&ctr, seed, sizeof(seed), 0, 0);
+		(void)tc_prng_guard_init_ctr(&guard, &ctr, test_entropy, 0);
+	} else {
+		(void)tc_hmac_prng_init(&hmac, (const uint_least8_t *)"guard", 5);
+		(void)tc_hmac_prng_reseed(&hmac, seed, sizeof(seed), 0, 0);
+		(void)tc_prng_guard_init_hmac(&guard, &hmac, test_entropy, 0);
+	}
+
+	if (pipe(fds) != 0) {
+		TC_ERROR("pipe() failed\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+
+	entropy_calls = 0;
+	pid = fork();
+	if (pid < 0) {
+		TC_ERROR("fork() failed\n");
+		result = TC_FAIL;
+		goto exitTest;
+	}
+
+	if (pid == 0) {
+		/* child: the first request must reseed */
+		int ok = tc_prng_guard_generate(&guard, child_out, sizeof(child_out));
+		ok = ok && entropy_calls == 1;
+		if (write(fds[1], child_out, sizeof(child_out)) != sizeof(child_out)) {
+			ok = 0;
+		}
+		_exit(ok ? 0 : 1);
+	}
+
+	if (tc_prng_guard_generate(&guard, parent_out, sizeof(parent_out)) !=
+	    TC_CRYPTO_SUCCESS || entropy_calls != 0) {
+		TC_ERROR("parent generate failed or reseeded\n");
+		result = TC_FAIL;
+	}
+
+	if (read(fds[0], child_out, sizeof(child_out)) != sizeof(child_out) ||
+	    waitpid(pid, &status, 0) != pid ||
+	    !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+		TC_ERROR("child did not reseed\n");
+		result = TC_FAIL;
+	} else if (memcmp(parent_out, child_out, sizeof(child_out)) == 0) {
+		TC_ERROR("parent and child produced the same output\n");
+		result = TC_FAIL;
+	}
+
+	close(fds[0]);
+	close(fds[1]);
+
+ exitTest:
+	TC_END_RESULT(result);
+	return result;
+}
+
+/*
+ * Main task to test the PRNG guard
+ */
+int main(void)
+{
+	unsigned int result = TC_PASS;
+
+	TC_START("Performing PRNG guard tests:");
+
+	result = test_robustness();
+	if (result == TC_FAIL) {
+		goto exitTest;
+	}
+	result = test_schedule();
+	if (result == TC_FAIL) {
+		goto exitTest;
+	}
+	result = test_fork(TC_PRNG_GUARD_CTR);
+	if (result == TC_FAIL) {
+		goto exitTest;
+	}
+	result = test_fork(TC_PRNG_GUARD_HMAC);
+	if (result == TC_FAIL) {
+		goto exitTest;
+	}
+
+	TC_PRINT("All PRNG guard tests succeeded!\n");
+
+ exitTest:
+	TC_END_RESULT(result);
+	TC_END_REPORT(result);
+}
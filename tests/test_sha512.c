@@ -0,0 +1,333 @@
+/*  test_sha512.c - TinyCrypt implementation of some SHA-512 tests */
+
+/*
+ *  Copyright (C) 2017 by Intel Corporation, All Rights Reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *    - Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *    - Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ *    - Neither the name of Intel Corporation nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software
+ *    without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+  DESCRIPTION
+  This module tests the following SHA512 routines:
+
+  Scenarios tested include:
+  - NIST SHA512 test vectors
+*/
+
+#include <tinycrypt/sha512.h>
+#include <tinycrypt/constants.h>
+#include <test_utils.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/*
+ * SHA512 test #1: abc.
+ */
+unsigned int test_1(void)
+{
+        unsigned int result = TC_PASS;
+
+        TC_PRINT("SHA512 test #1:\n");
+        const uint_least8_t expected[64] = {
+		0xdd, 0xaf, 0x35, 0xa1, 0x93, 0x61, 0x7a, 0xba, 0xcc, 0x41, 0x73, 0x49,
+		0xae, 0x20, 0x41, 0x31, 0x12, 0xe6, 0xfa, 0x4e, 0x89, 0xa9, 0x7e, 0xa2,
+		0x0a, 0x9e, 0xee, 0xe6, 0x4b, 0x55, 0xd3, 0x9a, 0x21, 0x92, 0x99, 0x2a,
+		0x27, 0x4f, 0xc1, 0xa8, 0x36, 0xba, 0x3c, 0x23, 0xa3, 0xfe, 0xeb, 0xbd,
+		0x45, 0x4d, 0x44, 0x23, 0x64, 0x3c, 0xe8, 0x0e, 0x2a, 0x9a, 0xc9, 0x4f,
+		0xa5, 0x4c, 0xa4, 0x9f
+        };
+        const char *m = "abc";
+        uint_least8_t digest[64];
+        struct tc_sha512_state_struct s;
+
+        (void)tc_sha512_init(&s);
+        tc_sha512_update(&s, (const uint_least8_t *) m, strlen(m));
+        (void)tc_sha512_final(digest, &s);
+
+        result = check_result(1, expected, sizeof(expected),
+			      digest, sizeof(digest));
+        TC_END_RESULT(result);
+        return result;
+}
+
+/*
+ * SHA512 test #2: two-block message.
+ */
+unsigned int test_2(void)
+{
+        unsigned int result = TC_PASS;
+
+        TC_PRINT("SHA512 test #2:\n");
+        const uint_least8_t expected[64] = {
+		0x8e, 0x95, 0x9b, 0x75, 0xda, 0xe3, 0x13, 0xda, 0x8c, 0xf4, 0xf7, 0x28,
+		0x14, 0xfc, 0x14, 0x3f, 0x8f, 0x77, 0x79, 0xc6, 0xeb, 0x9f, 0x7f, 0xa1,
+		0x72, 0x99, 0xae, 0xad, 0xb6, 0x88, 0x90, 0x18, 0x50, 0x1d, 0x28, 0x9e,
+		0x49, 0x00, 0xf7, 0xe4, 0x33, 0x1b, 0x99, 0xde, 0xc4, 0xb5, 0x43, 0x3a,
+		0xc7, 0xd3, 0x29, 0xee, 0xb6, 0xdd, 0x26, 0x54, 0x5e, 0x96, 0xe5, 0x5b,
+		0x87, 0x4b, 0xe9, 0x09
+        };
+        const char *m = "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmn"
+		"hijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu";
+        uint_least8_t digest[64];
+        struct tc_sha512_state_struct s;
+
+        (void)tc_sha512_init(&s);
+        tc_sha512_update(&s, (const uint_least8_t *) m, strlen(m));
+        (void)tc_sha512_final(digest, &s);
+
+        result = check_result(2, expected, sizeof(expected),
+			      digest, sizeof(digest));
+        TC_END_RESULT(result);
+        return result;
+}
+
+/*
+ * SHA512 test #3: one byte.
+ */
+unsigned int test_3(void)
+{
+        unsigned int result = TC_PASS;
+
+        TC_PRINT("SHA512 test #3:\n");
+        const uint_least8_t expected[64] = {
+		0x29, 0x6e, 0x22, 0x67, 0xd7, 0x4c, 0x27, 0x8d, 0xaa, 0xaa, 0x94, 0x0d,
+		0x17, 0xb0, 0xcf, 0xb7, 0x4a, 0x50, 0x83, 0xf8, 0xe0, 0x69, 0x72, 0x6d,
+		0x8c, 0x84, 0x1c, 0xbe, 0x59, 0x6e, 0x04, 0x31, 0xcb, 0x77, 0x41, 0xa5,
+		0xb5, 0x0f, 0x71, 0x66, 0x6c, 0xfd, 0x54, 0xba, 0xcb, 0x7b, 0x00, 0xae,
+		0xa8, 0x91, 0x49, 0x9c, 0xf4, 0xef, 0x6a, 0x03, 0xc8, 0xa8, 0x3f, 0xe3,
+		0x7c, 0x3f, 0x7b, 0xaf
+        };
+        const uint_least8_t m[1] = { 0xbd };
+        uint_least8_t digest[64];
+        struct tc_sha512_state_struct s;
+
+        (void)tc_sha512_init(&s);
+        tc_sha512_update(&s, m, sizeof(m));
+        (void)tc_sha512_final(digest, &s);
+
+        result = check_result(3, expected, sizeof(expected),
+			      digest, sizeof(digest));
+        TC_END_RESULT(result);
+        return result;
+}
+
+/*
+ * SHA512 test #4: 111 zero bytes: padding fits.
+ */
+unsigned int test_4(void)
+{
+        unsigned int result = TC_PASS;
+
+        TC_PRINT("SHA512 test #4:\n");
+        const uint_least8_t expected[64] = {
+		0x77, 0xdd, 0xd3, 0xa5, 0x42, 0xe5, 0x30, 0xfd, 0x04, 0x7b, 0x89, 0x77,
+		0xc6, 0x57, 0xba, 0x6c, 0xe7, 0x2f, 0x14, 0x92, 0xe3, 0x60, 0xb2, 0xb2,
+		0x21, 0x2c, 0xd2, 0x64, 0xe7, 0x5e, 0xc0, 0x38, 0x82, 0xe4, 0xff, 0x05,
+		0x25, 0x51, 0x7a, 0xb4, 0x20, 0x7d, 0x14, 0xc7, 0x0c, 0x22, 0x59, 0xba,
+		0x88, 0xd4, 0xd3, 0x35, 0xee, 0x0e, 0x7e, 0x20, 0x54, 0x3d, 0x22, 0x10,
+		0x2a, 0xb1, 0x78, 0x8c
+        };
+        uint_least8_t m[111];
+
+        (void)memset(m, 0x00, sizeof(m));
+        uint_least8_t digest[64];
+        struct tc_sha512_state_struct s;
+
+        (void)tc_sha512_init(&s);
+        tc_sha512_update(&s, m, sizeof(m));
+        (void)tc_sha512_final(digest, &s);
+
+        result = check_result(4, expected, sizeof(expected),
+			      digest, sizeof(digest));
+        TC_END_RESULT(result);
+        return result;
+}
+
+/*
+ * SHA512 test #5: 112 zero bytes: padding needs a second block.
+ */
+unsigned int test_5(void)
+{
+        unsigned int result = TC_PASS;
+
+        TC_PRINT("SHA512 test #5:\n");
+        const uint_least8_t expected[64] = {
+		0x2b, 0xe2, 0xe7, 0x88, 0xc8, 0xa8, 0xad, 0xea, 0xa9, 0xc8, 0x9a, 0x7f,
+		0x78, 0x90, 0x4c, 0xac, 0xea, 0x6e, 0x39, 0x29, 0x7d, 0x75, 0xe0, 0x57,
+		0x3a, 0x73, 0xc7, 0x56, 0x23, 0x45, 0x34, 0xd6, 0x62, 0x7a, 0xb4, 0x15,
+		0x6b, 0x48, 0xa6, 0x65, 0x7b, 0x29, 0xab, 0x8b, 0xeb, 0x73, 0x33, 0x40,
+		0x40, 0xad, 0x39, 0xea, 0xd8, 0x14, 0x46, 0xbb, 0x09, 0xc7, 0x07, 0x04,
+		0xec, 0x70, 0x79, 0x52
+        };
+        uint_least8_t m[112];
+
+        (void)memset(m, 0x00, sizeof(m));
+        uint_least8_t digest[64];
+        struct tc_sha512_state_struct s;
+
+        (void)tc_sha512_init(&s);
+        tc_sha512_update(&s, m, sizeof(m));
+        (void)tc_sha512_final(digest, &s);
+
+        result = check_result(5, expected, sizeof(expected),
+			      digest, sizeof(digest));
+        TC_END_RESULT(result);
+        return result;
+}
+
+/*
+ * SHA512 test #6: 1000 bytes 0x41.
+ */
+unsigned int test_6(void)
+{
+        unsigned int result = TC_PASS;
+
+        TC_PRINT("SHA512 test #6:\n");
+        const uint_least8_t expected[64] = {
+		0x32, 0x9c, 0x52, 0xac, 0x62, 0xd1, 0xfe, 0x73, 0x11, 0x51, 0xf2, 0xb8,
+		0x95, 0xa0, 0x04, 0x75, 0x44, 0x5e, 0xf7, 0x4f, 0x50, 0xb9, 0x79, 0xc6,
+		0xf7, 0xbb, 0x7c, 0xae, 0x34, 0x93, 0x28, 0xc1, 0xd4, 0xcb, 0x4f, 0x72,
+		0x61, 0xa0, 0xab, 0x43, 0xf9, 0x36, 0xa2, 0x4b, 0x00, 0x06, 0x51, 0xd4,
+		0xa8, 0x24, 0xfc, 0xdd, 0x57, 0x7f, 0x21, 0x1a, 0xef, 0x8f, 0x80, 0x6b,
+		0x16, 0xaf, 0xe8, 0xaf
+        };
+        uint_least8_t m[1000];
+
+        (void)memset(m, 0x41, sizeof(m));
+        uint_least8_t digest[64];
+        struct tc_sha512_state_struct s;
+
+        (void)tc_sha512_init(&s);
+        tc_sha512_update(&s, m, sizeof(m));
+        (void)tc_sha512_final(digest, &s);
+
+        result = check_result(6, expected, sizeof(expected),
+			      digest, sizeof(digest));
+        TC_END_RESULT(result);
+        return result;
+}
+
+/*
+ * SHA512 test #7: 1,000,000 bytes 'a', hashed in uneven segments.
+ */
+unsigned int test_7(void)
+{
+        unsigned int result = TC_PASS;
+
+        TC_PRINT("SHA512 test #7:\n");
+        const uint_least8_t expected[64] = {
+		0xe7, 0x18, 0x48, 0x3d, 0x0c, 0xe7, 0x69, 0x64, 0x4e, 0x2e, 0x42, 0xc7,
+		0xbc, 0x15, 0xb4, 0x63, 0x8e, 0x1f, 0x98, 0xb1, 0x3b, 0x20, 0x44, 0x28,
+		0x56, 0x32, 0xa8, 0x03, 0xaf, 0xa9, 0x73, 0xeb, 0xde, 0x0f, 0xf2, 0x44,
+		0x87, 0x7e, 0xa6, 0x0a, 0x4c, 0xb0, 0x43, 0x2c, 0xe5, 0x77, 0xc3, 0x1b,
+		0xeb, 0x00, 0x9c, 0x5c, 0x2c, 0x49, 0xaa, 0x2e, 0x4e, 0xad, 0xb2, 0x17,
+		0xad, 0x8c, 0xc0, 0x9b
+        };
+        uint_least8_t m[997];
+        uint_least8_t digest[64];
+        struct tc_sha512_state_struct s;
+        size_t left = 1000000;
+        size_t len;
+
+        (void)memset(m, 0x61, sizeof(m));
+
+        (void)tc_sha512_init(&s);
+        while (left > 0) {
+                len = left < sizeof(m) ? left : sizeof(m);
+                tc_sha512_update(&s, m, len);
+                left -= len;
+        }
+        (void)tc_sha512_final(digest, &s);
+
+        result = check_result(7, expected, sizeof(expected),
+			      digest, sizeof(digest));
+        TC_END_RESULT(result);
+        return result;
+}
+
+/*
+ * Main task to test SHA512
+ */
+
+int main(void)
+{
+        unsigned int result = TC_PASS;
+
+        TC_START("Performing SHA512 tests (NIST tests vectors):");
+
+        result = test_1();
+        if (result == TC_FAIL) {
+		/* terminate test */
+                TC_ERROR("SHA512 test #1 failed.\n");
+                goto exitTest;
+        }
+        result = test_2();
+        if (result == TC_FAIL) {
+		/* terminate test */
+                TC_ERROR("SHA512 test #2 failed.\n");
+                goto exitTest;
+        }
+        result = test_3();
+        if (result == TC_FAIL) {
+		/* terminate test */
+                TC_ERROR("SHA512 test #3 failed.\n");
+                goto exitTest;
+        }
+        result = test_4();
+        if (result == TC_FAIL) {
+		/* terminate test */
+                TC_ERROR("SHA512 test #4 failed.\n");
+                goto exitTest;
+        }
+        result = test_5();
+        if (result == TC_FAIL) {
+		/* terminate test */
+                TC_ERROR("SHA512 test #5 failed.\n");
+                goto exitTest;
+        }
+        result = test_6();
+        if (result == TC_FAIL) {
+		/* terminate test */
+                TC_ERROR("SHA512 test #6 failed.\n");
+                goto exitTest;
+        }
+        result = test_7();
+        if (result == TC_FAIL) {
+		/* terminate test */
+                TC_ERROR("SHA512 test #7 failed.\n");
+                goto exitTest;
+        }
+
+        TC_PRINT("All SHA512 tests succeeded!\n");
+
+exitTest:
+        TC_END_RESULT(result);
+        TC_END_REPORT(result);
+}